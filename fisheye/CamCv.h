@@ -75,6 +75,7 @@ class CamCv
 
       // フレームがキャプチャされたことを記録する
       buffer = frame.data;
+      ready.store(true, std::memory_order_release);
 
       // カメラが使える
       return true;
@@ -87,6 +88,12 @@ class CamCv
   // フレームをキャプチャする
   virtual void capture()
   {
+    // トレース上のスレッド名を設定する
+    ggTraceThread("capture");
+
+    // ロックを解除した後にイベント待ちのメインスレッドを起こすなら true
+    bool wake(false);
+
     // あらかじめキャプチャデバイスをロックして
     mtx.lock();
 
@@ -96,6 +103,9 @@ class CamCv
       // バッファが空のとき経過時間が現在のフレームの時刻に達していて
       if (!buffer && glfwGetTime() >= frameTime)
       {
+        // フレームの取得と復号の区間を記録する
+        ggTrace("capture");
+
         // 次のフレームが存在すれば
         if (camera.grab())
         {
@@ -107,6 +117,10 @@ class CamCv
 
           // フレームを更新し
           buffer = frame.data;
+          ready.store(true, std::memory_order_release);
+
+          // ロックを解除したらイベント待ちのメインスレッドを起こす
+          wake = true;
 
           // 次のフレームに進む
           continue;
@@ -129,11 +143,23 @@ class CamCv
       // フレームが切り出せなければロックを解除して
       mtx.unlock();
 
+      // 新しいフレームがあればイベント待ちのメインスレッドを起こして
+      //   ロックを解除してから起こすので, 起きたメインスレッドはすぐに転送できる
+      if (wake)
+      {
+        glfwPostEmptyEvent();
+        wake = false;
+      }
+
       // 他のスレッドがリソースにアクセスするために少し待ってから
       std::this_thread::sleep_for(std::chrono::milliseconds(10L));
 
       // またキャプチャデバイスをロックする
-      mtx.lock();
+      {
+        // ロック待ちの区間を記録する
+        ggTrace("lock");
+        mtx.lock();
+      }
     }
 
     // 終わるときはロックを解除する
@@ -11,6 +11,7 @@ using namespace gg;
 // キャプチャを非同期で行う
 #include <thread>
 #include <mutex>
+#include <atomic>
 
 //
 // カメラ関連の処理を担当するクラス
@@ -28,6 +29,9 @@ protected:
   // キャプチャした画像
   GLubyte *buffer;
 
+  // 転送していない新しい画像があれば true (ロックせずに調べる)
+  std::atomic<bool> ready;
+
   // キャプチャした画像の幅と高さ
   GLsizei width, height;
 
@@ -53,6 +57,7 @@ public:
   {
     // 画像がまだ取得されていないことを記録しておく
     buffer = nullptr;
+    ready = false;
 
     // スレッドが停止状態であることを記録しておく
     run = false;
@@ -117,9 +122,23 @@ public:
   // Ovrvision Pro の利得を下げる
   virtual void decreaseGain() {};
 
+  // 転送していない新しい画像があれば true を返す
+  //   キャプチャスレッドがカメラをロックしていても見落とさないようにロックせずに調べる
+  bool pending() const
+  {
+    return ready.load(std::memory_order_acquire);
+  }
+
   // カメラをロックして画像をテクスチャに転送する
-  void transmit()
+  //   新しい画像を転送したら true を返す
+  bool transmit()
   {
+    // 転送の区間を記録する
+    ggTrace("transmit");
+
+    // 新しい画像を転送したかどうか
+    bool transmitted(false);
+
     // カメラのロックを試みる
     if (mtx.try_lock())
     {
@@ -131,10 +150,14 @@ public:
 
         // データの転送完了を記録する
         buffer = nullptr;
+        ready.store(false, std::memory_order_release);
+        transmitted = true;
       }
 
       // 左カメラのロックを解除する
       mtx.unlock();
     }
+
+    return transmitted;
   }
 };
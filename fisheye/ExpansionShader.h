@@ -4,6 +4,22 @@
 // 平面展開に使うシェーダ
 //
 
+// 補助プログラム
+#include "gg.h"
+using namespace gg;
+
+// 標準ライブラリ
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <algorithm>
+#include <string>
+#include <sstream>
+#include <cstring>
+
 // シェーダのセットとパラメータ
 struct ExpansionShader
 {
@@ -50,3 +66,347 @@ constexpr ExpansionShader shader_type[] =
   // 8: RICHO THETA の HDMI ライブストリーミング映像 : (手動調整で決めた値)
   { "theta.vert",     "theta.frag",    1920,  1080, 1.003f, 1.003f, 0.0f, -0.002f }
 };
+
+// シェーダの種類の数
+constexpr int shader_count(sizeof shader_type / sizeof shader_type[0]);
+
+// 平面展開のパラメータの uniform block の結合ポイント (光源と材質の次)
+constexpr GLuint ExpansionBindingPoint(MaterialBindingPoint + 1);
+
+// 平面展開のパラメータ (シェーダの std140 の uniform block Expansion と同じ並び)
+struct Expansion
+{
+  // スクリーンを回転する変換行列
+  GLfloat rotation[16];
+
+  // スクリーンの大きさと中心位置
+  GLfloat screen[4];
+
+  // 背景テクスチャの半径と中心位置
+  GLfloat circle[4];
+
+  // スクリーンの格子間隔
+  GLfloat gap[2];
+
+  // スクリーンまでの焦点距離
+  GLfloat focal;
+
+  // std140 でのブロックの大きさに合わせる
+  GLfloat padding;
+};
+
+//
+// 平面展開のパラメータのユニフォームバッファオブジェクト
+//
+//   視点ごとのパラメータを GgStreamBuffer のフレームごとの領域に格納するので,
+//   GPU がまだ前のフレームを参照していてもパイプラインを停止させない.
+//
+class ExpansionBuffer
+  : public GgStreamBuffer<Expansion>
+{
+public:
+
+  // コンストラクタ
+  ExpansionBuffer(GLsizei views = 1, GLsizei frames = 3)
+    : GgStreamBuffer<Expansion>(GL_UNIFORM_BUFFER, nullptr, sizeof (Expansion), views, frames)
+  {
+  }
+
+  // デストラクタ
+  virtual ~ExpansionBuffer() {}
+
+  // 視点の数を得る
+  GLsizei getViews() const
+  {
+    return getCount();
+  }
+
+  // 次のフレームに切り替えて全視点のパラメータを一度に転送する
+  //   expansion 視点ごとのパラメータの配列
+  //   count 転送する視点の数 (0 なら全視点)
+  void update(const Expansion *expansion, GLsizei count = 0)
+  {
+    next();
+    send(expansion, 0, count);
+  }
+
+  // 現在のフレームの視点のパラメータを選択する
+  //   view 視点の番号
+  void select(GLint view = 0) const
+  {
+    GgStreamBuffer<Expansion>::select(ExpansionBindingPoint, view);
+  }
+};
+
+// プログラムオブジェクトの平面展開のパラメータの uniform block を結合ポイントに結び付ける
+//   program 平面展開に使うプログラムオブジェクト
+inline void bindExpansion(GLuint program)
+{
+  const GLuint index(glGetUniformBlockIndex(program, "Expansion"));
+  if (index != GL_INVALID_INDEX) glUniformBlockBinding(program, index, ExpansionBindingPoint);
+}
+
+//
+// 全ての種類の平面展開のシェーダのプログラムオブジェクト
+//
+//   最初に使うものは直ちに作成し, 残りはコンテキストを共有する不可視のウィンドウを使って
+//   別スレッドで作成するので, 実行中に展開の手法を切り替えても描画が止まらない.
+//   実際にキャプチャしている画像の縦横比を埋め込んだものも同じスレッドで作り直す.
+//
+class ExpansionPrograms
+{
+  // シェーダの種類ごとのプログラムオブジェクト (作成前は 0)
+  std::atomic<GLuint> program[shader_count];
+
+  // シェーダの種類ごとに program[] の作成に使った #define
+  std::string defines[shader_count];
+
+  // シェーダの種類ごとに作成を依頼している #define (依頼していなければ空)
+  std::string queued[shader_count];
+
+  // 作り直して使わなくなったプログラムオブジェクト
+  std::vector<GLuint> retired;
+
+  // 作成を依頼しているシェーダの種類と #define
+  std::deque<std::pair<int, std::string>> queue;
+
+  // defines[], queued[], retired, queue の排他制御
+  std::mutex mtx;
+
+  // 作成の依頼の通知
+  std::condition_variable cond;
+
+  // 別スレッドを続けるなら true
+  bool run;
+
+  // プログラムオブジェクトを作成するスレッドが使うコンテキスト
+  GLFWwindow *context;
+
+  // プログラムオブジェクトを作成するスレッド
+  std::thread worker;
+
+  // 背景テクスチャの縦横比を定数としてシェーダに埋め込む #define を作る
+  //   width, height 背景テクスチャの幅と高さ
+  static std::string aspect(GLsizei width, GLsizei height)
+  {
+    std::ostringstream str;
+    str.precision(9);
+    str << "#define IMAGE_ASPECT "
+      << std::showpoint << static_cast<float>(height) / static_cast<float>(width);
+    return str.str();
+  }
+
+  // 同じソースファイルと #define を使う作成済みのプログラムオブジェクトを探す
+  //   i シェーダの種類
+  //   define 埋め込む #define
+  //   mtx をロックして呼び出す
+  GLuint find(int i, const std::string &define) const
+  {
+    for (int j = 0; j < shader_count; ++j)
+    {
+      const GLuint p(program[j].load());
+      if (p != 0 && strcmp(shader_type[i].vsrc, shader_type[j].vsrc) == 0
+        && strcmp(shader_type[i].fsrc, shader_type[j].fsrc) == 0 && defines[j] == define)
+        return p;
+    }
+    return 0;
+  }
+
+  // i 番目の種類のプログラムオブジェクトを作成して program[] を置き換える
+  //   define 埋め込む #define
+  //   作成できなければ元のものを使い続ける
+  void load(int i, const std::string &define)
+  {
+    // 同じソースファイルと #define を使う種類のプログラムオブジェクトがあればそれを共用する
+    std::unique_lock<std::mutex> lock(mtx);
+    GLuint p(find(i, define));
+
+    if (p == 0)
+    {
+      // コンパイルしている間は他のスレッドを止めない
+      lock.unlock();
+
+      // プログラムオブジェクトを作成して平面展開のパラメータの uniform block を結び付ける
+      p = ggLoadShader(shader_type[i].vsrc, shader_type[i].fsrc, nullptr, 0, nullptr, define.c_str());
+      if (p != 0)
+      {
+        bindExpansion(p);
+
+        // 他のコンテキストから使う前に作成を完了させておく
+        glFinish();
+      }
+
+      lock.lock();
+    }
+
+    // 作成を依頼していた #define ならその依頼は済んだ
+    if (queued[i] == define) queued[i].clear();
+    if (p == 0) return;
+
+    // 置き換えたものは描画するスレッドで削除する
+    const GLuint previous(program[i].exchange(p));
+    if (previous != 0 && previous != p) retired.push_back(previous);
+    defines[i] = define;
+  }
+
+  // 作り直して使わなくなったプログラムオブジェクトのうち他の種類と共有していないものを削除する
+  //   描画するスレッドで mtx をロックして呼び出す
+  void purge()
+  {
+    std::sort(retired.begin(), retired.end());
+    retired.erase(std::unique(retired.begin(), retired.end()), retired.end());
+    for (const GLuint r : retired)
+    {
+      bool shared(false);
+      for (int j = 0; j < shader_count; ++j) if (program[j].load() == r) shared = true;
+      if (!shared) glDeleteProgram(r);
+    }
+    retired.clear();
+  }
+
+public:
+
+  // コンストラクタ
+  //   share プログラムオブジェクトを共有するウィンドウ
+  //   initial 直ちに作成するシェーダの種類
+  //   width, height 実際にキャプチャしている画像の幅と高さ
+  ExpansionPrograms(GLFWwindow *share, int initial, GLsizei width, GLsizei height)
+    : run(true)
+    , context(nullptr)
+  {
+    // プログラムオブジェクトはまだ作成していない
+    for (int i = 0; i < shader_count; ++i) program[i].store(0);
+
+    // 最初に使うプログラムオブジェクトは実際の縦横比を埋め込んで直ちに作成する
+    load(initial, aspect(width, height));
+
+    // 残りはカメラの解像度から求めた縦横比を定数として埋め込んで作成する
+    //   実際の解像度が異なれば get() で作り直しを依頼する
+    for (int i = 0; i < shader_count; ++i)
+      if (i != initial) queue.emplace_back(i, aspect(shader_type[i].width, shader_type[i].height));
+
+    // コンテキストを共有する不可視のウィンドウを作成する
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    context = glfwCreateWindow(1, 1, "", nullptr, share);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+
+    // 作成できなければ残りは使うときに作成する
+    if (!context) return;
+
+    // 別スレッドから API を呼び出す前に API のアドレスをすべて取得しておく
+    ggResolveProcs();
+
+    // 残りのプログラムオブジェクトを別スレッドで作成する
+    worker = std::thread([this]()
+    {
+      // トレース上のスレッド名を設定する
+      ggTraceThread("shader");
+
+      // 共有コンテキストを処理対象にする
+      glfwMakeContextCurrent(context);
+
+#if !defined(__APPLE__)
+      // ドライバが対応していればシェーダを並列にコンパイルさせる
+      if (glfwExtensionSupported("GL_ARB_parallel_shader_compile") && ggHasProc("glMaxShaderCompilerThreadsARB"))
+        glMaxShaderCompilerThreadsARB(0xffffffffu);
+#endif
+
+      // 依頼されたプログラムオブジェクトを順に作成する
+      std::unique_lock<std::mutex> lock(mtx);
+      for (;;)
+      {
+        cond.wait(lock, [this]() { return !run || !queue.empty(); });
+        if (!run) break;
+
+        const std::pair<int, std::string> job(queue.front());
+        queue.pop_front();
+
+        lock.unlock();
+        load(job.first, job.second);
+        lock.lock();
+      }
+      lock.unlock();
+
+      // 共有コンテキストを解放する
+      glfwMakeContextCurrent(nullptr);
+    });
+  }
+
+  // デストラクタ
+  virtual ~ExpansionPrograms()
+  {
+    // 別スレッドを止める
+    mtx.lock();
+    run = false;
+    mtx.unlock();
+    cond.notify_one();
+    if (worker.joinable()) worker.join();
+
+    // 置き換えたものと共有しているものは一度だけ削除する
+    purge();
+    for (int i = 0; i < shader_count; ++i)
+    {
+      const GLuint p(program[i].load());
+      if (p == 0) continue;
+      bool shared(false);
+      for (int j = 0; j < i; ++j) if (program[j].load() == p) shared = true;
+      if (!shared) glDeleteProgram(p);
+    }
+
+    // 共有コンテキストのウィンドウを破棄する
+    if (context) glfwDestroyWindow(context);
+  }
+
+  // コピーコンストラクタを封じる
+  ExpansionPrograms(const ExpansionPrograms &o) = delete;
+
+  // 代入演算子を封じる
+  ExpansionPrograms &operator=(const ExpansionPrograms &o) = delete;
+
+  // i 番目の種類のプログラムオブジェクトを得る
+  //   まだ作成されていなければ 0 を返す
+  GLuint get(int i)
+  {
+    // 共有コンテキストが使えなければここで作成する
+    if (!context && program[i].load() == 0)
+      load(i, aspect(shader_type[i].width, shader_type[i].height));
+
+    return program[i].load();
+  }
+
+  // 実際にキャプチャしている画像の縦横比を埋め込んだ i 番目の種類のプログラムオブジェクトを得る
+  //   width, height 実際にキャプチャしている画像の幅と高さ
+  //   まだ作成されていなければ別スレッドに作成を依頼して 0 を返すので, 毎フレーム呼び出して待たずに調べる
+  GLuint get(int i, GLsizei width, GLsizei height)
+  {
+    const std::string define(aspect(width, height));
+
+    std::unique_lock<std::mutex> lock(mtx);
+
+    // 置き換えたものを削除する
+    if (!retired.empty()) purge();
+
+    // 埋め込んだ縦横比が同じならそれを使う
+    if (defines[i] == define) return program[i].load();
+
+    // 共有コンテキストが使えなければここで作り直す
+    if (!context)
+    {
+      lock.unlock();
+      load(i, define);
+      lock.lock();
+      purge();
+      return defines[i] == define ? program[i].load() : 0;
+    }
+
+    // まだ依頼していなければ別スレッドに作り直しを依頼する
+    if (queued[i] != define)
+    {
+      queued[i] = define;
+      queue.emplace_back(i, define);
+      cond.notify_one();
+    }
+
+    return 0;
+  }
+};
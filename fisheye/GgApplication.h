@@ -105,6 +105,11 @@ struct GgApplication
     // Core Profile を選択する
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+#if GG_USE_DEBUG_OUTPUT && GG_DEBUG_SYNCHRONOUS
+    // 全てのメッセージを同期して受け取るためにデバッグコンテキストを要求する
+    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
+#endif
   }
 
   // デストラクタ
@@ -146,6 +151,12 @@ struct GgApplication
     // トラックボール
     GgTrackball trackball[2];
 
+    // 再描画が必要なら true
+    bool dirty;
+
+    // イベントを待つ最長時間 (0 以下ならイベントを待たない)
+    double waitTimeout;
+
 #if USE_OCULUS_RIFT
     //
     // Oculus Rift
@@ -233,6 +244,9 @@ struct GgApplication
         glViewport(0, 0, width, height);
 #endif
 
+        // 再描画が必要になる
+        instance->dirty = true;
+
         // ユーザー定義のコールバック関数の呼び出し
         if (instance->resizeFunc) (*instance->resizeFunc)(instance, width, height);
       }
@@ -248,6 +262,9 @@ struct GgApplication
 
       if (instance && action)
       {
+        // 再描画が必要になる
+        instance->dirty = true;
+
         switch (key)
         {
         case GLFW_KEY_R:
@@ -341,6 +358,9 @@ struct GgApplication
         const GLfloat x(instance->mouse_position[0]);
         const GLfloat y(instance->mouse_position[1]);
 
+        // 再描画が必要になる
+        instance->dirty = true;
+
         switch (button)
         {
         case GLFW_MOUSE_BUTTON_1:
@@ -404,11 +424,26 @@ struct GgApplication
         // マウスによる平行移動量の z 値の更新
         instance->translation[0][1][2] = instance->translation[1][1][2] = instance->getWheelY() * 0.05f;
 
+        // 再描画が必要になる
+        instance->dirty = true;
+
         // ユーザー定義のコールバック関数の呼び出し
         if (instance->wheelFunc) (*instance->wheelFunc)(instance, x, y);
       }
     }
 
+    //
+    // ウィンドウの内容が失われた時の処理
+    //
+    static void refresh(GLFWwindow *window)
+    {
+      // このインスタンスの this ポインタを得る
+      Window *const instance(static_cast<Window *>(glfwGetWindowUserPointer(window)));
+
+      // 再描画が必要になる
+      if (instance) instance->dirty = true;
+    }
+
   public:
 
     //
@@ -416,7 +451,7 @@ struct GgApplication
     //
     Window(const char *title = "GLFW Window", int width = 640, int height = 480,
       int fullscreen = 0, GLFWwindow *share = nullptr)
-      : window(nullptr), size{ width, height }
+      : window(nullptr), size{ width, height }, dirty(true), waitTimeout(0.0)
       , userPointer(nullptr), resizeFunc(nullptr), keyboardFunc(nullptr), mouseFunc(nullptr), wheelFunc(nullptr)
     {
 #if USE_OCULUS_RIFT
@@ -501,6 +536,11 @@ struct GgApplication
       // ゲームグラフィックス特論の都合による初期化を行う
       ggInit();
 
+#if GG_USE_DEBUG_OUTPUT
+      // OpenGL のエラーは毎フレーム glGetError() で調べずにデバッグ出力で受け取る
+      ggEnableDebugOutput(GG_DEBUG_SYNCHRONOUS != 0);
+#endif
+
       // このインスタンスの this ポインタを記録しておく
       glfwSetWindowUserPointer(window, this);
 
@@ -516,8 +556,12 @@ struct GgApplication
       // ウィンドウのサイズ変更時に呼び出す処理を登録する
       glfwSetFramebufferSizeCallback(window, resize);
 
+      // ウィンドウの内容が失われた時に呼び出す処理を登録する
+      glfwSetWindowRefreshCallback(window, refresh);
+
       // 矢印キー・マウス・ジョイスティック操作の初期値を設定する
       for (auto a : arrow) a[0] = a[1] = 0;
+      mouse_position[0] = mouse_position[1] = 0.0f;
       wheel_rotation[0] = wheel_rotation[1] = 0.0f;
 
       // 平行移動量の初期値を設定する
@@ -613,7 +657,7 @@ struct GgApplication
               // テクスチャのパラメータを設定する
               GLuint texId;
               ovr_GetTextureSwapChainBufferGL(session, layerData.ColorTexture[eye], i, &texId);
-              glBindTexture(GL_TEXTURE_2D, texId);
+              ggBindTexture(GL_TEXTURE_2D, texId);
               glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
               glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
               glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
@@ -623,7 +667,7 @@ struct GgApplication
 
           // Oculus Rift 表示用の FBO のデプスバッファとして使うテクスチャを作成する
           glGenTextures(1, &oculusDepth[eye]);
-          glBindTexture(GL_TEXTURE_2D, oculusDepth[eye]);
+          ggBindTexture(GL_TEXTURE_2D, oculusDepth[eye]);
           glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT32F, textureSize.w, textureSize.h, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
           glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
           glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -701,7 +745,7 @@ struct GgApplication
       glGenFramebuffers(ovrEye_Count, oculusFbo);
 
       // Oculus Rift にレンダリングするときは sRGB カラースペースを使う
-      glEnable(GL_FRAMEBUFFER_SRGB);
+      ggEnable(GL_FRAMEBUFFER_SRGB);
 
       // Oculus Rift への表示では垂直同期タイミングに合わせない
       glfwSwapInterval(0);
@@ -740,7 +784,7 @@ struct GgApplication
 #  if OVR_PRODUCT_VERSION > 0
         ovr_DestroyMirrorTexture(session, mirrorTexture);
 #  else
-        glDeleteTextures(1, &mirrorTexture->OGL.TexId);
+        ggDeleteTextures(1, &mirrorTexture->OGL.TexId);
         ovr_DestroyMirrorTexture(session, reinterpret_cast<ovrTexture *>(mirrorTexture));
 #  endif
       }
@@ -760,7 +804,7 @@ struct GgApplication
         }
 
         // デプスバッファとして使ったテクスチャを開放する
-        glDeleteTextures(1, &oculusDepth[eye]);
+        ggDeleteTextures(1, &oculusDepth[eye]);
         oculusDepth[eye] = 0;
 
 #  else
@@ -770,7 +814,7 @@ struct GgApplication
         for (int i = 0; i < colorTexture->TextureCount; ++i)
         {
           const auto *const ctex(reinterpret_cast<ovrGLTexture *>(&colorTexture->Textures[i]));
-          glDeleteTextures(1, &ctex->OGL.TexId);
+          ggDeleteTextures(1, &ctex->OGL.TexId);
         }
         ovr_DestroySwapTextureSet(session, colorTexture);
 
@@ -779,7 +823,7 @@ struct GgApplication
         for (int i = 0; i < depthTexture->TextureCount; ++i)
         {
           const auto *const dtex(reinterpret_cast<ovrGLTexture *>(&depthTexture->Textures[i]));
-          glDeleteTextures(1, &dtex->OGL.TexId);
+          ggDeleteTextures(1, &dtex->OGL.TexId);
         }
         ovr_DestroySwapTextureSet(session, depthTexture);
 #  endif
@@ -1038,6 +1082,14 @@ struct GgApplication
       return window;
     }
 
+    //
+    // ウィンドウのタイトルを設定する
+    //
+    void setTitle(const char *title) const
+    {
+      glfwSetWindowTitle(window, title);
+    }
+
     //
     // ウィンドウを閉じるよう指示する
     //
@@ -1060,8 +1112,17 @@ struct GgApplication
     //
     operator bool()
     {
-      // イベントを取り出す
-      glfwPollEvents();
+      // 再描画の必要がなくイベントを待つなら
+      if (!dirty && waitTimeout > 0.0)
+      {
+        // イベントが発生するか時間切れになるまで待つ
+        glfwWaitEventsTimeout(waitTimeout);
+      }
+      else
+      {
+        // イベントを取り出す
+        glfwPollEvents();
+      }
 
       // ウィンドウを閉じるべきなら false を返す
       if (shouldClose()) return false;
@@ -1069,9 +1130,14 @@ struct GgApplication
       // マウスの位置を調べる
       double x, y;
       glfwGetCursorPos(window, &x, &y);
+      const bool moved(mouse_position[0] != static_cast<GLfloat>(x) || mouse_position[1] != static_cast<GLfloat>(y));
       mouse_position[0] = static_cast<GLfloat>(x);
       mouse_position[1] = static_cast<GLfloat>(y);
 
+      // ドラッグ中にマウスが動いたら再描画が必要になる
+      if (moved && (glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_1) || glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_2)))
+        dirty = true;
+
       // 左ボタンドラッグ
       if (glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_1))
       {
@@ -1094,11 +1160,44 @@ struct GgApplication
     //
     void swapBuffers()
     {
+      // カラーバッファの入れ替えの区間を記録する
+      ggTrace("swapBuffers");
+
       // エラーチェック
       ggError();
 
       // カラーバッファを入れ替える
       glfwSwapBuffers(window);
+
+      // 再描画が完了した
+      dirty = false;
+    }
+
+    //
+    // 再描画を要求する
+    //
+    void postRedisplay()
+    {
+      dirty = true;
+    }
+
+    //
+    // 再描画が必要かどうかを判定する
+    //
+    bool shouldRedisplay() const
+    {
+      // イベントを待たないときは常に再描画する
+      return dirty || waitTimeout <= 0.0;
+    }
+
+    //
+    // 再描画の必要がないときにイベントを待つ最長時間を設定する
+    //
+    //   timeout 秒単位の待ち時間 (0 以下ならイベントを待たずに毎回描画する)
+    //
+    void setWaitTimeout(double timeout)
+    {
+      waitTimeout = timeout;
     }
 
     //
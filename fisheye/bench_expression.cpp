@@ -0,0 +1,117 @@
+﻿//
+// 変換行列の式テンプレートのベンチマーク
+//
+//   make bench で SIMD 命令を使う bench_expression と使わない bench_expression_scalar を作る.
+//   多数の図形を描く場面を想定し, 図形ごとにモデルビュー変換行列と法線変換行列を求める時間を,
+//   GgMatrix の積で一時的な変換行列を作る場合と ggExpression() の式で求める場合とで比べる.
+//
+
+// 補助プログラム
+#include "gg.h"
+using namespace gg;
+
+// 標準ライブラリ
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+
+// 1 フレームに描く図形の数
+constexpr std::size_t objects(5000);
+
+// 計測するフレーム数
+constexpr int frames(400);
+
+// 疑似乱数 [-1, 1)
+static GLfloat uniform()
+{
+  static std::uint32_t seed(12345u);
+  seed = seed * 1664525u + 1013904223u;
+  return static_cast<GLfloat>(seed >> 8) / 8388608.0f - 1.0f;
+}
+
+// 結果の検査値 (最適化で計算が省かれないようにする)
+static GLfloat sink(0.0f);
+
+// 1 フレーム分の処理 f を繰り返して図形一つあたりの時間 (ナノ秒) を表示する
+template <typename F>
+static void measure(const char *name, F f)
+{
+  // 一度実行してキャッシュを温めておく
+  f();
+
+  const auto start(std::chrono::steady_clock::now());
+  for (int i = 0; i < frames; ++i) f();
+  const double ns(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+
+  std::cout << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(3)
+    << std::setw(10) << ns / (static_cast<double>(frames) * objects) << " ns/object" << std::endl;
+}
+
+int main()
+{
+  std::cout << "simd: " << ggSimd() << ", objects: " << objects << ", frames: " << frames << std::endl;
+
+  // 視野変換行列とトラックボールの回転
+  const GgMatrix view(ggLookat(0.0f, 0.0f, 3.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f));
+  const GgMatrix trackball(ggRotate(0.3f, 0.5f, 0.7f, 0.8f));
+
+  // 図形ごとのモデル変換行列
+  std::vector<GgMatrix> model(objects);
+  for (auto &m : model)
+    m = ggTranslate(uniform(), uniform(), uniform()) * ggRotate(uniform(), uniform(), uniform(), uniform() * 3.0f)
+      * ggScale(1.0f + uniform() * 0.5f, 1.0f + uniform() * 0.5f, 1.0f + uniform() * 0.5f);
+
+  // 図形ごとのモデルビュー変換行列と法線変換行列
+  std::vector<GgMatrix> mv(objects), mn(objects);
+
+  // GgSimpleShader::use(mp, mv) と同じく積を求めてから法線変換行列を求める
+  measure("mv = view * model, mn = mv.normal()", [&]()
+  {
+    for (std::size_t i = 0; i < objects; ++i)
+    {
+      mv[i] = view * model[i];
+      mn[i] = mv[i].normal();
+    }
+  });
+  sink += mv[0].get()[0] + mn[0].get()[0];
+
+  measure("expression evaluate(mv, &mn)", [&]()
+  {
+    for (std::size_t i = 0; i < objects; ++i) (ggExpression(view) * model[i]).evaluate(mv[i], &mn[i]);
+  });
+  sink += mv[0].get()[0] + mn[0].get()[0];
+
+  // 三つの変換行列の積
+  measure("mv = view * trackball * model", [&]()
+  {
+    for (std::size_t i = 0; i < objects; ++i)
+    {
+      mv[i] = view * trackball * model[i];
+      mn[i] = mv[i].normal();
+    }
+  });
+  sink += mv[0].get()[0] + mn[0].get()[0];
+
+  measure("expression view * trackball * model", [&]()
+  {
+    for (std::size_t i = 0; i < objects; ++i) (ggExpression(view) * trackball * model[i]).evaluate(mv[i], &mn[i]);
+  });
+  sink += mv[0].get()[0] + mn[0].get()[0];
+
+  // 法線変換行列だけを求める
+  measure("mn = (view * model).normal()", [&]()
+  {
+    for (std::size_t i = 0; i < objects; ++i) mn[i] = (view * model[i]).normal();
+  });
+  sink += mn[0].get()[0];
+
+  measure("expression evaluateNormal(mn)", [&]()
+  {
+    for (std::size_t i = 0; i < objects; ++i) (ggExpression(view) * model[i]).evaluateNormal(mn[i]);
+  });
+  sink += mn[0].get()[0];
+
+  std::cout << "sink: " << sink << std::endl;
+}
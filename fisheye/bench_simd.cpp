@@ -0,0 +1,121 @@
+﻿//
+// 変換行列と四元数の演算のマイクロベンチマーク
+//
+//   make bench で SIMD 命令を使う bench_simd と使わない bench_simd_scalar を作る.
+//   bench_simd は AVX に対応していれば AVX を使い, 環境変数 GG_SIMD=sse2 で SSE2 を使う.
+//   最後に表示する検査値は結果のビット列から求めるので, いずれの命令セットでも一致する.
+//
+
+// 補助プログラム
+#include "gg.h"
+using namespace gg;
+
+// 標準ライブラリ
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+
+// 一度に処理する要素数 (追跡点やアノテーションの数に相当)
+constexpr std::size_t batch(50000);
+
+// 計測の繰り返し回数
+constexpr int repeat(200);
+
+// 疑似乱数 [-1, 1)
+static GLfloat uniform()
+{
+  static std::uint32_t seed(12345u);
+  seed = seed * 1664525u + 1013904223u;
+  return static_cast<GLfloat>(seed >> 8) / 8388608.0f - 1.0f;
+}
+
+// 結果のビット列の検査値を更新する (FNV-1a)
+static std::uint32_t checksum(std::uint32_t h, const void *data, std::size_t size)
+{
+  const unsigned char *const p(static_cast<const unsigned char *>(data));
+  for (std::size_t i = 0; i < size; ++i) h = (h ^ p[i]) * 16777619u;
+  return h;
+}
+
+// 処理 f を繰り返して一要素あたりの時間 (ナノ秒) を表示する
+template <typename F>
+static void measure(const char *name, F f)
+{
+  // 一度実行してキャッシュを温めておく
+  f();
+
+  const auto start(std::chrono::steady_clock::now());
+  for (int i = 0; i < repeat; ++i) f();
+  const double ns(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+
+  std::cout << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(3)
+    << std::setw(10) << ns / (static_cast<double>(repeat) * batch) << " ns/element" << std::endl;
+}
+
+int main()
+{
+  std::cout << "simd: " << ggSimd() << ", batch: " << batch << ", repeat: " << repeat << std::endl;
+
+  // 変換行列と変換するベクトル
+  const GgMatrix m(ggPerspective(1.0f, 1.5f, 0.1f, 10.0f) * ggLookat(0.0f, 0.0f, 3.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f)
+    * ggRotate(0.3f, 0.5f, 0.7f, 0.8f));
+  std::vector<GgVector> v(batch), c(batch);
+  for (auto &e : v) e = GgVector{ uniform(), uniform(), uniform(), 1.0f };
+
+  // 四元数
+  std::vector<GgQuaternion> p(batch), q(batch), r(batch);
+  for (std::size_t i = 0; i < batch; ++i)
+  {
+    p[i] = ggRotateQuaternion(uniform(), uniform(), uniform(), uniform() * 3.0f);
+    q[i] = ggRotateQuaternion(uniform(), uniform(), uniform(), uniform() * 3.0f);
+  }
+
+  std::uint32_t h(2166136261u);
+
+  // 一つずつの投影変換
+  measure("projection (single)", [&]()
+  {
+    for (std::size_t i = 0; i < batch; ++i) c[i] = m * v[i];
+  });
+  h = checksum(h, c.data(), batch * sizeof(GgVector));
+
+  // まとめての投影変換
+  measure("projection (batch)", [&]()
+  {
+    m.projection(c.data(), v.data(), batch);
+  });
+  h = checksum(h, c.data(), batch * sizeof(GgVector));
+
+  // 一つずつの四元数の積
+  measure("quaternion multiply (single)", [&]()
+  {
+    for (std::size_t i = 0; i < batch; ++i) r[i] = p[i] * q[i];
+  });
+  h = checksum(h, r.data(), batch * sizeof(GgQuaternion));
+
+  // まとめての四元数の積
+  measure("quaternion multiply (batch)", [&]()
+  {
+    ggMultiplyQuaternion(r.data(), p.data(), q.data(), batch);
+  });
+  h = checksum(h, r.data(), batch * sizeof(GgQuaternion));
+
+  // 一つずつの球面線形補間
+  measure("slerp (single)", [&]()
+  {
+    for (std::size_t i = 0; i < batch; ++i) r[i] = p[i].slerp(q[i], 0.3f);
+  });
+  h = checksum(h, r.data(), batch * sizeof(GgQuaternion));
+
+  // まとめての球面線形補間
+  measure("slerp (batch)", [&]()
+  {
+    ggSlerpQuaternion(r.data(), p.data(), q.data(), 0.3f, batch);
+  });
+  h = checksum(h, r.data(), batch * sizeof(GgQuaternion));
+
+  std::cout << "checksum: " << std::hex << h << std::endl;
+}
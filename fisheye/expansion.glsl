@@ -0,0 +1,13 @@
+//
+// 平面展開のパラメータ
+//
+
+// 平面展開のパラメータ
+layout (std140) uniform Expansion
+{
+  mat4 rotation;                                      // スクリーンを回転する変換行列
+  vec4 screen;                                        // スクリーンの大きさと中心位置
+  vec4 circle;                                        // 背景テクスチャの半径と中心位置
+  vec2 gap;                                           // スクリーンの格子間隔
+  float focal;                                        // スクリーンまでの焦点距離
+};
@@ -7,22 +7,19 @@
 // OpenCV によるビデオキャプチャ
 #include "CamCv.h"
 
+// 表示・書き出しの間隔の計測
+#include <chrono>
+
 // 背景画像の取得に使用するデバイス
 //#define CAPTURE_INPUT 0               // 0 番のキャプチャデバイスから入力
 //#define CAPTURE_INPUT "sp360.mp4"     // Kodak SP360 4K の Fish Eye 画像
 #define CAPTURE_INPUT "theta.mp4"     // THETA S の Equirectangular 画像
 
-// 背景画像を展開する手法 (ExpansionShader.h 参照)
+// 背景画像を展開する手法の初期値 (ExpansionShader.h 参照, 実行中は数字キーで切り替える)
 //constexpr int shader_selection(6);    // Kodak SP360 4K
 //constexpr int shader_selection(7);    // THETA S の Dual Fisheye 画像
 constexpr int shader_selection(2);    // THETA S の Equirectangular 画像
 
-// 背景画像の展開に使用するバーテックスシェーダのソースファイル名
-const char *const capture_vsrc(shader_type[shader_selection].vsrc);
-
-// 背景画像の展開に使用するフラグメントシェーダのソースファイル名
-const char *const capture_fsrc(shader_type[shader_selection].fsrc);
-
 // 背景画像の取得に使用するカメラの解像度 (0 ならカメラから取得)
 constexpr int capture_width(shader_type[shader_selection].width);
 constexpr int capture_height(shader_type[shader_selection].height);
@@ -30,8 +27,32 @@ constexpr int capture_height(shader_type[shader_selection].height);
 // 背景画像の取得に使用するカメラのフレームレート (0 ならカメラから取得)
 constexpr int capture_fps(0);
 
-// 背景画像の関心領域
-const float *const capture_circle(shader_type[shader_selection].circle);
+// 新しいフレームや操作がないときにイベントを待つ最長時間 (0 なら毎回描画する)
+constexpr double redisplay_timeout(0.1);
+
+// GPU の処理時間をウィンドウのタイトルに表示するなら true
+constexpr bool profile_title(false);
+
+// GPU の処理時間を書き出すファイル名 (.json なら JSON 形式, それ以外は CSV 形式, nullptr なら書き出さない)
+const char *const profile_file(nullptr);
+
+// GPU の処理時間を表示・書き出す間隔 (秒)
+constexpr double profile_interval(1.0);
+
+// 最初のフレームまでに OpenGL の API のアドレスの取得に要した時間を表示するなら true
+constexpr bool startup_report(false);
+
+// CPU 側の処理区間のトレースを保存するファイル名 (GG_USE_TRACE が 1 のとき)
+const char *const trace_file("trace.json");
+
+// シェーダのプログラムオブジェクトのバイナリを保存するディレクトリ (nullptr なら保存しない)
+const char *const shader_cache("shadercache");
+
+// 形状データを読み込んだ結果を保存するディレクトリ (nullptr なら保存しない)
+const char *const mesh_cache("meshcache");
+
+// 別スレッドで読み込んだデータを 1 フレームで転送する時間の予算 (ミリ秒)
+constexpr double load_budget(2.0);
 
 // 背景画像の描画に用いるメッシュの格子点数
 constexpr int screen_samples(1271);
@@ -54,6 +75,9 @@ constexpr char file[] = "bunny.obj";
 // アプリケーションの実行
 void GgApplication::run()
 {
+  // トレース上のスレッド名を設定する
+  ggTraceThread("render");
+
   // ウィンドウを作成する
   Window window;
 
@@ -64,6 +88,12 @@ void GgApplication::run()
     throw std::runtime_error("Can't open GLFW window.");
   }
 
+  // シェーダのコンパイル結果をキャッシュする
+  ggSetShaderCache(shader_cache);
+
+  // 形状データの読み込み結果をキャッシュする
+  ggSetMeshCache(mesh_cache);
+
   // カメラの使用を開始する
   CamCv camera;
   if (!camera.open(CAPTURE_INPUT, capture_width, capture_height, capture_fps))
@@ -73,26 +103,50 @@ void GgApplication::run()
   camera.start();
 
   // 背景描画用のシェーダプログラムを読み込む
-  const GLuint expansion(ggLoadShader(capture_vsrc, capture_fsrc));
+  //   最初に使うもの以外は共有コンテキストを使って別スレッドで作成しておく。
+  //   平面展開のパラメータの uniform block はそれぞれ結合ポイントに結び付けてある。
+  //   背景テクスチャの sampler の初期値は 0 番のテクスチャユニットなので設定しない。
+  //   背景テクスチャの縦横比は実際にキャプチャしている画像のものを埋め込む。
+  ExpansionPrograms programs(window.get(), shader_selection, camera.getWidth(), camera.getHeight());
+
+  // 現在の背景画像を展開する手法
+  int selection(shader_selection);
+  GLuint expansion(programs.get(selection));
   if (!expansion)
   {
     // シェーダが読み込めなかった
     throw std::runtime_error("Can't create program object.");
   }
 
-  // uniform 変数の場所を指定する
-  const GLuint gapLoc(glGetUniformLocation(expansion, "gap"));
-  const GLuint screenLoc(glGetUniformLocation(expansion, "screen"));
-  const GLuint focalLoc(glGetUniformLocation(expansion, "focal"));
-  const GLuint rotationLoc(glGetUniformLocation(expansion, "rotation"));
-  const GLuint circleLoc(glGetUniformLocation(expansion, "circle"));
-  const GLuint imageLoc(glGetUniformLocation(expansion, "image"));
+  // キャプチャデバイスを開き直している間は true (描画するスレッドだけが使う)
+  bool reopening(false);
+
+  // キャプチャデバイスを開き直した後に切り替える展開手法
+  int reopenTarget(shader_selection);
+
+  // キャプチャデバイスを開き直すスレッドの結果 (0: 実行中, 1: 開けた, -1: 開けなかった)
+  std::atomic<int> reopened(0);
+
+  // キャプチャデバイスを開き直すスレッド
+  std::thread reopener;
+
+  // 数字キーで背景画像を展開する手法を選択する
+  int request(selection);
+  window.setUserPointer(&request);
+  window.setKeyboardFunc([](const Window *window, int key, int scancode, int action, int mods)
+  {
+    if (action == GLFW_PRESS && key >= GLFW_KEY_0 && key < GLFW_KEY_0 + shader_count)
+      *static_cast<int *>(window->getUserPointer()) = key - GLFW_KEY_0;
+  });
+
+  // 平面展開のパラメータのユニフォームバッファオブジェクト
+  ExpansionBuffer expansionBuffer;
 
   // 背景用のテクスチャを作成する
   //   ポリゴンでビューポート全体を埋めるので背景は表示されない。
   //   GL_CLAMP_TO_BORDER にしておけばテクスチャの外が GL_TEXTURE_BORDER_COLOR になるので、これが背景色になる。
   const GLuint image([]() { GLuint image; glGenTextures(1, &image); return image; } ());
-  glBindTexture(GL_TEXTURE_2D, image);
+  ggBindTexture(GL_TEXTURE_2D, image);
   glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, camera.getWidth(), camera.getHeight(), 0, GL_BGR, GL_UNSIGNED_BYTE, NULL);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
@@ -110,21 +164,47 @@ void GgApplication::run()
   // 光源
   GgSimpleShader::LightBuffer light(lightData);
 
+  // 図形などのデータは別スレッドで読み込んで描画を止めないようにする
+  GgLoader loader;
+
   // 表示する図形の形状データファイルの読み込み
-  //const GgSimpleObj object(file, true);
+  //const auto object(loader.loadSimpleObj(file, true));
 
   // 図形表示用の視野変換行列の
-  const GgMatrix mv(ggLookat(0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f));
+  constexpr GgMatrix mv(ggConstLookat(0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f));
 
-  // ウィンドウが開いている間繰り返す
-  while (window)
+  // フレームの描画手順
+  //   描画パスごとに GPU の処理時間を計測する。
+  GgRenderGraph graph;
+
+  // 描画パスが読み書きする資源
+  const GLuint imageResource(graph.importTexture("image", image));
+  const GLuint screenResource(graph.importFramebuffer("screen"));
+
+  // ウィンドウのフレームバッファに至る描画パスを実行する
+  graph.setOutput(screenResource);
+
+  // キャプチャした画像を背景用のテクスチャに転送する
+  const GLuint uploadPass(graph.addPass("upload", [&]()
   {
+    ggActiveTexture(GL_TEXTURE0);
+    ggBindTexture(GL_TEXTURE_2D, image);
+
+    // キャプチャデバイスを開き直している間は画像の大きさが変わるので転送しない
+    if (!reopening) camera.transmit();
+  }));
+  graph.write(uploadPass, imageResource);
+
+  // 背景画像を展開する
+  const GLuint expansionPass(graph.addPass("expansion", [&]()
+  {
+    // 背景用のテクスチャを 0 番のテクスチャユニットに結合する
+    ggActiveTexture(GL_TEXTURE0);
+    ggBindTexture(GL_TEXTURE_2D, image);
+
     // 画面クリア
     glClear(GL_COLOR_BUFFER_BIT);
 
-    // 背景画像の展開に用いるシェーダプログラムの使用を開始する
-    glUseProgram(expansion);
-
     // スクリーンの矩形の格子点数
     //   標本点の数 (頂点数) n = x * y とするとき、これにアスペクト比 a = x / y をかければ、
     //   a * n = x * x となるから x = sqrt(a * n), y = n / x; で求められる。
@@ -132,61 +212,75 @@ void GgApplication::run()
     const GLsizei slices(static_cast<GLsizei>(sqrt(window.getAspect() * screen_samples)));
     const GLsizei stacks(screen_samples / slices - 1); // 描画するインスタンスの数なので先に 1 を引いておく。
 
-    // スクリーンの格子間隔
-    //   クリッピング空間全体を埋める四角形は [-1, 1] の範囲すなわち縦横 2 の大きさだから、
-    //   それを縦横の (格子数 - 1) で割って格子の間隔を求める。
-    glUniform2f(gapLoc, 2.0f / (slices - 1), 2.0f / stacks);
+    // 平面展開のパラメータ
+    Expansion param;
+
+    // 背景に対する視線の回転行列
+    //   トラックボールの回転の転置 (= 逆回転) を視線に適用する。
+    const GgMatrix rotation(window.getTrackball().transpose());
+    std::copy(rotation.get(), rotation.get() + 16, param.rotation);
 
     // スクリーンのサイズと中心位置
     //   screen[0] = (right - left) / 2
     //   screen[1] = (top - bottom) / 2
     //   screen[2] = (right + left) / 2
     //   screen[3] = (top + bottom) / 2
-    const GLfloat screen[] = { window.getAspect(), 1.0f, 0.0f, 0.0f };
-    glUniform4fv(screenLoc, 1, screen);
-
-    // スクリーンまでの焦点距離
-    //   window.getWheel() は [-100, 49] の範囲を返す。
-    //   したがって焦点距離 focal は [1 / 3, 1] の範囲になる。
-    //   これは焦点距離が長くなるにしたがって変化が大きくなる。
-    glUniform1f(focalLoc, -50.0f / (window.getWheelY() - 50.0f));
-
-    // 背景に対する視線の回転行列
-    glUniformMatrix4fv(rotationLoc, 1, GL_TRUE, window.getTrackball().get());
+    param.screen[0] = window.getAspect();
+    param.screen[1] = 1.0f;
+    param.screen[2] = 0.0f;
+    param.screen[3] = 0.0f;
 
     // テクスチャの半径と中心位置
     //   circle[0] = イメージサークルの x 方向の半径
     //   circle[1] = イメージサークルの y 方向の半径
     //   circle[2] = イメージサークルの中心の x 座標
     //   circle[3] = イメージサークルの中心の y 座標
-    const GLfloat circle[] =
-    {
-      capture_circle[0] + window.getArrowX() * 0.001f,
-      capture_circle[1] + window.getArrowY() * 0.001f,
-      capture_circle[2] + window.getShiftArrowX() * 0.001f,
-      capture_circle[3] + window.getShiftArrowY() * 0.001f
-    };
-    glUniform4fv(circleLoc, 1, circle);
+    const float *const circle(shader_type[selection].circle);
+    param.circle[0] = circle[0] + window.getArrowX() * 0.001f;
+    param.circle[1] = circle[1] + window.getArrowY() * 0.001f;
+    param.circle[2] = circle[2] + window.getShiftArrowX() * 0.001f;
+    param.circle[3] = circle[3] + window.getShiftArrowY() * 0.001f;
+
+    // スクリーンの格子間隔
+    //   クリッピング空間全体を埋める四角形は [-1, 1] の範囲すなわち縦横 2 の大きさだから、
+    //   それを縦横の (格子数 - 1) で割って格子の間隔を求める。
+    param.gap[0] = 2.0f / (slices - 1);
+    param.gap[1] = 2.0f / stacks;
+
+    // スクリーンまでの焦点距離
+    //   window.getWheel() は [-100, 49] の範囲を返す。
+    //   したがって焦点距離 focal は [1 / 3, 1] の範囲になる。
+    //   これは焦点距離が長くなるにしたがって変化が大きくなる。
+    param.focal = -50.0f / (window.getWheelY() - 50.0f);
+    param.padding = 0.0f;
 
-    // キャプチャした画像を背景用のテクスチャに転送する
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, image);
-    camera.transmit();
+    // 平面展開のパラメータをまとめて転送する
+    expansionBuffer.update(&param);
 
-    // テクスチャユニットを指定する
-    glUniform1i(imageLoc, 0);
+    // 背景画像の展開に用いるシェーダプログラムの使用を開始する
+    ggUseProgram(expansion);
+    expansionBuffer.select();
 
     // 隠面消去を行わない
-    glDisable(GL_DEPTH_TEST);
-    glDisable(GL_CULL_FACE);
+    ggDisable(GL_DEPTH_TEST);
+    ggDisable(GL_CULL_FACE);
 
     // メッシュを描画する
-    glBindVertexArray(mesh);
+    ggBindVertexArray(mesh);
     glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, slices * 2, stacks);
 
+    // 平面展開のパラメータのこのフレームの領域の使用を終える
+    expansionBuffer.fence();
+  }));
+  graph.read(expansionPass, imageResource);
+  graph.write(expansionPass, screenResource);
+
+  // 展開した背景画像に図形を重ねて描画する
+  const GLuint overlayPass(graph.addPass("overlay", [&]()
+  {
     // 隠面消去を行う
-    glEnable(GL_DEPTH_TEST);
-    glEnable(GL_CULL_FACE);
+    ggEnable(GL_DEPTH_TEST);
+    ggEnable(GL_CULL_FACE);
 
     // デプスバッファをクリアする
     glClear(GL_DEPTH_BUFFER_BIT);
@@ -195,12 +289,173 @@ void GgApplication::run()
     const GgMatrix mp(ggPerspective(1.0f, window.getAspect(), 0.1f, 3.0f));
 
     // 図形描画用のシェーダプログラムの使用開始
-    simple.use(mp, mv * window.getTrackball(), light);
+    simple.use(mp, ggExpression(mv) * window.getTrackball(), light);
+
+    // 図形を描画する (読み込みが完了するまでは描かない)
+    //if (object) object->draw();
+  }));
+  graph.read(overlayPass, screenResource);
+  graph.write(overlayPass, screenResource);
+
+  // GPU の処理時間を最後に表示・書き出した時刻
+  auto profileTime(std::chrono::steady_clock::now());
+
+  // API のアドレスの取得に要した時間をまだ表示していなければ true
+  bool startupPending(startup_report);
 
-    // 図形を描画する
-    //object.draw();
+#if GG_COUNT_STATE
+  // 表示の間隔の間の状態設定の呼び出しと省略の回数とフレーム数
+  GgStateCount stateCount{ 0, 0 };
+  unsigned int stateFrames(0);
+#endif
+
+  // 新しいフレームの到着や表示の変化がなければイベントを待つ
+  window.setWaitTimeout(redisplay_timeout);
+
+  // ウィンドウが開いている間繰り返す
+  while (window)
+  {
+    // キャプチャデバイスを開き直すスレッドが終わっていれば結果を反映する
+    if (reopening && reopened.load() != 0)
+    {
+      reopener.join();
+      reopening = false;
+
+      // 背景用のテクスチャのサイズを開き直したキャプチャデバイスの画像に合わせる
+      ggBindTexture(GL_TEXTURE_2D, image);
+      glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, camera.getWidth(), camera.getHeight(), 0, GL_BGR, GL_UNSIGNED_BYTE, NULL);
+
+      if (reopened.load() > 0)
+      {
+        // 展開手法を切り替える
+        expansion = programs.get(reopenTarget);
+        selection = reopenTarget;
+      }
+      else
+      {
+        // 開けなければ元の展開手法を使い続ける
+        request = selection;
+      }
+
+      window.postRedisplay();
+    }
+
+    // 選択された展開手法のプログラムオブジェクトが用意できていれば切り替える
+    if (request != selection && !reopening)
+    {
+      const GLuint program(programs.get(request));
+      if (program)
+      {
+        // カメラの解像度が異なればキャプチャデバイスを別スレッドで開き直す
+        //   開き直している間は描画を止めず、開けなければ元の解像度で開き直す。
+        if (shader_type[request].width != shader_type[selection].width
+          || shader_type[request].height != shader_type[selection].height)
+        {
+          reopening = true;
+          reopenTarget = request;
+          reopened.store(0);
+          reopener = std::thread([&camera, &reopened](int next, int previous)
+          {
+            // トレース上のスレッド名を設定する
+            ggTraceThread("reopen");
+
+            camera.stop();
+            if (camera.open(CAPTURE_INPUT, shader_type[next].width, shader_type[next].height, capture_fps))
+            {
+              camera.start();
+              reopened.store(1);
+            }
+            else
+            {
+              if (camera.open(CAPTURE_INPUT, shader_type[previous].width, shader_type[previous].height, capture_fps))
+                camera.start();
+              reopened.store(-1);
+            }
+
+            // イベント待ちのメインスレッドを起こす
+            glfwPostEmptyEvent();
+          }, request, selection);
+        }
+        else
+        {
+          // 展開手法を切り替える
+          expansion = program;
+          selection = request;
+          window.postRedisplay();
+        }
+      }
+    }
+
+    // 実際にキャプチャしている画像の縦横比を埋め込んだものができていればそれに切り替える
+    //   縦横比が埋め込んだものと異なれば別スレッドで作り直し、できるまでは今のものを使い続ける。
+    if (!reopening)
+    {
+      const GLuint variant(programs.get(selection, camera.getWidth(), camera.getHeight()));
+      if (variant != 0 && variant != expansion)
+      {
+        expansion = variant;
+        window.postRedisplay();
+      }
+    }
+
+    // 別スレッドで読み込んだデータを時間の予算内で転送する
+    //   読み込み中はイベントを待たずに転送を続け、完了したら表示を更新する。
+    if (loader.update(load_budget) > 0 || loader.getPending() > 0) window.postRedisplay();
+
+    // 新しい画像が届いていれば再描画する
+    if (camera.pending()) window.postRedisplay();
+
+    // 表示に変化がなければ描画しない
+    if (!window.shouldRedisplay()) continue;
+
+    // ウィンドウの大きさを描画の手順のビューポートにする (OpenGL の状態は問い合わせない)
+    graph.setViewport(0, 0, window.getWidth(), window.getHeight());
+
+    // 描画パスを実行順に実行する
+    graph.execute();
 
     // カラーバッファを入れ替えてイベントを取り出す
     window.swapBuffers();
+
+    // 前のフレームの描画パスの GPU の処理時間を回収する
+    graph.update();
+
+    // 最初のフレームまでに API のアドレスの取得に要した時間を表示する
+    if (startupPending)
+    {
+      std::cerr << ggInitReport() << std::endl;
+      startupPending = false;
+    }
+
+#if GG_COUNT_STATE
+    // このフレームの状態設定の呼び出しと省略の回数を積算する
+    const GgStateCount count(ggGetStateCount());
+    stateCount.issued += count.issued;
+    stateCount.elided += count.elided;
+    ++stateFrames;
+#endif
+
+    // 一定時間ごとに GPU の処理時間を表示・書き出す
+    const auto now(std::chrono::steady_clock::now());
+    if (std::chrono::duration<double>(now - profileTime).count() >= profile_interval)
+    {
+      if (profile_title) window.setTitle(graph.getProfiler().summary().c_str());
+      if (profile_file) graph.getProfiler().save(profile_file);
+      profileTime = now;
+
+#if GG_COUNT_STATE
+      // 1 フレームあたりの状態設定の呼び出しと省略の回数を表示する
+      std::cerr << "State calls per frame: issued " << stateCount.issued / stateFrames
+        << ", elided " << stateCount.elided / stateFrames << std::endl;
+      stateCount = { 0, 0 };
+      stateFrames = 0;
+#endif
+    }
   }
+
+  // キャプチャデバイスを開き直していれば終わるのを待つ
+  if (reopener.joinable()) reopener.join();
+
+  // CPU 側の処理区間のトレースを保存する
+  ggSaveTrace(trace_file);
 }
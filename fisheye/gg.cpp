@@ -29,6 +29,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 // 標準ライブラリ
 #include <cmath>
 #include <cfloat>
+#include <climits>
 #include <cstdlib>
 #include <cstddef>
 #include <stdexcept>
@@ -38,6 +39,44 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <string>
 #include <memory>
 #include <map>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#if defined(_WIN32)
+#  include <direct.h>
+#  include <sys/stat.h>
+#  define WIN32_LEAN_AND_MEAN
+#  include <windows.h>
+#else
+#  include <sys/stat.h>
+#  include <sys/mman.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+#if GG_USE_TRACE
+#  include <atomic>
+#  include <mutex>
+#endif
+
+// SIMD 命令
+#if GG_USE_SIMD && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#  define GG_SIMD_SSE
+#  include <immintrin.h>
+#  if defined(_MSC_VER)
+#    include <intrin.h>
+#    define GG_TARGET_AVX
+#  else
+#    define GG_TARGET_AVX __attribute__((target("avx")))
+#  endif
+#elif GG_USE_SIMD && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#  define GG_SIMD_NEON
+#  include <arm_neon.h>
+#endif
 
 //! \cond INCLUDE_OPENGL_FUNCTIONS
 
@@ -1298,6 +1337,106 @@ PFNGLWINDOWRECTANGLESEXTPROC glWindowRectanglesEXT;
 //! 使用している GPU のバッファアライメント
 GLint gg::ggBufferAlignment(0);
 
+//! 使用している GPU で永続的にマップするバッファオブジェクトが使えるか
+bool gg::ggBufferStorage(false);
+
+// \cond
+namespace gg
+{
+  // ggInit() で設定した API の数と処理時間 [ns]
+  static unsigned int initProcCount(0);
+  static long long initProcTime(0);
+
+  // ggInit() の後で最初の呼び出しか ggResolveProcs() でアドレスを取得した API の数と処理時間の合計 [ns]
+  static std::atomic<unsigned int> lazyProcCount(0);
+  static std::atomic<long long> lazyProcTime(0);
+
+  // 経過時間を ns 単位で求める
+  static long long elapsed(std::chrono::steady_clock::time_point start)
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+  }
+
+#if !defined(GL3_PROTOTYPES) && GG_LAZY_PROC
+  //
+  // API の関数ポインタに最初に設定しておく仮の関数
+  //
+  //   F は API の関数ポインタの型, P はその関数ポインタの変数のアドレス.
+  //   最初に呼び出されたときに API のアドレスを取得して *P を置き換えるので,
+  //   以降の呼び出しは直接 API に渡る. *P の置き換えは排他制御していないので,
+  //   別のスレッドから API を呼び出す前に ggResolveProcs() で置き換えを済ませておく.
+  //
+
+  // 仮の関数を設定した API のアドレスを取得する関数
+  static std::vector<void (*)()> lazyProcResolvers;
+
+  template <typename F> struct LazyProc;
+  template <typename R, typename... A> struct LazyProc<R (APIENTRY *)(A...)>
+  {
+    template <R (APIENTRY **P)(A...)> struct Entry
+    {
+      // API の名前
+      static const char *name;
+
+      // API のアドレスを取得して呼び出す
+      static R APIENTRY call(A... a)
+      {
+        const auto start(std::chrono::steady_clock::now());
+        const auto proc(reinterpret_cast<R (APIENTRY *)(A...)>(glfwGetProcAddress(name)));
+        lazyProcTime += elapsed(start);
+        ++lazyProcCount;
+
+        // 使えない API を呼び出したら原因がわかるようにして終了する
+        if (!proc)
+        {
+          std::cerr << "OpenGL API not available: " << name << std::endl;
+          std::abort();
+        }
+
+        *P = proc;
+        return proc(a...);
+      }
+
+      // まだ仮の関数のままなら API のアドレスを取得して *P を置き換える
+      //   使えない API は仮の関数のままにしておき, 呼び出されたときに終了する
+      static void resolve()
+      {
+        if (*P != &call) return;
+
+        const auto start(std::chrono::steady_clock::now());
+        const auto proc(reinterpret_cast<R (APIENTRY *)(A...)>(glfwGetProcAddress(name)));
+        lazyProcTime += elapsed(start);
+
+        if (proc)
+        {
+          *P = proc;
+          ++lazyProcCount;
+        }
+      }
+    };
+  };
+
+  template <typename R, typename... A>
+  template <R (APIENTRY **P)(A...)>
+  const char *LazyProc<R (APIENTRY *)(A...)>::Entry<P>::name(nullptr);
+
+  // 関数ポインタ *P に設定する仮の関数を得る
+  template <typename F, F *P> static F lazyProc(const char *name)
+  {
+    LazyProc<F>::template Entry<P>::name = name;
+    lazyProcResolvers.push_back(&LazyProc<F>::template Entry<P>::resolve);
+    return &LazyProc<F>::template Entry<P>::call;
+  }
+
+  // API の関数ポインタに仮の関数を設定する
+#  define GG_GET_PROC(type, proc) (proc = gg::lazyProc<type, &proc>(#proc), ++gg::initProcCount)
+#else
+  // API の関数ポインタに API のアドレスを設定する
+#  define GG_GET_PROC(type, proc) (proc = type(glfwGetProcAddress(#proc)), ++gg::initProcCount)
+#endif
+}
+// \endcond
+
 /*
 ** ゲームグラフィックス特論の都合にもとづく初期化
 */
@@ -1308,1245 +1447,1287 @@ void gg::ggInit()
 
   // macOS 以外で OpenGL 3.2 以降の API を取得する
 #if !defined(GL3_PROTOTYPES)
-  glActiveProgramEXT = PFNGLACTIVEPROGRAMEXTPROC(glfwGetProcAddress("glActiveProgramEXT"));
-  glActiveShaderProgram = PFNGLACTIVESHADERPROGRAMPROC(glfwGetProcAddress("glActiveShaderProgram"));
-  glActiveTexture = PFNGLACTIVETEXTUREPROC(glfwGetProcAddress("glActiveTexture"));
-  glApplyFramebufferAttachmentCMAAINTEL = PFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC(glfwGetProcAddress("glApplyFramebufferAttachmentCMAAINTEL"));
-  glAttachShader = PFNGLATTACHSHADERPROC(glfwGetProcAddress("glAttachShader"));
-  glBeginConditionalRender = PFNGLBEGINCONDITIONALRENDERPROC(glfwGetProcAddress("glBeginConditionalRender"));
-  glBeginConditionalRenderNV = PFNGLBEGINCONDITIONALRENDERNVPROC(glfwGetProcAddress("glBeginConditionalRenderNV"));
-  glBeginPerfMonitorAMD = PFNGLBEGINPERFMONITORAMDPROC(glfwGetProcAddress("glBeginPerfMonitorAMD"));
-  glBeginPerfQueryINTEL = PFNGLBEGINPERFQUERYINTELPROC(glfwGetProcAddress("glBeginPerfQueryINTEL"));
-  glBeginQuery = PFNGLBEGINQUERYPROC(glfwGetProcAddress("glBeginQuery"));
-  glBeginQueryIndexed = PFNGLBEGINQUERYINDEXEDPROC(glfwGetProcAddress("glBeginQueryIndexed"));
-  glBeginTransformFeedback = PFNGLBEGINTRANSFORMFEEDBACKPROC(glfwGetProcAddress("glBeginTransformFeedback"));
-  glBindAttribLocation = PFNGLBINDATTRIBLOCATIONPROC(glfwGetProcAddress("glBindAttribLocation"));
-  glBindBuffer = PFNGLBINDBUFFERPROC(glfwGetProcAddress("glBindBuffer"));
-  glBindBufferBase = PFNGLBINDBUFFERBASEPROC(glfwGetProcAddress("glBindBufferBase"));
-  glBindBufferRange = PFNGLBINDBUFFERRANGEPROC(glfwGetProcAddress("glBindBufferRange"));
-  glBindBuffersBase = PFNGLBINDBUFFERSBASEPROC(glfwGetProcAddress("glBindBuffersBase"));
-  glBindBuffersRange = PFNGLBINDBUFFERSRANGEPROC(glfwGetProcAddress("glBindBuffersRange"));
-  glBindFragDataLocation = PFNGLBINDFRAGDATALOCATIONPROC(glfwGetProcAddress("glBindFragDataLocation"));
-  glBindFragDataLocationIndexed = PFNGLBINDFRAGDATALOCATIONINDEXEDPROC(glfwGetProcAddress("glBindFragDataLocationIndexed"));
-  glBindFramebuffer = PFNGLBINDFRAMEBUFFERPROC(glfwGetProcAddress("glBindFramebuffer"));
-  glBindImageTexture = PFNGLBINDIMAGETEXTUREPROC(glfwGetProcAddress("glBindImageTexture"));
-  glBindImageTextures = PFNGLBINDIMAGETEXTURESPROC(glfwGetProcAddress("glBindImageTextures"));
-  glBindMultiTextureEXT = PFNGLBINDMULTITEXTUREEXTPROC(glfwGetProcAddress("glBindMultiTextureEXT"));
-  glBindProgramPipeline = PFNGLBINDPROGRAMPIPELINEPROC(glfwGetProcAddress("glBindProgramPipeline"));
-  glBindRenderbuffer = PFNGLBINDRENDERBUFFERPROC(glfwGetProcAddress("glBindRenderbuffer"));
-  glBindSampler = PFNGLBINDSAMPLERPROC(glfwGetProcAddress("glBindSampler"));
-  glBindSamplers = PFNGLBINDSAMPLERSPROC(glfwGetProcAddress("glBindSamplers"));
-  glBindTexture = PFNGLBINDTEXTUREPROC(glfwGetProcAddress("glBindTexture"));
-  glBindTextureUnit = PFNGLBINDTEXTUREUNITPROC(glfwGetProcAddress("glBindTextureUnit"));
-  glBindTextures = PFNGLBINDTEXTURESPROC(glfwGetProcAddress("glBindTextures"));
-  glBindTransformFeedback = PFNGLBINDTRANSFORMFEEDBACKPROC(glfwGetProcAddress("glBindTransformFeedback"));
-  glBindVertexArray = PFNGLBINDVERTEXARRAYPROC(glfwGetProcAddress("glBindVertexArray"));
-  glBindVertexBuffer = PFNGLBINDVERTEXBUFFERPROC(glfwGetProcAddress("glBindVertexBuffer"));
-  glBindVertexBuffers = PFNGLBINDVERTEXBUFFERSPROC(glfwGetProcAddress("glBindVertexBuffers"));
-  glBlendBarrierKHR = PFNGLBLENDBARRIERKHRPROC(glfwGetProcAddress("glBlendBarrierKHR"));
-  glBlendBarrierNV = PFNGLBLENDBARRIERNVPROC(glfwGetProcAddress("glBlendBarrierNV"));
-  glBlendColor = PFNGLBLENDCOLORPROC(glfwGetProcAddress("glBlendColor"));
-  glBlendEquation = PFNGLBLENDEQUATIONPROC(glfwGetProcAddress("glBlendEquation"));
-  glBlendEquationSeparate = PFNGLBLENDEQUATIONSEPARATEPROC(glfwGetProcAddress("glBlendEquationSeparate"));
-  glBlendEquationSeparatei = PFNGLBLENDEQUATIONSEPARATEIPROC(glfwGetProcAddress("glBlendEquationSeparatei"));
-  glBlendEquationSeparateiARB = PFNGLBLENDEQUATIONSEPARATEIARBPROC(glfwGetProcAddress("glBlendEquationSeparateiARB"));
-  glBlendEquationi = PFNGLBLENDEQUATIONIPROC(glfwGetProcAddress("glBlendEquationi"));
-  glBlendEquationiARB = PFNGLBLENDEQUATIONIARBPROC(glfwGetProcAddress("glBlendEquationiARB"));
-  glBlendFunc = PFNGLBLENDFUNCPROC(glfwGetProcAddress("glBlendFunc"));
-  glBlendFuncSeparate = PFNGLBLENDFUNCSEPARATEPROC(glfwGetProcAddress("glBlendFuncSeparate"));
-  glBlendFuncSeparatei = PFNGLBLENDFUNCSEPARATEIPROC(glfwGetProcAddress("glBlendFuncSeparatei"));
-  glBlendFuncSeparateiARB = PFNGLBLENDFUNCSEPARATEIARBPROC(glfwGetProcAddress("glBlendFuncSeparateiARB"));
-  glBlendFunci = PFNGLBLENDFUNCIPROC(glfwGetProcAddress("glBlendFunci"));
-  glBlendFunciARB = PFNGLBLENDFUNCIARBPROC(glfwGetProcAddress("glBlendFunciARB"));
-  glBlendParameteriNV = PFNGLBLENDPARAMETERINVPROC(glfwGetProcAddress("glBlendParameteriNV"));
-  glBlitFramebuffer = PFNGLBLITFRAMEBUFFERPROC(glfwGetProcAddress("glBlitFramebuffer"));
-  glBlitNamedFramebuffer = PFNGLBLITNAMEDFRAMEBUFFERPROC(glfwGetProcAddress("glBlitNamedFramebuffer"));
-  glBufferAddressRangeNV = PFNGLBUFFERADDRESSRANGENVPROC(glfwGetProcAddress("glBufferAddressRangeNV"));
-  glBufferData = PFNGLBUFFERDATAPROC(glfwGetProcAddress("glBufferData"));
-  glBufferPageCommitmentARB = PFNGLBUFFERPAGECOMMITMENTARBPROC(glfwGetProcAddress("glBufferPageCommitmentARB"));
-  glBufferStorage = PFNGLBUFFERSTORAGEPROC(glfwGetProcAddress("glBufferStorage"));
-  glBufferSubData = PFNGLBUFFERSUBDATAPROC(glfwGetProcAddress("glBufferSubData"));
-  glCallCommandListNV = PFNGLCALLCOMMANDLISTNVPROC(glfwGetProcAddress("glCallCommandListNV"));
-  glCheckFramebufferStatus = PFNGLCHECKFRAMEBUFFERSTATUSPROC(glfwGetProcAddress("glCheckFramebufferStatus"));
-  glCheckNamedFramebufferStatus = PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC(glfwGetProcAddress("glCheckNamedFramebufferStatus"));
-  glCheckNamedFramebufferStatusEXT = PFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC(glfwGetProcAddress("glCheckNamedFramebufferStatusEXT"));
-  glClampColor = PFNGLCLAMPCOLORPROC(glfwGetProcAddress("glClampColor"));
-  glClear = PFNGLCLEARPROC(glfwGetProcAddress("glClear"));
-  glClearBufferData = PFNGLCLEARBUFFERDATAPROC(glfwGetProcAddress("glClearBufferData"));
-  glClearBufferSubData = PFNGLCLEARBUFFERSUBDATAPROC(glfwGetProcAddress("glClearBufferSubData"));
-  glClearBufferfi = PFNGLCLEARBUFFERFIPROC(glfwGetProcAddress("glClearBufferfi"));
-  glClearBufferfv = PFNGLCLEARBUFFERFVPROC(glfwGetProcAddress("glClearBufferfv"));
-  glClearBufferiv = PFNGLCLEARBUFFERIVPROC(glfwGetProcAddress("glClearBufferiv"));
-  glClearBufferuiv = PFNGLCLEARBUFFERUIVPROC(glfwGetProcAddress("glClearBufferuiv"));
-  glClearColor = PFNGLCLEARCOLORPROC(glfwGetProcAddress("glClearColor"));
-  glClearDepth = PFNGLCLEARDEPTHPROC(glfwGetProcAddress("glClearDepth"));
-  glClearDepthf = PFNGLCLEARDEPTHFPROC(glfwGetProcAddress("glClearDepthf"));
-  glClearNamedBufferData = PFNGLCLEARNAMEDBUFFERDATAPROC(glfwGetProcAddress("glClearNamedBufferData"));
-  glClearNamedBufferDataEXT = PFNGLCLEARNAMEDBUFFERDATAEXTPROC(glfwGetProcAddress("glClearNamedBufferDataEXT"));
-  glClearNamedBufferSubData = PFNGLCLEARNAMEDBUFFERSUBDATAPROC(glfwGetProcAddress("glClearNamedBufferSubData"));
-  glClearNamedBufferSubDataEXT = PFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC(glfwGetProcAddress("glClearNamedBufferSubDataEXT"));
-  glClearNamedFramebufferfi = PFNGLCLEARNAMEDFRAMEBUFFERFIPROC(glfwGetProcAddress("glClearNamedFramebufferfi"));
-  glClearNamedFramebufferfv = PFNGLCLEARNAMEDFRAMEBUFFERFVPROC(glfwGetProcAddress("glClearNamedFramebufferfv"));
-  glClearNamedFramebufferiv = PFNGLCLEARNAMEDFRAMEBUFFERIVPROC(glfwGetProcAddress("glClearNamedFramebufferiv"));
-  glClearNamedFramebufferuiv = PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC(glfwGetProcAddress("glClearNamedFramebufferuiv"));
-  glClearStencil = PFNGLCLEARSTENCILPROC(glfwGetProcAddress("glClearStencil"));
-  glClearTexImage = PFNGLCLEARTEXIMAGEPROC(glfwGetProcAddress("glClearTexImage"));
-  glClearTexSubImage = PFNGLCLEARTEXSUBIMAGEPROC(glfwGetProcAddress("glClearTexSubImage"));
-  glClientAttribDefaultEXT = PFNGLCLIENTATTRIBDEFAULTEXTPROC(glfwGetProcAddress("glClientAttribDefaultEXT"));
-  glClientWaitSync = PFNGLCLIENTWAITSYNCPROC(glfwGetProcAddress("glClientWaitSync"));
-  glClipControl = PFNGLCLIPCONTROLPROC(glfwGetProcAddress("glClipControl"));
-  glColorFormatNV = PFNGLCOLORFORMATNVPROC(glfwGetProcAddress("glColorFormatNV"));
-  glColorMask = PFNGLCOLORMASKPROC(glfwGetProcAddress("glColorMask"));
-  glColorMaski = PFNGLCOLORMASKIPROC(glfwGetProcAddress("glColorMaski"));
-  glCommandListSegmentsNV = PFNGLCOMMANDLISTSEGMENTSNVPROC(glfwGetProcAddress("glCommandListSegmentsNV"));
-  glCompileCommandListNV = PFNGLCOMPILECOMMANDLISTNVPROC(glfwGetProcAddress("glCompileCommandListNV"));
-  glCompileShader = PFNGLCOMPILESHADERPROC(glfwGetProcAddress("glCompileShader"));
-  glCompileShaderIncludeARB = PFNGLCOMPILESHADERINCLUDEARBPROC(glfwGetProcAddress("glCompileShaderIncludeARB"));
-  glCompressedMultiTexImage1DEXT = PFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC(glfwGetProcAddress("glCompressedMultiTexImage1DEXT"));
-  glCompressedMultiTexImage2DEXT = PFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC(glfwGetProcAddress("glCompressedMultiTexImage2DEXT"));
-  glCompressedMultiTexImage3DEXT = PFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC(glfwGetProcAddress("glCompressedMultiTexImage3DEXT"));
-  glCompressedMultiTexSubImage1DEXT = PFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC(glfwGetProcAddress("glCompressedMultiTexSubImage1DEXT"));
-  glCompressedMultiTexSubImage2DEXT = PFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC(glfwGetProcAddress("glCompressedMultiTexSubImage2DEXT"));
-  glCompressedMultiTexSubImage3DEXT = PFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC(glfwGetProcAddress("glCompressedMultiTexSubImage3DEXT"));
-  glCompressedTexImage1D = PFNGLCOMPRESSEDTEXIMAGE1DPROC(glfwGetProcAddress("glCompressedTexImage1D"));
-  glCompressedTexImage2D = PFNGLCOMPRESSEDTEXIMAGE2DPROC(glfwGetProcAddress("glCompressedTexImage2D"));
-  glCompressedTexImage3D = PFNGLCOMPRESSEDTEXIMAGE3DPROC(glfwGetProcAddress("glCompressedTexImage3D"));
-  glCompressedTexSubImage1D = PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC(glfwGetProcAddress("glCompressedTexSubImage1D"));
-  glCompressedTexSubImage2D = PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC(glfwGetProcAddress("glCompressedTexSubImage2D"));
-  glCompressedTexSubImage3D = PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC(glfwGetProcAddress("glCompressedTexSubImage3D"));
-  glCompressedTextureImage1DEXT = PFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC(glfwGetProcAddress("glCompressedTextureImage1DEXT"));
-  glCompressedTextureImage2DEXT = PFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC(glfwGetProcAddress("glCompressedTextureImage2DEXT"));
-  glCompressedTextureImage3DEXT = PFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC(glfwGetProcAddress("glCompressedTextureImage3DEXT"));
-  glCompressedTextureSubImage1D = PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC(glfwGetProcAddress("glCompressedTextureSubImage1D"));
-  glCompressedTextureSubImage1DEXT = PFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC(glfwGetProcAddress("glCompressedTextureSubImage1DEXT"));
-  glCompressedTextureSubImage2D = PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC(glfwGetProcAddress("glCompressedTextureSubImage2D"));
-  glCompressedTextureSubImage2DEXT = PFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC(glfwGetProcAddress("glCompressedTextureSubImage2DEXT"));
-  glCompressedTextureSubImage3D = PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC(glfwGetProcAddress("glCompressedTextureSubImage3D"));
-  glCompressedTextureSubImage3DEXT = PFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC(glfwGetProcAddress("glCompressedTextureSubImage3DEXT"));
-  glConservativeRasterParameterfNV = PFNGLCONSERVATIVERASTERPARAMETERFNVPROC(glfwGetProcAddress("glConservativeRasterParameterfNV"));
-  glConservativeRasterParameteriNV = PFNGLCONSERVATIVERASTERPARAMETERINVPROC(glfwGetProcAddress("glConservativeRasterParameteriNV"));
-  glCopyBufferSubData = PFNGLCOPYBUFFERSUBDATAPROC(glfwGetProcAddress("glCopyBufferSubData"));
-  glCopyImageSubData = PFNGLCOPYIMAGESUBDATAPROC(glfwGetProcAddress("glCopyImageSubData"));
-  glCopyMultiTexImage1DEXT = PFNGLCOPYMULTITEXIMAGE1DEXTPROC(glfwGetProcAddress("glCopyMultiTexImage1DEXT"));
-  glCopyMultiTexImage2DEXT = PFNGLCOPYMULTITEXIMAGE2DEXTPROC(glfwGetProcAddress("glCopyMultiTexImage2DEXT"));
-  glCopyMultiTexSubImage1DEXT = PFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC(glfwGetProcAddress("glCopyMultiTexSubImage1DEXT"));
-  glCopyMultiTexSubImage2DEXT = PFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC(glfwGetProcAddress("glCopyMultiTexSubImage2DEXT"));
-  glCopyMultiTexSubImage3DEXT = PFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC(glfwGetProcAddress("glCopyMultiTexSubImage3DEXT"));
-  glCopyNamedBufferSubData = PFNGLCOPYNAMEDBUFFERSUBDATAPROC(glfwGetProcAddress("glCopyNamedBufferSubData"));
-  glCopyPathNV = PFNGLCOPYPATHNVPROC(glfwGetProcAddress("glCopyPathNV"));
-  glCopyTexImage1D = PFNGLCOPYTEXIMAGE1DPROC(glfwGetProcAddress("glCopyTexImage1D"));
-  glCopyTexImage2D = PFNGLCOPYTEXIMAGE2DPROC(glfwGetProcAddress("glCopyTexImage2D"));
-  glCopyTexSubImage1D = PFNGLCOPYTEXSUBIMAGE1DPROC(glfwGetProcAddress("glCopyTexSubImage1D"));
-  glCopyTexSubImage2D = PFNGLCOPYTEXSUBIMAGE2DPROC(glfwGetProcAddress("glCopyTexSubImage2D"));
-  glCopyTexSubImage3D = PFNGLCOPYTEXSUBIMAGE3DPROC(glfwGetProcAddress("glCopyTexSubImage3D"));
-  glCopyTextureImage1DEXT = PFNGLCOPYTEXTUREIMAGE1DEXTPROC(glfwGetProcAddress("glCopyTextureImage1DEXT"));
-  glCopyTextureImage2DEXT = PFNGLCOPYTEXTUREIMAGE2DEXTPROC(glfwGetProcAddress("glCopyTextureImage2DEXT"));
-  glCopyTextureSubImage1D = PFNGLCOPYTEXTURESUBIMAGE1DPROC(glfwGetProcAddress("glCopyTextureSubImage1D"));
-  glCopyTextureSubImage1DEXT = PFNGLCOPYTEXTURESUBIMAGE1DEXTPROC(glfwGetProcAddress("glCopyTextureSubImage1DEXT"));
-  glCopyTextureSubImage2D = PFNGLCOPYTEXTURESUBIMAGE2DPROC(glfwGetProcAddress("glCopyTextureSubImage2D"));
-  glCopyTextureSubImage2DEXT = PFNGLCOPYTEXTURESUBIMAGE2DEXTPROC(glfwGetProcAddress("glCopyTextureSubImage2DEXT"));
-  glCopyTextureSubImage3D = PFNGLCOPYTEXTURESUBIMAGE3DPROC(glfwGetProcAddress("glCopyTextureSubImage3D"));
-  glCopyTextureSubImage3DEXT = PFNGLCOPYTEXTURESUBIMAGE3DEXTPROC(glfwGetProcAddress("glCopyTextureSubImage3DEXT"));
-  glCoverFillPathInstancedNV = PFNGLCOVERFILLPATHINSTANCEDNVPROC(glfwGetProcAddress("glCoverFillPathInstancedNV"));
-  glCoverFillPathNV = PFNGLCOVERFILLPATHNVPROC(glfwGetProcAddress("glCoverFillPathNV"));
-  glCoverStrokePathInstancedNV = PFNGLCOVERSTROKEPATHINSTANCEDNVPROC(glfwGetProcAddress("glCoverStrokePathInstancedNV"));
-  glCoverStrokePathNV = PFNGLCOVERSTROKEPATHNVPROC(glfwGetProcAddress("glCoverStrokePathNV"));
-  glCoverageModulationNV = PFNGLCOVERAGEMODULATIONNVPROC(glfwGetProcAddress("glCoverageModulationNV"));
-  glCoverageModulationTableNV = PFNGLCOVERAGEMODULATIONTABLENVPROC(glfwGetProcAddress("glCoverageModulationTableNV"));
-  glCreateBuffers = PFNGLCREATEBUFFERSPROC(glfwGetProcAddress("glCreateBuffers"));
-  glCreateCommandListsNV = PFNGLCREATECOMMANDLISTSNVPROC(glfwGetProcAddress("glCreateCommandListsNV"));
-  glCreateFramebuffers = PFNGLCREATEFRAMEBUFFERSPROC(glfwGetProcAddress("glCreateFramebuffers"));
-  glCreatePerfQueryINTEL = PFNGLCREATEPERFQUERYINTELPROC(glfwGetProcAddress("glCreatePerfQueryINTEL"));
-  glCreateProgram = PFNGLCREATEPROGRAMPROC(glfwGetProcAddress("glCreateProgram"));
-  glCreateProgramPipelines = PFNGLCREATEPROGRAMPIPELINESPROC(glfwGetProcAddress("glCreateProgramPipelines"));
-  glCreateQueries = PFNGLCREATEQUERIESPROC(glfwGetProcAddress("glCreateQueries"));
-  glCreateRenderbuffers = PFNGLCREATERENDERBUFFERSPROC(glfwGetProcAddress("glCreateRenderbuffers"));
-  glCreateSamplers = PFNGLCREATESAMPLERSPROC(glfwGetProcAddress("glCreateSamplers"));
-  glCreateShader = PFNGLCREATESHADERPROC(glfwGetProcAddress("glCreateShader"));
-  glCreateShaderProgramEXT = PFNGLCREATESHADERPROGRAMEXTPROC(glfwGetProcAddress("glCreateShaderProgramEXT"));
-  glCreateShaderProgramv = PFNGLCREATESHADERPROGRAMVPROC(glfwGetProcAddress("glCreateShaderProgramv"));
-  glCreateStatesNV = PFNGLCREATESTATESNVPROC(glfwGetProcAddress("glCreateStatesNV"));
-  glCreateSyncFromCLeventARB = PFNGLCREATESYNCFROMCLEVENTARBPROC(glfwGetProcAddress("glCreateSyncFromCLeventARB"));
-  glCreateTextures = PFNGLCREATETEXTURESPROC(glfwGetProcAddress("glCreateTextures"));
-  glCreateTransformFeedbacks = PFNGLCREATETRANSFORMFEEDBACKSPROC(glfwGetProcAddress("glCreateTransformFeedbacks"));
-  glCreateVertexArrays = PFNGLCREATEVERTEXARRAYSPROC(glfwGetProcAddress("glCreateVertexArrays"));
-  glCullFace = PFNGLCULLFACEPROC(glfwGetProcAddress("glCullFace"));
-  glDebugMessageCallback = PFNGLDEBUGMESSAGECALLBACKPROC(glfwGetProcAddress("glDebugMessageCallback"));
-  glDebugMessageCallbackARB = PFNGLDEBUGMESSAGECALLBACKARBPROC(glfwGetProcAddress("glDebugMessageCallbackARB"));
-  glDebugMessageControl = PFNGLDEBUGMESSAGECONTROLPROC(glfwGetProcAddress("glDebugMessageControl"));
-  glDebugMessageControlARB = PFNGLDEBUGMESSAGECONTROLARBPROC(glfwGetProcAddress("glDebugMessageControlARB"));
-  glDebugMessageInsert = PFNGLDEBUGMESSAGEINSERTPROC(glfwGetProcAddress("glDebugMessageInsert"));
-  glDebugMessageInsertARB = PFNGLDEBUGMESSAGEINSERTARBPROC(glfwGetProcAddress("glDebugMessageInsertARB"));
-  glDeleteBuffers = PFNGLDELETEBUFFERSPROC(glfwGetProcAddress("glDeleteBuffers"));
-  glDeleteCommandListsNV = PFNGLDELETECOMMANDLISTSNVPROC(glfwGetProcAddress("glDeleteCommandListsNV"));
-  glDeleteFramebuffers = PFNGLDELETEFRAMEBUFFERSPROC(glfwGetProcAddress("glDeleteFramebuffers"));
-  glDeleteNamedStringARB = PFNGLDELETENAMEDSTRINGARBPROC(glfwGetProcAddress("glDeleteNamedStringARB"));
-  glDeletePathsNV = PFNGLDELETEPATHSNVPROC(glfwGetProcAddress("glDeletePathsNV"));
-  glDeletePerfMonitorsAMD = PFNGLDELETEPERFMONITORSAMDPROC(glfwGetProcAddress("glDeletePerfMonitorsAMD"));
-  glDeletePerfQueryINTEL = PFNGLDELETEPERFQUERYINTELPROC(glfwGetProcAddress("glDeletePerfQueryINTEL"));
-  glDeleteProgram = PFNGLDELETEPROGRAMPROC(glfwGetProcAddress("glDeleteProgram"));
-  glDeleteProgramPipelines = PFNGLDELETEPROGRAMPIPELINESPROC(glfwGetProcAddress("glDeleteProgramPipelines"));
-  glDeleteQueries = PFNGLDELETEQUERIESPROC(glfwGetProcAddress("glDeleteQueries"));
-  glDeleteRenderbuffers = PFNGLDELETERENDERBUFFERSPROC(glfwGetProcAddress("glDeleteRenderbuffers"));
-  glDeleteSamplers = PFNGLDELETESAMPLERSPROC(glfwGetProcAddress("glDeleteSamplers"));
-  glDeleteShader = PFNGLDELETESHADERPROC(glfwGetProcAddress("glDeleteShader"));
-  glDeleteStatesNV = PFNGLDELETESTATESNVPROC(glfwGetProcAddress("glDeleteStatesNV"));
-  glDeleteSync = PFNGLDELETESYNCPROC(glfwGetProcAddress("glDeleteSync"));
-  glDeleteTextures = PFNGLDELETETEXTURESPROC(glfwGetProcAddress("glDeleteTextures"));
-  glDeleteTransformFeedbacks = PFNGLDELETETRANSFORMFEEDBACKSPROC(glfwGetProcAddress("glDeleteTransformFeedbacks"));
-  glDeleteVertexArrays = PFNGLDELETEVERTEXARRAYSPROC(glfwGetProcAddress("glDeleteVertexArrays"));
-  glDepthFunc = PFNGLDEPTHFUNCPROC(glfwGetProcAddress("glDepthFunc"));
-  glDepthMask = PFNGLDEPTHMASKPROC(glfwGetProcAddress("glDepthMask"));
-  glDepthRange = PFNGLDEPTHRANGEPROC(glfwGetProcAddress("glDepthRange"));
-  glDepthRangeArrayv = PFNGLDEPTHRANGEARRAYVPROC(glfwGetProcAddress("glDepthRangeArrayv"));
-  glDepthRangeIndexed = PFNGLDEPTHRANGEINDEXEDPROC(glfwGetProcAddress("glDepthRangeIndexed"));
-  glDepthRangef = PFNGLDEPTHRANGEFPROC(glfwGetProcAddress("glDepthRangef"));
-  glDetachShader = PFNGLDETACHSHADERPROC(glfwGetProcAddress("glDetachShader"));
-  glDisable = PFNGLDISABLEPROC(glfwGetProcAddress("glDisable"));
-  glDisableClientStateIndexedEXT = PFNGLDISABLECLIENTSTATEINDEXEDEXTPROC(glfwGetProcAddress("glDisableClientStateIndexedEXT"));
-  glDisableClientStateiEXT = PFNGLDISABLECLIENTSTATEIEXTPROC(glfwGetProcAddress("glDisableClientStateiEXT"));
-  glDisableIndexedEXT = PFNGLDISABLEINDEXEDEXTPROC(glfwGetProcAddress("glDisableIndexedEXT"));
-  glDisableVertexArrayAttrib = PFNGLDISABLEVERTEXARRAYATTRIBPROC(glfwGetProcAddress("glDisableVertexArrayAttrib"));
-  glDisableVertexArrayAttribEXT = PFNGLDISABLEVERTEXARRAYATTRIBEXTPROC(glfwGetProcAddress("glDisableVertexArrayAttribEXT"));
-  glDisableVertexArrayEXT = PFNGLDISABLEVERTEXARRAYEXTPROC(glfwGetProcAddress("glDisableVertexArrayEXT"));
-  glDisableVertexAttribArray = PFNGLDISABLEVERTEXATTRIBARRAYPROC(glfwGetProcAddress("glDisableVertexAttribArray"));
-  glDisablei = PFNGLDISABLEIPROC(glfwGetProcAddress("glDisablei"));
-  glDispatchCompute = PFNGLDISPATCHCOMPUTEPROC(glfwGetProcAddress("glDispatchCompute"));
-  glDispatchComputeGroupSizeARB = PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC(glfwGetProcAddress("glDispatchComputeGroupSizeARB"));
-  glDispatchComputeIndirect = PFNGLDISPATCHCOMPUTEINDIRECTPROC(glfwGetProcAddress("glDispatchComputeIndirect"));
-  glDrawArrays = PFNGLDRAWARRAYSPROC(glfwGetProcAddress("glDrawArrays"));
-  glDrawArraysIndirect = PFNGLDRAWARRAYSINDIRECTPROC(glfwGetProcAddress("glDrawArraysIndirect"));
-  glDrawArraysInstanced = PFNGLDRAWARRAYSINSTANCEDPROC(glfwGetProcAddress("glDrawArraysInstanced"));
-  glDrawArraysInstancedARB = PFNGLDRAWARRAYSINSTANCEDARBPROC(glfwGetProcAddress("glDrawArraysInstancedARB"));
-  glDrawArraysInstancedBaseInstance = PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC(glfwGetProcAddress("glDrawArraysInstancedBaseInstance"));
-  glDrawArraysInstancedEXT = PFNGLDRAWARRAYSINSTANCEDEXTPROC(glfwGetProcAddress("glDrawArraysInstancedEXT"));
-  glDrawBuffer = PFNGLDRAWBUFFERPROC(glfwGetProcAddress("glDrawBuffer"));
-  glDrawBuffers = PFNGLDRAWBUFFERSPROC(glfwGetProcAddress("glDrawBuffers"));
-  glDrawCommandsAddressNV = PFNGLDRAWCOMMANDSADDRESSNVPROC(glfwGetProcAddress("glDrawCommandsAddressNV"));
-  glDrawCommandsNV = PFNGLDRAWCOMMANDSNVPROC(glfwGetProcAddress("glDrawCommandsNV"));
-  glDrawCommandsStatesAddressNV = PFNGLDRAWCOMMANDSSTATESADDRESSNVPROC(glfwGetProcAddress("glDrawCommandsStatesAddressNV"));
-  glDrawCommandsStatesNV = PFNGLDRAWCOMMANDSSTATESNVPROC(glfwGetProcAddress("glDrawCommandsStatesNV"));
-  glDrawElements = PFNGLDRAWELEMENTSPROC(glfwGetProcAddress("glDrawElements"));
-  glDrawElementsBaseVertex = PFNGLDRAWELEMENTSBASEVERTEXPROC(glfwGetProcAddress("glDrawElementsBaseVertex"));
-  glDrawElementsIndirect = PFNGLDRAWELEMENTSINDIRECTPROC(glfwGetProcAddress("glDrawElementsIndirect"));
-  glDrawElementsInstanced = PFNGLDRAWELEMENTSINSTANCEDPROC(glfwGetProcAddress("glDrawElementsInstanced"));
-  glDrawElementsInstancedARB = PFNGLDRAWELEMENTSINSTANCEDARBPROC(glfwGetProcAddress("glDrawElementsInstancedARB"));
-  glDrawElementsInstancedBaseInstance = PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC(glfwGetProcAddress("glDrawElementsInstancedBaseInstance"));
-  glDrawElementsInstancedBaseVertex = PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC(glfwGetProcAddress("glDrawElementsInstancedBaseVertex"));
-  glDrawElementsInstancedBaseVertexBaseInstance = PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC(glfwGetProcAddress("glDrawElementsInstancedBaseVertexBaseInstance"));
-  glDrawElementsInstancedEXT = PFNGLDRAWELEMENTSINSTANCEDEXTPROC(glfwGetProcAddress("glDrawElementsInstancedEXT"));
-  glDrawRangeElements = PFNGLDRAWRANGEELEMENTSPROC(glfwGetProcAddress("glDrawRangeElements"));
-  glDrawRangeElementsBaseVertex = PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC(glfwGetProcAddress("glDrawRangeElementsBaseVertex"));
-  glDrawTransformFeedback = PFNGLDRAWTRANSFORMFEEDBACKPROC(glfwGetProcAddress("glDrawTransformFeedback"));
-  glDrawTransformFeedbackInstanced = PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC(glfwGetProcAddress("glDrawTransformFeedbackInstanced"));
-  glDrawTransformFeedbackStream = PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC(glfwGetProcAddress("glDrawTransformFeedbackStream"));
-  glDrawTransformFeedbackStreamInstanced = PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC(glfwGetProcAddress("glDrawTransformFeedbackStreamInstanced"));
-  glDrawVkImageNV = PFNGLDRAWVKIMAGENVPROC(glfwGetProcAddress("glDrawVkImageNV"));
-  glEdgeFlagFormatNV = PFNGLEDGEFLAGFORMATNVPROC(glfwGetProcAddress("glEdgeFlagFormatNV"));
-  glEnable = PFNGLENABLEPROC(glfwGetProcAddress("glEnable"));
-  glEnableClientStateIndexedEXT = PFNGLENABLECLIENTSTATEINDEXEDEXTPROC(glfwGetProcAddress("glEnableClientStateIndexedEXT"));
-  glEnableClientStateiEXT = PFNGLENABLECLIENTSTATEIEXTPROC(glfwGetProcAddress("glEnableClientStateiEXT"));
-  glEnableIndexedEXT = PFNGLENABLEINDEXEDEXTPROC(glfwGetProcAddress("glEnableIndexedEXT"));
-  glEnableVertexArrayAttrib = PFNGLENABLEVERTEXARRAYATTRIBPROC(glfwGetProcAddress("glEnableVertexArrayAttrib"));
-  glEnableVertexArrayAttribEXT = PFNGLENABLEVERTEXARRAYATTRIBEXTPROC(glfwGetProcAddress("glEnableVertexArrayAttribEXT"));
-  glEnableVertexArrayEXT = PFNGLENABLEVERTEXARRAYEXTPROC(glfwGetProcAddress("glEnableVertexArrayEXT"));
-  glEnableVertexAttribArray = PFNGLENABLEVERTEXATTRIBARRAYPROC(glfwGetProcAddress("glEnableVertexAttribArray"));
-  glEnablei = PFNGLENABLEIPROC(glfwGetProcAddress("glEnablei"));
-  glEndConditionalRender = PFNGLENDCONDITIONALRENDERPROC(glfwGetProcAddress("glEndConditionalRender"));
-  glEndConditionalRenderNV = PFNGLENDCONDITIONALRENDERNVPROC(glfwGetProcAddress("glEndConditionalRenderNV"));
-  glEndPerfMonitorAMD = PFNGLENDPERFMONITORAMDPROC(glfwGetProcAddress("glEndPerfMonitorAMD"));
-  glEndPerfQueryINTEL = PFNGLENDPERFQUERYINTELPROC(glfwGetProcAddress("glEndPerfQueryINTEL"));
-  glEndQuery = PFNGLENDQUERYPROC(glfwGetProcAddress("glEndQuery"));
-  glEndQueryIndexed = PFNGLENDQUERYINDEXEDPROC(glfwGetProcAddress("glEndQueryIndexed"));
-  glEndTransformFeedback = PFNGLENDTRANSFORMFEEDBACKPROC(glfwGetProcAddress("glEndTransformFeedback"));
-  glEvaluateDepthValuesARB = PFNGLEVALUATEDEPTHVALUESARBPROC(glfwGetProcAddress("glEvaluateDepthValuesARB"));
-  glFenceSync = PFNGLFENCESYNCPROC(glfwGetProcAddress("glFenceSync"));
-  glFinish = PFNGLFINISHPROC(glfwGetProcAddress("glFinish"));
-  glFlush = PFNGLFLUSHPROC(glfwGetProcAddress("glFlush"));
-  glFlushMappedBufferRange = PFNGLFLUSHMAPPEDBUFFERRANGEPROC(glfwGetProcAddress("glFlushMappedBufferRange"));
-  glFlushMappedNamedBufferRange = PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC(glfwGetProcAddress("glFlushMappedNamedBufferRange"));
-  glFlushMappedNamedBufferRangeEXT = PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC(glfwGetProcAddress("glFlushMappedNamedBufferRangeEXT"));
-  glFogCoordFormatNV = PFNGLFOGCOORDFORMATNVPROC(glfwGetProcAddress("glFogCoordFormatNV"));
-  glFragmentCoverageColorNV = PFNGLFRAGMENTCOVERAGECOLORNVPROC(glfwGetProcAddress("glFragmentCoverageColorNV"));
-  glFramebufferDrawBufferEXT = PFNGLFRAMEBUFFERDRAWBUFFEREXTPROC(glfwGetProcAddress("glFramebufferDrawBufferEXT"));
-  glFramebufferDrawBuffersEXT = PFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC(glfwGetProcAddress("glFramebufferDrawBuffersEXT"));
-  glFramebufferParameteri = PFNGLFRAMEBUFFERPARAMETERIPROC(glfwGetProcAddress("glFramebufferParameteri"));
-  glFramebufferReadBufferEXT = PFNGLFRAMEBUFFERREADBUFFEREXTPROC(glfwGetProcAddress("glFramebufferReadBufferEXT"));
-  glFramebufferRenderbuffer = PFNGLFRAMEBUFFERRENDERBUFFERPROC(glfwGetProcAddress("glFramebufferRenderbuffer"));
-  glFramebufferSampleLocationsfvARB = PFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC(glfwGetProcAddress("glFramebufferSampleLocationsfvARB"));
-  glFramebufferSampleLocationsfvNV = PFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC(glfwGetProcAddress("glFramebufferSampleLocationsfvNV"));
-  glFramebufferTexture = PFNGLFRAMEBUFFERTEXTUREPROC(glfwGetProcAddress("glFramebufferTexture"));
-  glFramebufferTexture1D = PFNGLFRAMEBUFFERTEXTURE1DPROC(glfwGetProcAddress("glFramebufferTexture1D"));
-  glFramebufferTexture2D = PFNGLFRAMEBUFFERTEXTURE2DPROC(glfwGetProcAddress("glFramebufferTexture2D"));
-  glFramebufferTexture3D = PFNGLFRAMEBUFFERTEXTURE3DPROC(glfwGetProcAddress("glFramebufferTexture3D"));
-  glFramebufferTextureARB = PFNGLFRAMEBUFFERTEXTUREARBPROC(glfwGetProcAddress("glFramebufferTextureARB"));
-  glFramebufferTextureFaceARB = PFNGLFRAMEBUFFERTEXTUREFACEARBPROC(glfwGetProcAddress("glFramebufferTextureFaceARB"));
-  glFramebufferTextureLayer = PFNGLFRAMEBUFFERTEXTURELAYERPROC(glfwGetProcAddress("glFramebufferTextureLayer"));
-  glFramebufferTextureLayerARB = PFNGLFRAMEBUFFERTEXTURELAYERARBPROC(glfwGetProcAddress("glFramebufferTextureLayerARB"));
-  glFramebufferTextureMultiviewOVR = PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC(glfwGetProcAddress("glFramebufferTextureMultiviewOVR"));
-  glFrontFace = PFNGLFRONTFACEPROC(glfwGetProcAddress("glFrontFace"));
-  glGenBuffers = PFNGLGENBUFFERSPROC(glfwGetProcAddress("glGenBuffers"));
-  glGenFramebuffers = PFNGLGENFRAMEBUFFERSPROC(glfwGetProcAddress("glGenFramebuffers"));
-  glGenPathsNV = PFNGLGENPATHSNVPROC(glfwGetProcAddress("glGenPathsNV"));
-  glGenPerfMonitorsAMD = PFNGLGENPERFMONITORSAMDPROC(glfwGetProcAddress("glGenPerfMonitorsAMD"));
-  glGenProgramPipelines = PFNGLGENPROGRAMPIPELINESPROC(glfwGetProcAddress("glGenProgramPipelines"));
-  glGenQueries = PFNGLGENQUERIESPROC(glfwGetProcAddress("glGenQueries"));
-  glGenRenderbuffers = PFNGLGENRENDERBUFFERSPROC(glfwGetProcAddress("glGenRenderbuffers"));
-  glGenSamplers = PFNGLGENSAMPLERSPROC(glfwGetProcAddress("glGenSamplers"));
-  glGenTextures = PFNGLGENTEXTURESPROC(glfwGetProcAddress("glGenTextures"));
-  glGenTransformFeedbacks = PFNGLGENTRANSFORMFEEDBACKSPROC(glfwGetProcAddress("glGenTransformFeedbacks"));
-  glGenVertexArrays = PFNGLGENVERTEXARRAYSPROC(glfwGetProcAddress("glGenVertexArrays"));
-  glGenerateMipmap = PFNGLGENERATEMIPMAPPROC(glfwGetProcAddress("glGenerateMipmap"));
-  glGenerateMultiTexMipmapEXT = PFNGLGENERATEMULTITEXMIPMAPEXTPROC(glfwGetProcAddress("glGenerateMultiTexMipmapEXT"));
-  glGenerateTextureMipmap = PFNGLGENERATETEXTUREMIPMAPPROC(glfwGetProcAddress("glGenerateTextureMipmap"));
-  glGenerateTextureMipmapEXT = PFNGLGENERATETEXTUREMIPMAPEXTPROC(glfwGetProcAddress("glGenerateTextureMipmapEXT"));
-  glGetActiveAtomicCounterBufferiv = PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC(glfwGetProcAddress("glGetActiveAtomicCounterBufferiv"));
-  glGetActiveAttrib = PFNGLGETACTIVEATTRIBPROC(glfwGetProcAddress("glGetActiveAttrib"));
-  glGetActiveSubroutineName = PFNGLGETACTIVESUBROUTINENAMEPROC(glfwGetProcAddress("glGetActiveSubroutineName"));
-  glGetActiveSubroutineUniformName = PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC(glfwGetProcAddress("glGetActiveSubroutineUniformName"));
-  glGetActiveSubroutineUniformiv = PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC(glfwGetProcAddress("glGetActiveSubroutineUniformiv"));
-  glGetActiveUniform = PFNGLGETACTIVEUNIFORMPROC(glfwGetProcAddress("glGetActiveUniform"));
-  glGetActiveUniformBlockName = PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC(glfwGetProcAddress("glGetActiveUniformBlockName"));
-  glGetActiveUniformBlockiv = PFNGLGETACTIVEUNIFORMBLOCKIVPROC(glfwGetProcAddress("glGetActiveUniformBlockiv"));
-  glGetActiveUniformName = PFNGLGETACTIVEUNIFORMNAMEPROC(glfwGetProcAddress("glGetActiveUniformName"));
-  glGetActiveUniformsiv = PFNGLGETACTIVEUNIFORMSIVPROC(glfwGetProcAddress("glGetActiveUniformsiv"));
-  glGetAttachedShaders = PFNGLGETATTACHEDSHADERSPROC(glfwGetProcAddress("glGetAttachedShaders"));
-  glGetAttribLocation = PFNGLGETATTRIBLOCATIONPROC(glfwGetProcAddress("glGetAttribLocation"));
-  glGetBooleanIndexedvEXT = PFNGLGETBOOLEANINDEXEDVEXTPROC(glfwGetProcAddress("glGetBooleanIndexedvEXT"));
-  glGetBooleani_v = PFNGLGETBOOLEANI_VPROC(glfwGetProcAddress("glGetBooleani_v"));
-  glGetBooleanv = PFNGLGETBOOLEANVPROC(glfwGetProcAddress("glGetBooleanv"));
-  glGetBufferParameteri64v = PFNGLGETBUFFERPARAMETERI64VPROC(glfwGetProcAddress("glGetBufferParameteri64v"));
-  glGetBufferParameteriv = PFNGLGETBUFFERPARAMETERIVPROC(glfwGetProcAddress("glGetBufferParameteriv"));
-  glGetBufferParameterui64vNV = PFNGLGETBUFFERPARAMETERUI64VNVPROC(glfwGetProcAddress("glGetBufferParameterui64vNV"));
-  glGetBufferPointerv = PFNGLGETBUFFERPOINTERVPROC(glfwGetProcAddress("glGetBufferPointerv"));
-  glGetBufferSubData = PFNGLGETBUFFERSUBDATAPROC(glfwGetProcAddress("glGetBufferSubData"));
-  glGetCommandHeaderNV = PFNGLGETCOMMANDHEADERNVPROC(glfwGetProcAddress("glGetCommandHeaderNV"));
-  glGetCompressedMultiTexImageEXT = PFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC(glfwGetProcAddress("glGetCompressedMultiTexImageEXT"));
-  glGetCompressedTexImage = PFNGLGETCOMPRESSEDTEXIMAGEPROC(glfwGetProcAddress("glGetCompressedTexImage"));
-  glGetCompressedTextureImage = PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC(glfwGetProcAddress("glGetCompressedTextureImage"));
-  glGetCompressedTextureImageEXT = PFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC(glfwGetProcAddress("glGetCompressedTextureImageEXT"));
-  glGetCompressedTextureSubImage = PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC(glfwGetProcAddress("glGetCompressedTextureSubImage"));
-  glGetCoverageModulationTableNV = PFNGLGETCOVERAGEMODULATIONTABLENVPROC(glfwGetProcAddress("glGetCoverageModulationTableNV"));
-  glGetDebugMessageLog = PFNGLGETDEBUGMESSAGELOGPROC(glfwGetProcAddress("glGetDebugMessageLog"));
-  glGetDebugMessageLogARB = PFNGLGETDEBUGMESSAGELOGARBPROC(glfwGetProcAddress("glGetDebugMessageLogARB"));
-  glGetDoubleIndexedvEXT = PFNGLGETDOUBLEINDEXEDVEXTPROC(glfwGetProcAddress("glGetDoubleIndexedvEXT"));
-  glGetDoublei_v = PFNGLGETDOUBLEI_VPROC(glfwGetProcAddress("glGetDoublei_v"));
-  glGetDoublei_vEXT = PFNGLGETDOUBLEI_VEXTPROC(glfwGetProcAddress("glGetDoublei_vEXT"));
-  glGetDoublev = PFNGLGETDOUBLEVPROC(glfwGetProcAddress("glGetDoublev"));
-  glGetError = PFNGLGETERRORPROC(glfwGetProcAddress("glGetError"));
-  glGetFirstPerfQueryIdINTEL = PFNGLGETFIRSTPERFQUERYIDINTELPROC(glfwGetProcAddress("glGetFirstPerfQueryIdINTEL"));
-  glGetFloatIndexedvEXT = PFNGLGETFLOATINDEXEDVEXTPROC(glfwGetProcAddress("glGetFloatIndexedvEXT"));
-  glGetFloati_v = PFNGLGETFLOATI_VPROC(glfwGetProcAddress("glGetFloati_v"));
-  glGetFloati_vEXT = PFNGLGETFLOATI_VEXTPROC(glfwGetProcAddress("glGetFloati_vEXT"));
-  glGetFloatv = PFNGLGETFLOATVPROC(glfwGetProcAddress("glGetFloatv"));
-  glGetFragDataIndex = PFNGLGETFRAGDATAINDEXPROC(glfwGetProcAddress("glGetFragDataIndex"));
-  glGetFragDataLocation = PFNGLGETFRAGDATALOCATIONPROC(glfwGetProcAddress("glGetFragDataLocation"));
-  glGetFramebufferAttachmentParameteriv = PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC(glfwGetProcAddress("glGetFramebufferAttachmentParameteriv"));
-  glGetFramebufferParameteriv = PFNGLGETFRAMEBUFFERPARAMETERIVPROC(glfwGetProcAddress("glGetFramebufferParameteriv"));
-  glGetFramebufferParameterivEXT = PFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC(glfwGetProcAddress("glGetFramebufferParameterivEXT"));
-  glGetGraphicsResetStatus = PFNGLGETGRAPHICSRESETSTATUSPROC(glfwGetProcAddress("glGetGraphicsResetStatus"));
-  glGetGraphicsResetStatusARB = PFNGLGETGRAPHICSRESETSTATUSARBPROC(glfwGetProcAddress("glGetGraphicsResetStatusARB"));
-  glGetImageHandleARB = PFNGLGETIMAGEHANDLEARBPROC(glfwGetProcAddress("glGetImageHandleARB"));
-  glGetImageHandleNV = PFNGLGETIMAGEHANDLENVPROC(glfwGetProcAddress("glGetImageHandleNV"));
-  glGetInteger64i_v = PFNGLGETINTEGER64I_VPROC(glfwGetProcAddress("glGetInteger64i_v"));
-  glGetInteger64v = PFNGLGETINTEGER64VPROC(glfwGetProcAddress("glGetInteger64v"));
-  glGetIntegerIndexedvEXT = PFNGLGETINTEGERINDEXEDVEXTPROC(glfwGetProcAddress("glGetIntegerIndexedvEXT"));
-  glGetIntegeri_v = PFNGLGETINTEGERI_VPROC(glfwGetProcAddress("glGetIntegeri_v"));
-  glGetIntegerui64i_vNV = PFNGLGETINTEGERUI64I_VNVPROC(glfwGetProcAddress("glGetIntegerui64i_vNV"));
-  glGetIntegerui64vNV = PFNGLGETINTEGERUI64VNVPROC(glfwGetProcAddress("glGetIntegerui64vNV"));
-  glGetIntegerv = PFNGLGETINTEGERVPROC(glfwGetProcAddress("glGetIntegerv"));
-  glGetInternalformatSampleivNV = PFNGLGETINTERNALFORMATSAMPLEIVNVPROC(glfwGetProcAddress("glGetInternalformatSampleivNV"));
-  glGetInternalformati64v = PFNGLGETINTERNALFORMATI64VPROC(glfwGetProcAddress("glGetInternalformati64v"));
-  glGetInternalformativ = PFNGLGETINTERNALFORMATIVPROC(glfwGetProcAddress("glGetInternalformativ"));
-  glGetMultiTexEnvfvEXT = PFNGLGETMULTITEXENVFVEXTPROC(glfwGetProcAddress("glGetMultiTexEnvfvEXT"));
-  glGetMultiTexEnvivEXT = PFNGLGETMULTITEXENVIVEXTPROC(glfwGetProcAddress("glGetMultiTexEnvivEXT"));
-  glGetMultiTexGendvEXT = PFNGLGETMULTITEXGENDVEXTPROC(glfwGetProcAddress("glGetMultiTexGendvEXT"));
-  glGetMultiTexGenfvEXT = PFNGLGETMULTITEXGENFVEXTPROC(glfwGetProcAddress("glGetMultiTexGenfvEXT"));
-  glGetMultiTexGenivEXT = PFNGLGETMULTITEXGENIVEXTPROC(glfwGetProcAddress("glGetMultiTexGenivEXT"));
-  glGetMultiTexImageEXT = PFNGLGETMULTITEXIMAGEEXTPROC(glfwGetProcAddress("glGetMultiTexImageEXT"));
-  glGetMultiTexLevelParameterfvEXT = PFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC(glfwGetProcAddress("glGetMultiTexLevelParameterfvEXT"));
-  glGetMultiTexLevelParameterivEXT = PFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC(glfwGetProcAddress("glGetMultiTexLevelParameterivEXT"));
-  glGetMultiTexParameterIivEXT = PFNGLGETMULTITEXPARAMETERIIVEXTPROC(glfwGetProcAddress("glGetMultiTexParameterIivEXT"));
-  glGetMultiTexParameterIuivEXT = PFNGLGETMULTITEXPARAMETERIUIVEXTPROC(glfwGetProcAddress("glGetMultiTexParameterIuivEXT"));
-  glGetMultiTexParameterfvEXT = PFNGLGETMULTITEXPARAMETERFVEXTPROC(glfwGetProcAddress("glGetMultiTexParameterfvEXT"));
-  glGetMultiTexParameterivEXT = PFNGLGETMULTITEXPARAMETERIVEXTPROC(glfwGetProcAddress("glGetMultiTexParameterivEXT"));
-  glGetMultisamplefv = PFNGLGETMULTISAMPLEFVPROC(glfwGetProcAddress("glGetMultisamplefv"));
-  glGetNamedBufferParameteri64v = PFNGLGETNAMEDBUFFERPARAMETERI64VPROC(glfwGetProcAddress("glGetNamedBufferParameteri64v"));
-  glGetNamedBufferParameteriv = PFNGLGETNAMEDBUFFERPARAMETERIVPROC(glfwGetProcAddress("glGetNamedBufferParameteriv"));
-  glGetNamedBufferParameterivEXT = PFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC(glfwGetProcAddress("glGetNamedBufferParameterivEXT"));
-  glGetNamedBufferParameterui64vNV = PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC(glfwGetProcAddress("glGetNamedBufferParameterui64vNV"));
-  glGetNamedBufferPointerv = PFNGLGETNAMEDBUFFERPOINTERVPROC(glfwGetProcAddress("glGetNamedBufferPointerv"));
-  glGetNamedBufferPointervEXT = PFNGLGETNAMEDBUFFERPOINTERVEXTPROC(glfwGetProcAddress("glGetNamedBufferPointervEXT"));
-  glGetNamedBufferSubData = PFNGLGETNAMEDBUFFERSUBDATAPROC(glfwGetProcAddress("glGetNamedBufferSubData"));
-  glGetNamedBufferSubDataEXT = PFNGLGETNAMEDBUFFERSUBDATAEXTPROC(glfwGetProcAddress("glGetNamedBufferSubDataEXT"));
-  glGetNamedFramebufferAttachmentParameteriv = PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC(glfwGetProcAddress("glGetNamedFramebufferAttachmentParameteriv"));
-  glGetNamedFramebufferAttachmentParameterivEXT = PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC(glfwGetProcAddress("glGetNamedFramebufferAttachmentParameterivEXT"));
-  glGetNamedFramebufferParameteriv = PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC(glfwGetProcAddress("glGetNamedFramebufferParameteriv"));
-  glGetNamedFramebufferParameterivEXT = PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC(glfwGetProcAddress("glGetNamedFramebufferParameterivEXT"));
-  glGetNamedProgramLocalParameterIivEXT = PFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC(glfwGetProcAddress("glGetNamedProgramLocalParameterIivEXT"));
-  glGetNamedProgramLocalParameterIuivEXT = PFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC(glfwGetProcAddress("glGetNamedProgramLocalParameterIuivEXT"));
-  glGetNamedProgramLocalParameterdvEXT = PFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC(glfwGetProcAddress("glGetNamedProgramLocalParameterdvEXT"));
-  glGetNamedProgramLocalParameterfvEXT = PFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC(glfwGetProcAddress("glGetNamedProgramLocalParameterfvEXT"));
-  glGetNamedProgramStringEXT = PFNGLGETNAMEDPROGRAMSTRINGEXTPROC(glfwGetProcAddress("glGetNamedProgramStringEXT"));
-  glGetNamedProgramivEXT = PFNGLGETNAMEDPROGRAMIVEXTPROC(glfwGetProcAddress("glGetNamedProgramivEXT"));
-  glGetNamedRenderbufferParameteriv = PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC(glfwGetProcAddress("glGetNamedRenderbufferParameteriv"));
-  glGetNamedRenderbufferParameterivEXT = PFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC(glfwGetProcAddress("glGetNamedRenderbufferParameterivEXT"));
-  glGetNamedStringARB = PFNGLGETNAMEDSTRINGARBPROC(glfwGetProcAddress("glGetNamedStringARB"));
-  glGetNamedStringivARB = PFNGLGETNAMEDSTRINGIVARBPROC(glfwGetProcAddress("glGetNamedStringivARB"));
-  glGetNextPerfQueryIdINTEL = PFNGLGETNEXTPERFQUERYIDINTELPROC(glfwGetProcAddress("glGetNextPerfQueryIdINTEL"));
-  glGetObjectLabel = PFNGLGETOBJECTLABELPROC(glfwGetProcAddress("glGetObjectLabel"));
-  glGetObjectLabelEXT = PFNGLGETOBJECTLABELEXTPROC(glfwGetProcAddress("glGetObjectLabelEXT"));
-  glGetObjectPtrLabel = PFNGLGETOBJECTPTRLABELPROC(glfwGetProcAddress("glGetObjectPtrLabel"));
-  glGetPathCommandsNV = PFNGLGETPATHCOMMANDSNVPROC(glfwGetProcAddress("glGetPathCommandsNV"));
-  glGetPathCoordsNV = PFNGLGETPATHCOORDSNVPROC(glfwGetProcAddress("glGetPathCoordsNV"));
-  glGetPathDashArrayNV = PFNGLGETPATHDASHARRAYNVPROC(glfwGetProcAddress("glGetPathDashArrayNV"));
-  glGetPathLengthNV = PFNGLGETPATHLENGTHNVPROC(glfwGetProcAddress("glGetPathLengthNV"));
-  glGetPathMetricRangeNV = PFNGLGETPATHMETRICRANGENVPROC(glfwGetProcAddress("glGetPathMetricRangeNV"));
-  glGetPathMetricsNV = PFNGLGETPATHMETRICSNVPROC(glfwGetProcAddress("glGetPathMetricsNV"));
-  glGetPathParameterfvNV = PFNGLGETPATHPARAMETERFVNVPROC(glfwGetProcAddress("glGetPathParameterfvNV"));
-  glGetPathParameterivNV = PFNGLGETPATHPARAMETERIVNVPROC(glfwGetProcAddress("glGetPathParameterivNV"));
-  glGetPathSpacingNV = PFNGLGETPATHSPACINGNVPROC(glfwGetProcAddress("glGetPathSpacingNV"));
-  glGetPerfCounterInfoINTEL = PFNGLGETPERFCOUNTERINFOINTELPROC(glfwGetProcAddress("glGetPerfCounterInfoINTEL"));
-  glGetPerfMonitorCounterDataAMD = PFNGLGETPERFMONITORCOUNTERDATAAMDPROC(glfwGetProcAddress("glGetPerfMonitorCounterDataAMD"));
-  glGetPerfMonitorCounterInfoAMD = PFNGLGETPERFMONITORCOUNTERINFOAMDPROC(glfwGetProcAddress("glGetPerfMonitorCounterInfoAMD"));
-  glGetPerfMonitorCounterStringAMD = PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC(glfwGetProcAddress("glGetPerfMonitorCounterStringAMD"));
-  glGetPerfMonitorCountersAMD = PFNGLGETPERFMONITORCOUNTERSAMDPROC(glfwGetProcAddress("glGetPerfMonitorCountersAMD"));
-  glGetPerfMonitorGroupStringAMD = PFNGLGETPERFMONITORGROUPSTRINGAMDPROC(glfwGetProcAddress("glGetPerfMonitorGroupStringAMD"));
-  glGetPerfMonitorGroupsAMD = PFNGLGETPERFMONITORGROUPSAMDPROC(glfwGetProcAddress("glGetPerfMonitorGroupsAMD"));
-  glGetPerfQueryDataINTEL = PFNGLGETPERFQUERYDATAINTELPROC(glfwGetProcAddress("glGetPerfQueryDataINTEL"));
-  glGetPerfQueryIdByNameINTEL = PFNGLGETPERFQUERYIDBYNAMEINTELPROC(glfwGetProcAddress("glGetPerfQueryIdByNameINTEL"));
-  glGetPerfQueryInfoINTEL = PFNGLGETPERFQUERYINFOINTELPROC(glfwGetProcAddress("glGetPerfQueryInfoINTEL"));
-  glGetPointerIndexedvEXT = PFNGLGETPOINTERINDEXEDVEXTPROC(glfwGetProcAddress("glGetPointerIndexedvEXT"));
-  glGetPointeri_vEXT = PFNGLGETPOINTERI_VEXTPROC(glfwGetProcAddress("glGetPointeri_vEXT"));
-  glGetPointerv = PFNGLGETPOINTERVPROC(glfwGetProcAddress("glGetPointerv"));
-  glGetProgramBinary = PFNGLGETPROGRAMBINARYPROC(glfwGetProcAddress("glGetProgramBinary"));
-  glGetProgramInfoLog = PFNGLGETPROGRAMINFOLOGPROC(glfwGetProcAddress("glGetProgramInfoLog"));
-  glGetProgramInterfaceiv = PFNGLGETPROGRAMINTERFACEIVPROC(glfwGetProcAddress("glGetProgramInterfaceiv"));
-  glGetProgramPipelineInfoLog = PFNGLGETPROGRAMPIPELINEINFOLOGPROC(glfwGetProcAddress("glGetProgramPipelineInfoLog"));
-  glGetProgramPipelineiv = PFNGLGETPROGRAMPIPELINEIVPROC(glfwGetProcAddress("glGetProgramPipelineiv"));
-  glGetProgramResourceIndex = PFNGLGETPROGRAMRESOURCEINDEXPROC(glfwGetProcAddress("glGetProgramResourceIndex"));
-  glGetProgramResourceLocation = PFNGLGETPROGRAMRESOURCELOCATIONPROC(glfwGetProcAddress("glGetProgramResourceLocation"));
-  glGetProgramResourceLocationIndex = PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC(glfwGetProcAddress("glGetProgramResourceLocationIndex"));
-  glGetProgramResourceName = PFNGLGETPROGRAMRESOURCENAMEPROC(glfwGetProcAddress("glGetProgramResourceName"));
-  glGetProgramResourcefvNV = PFNGLGETPROGRAMRESOURCEFVNVPROC(glfwGetProcAddress("glGetProgramResourcefvNV"));
-  glGetProgramResourceiv = PFNGLGETPROGRAMRESOURCEIVPROC(glfwGetProcAddress("glGetProgramResourceiv"));
-  glGetProgramStageiv = PFNGLGETPROGRAMSTAGEIVPROC(glfwGetProcAddress("glGetProgramStageiv"));
-  glGetProgramiv = PFNGLGETPROGRAMIVPROC(glfwGetProcAddress("glGetProgramiv"));
-  glGetQueryBufferObjecti64v = PFNGLGETQUERYBUFFEROBJECTI64VPROC(glfwGetProcAddress("glGetQueryBufferObjecti64v"));
-  glGetQueryBufferObjectiv = PFNGLGETQUERYBUFFEROBJECTIVPROC(glfwGetProcAddress("glGetQueryBufferObjectiv"));
-  glGetQueryBufferObjectui64v = PFNGLGETQUERYBUFFEROBJECTUI64VPROC(glfwGetProcAddress("glGetQueryBufferObjectui64v"));
-  glGetQueryBufferObjectuiv = PFNGLGETQUERYBUFFEROBJECTUIVPROC(glfwGetProcAddress("glGetQueryBufferObjectuiv"));
-  glGetQueryIndexediv = PFNGLGETQUERYINDEXEDIVPROC(glfwGetProcAddress("glGetQueryIndexediv"));
-  glGetQueryObjecti64v = PFNGLGETQUERYOBJECTI64VPROC(glfwGetProcAddress("glGetQueryObjecti64v"));
-  glGetQueryObjectiv = PFNGLGETQUERYOBJECTIVPROC(glfwGetProcAddress("glGetQueryObjectiv"));
-  glGetQueryObjectui64v = PFNGLGETQUERYOBJECTUI64VPROC(glfwGetProcAddress("glGetQueryObjectui64v"));
-  glGetQueryObjectuiv = PFNGLGETQUERYOBJECTUIVPROC(glfwGetProcAddress("glGetQueryObjectuiv"));
-  glGetQueryiv = PFNGLGETQUERYIVPROC(glfwGetProcAddress("glGetQueryiv"));
-  glGetRenderbufferParameteriv = PFNGLGETRENDERBUFFERPARAMETERIVPROC(glfwGetProcAddress("glGetRenderbufferParameteriv"));
-  glGetSamplerParameterIiv = PFNGLGETSAMPLERPARAMETERIIVPROC(glfwGetProcAddress("glGetSamplerParameterIiv"));
-  glGetSamplerParameterIuiv = PFNGLGETSAMPLERPARAMETERIUIVPROC(glfwGetProcAddress("glGetSamplerParameterIuiv"));
-  glGetSamplerParameterfv = PFNGLGETSAMPLERPARAMETERFVPROC(glfwGetProcAddress("glGetSamplerParameterfv"));
-  glGetSamplerParameteriv = PFNGLGETSAMPLERPARAMETERIVPROC(glfwGetProcAddress("glGetSamplerParameteriv"));
-  glGetShaderInfoLog = PFNGLGETSHADERINFOLOGPROC(glfwGetProcAddress("glGetShaderInfoLog"));
-  glGetShaderPrecisionFormat = PFNGLGETSHADERPRECISIONFORMATPROC(glfwGetProcAddress("glGetShaderPrecisionFormat"));
-  glGetShaderSource = PFNGLGETSHADERSOURCEPROC(glfwGetProcAddress("glGetShaderSource"));
-  glGetShaderiv = PFNGLGETSHADERIVPROC(glfwGetProcAddress("glGetShaderiv"));
-  glGetStageIndexNV = PFNGLGETSTAGEINDEXNVPROC(glfwGetProcAddress("glGetStageIndexNV"));
-  glGetString = PFNGLGETSTRINGPROC(glfwGetProcAddress("glGetString"));
-  glGetStringi = PFNGLGETSTRINGIPROC(glfwGetProcAddress("glGetStringi"));
-  glGetSubroutineIndex = PFNGLGETSUBROUTINEINDEXPROC(glfwGetProcAddress("glGetSubroutineIndex"));
-  glGetSubroutineUniformLocation = PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC(glfwGetProcAddress("glGetSubroutineUniformLocation"));
-  glGetSynciv = PFNGLGETSYNCIVPROC(glfwGetProcAddress("glGetSynciv"));
-  glGetTexImage = PFNGLGETTEXIMAGEPROC(glfwGetProcAddress("glGetTexImage"));
-  glGetTexLevelParameterfv = PFNGLGETTEXLEVELPARAMETERFVPROC(glfwGetProcAddress("glGetTexLevelParameterfv"));
-  glGetTexLevelParameteriv = PFNGLGETTEXLEVELPARAMETERIVPROC(glfwGetProcAddress("glGetTexLevelParameteriv"));
-  glGetTexParameterIiv = PFNGLGETTEXPARAMETERIIVPROC(glfwGetProcAddress("glGetTexParameterIiv"));
-  glGetTexParameterIuiv = PFNGLGETTEXPARAMETERIUIVPROC(glfwGetProcAddress("glGetTexParameterIuiv"));
-  glGetTexParameterfv = PFNGLGETTEXPARAMETERFVPROC(glfwGetProcAddress("glGetTexParameterfv"));
-  glGetTexParameteriv = PFNGLGETTEXPARAMETERIVPROC(glfwGetProcAddress("glGetTexParameteriv"));
-  glGetTextureHandleARB = PFNGLGETTEXTUREHANDLEARBPROC(glfwGetProcAddress("glGetTextureHandleARB"));
-  glGetTextureHandleNV = PFNGLGETTEXTUREHANDLENVPROC(glfwGetProcAddress("glGetTextureHandleNV"));
-  glGetTextureImage = PFNGLGETTEXTUREIMAGEPROC(glfwGetProcAddress("glGetTextureImage"));
-  glGetTextureImageEXT = PFNGLGETTEXTUREIMAGEEXTPROC(glfwGetProcAddress("glGetTextureImageEXT"));
-  glGetTextureLevelParameterfv = PFNGLGETTEXTURELEVELPARAMETERFVPROC(glfwGetProcAddress("glGetTextureLevelParameterfv"));
-  glGetTextureLevelParameterfvEXT = PFNGLGETTEXTURELEVELPARAMETERFVEXTPROC(glfwGetProcAddress("glGetTextureLevelParameterfvEXT"));
-  glGetTextureLevelParameteriv = PFNGLGETTEXTURELEVELPARAMETERIVPROC(glfwGetProcAddress("glGetTextureLevelParameteriv"));
-  glGetTextureLevelParameterivEXT = PFNGLGETTEXTURELEVELPARAMETERIVEXTPROC(glfwGetProcAddress("glGetTextureLevelParameterivEXT"));
-  glGetTextureParameterIiv = PFNGLGETTEXTUREPARAMETERIIVPROC(glfwGetProcAddress("glGetTextureParameterIiv"));
-  glGetTextureParameterIivEXT = PFNGLGETTEXTUREPARAMETERIIVEXTPROC(glfwGetProcAddress("glGetTextureParameterIivEXT"));
-  glGetTextureParameterIuiv = PFNGLGETTEXTUREPARAMETERIUIVPROC(glfwGetProcAddress("glGetTextureParameterIuiv"));
-  glGetTextureParameterIuivEXT = PFNGLGETTEXTUREPARAMETERIUIVEXTPROC(glfwGetProcAddress("glGetTextureParameterIuivEXT"));
-  glGetTextureParameterfv = PFNGLGETTEXTUREPARAMETERFVPROC(glfwGetProcAddress("glGetTextureParameterfv"));
-  glGetTextureParameterfvEXT = PFNGLGETTEXTUREPARAMETERFVEXTPROC(glfwGetProcAddress("glGetTextureParameterfvEXT"));
-  glGetTextureParameteriv = PFNGLGETTEXTUREPARAMETERIVPROC(glfwGetProcAddress("glGetTextureParameteriv"));
-  glGetTextureParameterivEXT = PFNGLGETTEXTUREPARAMETERIVEXTPROC(glfwGetProcAddress("glGetTextureParameterivEXT"));
-  glGetTextureSamplerHandleARB = PFNGLGETTEXTURESAMPLERHANDLEARBPROC(glfwGetProcAddress("glGetTextureSamplerHandleARB"));
-  glGetTextureSamplerHandleNV = PFNGLGETTEXTURESAMPLERHANDLENVPROC(glfwGetProcAddress("glGetTextureSamplerHandleNV"));
-  glGetTextureSubImage = PFNGLGETTEXTURESUBIMAGEPROC(glfwGetProcAddress("glGetTextureSubImage"));
-  glGetTransformFeedbackVarying = PFNGLGETTRANSFORMFEEDBACKVARYINGPROC(glfwGetProcAddress("glGetTransformFeedbackVarying"));
-  glGetTransformFeedbacki64_v = PFNGLGETTRANSFORMFEEDBACKI64_VPROC(glfwGetProcAddress("glGetTransformFeedbacki64_v"));
-  glGetTransformFeedbacki_v = PFNGLGETTRANSFORMFEEDBACKI_VPROC(glfwGetProcAddress("glGetTransformFeedbacki_v"));
-  glGetTransformFeedbackiv = PFNGLGETTRANSFORMFEEDBACKIVPROC(glfwGetProcAddress("glGetTransformFeedbackiv"));
-  glGetUniformBlockIndex = PFNGLGETUNIFORMBLOCKINDEXPROC(glfwGetProcAddress("glGetUniformBlockIndex"));
-  glGetUniformIndices = PFNGLGETUNIFORMINDICESPROC(glfwGetProcAddress("glGetUniformIndices"));
-  glGetUniformLocation = PFNGLGETUNIFORMLOCATIONPROC(glfwGetProcAddress("glGetUniformLocation"));
-  glGetUniformSubroutineuiv = PFNGLGETUNIFORMSUBROUTINEUIVPROC(glfwGetProcAddress("glGetUniformSubroutineuiv"));
-  glGetUniformdv = PFNGLGETUNIFORMDVPROC(glfwGetProcAddress("glGetUniformdv"));
-  glGetUniformfv = PFNGLGETUNIFORMFVPROC(glfwGetProcAddress("glGetUniformfv"));
-  glGetUniformi64vARB = PFNGLGETUNIFORMI64VARBPROC(glfwGetProcAddress("glGetUniformi64vARB"));
-  glGetUniformi64vNV = PFNGLGETUNIFORMI64VNVPROC(glfwGetProcAddress("glGetUniformi64vNV"));
-  glGetUniformiv = PFNGLGETUNIFORMIVPROC(glfwGetProcAddress("glGetUniformiv"));
-  glGetUniformui64vARB = PFNGLGETUNIFORMUI64VARBPROC(glfwGetProcAddress("glGetUniformui64vARB"));
-  glGetUniformui64vNV = PFNGLGETUNIFORMUI64VNVPROC(glfwGetProcAddress("glGetUniformui64vNV"));
-  glGetUniformuiv = PFNGLGETUNIFORMUIVPROC(glfwGetProcAddress("glGetUniformuiv"));
-  glGetVertexArrayIndexed64iv = PFNGLGETVERTEXARRAYINDEXED64IVPROC(glfwGetProcAddress("glGetVertexArrayIndexed64iv"));
-  glGetVertexArrayIndexediv = PFNGLGETVERTEXARRAYINDEXEDIVPROC(glfwGetProcAddress("glGetVertexArrayIndexediv"));
-  glGetVertexArrayIntegeri_vEXT = PFNGLGETVERTEXARRAYINTEGERI_VEXTPROC(glfwGetProcAddress("glGetVertexArrayIntegeri_vEXT"));
-  glGetVertexArrayIntegervEXT = PFNGLGETVERTEXARRAYINTEGERVEXTPROC(glfwGetProcAddress("glGetVertexArrayIntegervEXT"));
-  glGetVertexArrayPointeri_vEXT = PFNGLGETVERTEXARRAYPOINTERI_VEXTPROC(glfwGetProcAddress("glGetVertexArrayPointeri_vEXT"));
-  glGetVertexArrayPointervEXT = PFNGLGETVERTEXARRAYPOINTERVEXTPROC(glfwGetProcAddress("glGetVertexArrayPointervEXT"));
-  glGetVertexArrayiv = PFNGLGETVERTEXARRAYIVPROC(glfwGetProcAddress("glGetVertexArrayiv"));
-  glGetVertexAttribIiv = PFNGLGETVERTEXATTRIBIIVPROC(glfwGetProcAddress("glGetVertexAttribIiv"));
-  glGetVertexAttribIuiv = PFNGLGETVERTEXATTRIBIUIVPROC(glfwGetProcAddress("glGetVertexAttribIuiv"));
-  glGetVertexAttribLdv = PFNGLGETVERTEXATTRIBLDVPROC(glfwGetProcAddress("glGetVertexAttribLdv"));
-  glGetVertexAttribLi64vNV = PFNGLGETVERTEXATTRIBLI64VNVPROC(glfwGetProcAddress("glGetVertexAttribLi64vNV"));
-  glGetVertexAttribLui64vARB = PFNGLGETVERTEXATTRIBLUI64VARBPROC(glfwGetProcAddress("glGetVertexAttribLui64vARB"));
-  glGetVertexAttribLui64vNV = PFNGLGETVERTEXATTRIBLUI64VNVPROC(glfwGetProcAddress("glGetVertexAttribLui64vNV"));
-  glGetVertexAttribPointerv = PFNGLGETVERTEXATTRIBPOINTERVPROC(glfwGetProcAddress("glGetVertexAttribPointerv"));
-  glGetVertexAttribdv = PFNGLGETVERTEXATTRIBDVPROC(glfwGetProcAddress("glGetVertexAttribdv"));
-  glGetVertexAttribfv = PFNGLGETVERTEXATTRIBFVPROC(glfwGetProcAddress("glGetVertexAttribfv"));
-  glGetVertexAttribiv = PFNGLGETVERTEXATTRIBIVPROC(glfwGetProcAddress("glGetVertexAttribiv"));
-  glGetVkProcAddrNV = PFNGLGETVKPROCADDRNVPROC(glfwGetProcAddress("glGetVkProcAddrNV"));
-  glGetnCompressedTexImage = PFNGLGETNCOMPRESSEDTEXIMAGEPROC(glfwGetProcAddress("glGetnCompressedTexImage"));
-  glGetnCompressedTexImageARB = PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC(glfwGetProcAddress("glGetnCompressedTexImageARB"));
-  glGetnTexImage = PFNGLGETNTEXIMAGEPROC(glfwGetProcAddress("glGetnTexImage"));
-  glGetnTexImageARB = PFNGLGETNTEXIMAGEARBPROC(glfwGetProcAddress("glGetnTexImageARB"));
-  glGetnUniformdv = PFNGLGETNUNIFORMDVPROC(glfwGetProcAddress("glGetnUniformdv"));
-  glGetnUniformdvARB = PFNGLGETNUNIFORMDVARBPROC(glfwGetProcAddress("glGetnUniformdvARB"));
-  glGetnUniformfv = PFNGLGETNUNIFORMFVPROC(glfwGetProcAddress("glGetnUniformfv"));
-  glGetnUniformfvARB = PFNGLGETNUNIFORMFVARBPROC(glfwGetProcAddress("glGetnUniformfvARB"));
-  glGetnUniformi64vARB = PFNGLGETNUNIFORMI64VARBPROC(glfwGetProcAddress("glGetnUniformi64vARB"));
-  glGetnUniformiv = PFNGLGETNUNIFORMIVPROC(glfwGetProcAddress("glGetnUniformiv"));
-  glGetnUniformivARB = PFNGLGETNUNIFORMIVARBPROC(glfwGetProcAddress("glGetnUniformivARB"));
-  glGetnUniformui64vARB = PFNGLGETNUNIFORMUI64VARBPROC(glfwGetProcAddress("glGetnUniformui64vARB"));
-  glGetnUniformuiv = PFNGLGETNUNIFORMUIVPROC(glfwGetProcAddress("glGetnUniformuiv"));
-  glGetnUniformuivARB = PFNGLGETNUNIFORMUIVARBPROC(glfwGetProcAddress("glGetnUniformuivARB"));
-  glHint = PFNGLHINTPROC(glfwGetProcAddress("glHint"));
-  glIndexFormatNV = PFNGLINDEXFORMATNVPROC(glfwGetProcAddress("glIndexFormatNV"));
-  glInsertEventMarkerEXT = PFNGLINSERTEVENTMARKEREXTPROC(glfwGetProcAddress("glInsertEventMarkerEXT"));
-  glInterpolatePathsNV = PFNGLINTERPOLATEPATHSNVPROC(glfwGetProcAddress("glInterpolatePathsNV"));
-  glInvalidateBufferData = PFNGLINVALIDATEBUFFERDATAPROC(glfwGetProcAddress("glInvalidateBufferData"));
-  glInvalidateBufferSubData = PFNGLINVALIDATEBUFFERSUBDATAPROC(glfwGetProcAddress("glInvalidateBufferSubData"));
-  glInvalidateFramebuffer = PFNGLINVALIDATEFRAMEBUFFERPROC(glfwGetProcAddress("glInvalidateFramebuffer"));
-  glInvalidateNamedFramebufferData = PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC(glfwGetProcAddress("glInvalidateNamedFramebufferData"));
-  glInvalidateNamedFramebufferSubData = PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC(glfwGetProcAddress("glInvalidateNamedFramebufferSubData"));
-  glInvalidateSubFramebuffer = PFNGLINVALIDATESUBFRAMEBUFFERPROC(glfwGetProcAddress("glInvalidateSubFramebuffer"));
-  glInvalidateTexImage = PFNGLINVALIDATETEXIMAGEPROC(glfwGetProcAddress("glInvalidateTexImage"));
-  glInvalidateTexSubImage = PFNGLINVALIDATETEXSUBIMAGEPROC(glfwGetProcAddress("glInvalidateTexSubImage"));
-  glIsBuffer = PFNGLISBUFFERPROC(glfwGetProcAddress("glIsBuffer"));
-  glIsBufferResidentNV = PFNGLISBUFFERRESIDENTNVPROC(glfwGetProcAddress("glIsBufferResidentNV"));
-  glIsCommandListNV = PFNGLISCOMMANDLISTNVPROC(glfwGetProcAddress("glIsCommandListNV"));
-  glIsEnabled = PFNGLISENABLEDPROC(glfwGetProcAddress("glIsEnabled"));
-  glIsEnabledIndexedEXT = PFNGLISENABLEDINDEXEDEXTPROC(glfwGetProcAddress("glIsEnabledIndexedEXT"));
-  glIsEnabledi = PFNGLISENABLEDIPROC(glfwGetProcAddress("glIsEnabledi"));
-  glIsFramebuffer = PFNGLISFRAMEBUFFERPROC(glfwGetProcAddress("glIsFramebuffer"));
-  glIsImageHandleResidentARB = PFNGLISIMAGEHANDLERESIDENTARBPROC(glfwGetProcAddress("glIsImageHandleResidentARB"));
-  glIsImageHandleResidentNV = PFNGLISIMAGEHANDLERESIDENTNVPROC(glfwGetProcAddress("glIsImageHandleResidentNV"));
-  glIsNamedBufferResidentNV = PFNGLISNAMEDBUFFERRESIDENTNVPROC(glfwGetProcAddress("glIsNamedBufferResidentNV"));
-  glIsNamedStringARB = PFNGLISNAMEDSTRINGARBPROC(glfwGetProcAddress("glIsNamedStringARB"));
-  glIsPathNV = PFNGLISPATHNVPROC(glfwGetProcAddress("glIsPathNV"));
-  glIsPointInFillPathNV = PFNGLISPOINTINFILLPATHNVPROC(glfwGetProcAddress("glIsPointInFillPathNV"));
-  glIsPointInStrokePathNV = PFNGLISPOINTINSTROKEPATHNVPROC(glfwGetProcAddress("glIsPointInStrokePathNV"));
-  glIsProgram = PFNGLISPROGRAMPROC(glfwGetProcAddress("glIsProgram"));
-  glIsProgramPipeline = PFNGLISPROGRAMPIPELINEPROC(glfwGetProcAddress("glIsProgramPipeline"));
-  glIsQuery = PFNGLISQUERYPROC(glfwGetProcAddress("glIsQuery"));
-  glIsRenderbuffer = PFNGLISRENDERBUFFERPROC(glfwGetProcAddress("glIsRenderbuffer"));
-  glIsSampler = PFNGLISSAMPLERPROC(glfwGetProcAddress("glIsSampler"));
-  glIsShader = PFNGLISSHADERPROC(glfwGetProcAddress("glIsShader"));
-  glIsStateNV = PFNGLISSTATENVPROC(glfwGetProcAddress("glIsStateNV"));
-  glIsSync = PFNGLISSYNCPROC(glfwGetProcAddress("glIsSync"));
-  glIsTexture = PFNGLISTEXTUREPROC(glfwGetProcAddress("glIsTexture"));
-  glIsTextureHandleResidentARB = PFNGLISTEXTUREHANDLERESIDENTARBPROC(glfwGetProcAddress("glIsTextureHandleResidentARB"));
-  glIsTextureHandleResidentNV = PFNGLISTEXTUREHANDLERESIDENTNVPROC(glfwGetProcAddress("glIsTextureHandleResidentNV"));
-  glIsTransformFeedback = PFNGLISTRANSFORMFEEDBACKPROC(glfwGetProcAddress("glIsTransformFeedback"));
-  glIsVertexArray = PFNGLISVERTEXARRAYPROC(glfwGetProcAddress("glIsVertexArray"));
-  glLabelObjectEXT = PFNGLLABELOBJECTEXTPROC(glfwGetProcAddress("glLabelObjectEXT"));
-  glLineWidth = PFNGLLINEWIDTHPROC(glfwGetProcAddress("glLineWidth"));
-  glLinkProgram = PFNGLLINKPROGRAMPROC(glfwGetProcAddress("glLinkProgram"));
-  glListDrawCommandsStatesClientNV = PFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC(glfwGetProcAddress("glListDrawCommandsStatesClientNV"));
-  glLogicOp = PFNGLLOGICOPPROC(glfwGetProcAddress("glLogicOp"));
-  glMakeBufferNonResidentNV = PFNGLMAKEBUFFERNONRESIDENTNVPROC(glfwGetProcAddress("glMakeBufferNonResidentNV"));
-  glMakeBufferResidentNV = PFNGLMAKEBUFFERRESIDENTNVPROC(glfwGetProcAddress("glMakeBufferResidentNV"));
-  glMakeImageHandleNonResidentARB = PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC(glfwGetProcAddress("glMakeImageHandleNonResidentARB"));
-  glMakeImageHandleNonResidentNV = PFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC(glfwGetProcAddress("glMakeImageHandleNonResidentNV"));
-  glMakeImageHandleResidentARB = PFNGLMAKEIMAGEHANDLERESIDENTARBPROC(glfwGetProcAddress("glMakeImageHandleResidentARB"));
-  glMakeImageHandleResidentNV = PFNGLMAKEIMAGEHANDLERESIDENTNVPROC(glfwGetProcAddress("glMakeImageHandleResidentNV"));
-  glMakeNamedBufferNonResidentNV = PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC(glfwGetProcAddress("glMakeNamedBufferNonResidentNV"));
-  glMakeNamedBufferResidentNV = PFNGLMAKENAMEDBUFFERRESIDENTNVPROC(glfwGetProcAddress("glMakeNamedBufferResidentNV"));
-  glMakeTextureHandleNonResidentARB = PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC(glfwGetProcAddress("glMakeTextureHandleNonResidentARB"));
-  glMakeTextureHandleNonResidentNV = PFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC(glfwGetProcAddress("glMakeTextureHandleNonResidentNV"));
-  glMakeTextureHandleResidentARB = PFNGLMAKETEXTUREHANDLERESIDENTARBPROC(glfwGetProcAddress("glMakeTextureHandleResidentARB"));
-  glMakeTextureHandleResidentNV = PFNGLMAKETEXTUREHANDLERESIDENTNVPROC(glfwGetProcAddress("glMakeTextureHandleResidentNV"));
-  glMapBuffer = PFNGLMAPBUFFERPROC(glfwGetProcAddress("glMapBuffer"));
-  glMapBufferRange = PFNGLMAPBUFFERRANGEPROC(glfwGetProcAddress("glMapBufferRange"));
-  glMapNamedBuffer = PFNGLMAPNAMEDBUFFERPROC(glfwGetProcAddress("glMapNamedBuffer"));
-  glMapNamedBufferEXT = PFNGLMAPNAMEDBUFFEREXTPROC(glfwGetProcAddress("glMapNamedBufferEXT"));
-  glMapNamedBufferRange = PFNGLMAPNAMEDBUFFERRANGEPROC(glfwGetProcAddress("glMapNamedBufferRange"));
-  glMapNamedBufferRangeEXT = PFNGLMAPNAMEDBUFFERRANGEEXTPROC(glfwGetProcAddress("glMapNamedBufferRangeEXT"));
-  glMatrixFrustumEXT = PFNGLMATRIXFRUSTUMEXTPROC(glfwGetProcAddress("glMatrixFrustumEXT"));
-  glMatrixLoad3x2fNV = PFNGLMATRIXLOAD3X2FNVPROC(glfwGetProcAddress("glMatrixLoad3x2fNV"));
-  glMatrixLoad3x3fNV = PFNGLMATRIXLOAD3X3FNVPROC(glfwGetProcAddress("glMatrixLoad3x3fNV"));
-  glMatrixLoadIdentityEXT = PFNGLMATRIXLOADIDENTITYEXTPROC(glfwGetProcAddress("glMatrixLoadIdentityEXT"));
-  glMatrixLoadTranspose3x3fNV = PFNGLMATRIXLOADTRANSPOSE3X3FNVPROC(glfwGetProcAddress("glMatrixLoadTranspose3x3fNV"));
-  glMatrixLoadTransposedEXT = PFNGLMATRIXLOADTRANSPOSEDEXTPROC(glfwGetProcAddress("glMatrixLoadTransposedEXT"));
-  glMatrixLoadTransposefEXT = PFNGLMATRIXLOADTRANSPOSEFEXTPROC(glfwGetProcAddress("glMatrixLoadTransposefEXT"));
-  glMatrixLoaddEXT = PFNGLMATRIXLOADDEXTPROC(glfwGetProcAddress("glMatrixLoaddEXT"));
-  glMatrixLoadfEXT = PFNGLMATRIXLOADFEXTPROC(glfwGetProcAddress("glMatrixLoadfEXT"));
-  glMatrixMult3x2fNV = PFNGLMATRIXMULT3X2FNVPROC(glfwGetProcAddress("glMatrixMult3x2fNV"));
-  glMatrixMult3x3fNV = PFNGLMATRIXMULT3X3FNVPROC(glfwGetProcAddress("glMatrixMult3x3fNV"));
-  glMatrixMultTranspose3x3fNV = PFNGLMATRIXMULTTRANSPOSE3X3FNVPROC(glfwGetProcAddress("glMatrixMultTranspose3x3fNV"));
-  glMatrixMultTransposedEXT = PFNGLMATRIXMULTTRANSPOSEDEXTPROC(glfwGetProcAddress("glMatrixMultTransposedEXT"));
-  glMatrixMultTransposefEXT = PFNGLMATRIXMULTTRANSPOSEFEXTPROC(glfwGetProcAddress("glMatrixMultTransposefEXT"));
-  glMatrixMultdEXT = PFNGLMATRIXMULTDEXTPROC(glfwGetProcAddress("glMatrixMultdEXT"));
-  glMatrixMultfEXT = PFNGLMATRIXMULTFEXTPROC(glfwGetProcAddress("glMatrixMultfEXT"));
-  glMatrixOrthoEXT = PFNGLMATRIXORTHOEXTPROC(glfwGetProcAddress("glMatrixOrthoEXT"));
-  glMatrixPopEXT = PFNGLMATRIXPOPEXTPROC(glfwGetProcAddress("glMatrixPopEXT"));
-  glMatrixPushEXT = PFNGLMATRIXPUSHEXTPROC(glfwGetProcAddress("glMatrixPushEXT"));
-  glMatrixRotatedEXT = PFNGLMATRIXROTATEDEXTPROC(glfwGetProcAddress("glMatrixRotatedEXT"));
-  glMatrixRotatefEXT = PFNGLMATRIXROTATEFEXTPROC(glfwGetProcAddress("glMatrixRotatefEXT"));
-  glMatrixScaledEXT = PFNGLMATRIXSCALEDEXTPROC(glfwGetProcAddress("glMatrixScaledEXT"));
-  glMatrixScalefEXT = PFNGLMATRIXSCALEFEXTPROC(glfwGetProcAddress("glMatrixScalefEXT"));
-  glMatrixTranslatedEXT = PFNGLMATRIXTRANSLATEDEXTPROC(glfwGetProcAddress("glMatrixTranslatedEXT"));
-  glMatrixTranslatefEXT = PFNGLMATRIXTRANSLATEFEXTPROC(glfwGetProcAddress("glMatrixTranslatefEXT"));
-  glMaxShaderCompilerThreadsARB = PFNGLMAXSHADERCOMPILERTHREADSARBPROC(glfwGetProcAddress("glMaxShaderCompilerThreadsARB"));
-  glMemoryBarrier = PFNGLMEMORYBARRIERPROC(glfwGetProcAddress("glMemoryBarrier"));
-  glMemoryBarrierByRegion = PFNGLMEMORYBARRIERBYREGIONPROC(glfwGetProcAddress("glMemoryBarrierByRegion"));
-  glMinSampleShading = PFNGLMINSAMPLESHADINGPROC(glfwGetProcAddress("glMinSampleShading"));
-  glMinSampleShadingARB = PFNGLMINSAMPLESHADINGARBPROC(glfwGetProcAddress("glMinSampleShadingARB"));
-  glMultiDrawArrays = PFNGLMULTIDRAWARRAYSPROC(glfwGetProcAddress("glMultiDrawArrays"));
-  glMultiDrawArraysIndirect = PFNGLMULTIDRAWARRAYSINDIRECTPROC(glfwGetProcAddress("glMultiDrawArraysIndirect"));
-  glMultiDrawArraysIndirectBindlessCountNV = PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC(glfwGetProcAddress("glMultiDrawArraysIndirectBindlessCountNV"));
-  glMultiDrawArraysIndirectBindlessNV = PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC(glfwGetProcAddress("glMultiDrawArraysIndirectBindlessNV"));
-  glMultiDrawArraysIndirectCountARB = PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC(glfwGetProcAddress("glMultiDrawArraysIndirectCountARB"));
-  glMultiDrawElements = PFNGLMULTIDRAWELEMENTSPROC(glfwGetProcAddress("glMultiDrawElements"));
-  glMultiDrawElementsBaseVertex = PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC(glfwGetProcAddress("glMultiDrawElementsBaseVertex"));
-  glMultiDrawElementsIndirect = PFNGLMULTIDRAWELEMENTSINDIRECTPROC(glfwGetProcAddress("glMultiDrawElementsIndirect"));
-  glMultiDrawElementsIndirectBindlessCountNV = PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC(glfwGetProcAddress("glMultiDrawElementsIndirectBindlessCountNV"));
-  glMultiDrawElementsIndirectBindlessNV = PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC(glfwGetProcAddress("glMultiDrawElementsIndirectBindlessNV"));
-  glMultiDrawElementsIndirectCountARB = PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC(glfwGetProcAddress("glMultiDrawElementsIndirectCountARB"));
-  glMultiTexBufferEXT = PFNGLMULTITEXBUFFEREXTPROC(glfwGetProcAddress("glMultiTexBufferEXT"));
-  glMultiTexCoordPointerEXT = PFNGLMULTITEXCOORDPOINTEREXTPROC(glfwGetProcAddress("glMultiTexCoordPointerEXT"));
-  glMultiTexEnvfEXT = PFNGLMULTITEXENVFEXTPROC(glfwGetProcAddress("glMultiTexEnvfEXT"));
-  glMultiTexEnvfvEXT = PFNGLMULTITEXENVFVEXTPROC(glfwGetProcAddress("glMultiTexEnvfvEXT"));
-  glMultiTexEnviEXT = PFNGLMULTITEXENVIEXTPROC(glfwGetProcAddress("glMultiTexEnviEXT"));
-  glMultiTexEnvivEXT = PFNGLMULTITEXENVIVEXTPROC(glfwGetProcAddress("glMultiTexEnvivEXT"));
-  glMultiTexGendEXT = PFNGLMULTITEXGENDEXTPROC(glfwGetProcAddress("glMultiTexGendEXT"));
-  glMultiTexGendvEXT = PFNGLMULTITEXGENDVEXTPROC(glfwGetProcAddress("glMultiTexGendvEXT"));
-  glMultiTexGenfEXT = PFNGLMULTITEXGENFEXTPROC(glfwGetProcAddress("glMultiTexGenfEXT"));
-  glMultiTexGenfvEXT = PFNGLMULTITEXGENFVEXTPROC(glfwGetProcAddress("glMultiTexGenfvEXT"));
-  glMultiTexGeniEXT = PFNGLMULTITEXGENIEXTPROC(glfwGetProcAddress("glMultiTexGeniEXT"));
-  glMultiTexGenivEXT = PFNGLMULTITEXGENIVEXTPROC(glfwGetProcAddress("glMultiTexGenivEXT"));
-  glMultiTexImage1DEXT = PFNGLMULTITEXIMAGE1DEXTPROC(glfwGetProcAddress("glMultiTexImage1DEXT"));
-  glMultiTexImage2DEXT = PFNGLMULTITEXIMAGE2DEXTPROC(glfwGetProcAddress("glMultiTexImage2DEXT"));
-  glMultiTexImage3DEXT = PFNGLMULTITEXIMAGE3DEXTPROC(glfwGetProcAddress("glMultiTexImage3DEXT"));
-  glMultiTexParameterIivEXT = PFNGLMULTITEXPARAMETERIIVEXTPROC(glfwGetProcAddress("glMultiTexParameterIivEXT"));
-  glMultiTexParameterIuivEXT = PFNGLMULTITEXPARAMETERIUIVEXTPROC(glfwGetProcAddress("glMultiTexParameterIuivEXT"));
-  glMultiTexParameterfEXT = PFNGLMULTITEXPARAMETERFEXTPROC(glfwGetProcAddress("glMultiTexParameterfEXT"));
-  glMultiTexParameterfvEXT = PFNGLMULTITEXPARAMETERFVEXTPROC(glfwGetProcAddress("glMultiTexParameterfvEXT"));
-  glMultiTexParameteriEXT = PFNGLMULTITEXPARAMETERIEXTPROC(glfwGetProcAddress("glMultiTexParameteriEXT"));
-  glMultiTexParameterivEXT = PFNGLMULTITEXPARAMETERIVEXTPROC(glfwGetProcAddress("glMultiTexParameterivEXT"));
-  glMultiTexRenderbufferEXT = PFNGLMULTITEXRENDERBUFFEREXTPROC(glfwGetProcAddress("glMultiTexRenderbufferEXT"));
-  glMultiTexSubImage1DEXT = PFNGLMULTITEXSUBIMAGE1DEXTPROC(glfwGetProcAddress("glMultiTexSubImage1DEXT"));
-  glMultiTexSubImage2DEXT = PFNGLMULTITEXSUBIMAGE2DEXTPROC(glfwGetProcAddress("glMultiTexSubImage2DEXT"));
-  glMultiTexSubImage3DEXT = PFNGLMULTITEXSUBIMAGE3DEXTPROC(glfwGetProcAddress("glMultiTexSubImage3DEXT"));
-  glNamedBufferData = PFNGLNAMEDBUFFERDATAPROC(glfwGetProcAddress("glNamedBufferData"));
-  glNamedBufferDataEXT = PFNGLNAMEDBUFFERDATAEXTPROC(glfwGetProcAddress("glNamedBufferDataEXT"));
-  glNamedBufferPageCommitmentARB = PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC(glfwGetProcAddress("glNamedBufferPageCommitmentARB"));
-  glNamedBufferPageCommitmentEXT = PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC(glfwGetProcAddress("glNamedBufferPageCommitmentEXT"));
-  glNamedBufferStorage = PFNGLNAMEDBUFFERSTORAGEPROC(glfwGetProcAddress("glNamedBufferStorage"));
-  glNamedBufferStorageEXT = PFNGLNAMEDBUFFERSTORAGEEXTPROC(glfwGetProcAddress("glNamedBufferStorageEXT"));
-  glNamedBufferSubData = PFNGLNAMEDBUFFERSUBDATAPROC(glfwGetProcAddress("glNamedBufferSubData"));
-  glNamedBufferSubDataEXT = PFNGLNAMEDBUFFERSUBDATAEXTPROC(glfwGetProcAddress("glNamedBufferSubDataEXT"));
-  glNamedCopyBufferSubDataEXT = PFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC(glfwGetProcAddress("glNamedCopyBufferSubDataEXT"));
-  glNamedFramebufferDrawBuffer = PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC(glfwGetProcAddress("glNamedFramebufferDrawBuffer"));
-  glNamedFramebufferDrawBuffers = PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC(glfwGetProcAddress("glNamedFramebufferDrawBuffers"));
-  glNamedFramebufferParameteri = PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC(glfwGetProcAddress("glNamedFramebufferParameteri"));
-  glNamedFramebufferParameteriEXT = PFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC(glfwGetProcAddress("glNamedFramebufferParameteriEXT"));
-  glNamedFramebufferReadBuffer = PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC(glfwGetProcAddress("glNamedFramebufferReadBuffer"));
-  glNamedFramebufferRenderbuffer = PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC(glfwGetProcAddress("glNamedFramebufferRenderbuffer"));
-  glNamedFramebufferRenderbufferEXT = PFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC(glfwGetProcAddress("glNamedFramebufferRenderbufferEXT"));
-  glNamedFramebufferSampleLocationsfvARB = PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC(glfwGetProcAddress("glNamedFramebufferSampleLocationsfvARB"));
-  glNamedFramebufferSampleLocationsfvNV = PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC(glfwGetProcAddress("glNamedFramebufferSampleLocationsfvNV"));
-  glNamedFramebufferTexture = PFNGLNAMEDFRAMEBUFFERTEXTUREPROC(glfwGetProcAddress("glNamedFramebufferTexture"));
-  glNamedFramebufferTexture1DEXT = PFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC(glfwGetProcAddress("glNamedFramebufferTexture1DEXT"));
-  glNamedFramebufferTexture2DEXT = PFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC(glfwGetProcAddress("glNamedFramebufferTexture2DEXT"));
-  glNamedFramebufferTexture3DEXT = PFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC(glfwGetProcAddress("glNamedFramebufferTexture3DEXT"));
-  glNamedFramebufferTextureEXT = PFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC(glfwGetProcAddress("glNamedFramebufferTextureEXT"));
-  glNamedFramebufferTextureFaceEXT = PFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC(glfwGetProcAddress("glNamedFramebufferTextureFaceEXT"));
-  glNamedFramebufferTextureLayer = PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC(glfwGetProcAddress("glNamedFramebufferTextureLayer"));
-  glNamedFramebufferTextureLayerEXT = PFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC(glfwGetProcAddress("glNamedFramebufferTextureLayerEXT"));
-  glNamedProgramLocalParameter4dEXT = PFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC(glfwGetProcAddress("glNamedProgramLocalParameter4dEXT"));
-  glNamedProgramLocalParameter4dvEXT = PFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC(glfwGetProcAddress("glNamedProgramLocalParameter4dvEXT"));
-  glNamedProgramLocalParameter4fEXT = PFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC(glfwGetProcAddress("glNamedProgramLocalParameter4fEXT"));
-  glNamedProgramLocalParameter4fvEXT = PFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC(glfwGetProcAddress("glNamedProgramLocalParameter4fvEXT"));
-  glNamedProgramLocalParameterI4iEXT = PFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC(glfwGetProcAddress("glNamedProgramLocalParameterI4iEXT"));
-  glNamedProgramLocalParameterI4ivEXT = PFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC(glfwGetProcAddress("glNamedProgramLocalParameterI4ivEXT"));
-  glNamedProgramLocalParameterI4uiEXT = PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC(glfwGetProcAddress("glNamedProgramLocalParameterI4uiEXT"));
-  glNamedProgramLocalParameterI4uivEXT = PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC(glfwGetProcAddress("glNamedProgramLocalParameterI4uivEXT"));
-  glNamedProgramLocalParameters4fvEXT = PFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC(glfwGetProcAddress("glNamedProgramLocalParameters4fvEXT"));
-  glNamedProgramLocalParametersI4ivEXT = PFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC(glfwGetProcAddress("glNamedProgramLocalParametersI4ivEXT"));
-  glNamedProgramLocalParametersI4uivEXT = PFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC(glfwGetProcAddress("glNamedProgramLocalParametersI4uivEXT"));
-  glNamedProgramStringEXT = PFNGLNAMEDPROGRAMSTRINGEXTPROC(glfwGetProcAddress("glNamedProgramStringEXT"));
-  glNamedRenderbufferStorage = PFNGLNAMEDRENDERBUFFERSTORAGEPROC(glfwGetProcAddress("glNamedRenderbufferStorage"));
-  glNamedRenderbufferStorageEXT = PFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC(glfwGetProcAddress("glNamedRenderbufferStorageEXT"));
-  glNamedRenderbufferStorageMultisample = PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC(glfwGetProcAddress("glNamedRenderbufferStorageMultisample"));
-  glNamedRenderbufferStorageMultisampleCoverageEXT = PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC(glfwGetProcAddress("glNamedRenderbufferStorageMultisampleCoverageEXT"));
-  glNamedRenderbufferStorageMultisampleEXT = PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC(glfwGetProcAddress("glNamedRenderbufferStorageMultisampleEXT"));
-  glNamedStringARB = PFNGLNAMEDSTRINGARBPROC(glfwGetProcAddress("glNamedStringARB"));
-  glNormalFormatNV = PFNGLNORMALFORMATNVPROC(glfwGetProcAddress("glNormalFormatNV"));
-  glObjectLabel = PFNGLOBJECTLABELPROC(glfwGetProcAddress("glObjectLabel"));
-  glObjectPtrLabel = PFNGLOBJECTPTRLABELPROC(glfwGetProcAddress("glObjectPtrLabel"));
-  glPatchParameterfv = PFNGLPATCHPARAMETERFVPROC(glfwGetProcAddress("glPatchParameterfv"));
-  glPatchParameteri = PFNGLPATCHPARAMETERIPROC(glfwGetProcAddress("glPatchParameteri"));
-  glPathCommandsNV = PFNGLPATHCOMMANDSNVPROC(glfwGetProcAddress("glPathCommandsNV"));
-  glPathCoordsNV = PFNGLPATHCOORDSNVPROC(glfwGetProcAddress("glPathCoordsNV"));
-  glPathCoverDepthFuncNV = PFNGLPATHCOVERDEPTHFUNCNVPROC(glfwGetProcAddress("glPathCoverDepthFuncNV"));
-  glPathDashArrayNV = PFNGLPATHDASHARRAYNVPROC(glfwGetProcAddress("glPathDashArrayNV"));
-  glPathGlyphIndexArrayNV = PFNGLPATHGLYPHINDEXARRAYNVPROC(glfwGetProcAddress("glPathGlyphIndexArrayNV"));
-  glPathGlyphIndexRangeNV = PFNGLPATHGLYPHINDEXRANGENVPROC(glfwGetProcAddress("glPathGlyphIndexRangeNV"));
-  glPathGlyphRangeNV = PFNGLPATHGLYPHRANGENVPROC(glfwGetProcAddress("glPathGlyphRangeNV"));
-  glPathGlyphsNV = PFNGLPATHGLYPHSNVPROC(glfwGetProcAddress("glPathGlyphsNV"));
-  glPathMemoryGlyphIndexArrayNV = PFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC(glfwGetProcAddress("glPathMemoryGlyphIndexArrayNV"));
-  glPathParameterfNV = PFNGLPATHPARAMETERFNVPROC(glfwGetProcAddress("glPathParameterfNV"));
-  glPathParameterfvNV = PFNGLPATHPARAMETERFVNVPROC(glfwGetProcAddress("glPathParameterfvNV"));
-  glPathParameteriNV = PFNGLPATHPARAMETERINVPROC(glfwGetProcAddress("glPathParameteriNV"));
-  glPathParameterivNV = PFNGLPATHPARAMETERIVNVPROC(glfwGetProcAddress("glPathParameterivNV"));
-  glPathStencilDepthOffsetNV = PFNGLPATHSTENCILDEPTHOFFSETNVPROC(glfwGetProcAddress("glPathStencilDepthOffsetNV"));
-  glPathStencilFuncNV = PFNGLPATHSTENCILFUNCNVPROC(glfwGetProcAddress("glPathStencilFuncNV"));
-  glPathStringNV = PFNGLPATHSTRINGNVPROC(glfwGetProcAddress("glPathStringNV"));
-  glPathSubCommandsNV = PFNGLPATHSUBCOMMANDSNVPROC(glfwGetProcAddress("glPathSubCommandsNV"));
-  glPathSubCoordsNV = PFNGLPATHSUBCOORDSNVPROC(glfwGetProcAddress("glPathSubCoordsNV"));
-  glPauseTransformFeedback = PFNGLPAUSETRANSFORMFEEDBACKPROC(glfwGetProcAddress("glPauseTransformFeedback"));
-  glPixelStoref = PFNGLPIXELSTOREFPROC(glfwGetProcAddress("glPixelStoref"));
-  glPixelStorei = PFNGLPIXELSTOREIPROC(glfwGetProcAddress("glPixelStorei"));
-  glPointAlongPathNV = PFNGLPOINTALONGPATHNVPROC(glfwGetProcAddress("glPointAlongPathNV"));
-  glPointParameterf = PFNGLPOINTPARAMETERFPROC(glfwGetProcAddress("glPointParameterf"));
-  glPointParameterfv = PFNGLPOINTPARAMETERFVPROC(glfwGetProcAddress("glPointParameterfv"));
-  glPointParameteri = PFNGLPOINTPARAMETERIPROC(glfwGetProcAddress("glPointParameteri"));
-  glPointParameteriv = PFNGLPOINTPARAMETERIVPROC(glfwGetProcAddress("glPointParameteriv"));
-  glPointSize = PFNGLPOINTSIZEPROC(glfwGetProcAddress("glPointSize"));
-  glPolygonMode = PFNGLPOLYGONMODEPROC(glfwGetProcAddress("glPolygonMode"));
-  glPolygonOffset = PFNGLPOLYGONOFFSETPROC(glfwGetProcAddress("glPolygonOffset"));
-  glPolygonOffsetClampEXT = PFNGLPOLYGONOFFSETCLAMPEXTPROC(glfwGetProcAddress("glPolygonOffsetClampEXT"));
-  glPopDebugGroup = PFNGLPOPDEBUGGROUPPROC(glfwGetProcAddress("glPopDebugGroup"));
-  glPopGroupMarkerEXT = PFNGLPOPGROUPMARKEREXTPROC(glfwGetProcAddress("glPopGroupMarkerEXT"));
-  glPrimitiveBoundingBoxARB = PFNGLPRIMITIVEBOUNDINGBOXARBPROC(glfwGetProcAddress("glPrimitiveBoundingBoxARB"));
-  glPrimitiveRestartIndex = PFNGLPRIMITIVERESTARTINDEXPROC(glfwGetProcAddress("glPrimitiveRestartIndex"));
-  glProgramBinary = PFNGLPROGRAMBINARYPROC(glfwGetProcAddress("glProgramBinary"));
-  glProgramParameteri = PFNGLPROGRAMPARAMETERIPROC(glfwGetProcAddress("glProgramParameteri"));
-  glProgramParameteriARB = PFNGLPROGRAMPARAMETERIARBPROC(glfwGetProcAddress("glProgramParameteriARB"));
-  glProgramPathFragmentInputGenNV = PFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC(glfwGetProcAddress("glProgramPathFragmentInputGenNV"));
-  glProgramUniform1d = PFNGLPROGRAMUNIFORM1DPROC(glfwGetProcAddress("glProgramUniform1d"));
-  glProgramUniform1dEXT = PFNGLPROGRAMUNIFORM1DEXTPROC(glfwGetProcAddress("glProgramUniform1dEXT"));
-  glProgramUniform1dv = PFNGLPROGRAMUNIFORM1DVPROC(glfwGetProcAddress("glProgramUniform1dv"));
-  glProgramUniform1dvEXT = PFNGLPROGRAMUNIFORM1DVEXTPROC(glfwGetProcAddress("glProgramUniform1dvEXT"));
-  glProgramUniform1f = PFNGLPROGRAMUNIFORM1FPROC(glfwGetProcAddress("glProgramUniform1f"));
-  glProgramUniform1fEXT = PFNGLPROGRAMUNIFORM1FEXTPROC(glfwGetProcAddress("glProgramUniform1fEXT"));
-  glProgramUniform1fv = PFNGLPROGRAMUNIFORM1FVPROC(glfwGetProcAddress("glProgramUniform1fv"));
-  glProgramUniform1fvEXT = PFNGLPROGRAMUNIFORM1FVEXTPROC(glfwGetProcAddress("glProgramUniform1fvEXT"));
-  glProgramUniform1i = PFNGLPROGRAMUNIFORM1IPROC(glfwGetProcAddress("glProgramUniform1i"));
-  glProgramUniform1i64ARB = PFNGLPROGRAMUNIFORM1I64ARBPROC(glfwGetProcAddress("glProgramUniform1i64ARB"));
-  glProgramUniform1i64NV = PFNGLPROGRAMUNIFORM1I64NVPROC(glfwGetProcAddress("glProgramUniform1i64NV"));
-  glProgramUniform1i64vARB = PFNGLPROGRAMUNIFORM1I64VARBPROC(glfwGetProcAddress("glProgramUniform1i64vARB"));
-  glProgramUniform1i64vNV = PFNGLPROGRAMUNIFORM1I64VNVPROC(glfwGetProcAddress("glProgramUniform1i64vNV"));
-  glProgramUniform1iEXT = PFNGLPROGRAMUNIFORM1IEXTPROC(glfwGetProcAddress("glProgramUniform1iEXT"));
-  glProgramUniform1iv = PFNGLPROGRAMUNIFORM1IVPROC(glfwGetProcAddress("glProgramUniform1iv"));
-  glProgramUniform1ivEXT = PFNGLPROGRAMUNIFORM1IVEXTPROC(glfwGetProcAddress("glProgramUniform1ivEXT"));
-  glProgramUniform1ui = PFNGLPROGRAMUNIFORM1UIPROC(glfwGetProcAddress("glProgramUniform1ui"));
-  glProgramUniform1ui64ARB = PFNGLPROGRAMUNIFORM1UI64ARBPROC(glfwGetProcAddress("glProgramUniform1ui64ARB"));
-  glProgramUniform1ui64NV = PFNGLPROGRAMUNIFORM1UI64NVPROC(glfwGetProcAddress("glProgramUniform1ui64NV"));
-  glProgramUniform1ui64vARB = PFNGLPROGRAMUNIFORM1UI64VARBPROC(glfwGetProcAddress("glProgramUniform1ui64vARB"));
-  glProgramUniform1ui64vNV = PFNGLPROGRAMUNIFORM1UI64VNVPROC(glfwGetProcAddress("glProgramUniform1ui64vNV"));
-  glProgramUniform1uiEXT = PFNGLPROGRAMUNIFORM1UIEXTPROC(glfwGetProcAddress("glProgramUniform1uiEXT"));
-  glProgramUniform1uiv = PFNGLPROGRAMUNIFORM1UIVPROC(glfwGetProcAddress("glProgramUniform1uiv"));
-  glProgramUniform1uivEXT = PFNGLPROGRAMUNIFORM1UIVEXTPROC(glfwGetProcAddress("glProgramUniform1uivEXT"));
-  glProgramUniform2d = PFNGLPROGRAMUNIFORM2DPROC(glfwGetProcAddress("glProgramUniform2d"));
-  glProgramUniform2dEXT = PFNGLPROGRAMUNIFORM2DEXTPROC(glfwGetProcAddress("glProgramUniform2dEXT"));
-  glProgramUniform2dv = PFNGLPROGRAMUNIFORM2DVPROC(glfwGetProcAddress("glProgramUniform2dv"));
-  glProgramUniform2dvEXT = PFNGLPROGRAMUNIFORM2DVEXTPROC(glfwGetProcAddress("glProgramUniform2dvEXT"));
-  glProgramUniform2f = PFNGLPROGRAMUNIFORM2FPROC(glfwGetProcAddress("glProgramUniform2f"));
-  glProgramUniform2fEXT = PFNGLPROGRAMUNIFORM2FEXTPROC(glfwGetProcAddress("glProgramUniform2fEXT"));
-  glProgramUniform2fv = PFNGLPROGRAMUNIFORM2FVPROC(glfwGetProcAddress("glProgramUniform2fv"));
-  glProgramUniform2fvEXT = PFNGLPROGRAMUNIFORM2FVEXTPROC(glfwGetProcAddress("glProgramUniform2fvEXT"));
-  glProgramUniform2i = PFNGLPROGRAMUNIFORM2IPROC(glfwGetProcAddress("glProgramUniform2i"));
-  glProgramUniform2i64ARB = PFNGLPROGRAMUNIFORM2I64ARBPROC(glfwGetProcAddress("glProgramUniform2i64ARB"));
-  glProgramUniform2i64NV = PFNGLPROGRAMUNIFORM2I64NVPROC(glfwGetProcAddress("glProgramUniform2i64NV"));
-  glProgramUniform2i64vARB = PFNGLPROGRAMUNIFORM2I64VARBPROC(glfwGetProcAddress("glProgramUniform2i64vARB"));
-  glProgramUniform2i64vNV = PFNGLPROGRAMUNIFORM2I64VNVPROC(glfwGetProcAddress("glProgramUniform2i64vNV"));
-  glProgramUniform2iEXT = PFNGLPROGRAMUNIFORM2IEXTPROC(glfwGetProcAddress("glProgramUniform2iEXT"));
-  glProgramUniform2iv = PFNGLPROGRAMUNIFORM2IVPROC(glfwGetProcAddress("glProgramUniform2iv"));
-  glProgramUniform2ivEXT = PFNGLPROGRAMUNIFORM2IVEXTPROC(glfwGetProcAddress("glProgramUniform2ivEXT"));
-  glProgramUniform2ui = PFNGLPROGRAMUNIFORM2UIPROC(glfwGetProcAddress("glProgramUniform2ui"));
-  glProgramUniform2ui64ARB = PFNGLPROGRAMUNIFORM2UI64ARBPROC(glfwGetProcAddress("glProgramUniform2ui64ARB"));
-  glProgramUniform2ui64NV = PFNGLPROGRAMUNIFORM2UI64NVPROC(glfwGetProcAddress("glProgramUniform2ui64NV"));
-  glProgramUniform2ui64vARB = PFNGLPROGRAMUNIFORM2UI64VARBPROC(glfwGetProcAddress("glProgramUniform2ui64vARB"));
-  glProgramUniform2ui64vNV = PFNGLPROGRAMUNIFORM2UI64VNVPROC(glfwGetProcAddress("glProgramUniform2ui64vNV"));
-  glProgramUniform2uiEXT = PFNGLPROGRAMUNIFORM2UIEXTPROC(glfwGetProcAddress("glProgramUniform2uiEXT"));
-  glProgramUniform2uiv = PFNGLPROGRAMUNIFORM2UIVPROC(glfwGetProcAddress("glProgramUniform2uiv"));
-  glProgramUniform2uivEXT = PFNGLPROGRAMUNIFORM2UIVEXTPROC(glfwGetProcAddress("glProgramUniform2uivEXT"));
-  glProgramUniform3d = PFNGLPROGRAMUNIFORM3DPROC(glfwGetProcAddress("glProgramUniform3d"));
-  glProgramUniform3dEXT = PFNGLPROGRAMUNIFORM3DEXTPROC(glfwGetProcAddress("glProgramUniform3dEXT"));
-  glProgramUniform3dv = PFNGLPROGRAMUNIFORM3DVPROC(glfwGetProcAddress("glProgramUniform3dv"));
-  glProgramUniform3dvEXT = PFNGLPROGRAMUNIFORM3DVEXTPROC(glfwGetProcAddress("glProgramUniform3dvEXT"));
-  glProgramUniform3f = PFNGLPROGRAMUNIFORM3FPROC(glfwGetProcAddress("glProgramUniform3f"));
-  glProgramUniform3fEXT = PFNGLPROGRAMUNIFORM3FEXTPROC(glfwGetProcAddress("glProgramUniform3fEXT"));
-  glProgramUniform3fv = PFNGLPROGRAMUNIFORM3FVPROC(glfwGetProcAddress("glProgramUniform3fv"));
-  glProgramUniform3fvEXT = PFNGLPROGRAMUNIFORM3FVEXTPROC(glfwGetProcAddress("glProgramUniform3fvEXT"));
-  glProgramUniform3i = PFNGLPROGRAMUNIFORM3IPROC(glfwGetProcAddress("glProgramUniform3i"));
-  glProgramUniform3i64ARB = PFNGLPROGRAMUNIFORM3I64ARBPROC(glfwGetProcAddress("glProgramUniform3i64ARB"));
-  glProgramUniform3i64NV = PFNGLPROGRAMUNIFORM3I64NVPROC(glfwGetProcAddress("glProgramUniform3i64NV"));
-  glProgramUniform3i64vARB = PFNGLPROGRAMUNIFORM3I64VARBPROC(glfwGetProcAddress("glProgramUniform3i64vARB"));
-  glProgramUniform3i64vNV = PFNGLPROGRAMUNIFORM3I64VNVPROC(glfwGetProcAddress("glProgramUniform3i64vNV"));
-  glProgramUniform3iEXT = PFNGLPROGRAMUNIFORM3IEXTPROC(glfwGetProcAddress("glProgramUniform3iEXT"));
-  glProgramUniform3iv = PFNGLPROGRAMUNIFORM3IVPROC(glfwGetProcAddress("glProgramUniform3iv"));
-  glProgramUniform3ivEXT = PFNGLPROGRAMUNIFORM3IVEXTPROC(glfwGetProcAddress("glProgramUniform3ivEXT"));
-  glProgramUniform3ui = PFNGLPROGRAMUNIFORM3UIPROC(glfwGetProcAddress("glProgramUniform3ui"));
-  glProgramUniform3ui64ARB = PFNGLPROGRAMUNIFORM3UI64ARBPROC(glfwGetProcAddress("glProgramUniform3ui64ARB"));
-  glProgramUniform3ui64NV = PFNGLPROGRAMUNIFORM3UI64NVPROC(glfwGetProcAddress("glProgramUniform3ui64NV"));
-  glProgramUniform3ui64vARB = PFNGLPROGRAMUNIFORM3UI64VARBPROC(glfwGetProcAddress("glProgramUniform3ui64vARB"));
-  glProgramUniform3ui64vNV = PFNGLPROGRAMUNIFORM3UI64VNVPROC(glfwGetProcAddress("glProgramUniform3ui64vNV"));
-  glProgramUniform3uiEXT = PFNGLPROGRAMUNIFORM3UIEXTPROC(glfwGetProcAddress("glProgramUniform3uiEXT"));
-  glProgramUniform3uiv = PFNGLPROGRAMUNIFORM3UIVPROC(glfwGetProcAddress("glProgramUniform3uiv"));
-  glProgramUniform3uivEXT = PFNGLPROGRAMUNIFORM3UIVEXTPROC(glfwGetProcAddress("glProgramUniform3uivEXT"));
-  glProgramUniform4d = PFNGLPROGRAMUNIFORM4DPROC(glfwGetProcAddress("glProgramUniform4d"));
-  glProgramUniform4dEXT = PFNGLPROGRAMUNIFORM4DEXTPROC(glfwGetProcAddress("glProgramUniform4dEXT"));
-  glProgramUniform4dv = PFNGLPROGRAMUNIFORM4DVPROC(glfwGetProcAddress("glProgramUniform4dv"));
-  glProgramUniform4dvEXT = PFNGLPROGRAMUNIFORM4DVEXTPROC(glfwGetProcAddress("glProgramUniform4dvEXT"));
-  glProgramUniform4f = PFNGLPROGRAMUNIFORM4FPROC(glfwGetProcAddress("glProgramUniform4f"));
-  glProgramUniform4fEXT = PFNGLPROGRAMUNIFORM4FEXTPROC(glfwGetProcAddress("glProgramUniform4fEXT"));
-  glProgramUniform4fv = PFNGLPROGRAMUNIFORM4FVPROC(glfwGetProcAddress("glProgramUniform4fv"));
-  glProgramUniform4fvEXT = PFNGLPROGRAMUNIFORM4FVEXTPROC(glfwGetProcAddress("glProgramUniform4fvEXT"));
-  glProgramUniform4i = PFNGLPROGRAMUNIFORM4IPROC(glfwGetProcAddress("glProgramUniform4i"));
-  glProgramUniform4i64ARB = PFNGLPROGRAMUNIFORM4I64ARBPROC(glfwGetProcAddress("glProgramUniform4i64ARB"));
-  glProgramUniform4i64NV = PFNGLPROGRAMUNIFORM4I64NVPROC(glfwGetProcAddress("glProgramUniform4i64NV"));
-  glProgramUniform4i64vARB = PFNGLPROGRAMUNIFORM4I64VARBPROC(glfwGetProcAddress("glProgramUniform4i64vARB"));
-  glProgramUniform4i64vNV = PFNGLPROGRAMUNIFORM4I64VNVPROC(glfwGetProcAddress("glProgramUniform4i64vNV"));
-  glProgramUniform4iEXT = PFNGLPROGRAMUNIFORM4IEXTPROC(glfwGetProcAddress("glProgramUniform4iEXT"));
-  glProgramUniform4iv = PFNGLPROGRAMUNIFORM4IVPROC(glfwGetProcAddress("glProgramUniform4iv"));
-  glProgramUniform4ivEXT = PFNGLPROGRAMUNIFORM4IVEXTPROC(glfwGetProcAddress("glProgramUniform4ivEXT"));
-  glProgramUniform4ui = PFNGLPROGRAMUNIFORM4UIPROC(glfwGetProcAddress("glProgramUniform4ui"));
-  glProgramUniform4ui64ARB = PFNGLPROGRAMUNIFORM4UI64ARBPROC(glfwGetProcAddress("glProgramUniform4ui64ARB"));
-  glProgramUniform4ui64NV = PFNGLPROGRAMUNIFORM4UI64NVPROC(glfwGetProcAddress("glProgramUniform4ui64NV"));
-  glProgramUniform4ui64vARB = PFNGLPROGRAMUNIFORM4UI64VARBPROC(glfwGetProcAddress("glProgramUniform4ui64vARB"));
-  glProgramUniform4ui64vNV = PFNGLPROGRAMUNIFORM4UI64VNVPROC(glfwGetProcAddress("glProgramUniform4ui64vNV"));
-  glProgramUniform4uiEXT = PFNGLPROGRAMUNIFORM4UIEXTPROC(glfwGetProcAddress("glProgramUniform4uiEXT"));
-  glProgramUniform4uiv = PFNGLPROGRAMUNIFORM4UIVPROC(glfwGetProcAddress("glProgramUniform4uiv"));
-  glProgramUniform4uivEXT = PFNGLPROGRAMUNIFORM4UIVEXTPROC(glfwGetProcAddress("glProgramUniform4uivEXT"));
-  glProgramUniformHandleui64ARB = PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC(glfwGetProcAddress("glProgramUniformHandleui64ARB"));
-  glProgramUniformHandleui64NV = PFNGLPROGRAMUNIFORMHANDLEUI64NVPROC(glfwGetProcAddress("glProgramUniformHandleui64NV"));
-  glProgramUniformHandleui64vARB = PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC(glfwGetProcAddress("glProgramUniformHandleui64vARB"));
-  glProgramUniformHandleui64vNV = PFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC(glfwGetProcAddress("glProgramUniformHandleui64vNV"));
-  glProgramUniformMatrix2dv = PFNGLPROGRAMUNIFORMMATRIX2DVPROC(glfwGetProcAddress("glProgramUniformMatrix2dv"));
-  glProgramUniformMatrix2dvEXT = PFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix2dvEXT"));
-  glProgramUniformMatrix2fv = PFNGLPROGRAMUNIFORMMATRIX2FVPROC(glfwGetProcAddress("glProgramUniformMatrix2fv"));
-  glProgramUniformMatrix2fvEXT = PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix2fvEXT"));
-  glProgramUniformMatrix2x3dv = PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC(glfwGetProcAddress("glProgramUniformMatrix2x3dv"));
-  glProgramUniformMatrix2x3dvEXT = PFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix2x3dvEXT"));
-  glProgramUniformMatrix2x3fv = PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC(glfwGetProcAddress("glProgramUniformMatrix2x3fv"));
-  glProgramUniformMatrix2x3fvEXT = PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix2x3fvEXT"));
-  glProgramUniformMatrix2x4dv = PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC(glfwGetProcAddress("glProgramUniformMatrix2x4dv"));
-  glProgramUniformMatrix2x4dvEXT = PFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix2x4dvEXT"));
-  glProgramUniformMatrix2x4fv = PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC(glfwGetProcAddress("glProgramUniformMatrix2x4fv"));
-  glProgramUniformMatrix2x4fvEXT = PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix2x4fvEXT"));
-  glProgramUniformMatrix3dv = PFNGLPROGRAMUNIFORMMATRIX3DVPROC(glfwGetProcAddress("glProgramUniformMatrix3dv"));
-  glProgramUniformMatrix3dvEXT = PFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix3dvEXT"));
-  glProgramUniformMatrix3fv = PFNGLPROGRAMUNIFORMMATRIX3FVPROC(glfwGetProcAddress("glProgramUniformMatrix3fv"));
-  glProgramUniformMatrix3fvEXT = PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix3fvEXT"));
-  glProgramUniformMatrix3x2dv = PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC(glfwGetProcAddress("glProgramUniformMatrix3x2dv"));
-  glProgramUniformMatrix3x2dvEXT = PFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix3x2dvEXT"));
-  glProgramUniformMatrix3x2fv = PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC(glfwGetProcAddress("glProgramUniformMatrix3x2fv"));
-  glProgramUniformMatrix3x2fvEXT = PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix3x2fvEXT"));
-  glProgramUniformMatrix3x4dv = PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC(glfwGetProcAddress("glProgramUniformMatrix3x4dv"));
-  glProgramUniformMatrix3x4dvEXT = PFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix3x4dvEXT"));
-  glProgramUniformMatrix3x4fv = PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC(glfwGetProcAddress("glProgramUniformMatrix3x4fv"));
-  glProgramUniformMatrix3x4fvEXT = PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix3x4fvEXT"));
-  glProgramUniformMatrix4dv = PFNGLPROGRAMUNIFORMMATRIX4DVPROC(glfwGetProcAddress("glProgramUniformMatrix4dv"));
-  glProgramUniformMatrix4dvEXT = PFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix4dvEXT"));
-  glProgramUniformMatrix4fv = PFNGLPROGRAMUNIFORMMATRIX4FVPROC(glfwGetProcAddress("glProgramUniformMatrix4fv"));
-  glProgramUniformMatrix4fvEXT = PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix4fvEXT"));
-  glProgramUniformMatrix4x2dv = PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC(glfwGetProcAddress("glProgramUniformMatrix4x2dv"));
-  glProgramUniformMatrix4x2dvEXT = PFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix4x2dvEXT"));
-  glProgramUniformMatrix4x2fv = PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC(glfwGetProcAddress("glProgramUniformMatrix4x2fv"));
-  glProgramUniformMatrix4x2fvEXT = PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix4x2fvEXT"));
-  glProgramUniformMatrix4x3dv = PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC(glfwGetProcAddress("glProgramUniformMatrix4x3dv"));
-  glProgramUniformMatrix4x3dvEXT = PFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix4x3dvEXT"));
-  glProgramUniformMatrix4x3fv = PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC(glfwGetProcAddress("glProgramUniformMatrix4x3fv"));
-  glProgramUniformMatrix4x3fvEXT = PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC(glfwGetProcAddress("glProgramUniformMatrix4x3fvEXT"));
-  glProgramUniformui64NV = PFNGLPROGRAMUNIFORMUI64NVPROC(glfwGetProcAddress("glProgramUniformui64NV"));
-  glProgramUniformui64vNV = PFNGLPROGRAMUNIFORMUI64VNVPROC(glfwGetProcAddress("glProgramUniformui64vNV"));
-  glProvokingVertex = PFNGLPROVOKINGVERTEXPROC(glfwGetProcAddress("glProvokingVertex"));
-  glPushClientAttribDefaultEXT = PFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC(glfwGetProcAddress("glPushClientAttribDefaultEXT"));
-  glPushDebugGroup = PFNGLPUSHDEBUGGROUPPROC(glfwGetProcAddress("glPushDebugGroup"));
-  glPushGroupMarkerEXT = PFNGLPUSHGROUPMARKEREXTPROC(glfwGetProcAddress("glPushGroupMarkerEXT"));
-  glQueryCounter = PFNGLQUERYCOUNTERPROC(glfwGetProcAddress("glQueryCounter"));
-  glRasterSamplesEXT = PFNGLRASTERSAMPLESEXTPROC(glfwGetProcAddress("glRasterSamplesEXT"));
-  glReadBuffer = PFNGLREADBUFFERPROC(glfwGetProcAddress("glReadBuffer"));
-  glReadPixels = PFNGLREADPIXELSPROC(glfwGetProcAddress("glReadPixels"));
-  glReadnPixels = PFNGLREADNPIXELSPROC(glfwGetProcAddress("glReadnPixels"));
-  glReadnPixelsARB = PFNGLREADNPIXELSARBPROC(glfwGetProcAddress("glReadnPixelsARB"));
-  glReleaseShaderCompiler = PFNGLRELEASESHADERCOMPILERPROC(glfwGetProcAddress("glReleaseShaderCompiler"));
-  glRenderbufferStorage = PFNGLRENDERBUFFERSTORAGEPROC(glfwGetProcAddress("glRenderbufferStorage"));
-  glRenderbufferStorageMultisample = PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC(glfwGetProcAddress("glRenderbufferStorageMultisample"));
-  glRenderbufferStorageMultisampleCoverageNV = PFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC(glfwGetProcAddress("glRenderbufferStorageMultisampleCoverageNV"));
-  glResolveDepthValuesNV = PFNGLRESOLVEDEPTHVALUESNVPROC(glfwGetProcAddress("glResolveDepthValuesNV"));
-  glResumeTransformFeedback = PFNGLRESUMETRANSFORMFEEDBACKPROC(glfwGetProcAddress("glResumeTransformFeedback"));
-  glSampleCoverage = PFNGLSAMPLECOVERAGEPROC(glfwGetProcAddress("glSampleCoverage"));
-  glSampleMaski = PFNGLSAMPLEMASKIPROC(glfwGetProcAddress("glSampleMaski"));
-  glSamplerParameterIiv = PFNGLSAMPLERPARAMETERIIVPROC(glfwGetProcAddress("glSamplerParameterIiv"));
-  glSamplerParameterIuiv = PFNGLSAMPLERPARAMETERIUIVPROC(glfwGetProcAddress("glSamplerParameterIuiv"));
-  glSamplerParameterf = PFNGLSAMPLERPARAMETERFPROC(glfwGetProcAddress("glSamplerParameterf"));
-  glSamplerParameterfv = PFNGLSAMPLERPARAMETERFVPROC(glfwGetProcAddress("glSamplerParameterfv"));
-  glSamplerParameteri = PFNGLSAMPLERPARAMETERIPROC(glfwGetProcAddress("glSamplerParameteri"));
-  glSamplerParameteriv = PFNGLSAMPLERPARAMETERIVPROC(glfwGetProcAddress("glSamplerParameteriv"));
-  glScissor = PFNGLSCISSORPROC(glfwGetProcAddress("glScissor"));
-  glScissorArrayv = PFNGLSCISSORARRAYVPROC(glfwGetProcAddress("glScissorArrayv"));
-  glScissorIndexed = PFNGLSCISSORINDEXEDPROC(glfwGetProcAddress("glScissorIndexed"));
-  glScissorIndexedv = PFNGLSCISSORINDEXEDVPROC(glfwGetProcAddress("glScissorIndexedv"));
-  glSecondaryColorFormatNV = PFNGLSECONDARYCOLORFORMATNVPROC(glfwGetProcAddress("glSecondaryColorFormatNV"));
-  glSelectPerfMonitorCountersAMD = PFNGLSELECTPERFMONITORCOUNTERSAMDPROC(glfwGetProcAddress("glSelectPerfMonitorCountersAMD"));
-  glShaderBinary = PFNGLSHADERBINARYPROC(glfwGetProcAddress("glShaderBinary"));
-  glShaderSource = PFNGLSHADERSOURCEPROC(glfwGetProcAddress("glShaderSource"));
-  glShaderStorageBlockBinding = PFNGLSHADERSTORAGEBLOCKBINDINGPROC(glfwGetProcAddress("glShaderStorageBlockBinding"));
-  glSignalVkFenceNV = PFNGLSIGNALVKFENCENVPROC(glfwGetProcAddress("glSignalVkFenceNV"));
-  glSignalVkSemaphoreNV = PFNGLSIGNALVKSEMAPHORENVPROC(glfwGetProcAddress("glSignalVkSemaphoreNV"));
-  glSpecializeShaderARB = PFNGLSPECIALIZESHADERARBPROC(glfwGetProcAddress("glSpecializeShaderARB"));
-  glStateCaptureNV = PFNGLSTATECAPTURENVPROC(glfwGetProcAddress("glStateCaptureNV"));
-  glStencilFillPathInstancedNV = PFNGLSTENCILFILLPATHINSTANCEDNVPROC(glfwGetProcAddress("glStencilFillPathInstancedNV"));
-  glStencilFillPathNV = PFNGLSTENCILFILLPATHNVPROC(glfwGetProcAddress("glStencilFillPathNV"));
-  glStencilFunc = PFNGLSTENCILFUNCPROC(glfwGetProcAddress("glStencilFunc"));
-  glStencilFuncSeparate = PFNGLSTENCILFUNCSEPARATEPROC(glfwGetProcAddress("glStencilFuncSeparate"));
-  glStencilMask = PFNGLSTENCILMASKPROC(glfwGetProcAddress("glStencilMask"));
-  glStencilMaskSeparate = PFNGLSTENCILMASKSEPARATEPROC(glfwGetProcAddress("glStencilMaskSeparate"));
-  glStencilOp = PFNGLSTENCILOPPROC(glfwGetProcAddress("glStencilOp"));
-  glStencilOpSeparate = PFNGLSTENCILOPSEPARATEPROC(glfwGetProcAddress("glStencilOpSeparate"));
-  glStencilStrokePathInstancedNV = PFNGLSTENCILSTROKEPATHINSTANCEDNVPROC(glfwGetProcAddress("glStencilStrokePathInstancedNV"));
-  glStencilStrokePathNV = PFNGLSTENCILSTROKEPATHNVPROC(glfwGetProcAddress("glStencilStrokePathNV"));
-  glStencilThenCoverFillPathInstancedNV = PFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC(glfwGetProcAddress("glStencilThenCoverFillPathInstancedNV"));
-  glStencilThenCoverFillPathNV = PFNGLSTENCILTHENCOVERFILLPATHNVPROC(glfwGetProcAddress("glStencilThenCoverFillPathNV"));
-  glStencilThenCoverStrokePathInstancedNV = PFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC(glfwGetProcAddress("glStencilThenCoverStrokePathInstancedNV"));
-  glStencilThenCoverStrokePathNV = PFNGLSTENCILTHENCOVERSTROKEPATHNVPROC(glfwGetProcAddress("glStencilThenCoverStrokePathNV"));
-  glSubpixelPrecisionBiasNV = PFNGLSUBPIXELPRECISIONBIASNVPROC(glfwGetProcAddress("glSubpixelPrecisionBiasNV"));
-  glTexBuffer = PFNGLTEXBUFFERPROC(glfwGetProcAddress("glTexBuffer"));
-  glTexBufferARB = PFNGLTEXBUFFERARBPROC(glfwGetProcAddress("glTexBufferARB"));
-  glTexBufferRange = PFNGLTEXBUFFERRANGEPROC(glfwGetProcAddress("glTexBufferRange"));
-  glTexCoordFormatNV = PFNGLTEXCOORDFORMATNVPROC(glfwGetProcAddress("glTexCoordFormatNV"));
-  glTexImage1D = PFNGLTEXIMAGE1DPROC(glfwGetProcAddress("glTexImage1D"));
-  glTexImage2D = PFNGLTEXIMAGE2DPROC(glfwGetProcAddress("glTexImage2D"));
-  glTexImage2DMultisample = PFNGLTEXIMAGE2DMULTISAMPLEPROC(glfwGetProcAddress("glTexImage2DMultisample"));
-  glTexImage3D = PFNGLTEXIMAGE3DPROC(glfwGetProcAddress("glTexImage3D"));
-  glTexImage3DMultisample = PFNGLTEXIMAGE3DMULTISAMPLEPROC(glfwGetProcAddress("glTexImage3DMultisample"));
-  glTexPageCommitmentARB = PFNGLTEXPAGECOMMITMENTARBPROC(glfwGetProcAddress("glTexPageCommitmentARB"));
-  glTexParameterIiv = PFNGLTEXPARAMETERIIVPROC(glfwGetProcAddress("glTexParameterIiv"));
-  glTexParameterIuiv = PFNGLTEXPARAMETERIUIVPROC(glfwGetProcAddress("glTexParameterIuiv"));
-  glTexParameterf = PFNGLTEXPARAMETERFPROC(glfwGetProcAddress("glTexParameterf"));
-  glTexParameterfv = PFNGLTEXPARAMETERFVPROC(glfwGetProcAddress("glTexParameterfv"));
-  glTexParameteri = PFNGLTEXPARAMETERIPROC(glfwGetProcAddress("glTexParameteri"));
-  glTexParameteriv = PFNGLTEXPARAMETERIVPROC(glfwGetProcAddress("glTexParameteriv"));
-  glTexStorage1D = PFNGLTEXSTORAGE1DPROC(glfwGetProcAddress("glTexStorage1D"));
-  glTexStorage2D = PFNGLTEXSTORAGE2DPROC(glfwGetProcAddress("glTexStorage2D"));
-  glTexStorage2DMultisample = PFNGLTEXSTORAGE2DMULTISAMPLEPROC(glfwGetProcAddress("glTexStorage2DMultisample"));
-  glTexStorage3D = PFNGLTEXSTORAGE3DPROC(glfwGetProcAddress("glTexStorage3D"));
-  glTexStorage3DMultisample = PFNGLTEXSTORAGE3DMULTISAMPLEPROC(glfwGetProcAddress("glTexStorage3DMultisample"));
-  glTexSubImage1D = PFNGLTEXSUBIMAGE1DPROC(glfwGetProcAddress("glTexSubImage1D"));
-  glTexSubImage2D = PFNGLTEXSUBIMAGE2DPROC(glfwGetProcAddress("glTexSubImage2D"));
-  glTexSubImage3D = PFNGLTEXSUBIMAGE3DPROC(glfwGetProcAddress("glTexSubImage3D"));
-  glTextureBarrier = PFNGLTEXTUREBARRIERPROC(glfwGetProcAddress("glTextureBarrier"));
-  glTextureBarrierNV = PFNGLTEXTUREBARRIERNVPROC(glfwGetProcAddress("glTextureBarrierNV"));
-  glTextureBuffer = PFNGLTEXTUREBUFFERPROC(glfwGetProcAddress("glTextureBuffer"));
-  glTextureBufferEXT = PFNGLTEXTUREBUFFEREXTPROC(glfwGetProcAddress("glTextureBufferEXT"));
-  glTextureBufferRange = PFNGLTEXTUREBUFFERRANGEPROC(glfwGetProcAddress("glTextureBufferRange"));
-  glTextureBufferRangeEXT = PFNGLTEXTUREBUFFERRANGEEXTPROC(glfwGetProcAddress("glTextureBufferRangeEXT"));
-  glTextureImage1DEXT = PFNGLTEXTUREIMAGE1DEXTPROC(glfwGetProcAddress("glTextureImage1DEXT"));
-  glTextureImage2DEXT = PFNGLTEXTUREIMAGE2DEXTPROC(glfwGetProcAddress("glTextureImage2DEXT"));
-  glTextureImage3DEXT = PFNGLTEXTUREIMAGE3DEXTPROC(glfwGetProcAddress("glTextureImage3DEXT"));
-  glTexturePageCommitmentEXT = PFNGLTEXTUREPAGECOMMITMENTEXTPROC(glfwGetProcAddress("glTexturePageCommitmentEXT"));
-  glTextureParameterIiv = PFNGLTEXTUREPARAMETERIIVPROC(glfwGetProcAddress("glTextureParameterIiv"));
-  glTextureParameterIivEXT = PFNGLTEXTUREPARAMETERIIVEXTPROC(glfwGetProcAddress("glTextureParameterIivEXT"));
-  glTextureParameterIuiv = PFNGLTEXTUREPARAMETERIUIVPROC(glfwGetProcAddress("glTextureParameterIuiv"));
-  glTextureParameterIuivEXT = PFNGLTEXTUREPARAMETERIUIVEXTPROC(glfwGetProcAddress("glTextureParameterIuivEXT"));
-  glTextureParameterf = PFNGLTEXTUREPARAMETERFPROC(glfwGetProcAddress("glTextureParameterf"));
-  glTextureParameterfEXT = PFNGLTEXTUREPARAMETERFEXTPROC(glfwGetProcAddress("glTextureParameterfEXT"));
-  glTextureParameterfv = PFNGLTEXTUREPARAMETERFVPROC(glfwGetProcAddress("glTextureParameterfv"));
-  glTextureParameterfvEXT = PFNGLTEXTUREPARAMETERFVEXTPROC(glfwGetProcAddress("glTextureParameterfvEXT"));
-  glTextureParameteri = PFNGLTEXTUREPARAMETERIPROC(glfwGetProcAddress("glTextureParameteri"));
-  glTextureParameteriEXT = PFNGLTEXTUREPARAMETERIEXTPROC(glfwGetProcAddress("glTextureParameteriEXT"));
-  glTextureParameteriv = PFNGLTEXTUREPARAMETERIVPROC(glfwGetProcAddress("glTextureParameteriv"));
-  glTextureParameterivEXT = PFNGLTEXTUREPARAMETERIVEXTPROC(glfwGetProcAddress("glTextureParameterivEXT"));
-  glTextureRenderbufferEXT = PFNGLTEXTURERENDERBUFFEREXTPROC(glfwGetProcAddress("glTextureRenderbufferEXT"));
-  glTextureStorage1D = PFNGLTEXTURESTORAGE1DPROC(glfwGetProcAddress("glTextureStorage1D"));
-  glTextureStorage1DEXT = PFNGLTEXTURESTORAGE1DEXTPROC(glfwGetProcAddress("glTextureStorage1DEXT"));
-  glTextureStorage2D = PFNGLTEXTURESTORAGE2DPROC(glfwGetProcAddress("glTextureStorage2D"));
-  glTextureStorage2DEXT = PFNGLTEXTURESTORAGE2DEXTPROC(glfwGetProcAddress("glTextureStorage2DEXT"));
-  glTextureStorage2DMultisample = PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC(glfwGetProcAddress("glTextureStorage2DMultisample"));
-  glTextureStorage2DMultisampleEXT = PFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC(glfwGetProcAddress("glTextureStorage2DMultisampleEXT"));
-  glTextureStorage3D = PFNGLTEXTURESTORAGE3DPROC(glfwGetProcAddress("glTextureStorage3D"));
-  glTextureStorage3DEXT = PFNGLTEXTURESTORAGE3DEXTPROC(glfwGetProcAddress("glTextureStorage3DEXT"));
-  glTextureStorage3DMultisample = PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC(glfwGetProcAddress("glTextureStorage3DMultisample"));
-  glTextureStorage3DMultisampleEXT = PFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC(glfwGetProcAddress("glTextureStorage3DMultisampleEXT"));
-  glTextureSubImage1D = PFNGLTEXTURESUBIMAGE1DPROC(glfwGetProcAddress("glTextureSubImage1D"));
-  glTextureSubImage1DEXT = PFNGLTEXTURESUBIMAGE1DEXTPROC(glfwGetProcAddress("glTextureSubImage1DEXT"));
-  glTextureSubImage2D = PFNGLTEXTURESUBIMAGE2DPROC(glfwGetProcAddress("glTextureSubImage2D"));
-  glTextureSubImage2DEXT = PFNGLTEXTURESUBIMAGE2DEXTPROC(glfwGetProcAddress("glTextureSubImage2DEXT"));
-  glTextureSubImage3D = PFNGLTEXTURESUBIMAGE3DPROC(glfwGetProcAddress("glTextureSubImage3D"));
-  glTextureSubImage3DEXT = PFNGLTEXTURESUBIMAGE3DEXTPROC(glfwGetProcAddress("glTextureSubImage3DEXT"));
-  glTextureView = PFNGLTEXTUREVIEWPROC(glfwGetProcAddress("glTextureView"));
-  glTransformFeedbackBufferBase = PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC(glfwGetProcAddress("glTransformFeedbackBufferBase"));
-  glTransformFeedbackBufferRange = PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC(glfwGetProcAddress("glTransformFeedbackBufferRange"));
-  glTransformFeedbackVaryings = PFNGLTRANSFORMFEEDBACKVARYINGSPROC(glfwGetProcAddress("glTransformFeedbackVaryings"));
-  glTransformPathNV = PFNGLTRANSFORMPATHNVPROC(glfwGetProcAddress("glTransformPathNV"));
-  glUniform1d = PFNGLUNIFORM1DPROC(glfwGetProcAddress("glUniform1d"));
-  glUniform1dv = PFNGLUNIFORM1DVPROC(glfwGetProcAddress("glUniform1dv"));
-  glUniform1f = PFNGLUNIFORM1FPROC(glfwGetProcAddress("glUniform1f"));
-  glUniform1fv = PFNGLUNIFORM1FVPROC(glfwGetProcAddress("glUniform1fv"));
-  glUniform1i = PFNGLUNIFORM1IPROC(glfwGetProcAddress("glUniform1i"));
-  glUniform1i64ARB = PFNGLUNIFORM1I64ARBPROC(glfwGetProcAddress("glUniform1i64ARB"));
-  glUniform1i64NV = PFNGLUNIFORM1I64NVPROC(glfwGetProcAddress("glUniform1i64NV"));
-  glUniform1i64vARB = PFNGLUNIFORM1I64VARBPROC(glfwGetProcAddress("glUniform1i64vARB"));
-  glUniform1i64vNV = PFNGLUNIFORM1I64VNVPROC(glfwGetProcAddress("glUniform1i64vNV"));
-  glUniform1iv = PFNGLUNIFORM1IVPROC(glfwGetProcAddress("glUniform1iv"));
-  glUniform1ui = PFNGLUNIFORM1UIPROC(glfwGetProcAddress("glUniform1ui"));
-  glUniform1ui64ARB = PFNGLUNIFORM1UI64ARBPROC(glfwGetProcAddress("glUniform1ui64ARB"));
-  glUniform1ui64NV = PFNGLUNIFORM1UI64NVPROC(glfwGetProcAddress("glUniform1ui64NV"));
-  glUniform1ui64vARB = PFNGLUNIFORM1UI64VARBPROC(glfwGetProcAddress("glUniform1ui64vARB"));
-  glUniform1ui64vNV = PFNGLUNIFORM1UI64VNVPROC(glfwGetProcAddress("glUniform1ui64vNV"));
-  glUniform1uiv = PFNGLUNIFORM1UIVPROC(glfwGetProcAddress("glUniform1uiv"));
-  glUniform2d = PFNGLUNIFORM2DPROC(glfwGetProcAddress("glUniform2d"));
-  glUniform2dv = PFNGLUNIFORM2DVPROC(glfwGetProcAddress("glUniform2dv"));
-  glUniform2f = PFNGLUNIFORM2FPROC(glfwGetProcAddress("glUniform2f"));
-  glUniform2fv = PFNGLUNIFORM2FVPROC(glfwGetProcAddress("glUniform2fv"));
-  glUniform2i = PFNGLUNIFORM2IPROC(glfwGetProcAddress("glUniform2i"));
-  glUniform2i64ARB = PFNGLUNIFORM2I64ARBPROC(glfwGetProcAddress("glUniform2i64ARB"));
-  glUniform2i64NV = PFNGLUNIFORM2I64NVPROC(glfwGetProcAddress("glUniform2i64NV"));
-  glUniform2i64vARB = PFNGLUNIFORM2I64VARBPROC(glfwGetProcAddress("glUniform2i64vARB"));
-  glUniform2i64vNV = PFNGLUNIFORM2I64VNVPROC(glfwGetProcAddress("glUniform2i64vNV"));
-  glUniform2iv = PFNGLUNIFORM2IVPROC(glfwGetProcAddress("glUniform2iv"));
-  glUniform2ui = PFNGLUNIFORM2UIPROC(glfwGetProcAddress("glUniform2ui"));
-  glUniform2ui64ARB = PFNGLUNIFORM2UI64ARBPROC(glfwGetProcAddress("glUniform2ui64ARB"));
-  glUniform2ui64NV = PFNGLUNIFORM2UI64NVPROC(glfwGetProcAddress("glUniform2ui64NV"));
-  glUniform2ui64vARB = PFNGLUNIFORM2UI64VARBPROC(glfwGetProcAddress("glUniform2ui64vARB"));
-  glUniform2ui64vNV = PFNGLUNIFORM2UI64VNVPROC(glfwGetProcAddress("glUniform2ui64vNV"));
-  glUniform2uiv = PFNGLUNIFORM2UIVPROC(glfwGetProcAddress("glUniform2uiv"));
-  glUniform3d = PFNGLUNIFORM3DPROC(glfwGetProcAddress("glUniform3d"));
-  glUniform3dv = PFNGLUNIFORM3DVPROC(glfwGetProcAddress("glUniform3dv"));
-  glUniform3f = PFNGLUNIFORM3FPROC(glfwGetProcAddress("glUniform3f"));
-  glUniform3fv = PFNGLUNIFORM3FVPROC(glfwGetProcAddress("glUniform3fv"));
-  glUniform3i = PFNGLUNIFORM3IPROC(glfwGetProcAddress("glUniform3i"));
-  glUniform3i64ARB = PFNGLUNIFORM3I64ARBPROC(glfwGetProcAddress("glUniform3i64ARB"));
-  glUniform3i64NV = PFNGLUNIFORM3I64NVPROC(glfwGetProcAddress("glUniform3i64NV"));
-  glUniform3i64vARB = PFNGLUNIFORM3I64VARBPROC(glfwGetProcAddress("glUniform3i64vARB"));
-  glUniform3i64vNV = PFNGLUNIFORM3I64VNVPROC(glfwGetProcAddress("glUniform3i64vNV"));
-  glUniform3iv = PFNGLUNIFORM3IVPROC(glfwGetProcAddress("glUniform3iv"));
-  glUniform3ui = PFNGLUNIFORM3UIPROC(glfwGetProcAddress("glUniform3ui"));
-  glUniform3ui64ARB = PFNGLUNIFORM3UI64ARBPROC(glfwGetProcAddress("glUniform3ui64ARB"));
-  glUniform3ui64NV = PFNGLUNIFORM3UI64NVPROC(glfwGetProcAddress("glUniform3ui64NV"));
-  glUniform3ui64vARB = PFNGLUNIFORM3UI64VARBPROC(glfwGetProcAddress("glUniform3ui64vARB"));
-  glUniform3ui64vNV = PFNGLUNIFORM3UI64VNVPROC(glfwGetProcAddress("glUniform3ui64vNV"));
-  glUniform3uiv = PFNGLUNIFORM3UIVPROC(glfwGetProcAddress("glUniform3uiv"));
-  glUniform4d = PFNGLUNIFORM4DPROC(glfwGetProcAddress("glUniform4d"));
-  glUniform4dv = PFNGLUNIFORM4DVPROC(glfwGetProcAddress("glUniform4dv"));
-  glUniform4f = PFNGLUNIFORM4FPROC(glfwGetProcAddress("glUniform4f"));
-  glUniform4fv = PFNGLUNIFORM4FVPROC(glfwGetProcAddress("glUniform4fv"));
-  glUniform4i = PFNGLUNIFORM4IPROC(glfwGetProcAddress("glUniform4i"));
-  glUniform4i64ARB = PFNGLUNIFORM4I64ARBPROC(glfwGetProcAddress("glUniform4i64ARB"));
-  glUniform4i64NV = PFNGLUNIFORM4I64NVPROC(glfwGetProcAddress("glUniform4i64NV"));
-  glUniform4i64vARB = PFNGLUNIFORM4I64VARBPROC(glfwGetProcAddress("glUniform4i64vARB"));
-  glUniform4i64vNV = PFNGLUNIFORM4I64VNVPROC(glfwGetProcAddress("glUniform4i64vNV"));
-  glUniform4iv = PFNGLUNIFORM4IVPROC(glfwGetProcAddress("glUniform4iv"));
-  glUniform4ui = PFNGLUNIFORM4UIPROC(glfwGetProcAddress("glUniform4ui"));
-  glUniform4ui64ARB = PFNGLUNIFORM4UI64ARBPROC(glfwGetProcAddress("glUniform4ui64ARB"));
-  glUniform4ui64NV = PFNGLUNIFORM4UI64NVPROC(glfwGetProcAddress("glUniform4ui64NV"));
-  glUniform4ui64vARB = PFNGLUNIFORM4UI64VARBPROC(glfwGetProcAddress("glUniform4ui64vARB"));
-  glUniform4ui64vNV = PFNGLUNIFORM4UI64VNVPROC(glfwGetProcAddress("glUniform4ui64vNV"));
-  glUniform4uiv = PFNGLUNIFORM4UIVPROC(glfwGetProcAddress("glUniform4uiv"));
-  glUniformBlockBinding = PFNGLUNIFORMBLOCKBINDINGPROC(glfwGetProcAddress("glUniformBlockBinding"));
-  glUniformHandleui64ARB = PFNGLUNIFORMHANDLEUI64ARBPROC(glfwGetProcAddress("glUniformHandleui64ARB"));
-  glUniformHandleui64NV = PFNGLUNIFORMHANDLEUI64NVPROC(glfwGetProcAddress("glUniformHandleui64NV"));
-  glUniformHandleui64vARB = PFNGLUNIFORMHANDLEUI64VARBPROC(glfwGetProcAddress("glUniformHandleui64vARB"));
-  glUniformHandleui64vNV = PFNGLUNIFORMHANDLEUI64VNVPROC(glfwGetProcAddress("glUniformHandleui64vNV"));
-  glUniformMatrix2dv = PFNGLUNIFORMMATRIX2DVPROC(glfwGetProcAddress("glUniformMatrix2dv"));
-  glUniformMatrix2fv = PFNGLUNIFORMMATRIX2FVPROC(glfwGetProcAddress("glUniformMatrix2fv"));
-  glUniformMatrix2x3dv = PFNGLUNIFORMMATRIX2X3DVPROC(glfwGetProcAddress("glUniformMatrix2x3dv"));
-  glUniformMatrix2x3fv = PFNGLUNIFORMMATRIX2X3FVPROC(glfwGetProcAddress("glUniformMatrix2x3fv"));
-  glUniformMatrix2x4dv = PFNGLUNIFORMMATRIX2X4DVPROC(glfwGetProcAddress("glUniformMatrix2x4dv"));
-  glUniformMatrix2x4fv = PFNGLUNIFORMMATRIX2X4FVPROC(glfwGetProcAddress("glUniformMatrix2x4fv"));
-  glUniformMatrix3dv = PFNGLUNIFORMMATRIX3DVPROC(glfwGetProcAddress("glUniformMatrix3dv"));
-  glUniformMatrix3fv = PFNGLUNIFORMMATRIX3FVPROC(glfwGetProcAddress("glUniformMatrix3fv"));
-  glUniformMatrix3x2dv = PFNGLUNIFORMMATRIX3X2DVPROC(glfwGetProcAddress("glUniformMatrix3x2dv"));
-  glUniformMatrix3x2fv = PFNGLUNIFORMMATRIX3X2FVPROC(glfwGetProcAddress("glUniformMatrix3x2fv"));
-  glUniformMatrix3x4dv = PFNGLUNIFORMMATRIX3X4DVPROC(glfwGetProcAddress("glUniformMatrix3x4dv"));
-  glUniformMatrix3x4fv = PFNGLUNIFORMMATRIX3X4FVPROC(glfwGetProcAddress("glUniformMatrix3x4fv"));
-  glUniformMatrix4dv = PFNGLUNIFORMMATRIX4DVPROC(glfwGetProcAddress("glUniformMatrix4dv"));
-  glUniformMatrix4fv = PFNGLUNIFORMMATRIX4FVPROC(glfwGetProcAddress("glUniformMatrix4fv"));
-  glUniformMatrix4x2dv = PFNGLUNIFORMMATRIX4X2DVPROC(glfwGetProcAddress("glUniformMatrix4x2dv"));
-  glUniformMatrix4x2fv = PFNGLUNIFORMMATRIX4X2FVPROC(glfwGetProcAddress("glUniformMatrix4x2fv"));
-  glUniformMatrix4x3dv = PFNGLUNIFORMMATRIX4X3DVPROC(glfwGetProcAddress("glUniformMatrix4x3dv"));
-  glUniformMatrix4x3fv = PFNGLUNIFORMMATRIX4X3FVPROC(glfwGetProcAddress("glUniformMatrix4x3fv"));
-  glUniformSubroutinesuiv = PFNGLUNIFORMSUBROUTINESUIVPROC(glfwGetProcAddress("glUniformSubroutinesuiv"));
-  glUniformui64NV = PFNGLUNIFORMUI64NVPROC(glfwGetProcAddress("glUniformui64NV"));
-  glUniformui64vNV = PFNGLUNIFORMUI64VNVPROC(glfwGetProcAddress("glUniformui64vNV"));
-  glUnmapBuffer = PFNGLUNMAPBUFFERPROC(glfwGetProcAddress("glUnmapBuffer"));
-  glUnmapNamedBuffer = PFNGLUNMAPNAMEDBUFFERPROC(glfwGetProcAddress("glUnmapNamedBuffer"));
-  glUnmapNamedBufferEXT = PFNGLUNMAPNAMEDBUFFEREXTPROC(glfwGetProcAddress("glUnmapNamedBufferEXT"));
-  glUseProgram = PFNGLUSEPROGRAMPROC(glfwGetProcAddress("glUseProgram"));
-  glUseProgramStages = PFNGLUSEPROGRAMSTAGESPROC(glfwGetProcAddress("glUseProgramStages"));
-  glUseShaderProgramEXT = PFNGLUSESHADERPROGRAMEXTPROC(glfwGetProcAddress("glUseShaderProgramEXT"));
-  glValidateProgram = PFNGLVALIDATEPROGRAMPROC(glfwGetProcAddress("glValidateProgram"));
-  glValidateProgramPipeline = PFNGLVALIDATEPROGRAMPIPELINEPROC(glfwGetProcAddress("glValidateProgramPipeline"));
-  glVertexArrayAttribBinding = PFNGLVERTEXARRAYATTRIBBINDINGPROC(glfwGetProcAddress("glVertexArrayAttribBinding"));
-  glVertexArrayAttribFormat = PFNGLVERTEXARRAYATTRIBFORMATPROC(glfwGetProcAddress("glVertexArrayAttribFormat"));
-  glVertexArrayAttribIFormat = PFNGLVERTEXARRAYATTRIBIFORMATPROC(glfwGetProcAddress("glVertexArrayAttribIFormat"));
-  glVertexArrayAttribLFormat = PFNGLVERTEXARRAYATTRIBLFORMATPROC(glfwGetProcAddress("glVertexArrayAttribLFormat"));
-  glVertexArrayBindVertexBufferEXT = PFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC(glfwGetProcAddress("glVertexArrayBindVertexBufferEXT"));
-  glVertexArrayBindingDivisor = PFNGLVERTEXARRAYBINDINGDIVISORPROC(glfwGetProcAddress("glVertexArrayBindingDivisor"));
-  glVertexArrayColorOffsetEXT = PFNGLVERTEXARRAYCOLOROFFSETEXTPROC(glfwGetProcAddress("glVertexArrayColorOffsetEXT"));
-  glVertexArrayEdgeFlagOffsetEXT = PFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC(glfwGetProcAddress("glVertexArrayEdgeFlagOffsetEXT"));
-  glVertexArrayElementBuffer = PFNGLVERTEXARRAYELEMENTBUFFERPROC(glfwGetProcAddress("glVertexArrayElementBuffer"));
-  glVertexArrayFogCoordOffsetEXT = PFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC(glfwGetProcAddress("glVertexArrayFogCoordOffsetEXT"));
-  glVertexArrayIndexOffsetEXT = PFNGLVERTEXARRAYINDEXOFFSETEXTPROC(glfwGetProcAddress("glVertexArrayIndexOffsetEXT"));
-  glVertexArrayMultiTexCoordOffsetEXT = PFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC(glfwGetProcAddress("glVertexArrayMultiTexCoordOffsetEXT"));
-  glVertexArrayNormalOffsetEXT = PFNGLVERTEXARRAYNORMALOFFSETEXTPROC(glfwGetProcAddress("glVertexArrayNormalOffsetEXT"));
-  glVertexArraySecondaryColorOffsetEXT = PFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC(glfwGetProcAddress("glVertexArraySecondaryColorOffsetEXT"));
-  glVertexArrayTexCoordOffsetEXT = PFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC(glfwGetProcAddress("glVertexArrayTexCoordOffsetEXT"));
-  glVertexArrayVertexAttribBindingEXT = PFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC(glfwGetProcAddress("glVertexArrayVertexAttribBindingEXT"));
-  glVertexArrayVertexAttribDivisorEXT = PFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC(glfwGetProcAddress("glVertexArrayVertexAttribDivisorEXT"));
-  glVertexArrayVertexAttribFormatEXT = PFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC(glfwGetProcAddress("glVertexArrayVertexAttribFormatEXT"));
-  glVertexArrayVertexAttribIFormatEXT = PFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC(glfwGetProcAddress("glVertexArrayVertexAttribIFormatEXT"));
-  glVertexArrayVertexAttribIOffsetEXT = PFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC(glfwGetProcAddress("glVertexArrayVertexAttribIOffsetEXT"));
-  glVertexArrayVertexAttribLFormatEXT = PFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC(glfwGetProcAddress("glVertexArrayVertexAttribLFormatEXT"));
-  glVertexArrayVertexAttribLOffsetEXT = PFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC(glfwGetProcAddress("glVertexArrayVertexAttribLOffsetEXT"));
-  glVertexArrayVertexAttribOffsetEXT = PFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC(glfwGetProcAddress("glVertexArrayVertexAttribOffsetEXT"));
-  glVertexArrayVertexBindingDivisorEXT = PFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC(glfwGetProcAddress("glVertexArrayVertexBindingDivisorEXT"));
-  glVertexArrayVertexBuffer = PFNGLVERTEXARRAYVERTEXBUFFERPROC(glfwGetProcAddress("glVertexArrayVertexBuffer"));
-  glVertexArrayVertexBuffers = PFNGLVERTEXARRAYVERTEXBUFFERSPROC(glfwGetProcAddress("glVertexArrayVertexBuffers"));
-  glVertexArrayVertexOffsetEXT = PFNGLVERTEXARRAYVERTEXOFFSETEXTPROC(glfwGetProcAddress("glVertexArrayVertexOffsetEXT"));
-  glVertexAttrib1d = PFNGLVERTEXATTRIB1DPROC(glfwGetProcAddress("glVertexAttrib1d"));
-  glVertexAttrib1dv = PFNGLVERTEXATTRIB1DVPROC(glfwGetProcAddress("glVertexAttrib1dv"));
-  glVertexAttrib1f = PFNGLVERTEXATTRIB1FPROC(glfwGetProcAddress("glVertexAttrib1f"));
-  glVertexAttrib1fv = PFNGLVERTEXATTRIB1FVPROC(glfwGetProcAddress("glVertexAttrib1fv"));
-  glVertexAttrib1s = PFNGLVERTEXATTRIB1SPROC(glfwGetProcAddress("glVertexAttrib1s"));
-  glVertexAttrib1sv = PFNGLVERTEXATTRIB1SVPROC(glfwGetProcAddress("glVertexAttrib1sv"));
-  glVertexAttrib2d = PFNGLVERTEXATTRIB2DPROC(glfwGetProcAddress("glVertexAttrib2d"));
-  glVertexAttrib2dv = PFNGLVERTEXATTRIB2DVPROC(glfwGetProcAddress("glVertexAttrib2dv"));
-  glVertexAttrib2f = PFNGLVERTEXATTRIB2FPROC(glfwGetProcAddress("glVertexAttrib2f"));
-  glVertexAttrib2fv = PFNGLVERTEXATTRIB2FVPROC(glfwGetProcAddress("glVertexAttrib2fv"));
-  glVertexAttrib2s = PFNGLVERTEXATTRIB2SPROC(glfwGetProcAddress("glVertexAttrib2s"));
-  glVertexAttrib2sv = PFNGLVERTEXATTRIB2SVPROC(glfwGetProcAddress("glVertexAttrib2sv"));
-  glVertexAttrib3d = PFNGLVERTEXATTRIB3DPROC(glfwGetProcAddress("glVertexAttrib3d"));
-  glVertexAttrib3dv = PFNGLVERTEXATTRIB3DVPROC(glfwGetProcAddress("glVertexAttrib3dv"));
-  glVertexAttrib3f = PFNGLVERTEXATTRIB3FPROC(glfwGetProcAddress("glVertexAttrib3f"));
-  glVertexAttrib3fv = PFNGLVERTEXATTRIB3FVPROC(glfwGetProcAddress("glVertexAttrib3fv"));
-  glVertexAttrib3s = PFNGLVERTEXATTRIB3SPROC(glfwGetProcAddress("glVertexAttrib3s"));
-  glVertexAttrib3sv = PFNGLVERTEXATTRIB3SVPROC(glfwGetProcAddress("glVertexAttrib3sv"));
-  glVertexAttrib4Nbv = PFNGLVERTEXATTRIB4NBVPROC(glfwGetProcAddress("glVertexAttrib4Nbv"));
-  glVertexAttrib4Niv = PFNGLVERTEXATTRIB4NIVPROC(glfwGetProcAddress("glVertexAttrib4Niv"));
-  glVertexAttrib4Nsv = PFNGLVERTEXATTRIB4NSVPROC(glfwGetProcAddress("glVertexAttrib4Nsv"));
-  glVertexAttrib4Nub = PFNGLVERTEXATTRIB4NUBPROC(glfwGetProcAddress("glVertexAttrib4Nub"));
-  glVertexAttrib4Nubv = PFNGLVERTEXATTRIB4NUBVPROC(glfwGetProcAddress("glVertexAttrib4Nubv"));
-  glVertexAttrib4Nuiv = PFNGLVERTEXATTRIB4NUIVPROC(glfwGetProcAddress("glVertexAttrib4Nuiv"));
-  glVertexAttrib4Nusv = PFNGLVERTEXATTRIB4NUSVPROC(glfwGetProcAddress("glVertexAttrib4Nusv"));
-  glVertexAttrib4bv = PFNGLVERTEXATTRIB4BVPROC(glfwGetProcAddress("glVertexAttrib4bv"));
-  glVertexAttrib4d = PFNGLVERTEXATTRIB4DPROC(glfwGetProcAddress("glVertexAttrib4d"));
-  glVertexAttrib4dv = PFNGLVERTEXATTRIB4DVPROC(glfwGetProcAddress("glVertexAttrib4dv"));
-  glVertexAttrib4f = PFNGLVERTEXATTRIB4FPROC(glfwGetProcAddress("glVertexAttrib4f"));
-  glVertexAttrib4fv = PFNGLVERTEXATTRIB4FVPROC(glfwGetProcAddress("glVertexAttrib4fv"));
-  glVertexAttrib4iv = PFNGLVERTEXATTRIB4IVPROC(glfwGetProcAddress("glVertexAttrib4iv"));
-  glVertexAttrib4s = PFNGLVERTEXATTRIB4SPROC(glfwGetProcAddress("glVertexAttrib4s"));
-  glVertexAttrib4sv = PFNGLVERTEXATTRIB4SVPROC(glfwGetProcAddress("glVertexAttrib4sv"));
-  glVertexAttrib4ubv = PFNGLVERTEXATTRIB4UBVPROC(glfwGetProcAddress("glVertexAttrib4ubv"));
-  glVertexAttrib4uiv = PFNGLVERTEXATTRIB4UIVPROC(glfwGetProcAddress("glVertexAttrib4uiv"));
-  glVertexAttrib4usv = PFNGLVERTEXATTRIB4USVPROC(glfwGetProcAddress("glVertexAttrib4usv"));
-  glVertexAttribBinding = PFNGLVERTEXATTRIBBINDINGPROC(glfwGetProcAddress("glVertexAttribBinding"));
-  glVertexAttribDivisor = PFNGLVERTEXATTRIBDIVISORPROC(glfwGetProcAddress("glVertexAttribDivisor"));
-  glVertexAttribDivisorARB = PFNGLVERTEXATTRIBDIVISORARBPROC(glfwGetProcAddress("glVertexAttribDivisorARB"));
-  glVertexAttribFormat = PFNGLVERTEXATTRIBFORMATPROC(glfwGetProcAddress("glVertexAttribFormat"));
-  glVertexAttribFormatNV = PFNGLVERTEXATTRIBFORMATNVPROC(glfwGetProcAddress("glVertexAttribFormatNV"));
-  glVertexAttribI1i = PFNGLVERTEXATTRIBI1IPROC(glfwGetProcAddress("glVertexAttribI1i"));
-  glVertexAttribI1iv = PFNGLVERTEXATTRIBI1IVPROC(glfwGetProcAddress("glVertexAttribI1iv"));
-  glVertexAttribI1ui = PFNGLVERTEXATTRIBI1UIPROC(glfwGetProcAddress("glVertexAttribI1ui"));
-  glVertexAttribI1uiv = PFNGLVERTEXATTRIBI1UIVPROC(glfwGetProcAddress("glVertexAttribI1uiv"));
-  glVertexAttribI2i = PFNGLVERTEXATTRIBI2IPROC(glfwGetProcAddress("glVertexAttribI2i"));
-  glVertexAttribI2iv = PFNGLVERTEXATTRIBI2IVPROC(glfwGetProcAddress("glVertexAttribI2iv"));
-  glVertexAttribI2ui = PFNGLVERTEXATTRIBI2UIPROC(glfwGetProcAddress("glVertexAttribI2ui"));
-  glVertexAttribI2uiv = PFNGLVERTEXATTRIBI2UIVPROC(glfwGetProcAddress("glVertexAttribI2uiv"));
-  glVertexAttribI3i = PFNGLVERTEXATTRIBI3IPROC(glfwGetProcAddress("glVertexAttribI3i"));
-  glVertexAttribI3iv = PFNGLVERTEXATTRIBI3IVPROC(glfwGetProcAddress("glVertexAttribI3iv"));
-  glVertexAttribI3ui = PFNGLVERTEXATTRIBI3UIPROC(glfwGetProcAddress("glVertexAttribI3ui"));
-  glVertexAttribI3uiv = PFNGLVERTEXATTRIBI3UIVPROC(glfwGetProcAddress("glVertexAttribI3uiv"));
-  glVertexAttribI4bv = PFNGLVERTEXATTRIBI4BVPROC(glfwGetProcAddress("glVertexAttribI4bv"));
-  glVertexAttribI4i = PFNGLVERTEXATTRIBI4IPROC(glfwGetProcAddress("glVertexAttribI4i"));
-  glVertexAttribI4iv = PFNGLVERTEXATTRIBI4IVPROC(glfwGetProcAddress("glVertexAttribI4iv"));
-  glVertexAttribI4sv = PFNGLVERTEXATTRIBI4SVPROC(glfwGetProcAddress("glVertexAttribI4sv"));
-  glVertexAttribI4ubv = PFNGLVERTEXATTRIBI4UBVPROC(glfwGetProcAddress("glVertexAttribI4ubv"));
-  glVertexAttribI4ui = PFNGLVERTEXATTRIBI4UIPROC(glfwGetProcAddress("glVertexAttribI4ui"));
-  glVertexAttribI4uiv = PFNGLVERTEXATTRIBI4UIVPROC(glfwGetProcAddress("glVertexAttribI4uiv"));
-  glVertexAttribI4usv = PFNGLVERTEXATTRIBI4USVPROC(glfwGetProcAddress("glVertexAttribI4usv"));
-  glVertexAttribIFormat = PFNGLVERTEXATTRIBIFORMATPROC(glfwGetProcAddress("glVertexAttribIFormat"));
-  glVertexAttribIFormatNV = PFNGLVERTEXATTRIBIFORMATNVPROC(glfwGetProcAddress("glVertexAttribIFormatNV"));
-  glVertexAttribIPointer = PFNGLVERTEXATTRIBIPOINTERPROC(glfwGetProcAddress("glVertexAttribIPointer"));
-  glVertexAttribL1d = PFNGLVERTEXATTRIBL1DPROC(glfwGetProcAddress("glVertexAttribL1d"));
-  glVertexAttribL1dv = PFNGLVERTEXATTRIBL1DVPROC(glfwGetProcAddress("glVertexAttribL1dv"));
-  glVertexAttribL1i64NV = PFNGLVERTEXATTRIBL1I64NVPROC(glfwGetProcAddress("glVertexAttribL1i64NV"));
-  glVertexAttribL1i64vNV = PFNGLVERTEXATTRIBL1I64VNVPROC(glfwGetProcAddress("glVertexAttribL1i64vNV"));
-  glVertexAttribL1ui64ARB = PFNGLVERTEXATTRIBL1UI64ARBPROC(glfwGetProcAddress("glVertexAttribL1ui64ARB"));
-  glVertexAttribL1ui64NV = PFNGLVERTEXATTRIBL1UI64NVPROC(glfwGetProcAddress("glVertexAttribL1ui64NV"));
-  glVertexAttribL1ui64vARB = PFNGLVERTEXATTRIBL1UI64VARBPROC(glfwGetProcAddress("glVertexAttribL1ui64vARB"));
-  glVertexAttribL1ui64vNV = PFNGLVERTEXATTRIBL1UI64VNVPROC(glfwGetProcAddress("glVertexAttribL1ui64vNV"));
-  glVertexAttribL2d = PFNGLVERTEXATTRIBL2DPROC(glfwGetProcAddress("glVertexAttribL2d"));
-  glVertexAttribL2dv = PFNGLVERTEXATTRIBL2DVPROC(glfwGetProcAddress("glVertexAttribL2dv"));
-  glVertexAttribL2i64NV = PFNGLVERTEXATTRIBL2I64NVPROC(glfwGetProcAddress("glVertexAttribL2i64NV"));
-  glVertexAttribL2i64vNV = PFNGLVERTEXATTRIBL2I64VNVPROC(glfwGetProcAddress("glVertexAttribL2i64vNV"));
-  glVertexAttribL2ui64NV = PFNGLVERTEXATTRIBL2UI64NVPROC(glfwGetProcAddress("glVertexAttribL2ui64NV"));
-  glVertexAttribL2ui64vNV = PFNGLVERTEXATTRIBL2UI64VNVPROC(glfwGetProcAddress("glVertexAttribL2ui64vNV"));
-  glVertexAttribL3d = PFNGLVERTEXATTRIBL3DPROC(glfwGetProcAddress("glVertexAttribL3d"));
-  glVertexAttribL3dv = PFNGLVERTEXATTRIBL3DVPROC(glfwGetProcAddress("glVertexAttribL3dv"));
-  glVertexAttribL3i64NV = PFNGLVERTEXATTRIBL3I64NVPROC(glfwGetProcAddress("glVertexAttribL3i64NV"));
-  glVertexAttribL3i64vNV = PFNGLVERTEXATTRIBL3I64VNVPROC(glfwGetProcAddress("glVertexAttribL3i64vNV"));
-  glVertexAttribL3ui64NV = PFNGLVERTEXATTRIBL3UI64NVPROC(glfwGetProcAddress("glVertexAttribL3ui64NV"));
-  glVertexAttribL3ui64vNV = PFNGLVERTEXATTRIBL3UI64VNVPROC(glfwGetProcAddress("glVertexAttribL3ui64vNV"));
-  glVertexAttribL4d = PFNGLVERTEXATTRIBL4DPROC(glfwGetProcAddress("glVertexAttribL4d"));
-  glVertexAttribL4dv = PFNGLVERTEXATTRIBL4DVPROC(glfwGetProcAddress("glVertexAttribL4dv"));
-  glVertexAttribL4i64NV = PFNGLVERTEXATTRIBL4I64NVPROC(glfwGetProcAddress("glVertexAttribL4i64NV"));
-  glVertexAttribL4i64vNV = PFNGLVERTEXATTRIBL4I64VNVPROC(glfwGetProcAddress("glVertexAttribL4i64vNV"));
-  glVertexAttribL4ui64NV = PFNGLVERTEXATTRIBL4UI64NVPROC(glfwGetProcAddress("glVertexAttribL4ui64NV"));
-  glVertexAttribL4ui64vNV = PFNGLVERTEXATTRIBL4UI64VNVPROC(glfwGetProcAddress("glVertexAttribL4ui64vNV"));
-  glVertexAttribLFormat = PFNGLVERTEXATTRIBLFORMATPROC(glfwGetProcAddress("glVertexAttribLFormat"));
-  glVertexAttribLFormatNV = PFNGLVERTEXATTRIBLFORMATNVPROC(glfwGetProcAddress("glVertexAttribLFormatNV"));
-  glVertexAttribLPointer = PFNGLVERTEXATTRIBLPOINTERPROC(glfwGetProcAddress("glVertexAttribLPointer"));
-  glVertexAttribP1ui = PFNGLVERTEXATTRIBP1UIPROC(glfwGetProcAddress("glVertexAttribP1ui"));
-  glVertexAttribP1uiv = PFNGLVERTEXATTRIBP1UIVPROC(glfwGetProcAddress("glVertexAttribP1uiv"));
-  glVertexAttribP2ui = PFNGLVERTEXATTRIBP2UIPROC(glfwGetProcAddress("glVertexAttribP2ui"));
-  glVertexAttribP2uiv = PFNGLVERTEXATTRIBP2UIVPROC(glfwGetProcAddress("glVertexAttribP2uiv"));
-  glVertexAttribP3ui = PFNGLVERTEXATTRIBP3UIPROC(glfwGetProcAddress("glVertexAttribP3ui"));
-  glVertexAttribP3uiv = PFNGLVERTEXATTRIBP3UIVPROC(glfwGetProcAddress("glVertexAttribP3uiv"));
-  glVertexAttribP4ui = PFNGLVERTEXATTRIBP4UIPROC(glfwGetProcAddress("glVertexAttribP4ui"));
-  glVertexAttribP4uiv = PFNGLVERTEXATTRIBP4UIVPROC(glfwGetProcAddress("glVertexAttribP4uiv"));
-  glVertexAttribPointer = PFNGLVERTEXATTRIBPOINTERPROC(glfwGetProcAddress("glVertexAttribPointer"));
-  glVertexBindingDivisor = PFNGLVERTEXBINDINGDIVISORPROC(glfwGetProcAddress("glVertexBindingDivisor"));
-  glVertexFormatNV = PFNGLVERTEXFORMATNVPROC(glfwGetProcAddress("glVertexFormatNV"));
-  glViewport = PFNGLVIEWPORTPROC(glfwGetProcAddress("glViewport"));
-  glViewportArrayv = PFNGLVIEWPORTARRAYVPROC(glfwGetProcAddress("glViewportArrayv"));
-  glViewportIndexedf = PFNGLVIEWPORTINDEXEDFPROC(glfwGetProcAddress("glViewportIndexedf"));
-  glViewportIndexedfv = PFNGLVIEWPORTINDEXEDFVPROC(glfwGetProcAddress("glViewportIndexedfv"));
-  glViewportPositionWScaleNV = PFNGLVIEWPORTPOSITIONWSCALENVPROC(glfwGetProcAddress("glViewportPositionWScaleNV"));
-  glViewportSwizzleNV = PFNGLVIEWPORTSWIZZLENVPROC(glfwGetProcAddress("glViewportSwizzleNV"));
-  glWaitSync = PFNGLWAITSYNCPROC(glfwGetProcAddress("glWaitSync"));
-  glWaitVkSemaphoreNV = PFNGLWAITVKSEMAPHORENVPROC(glfwGetProcAddress("glWaitVkSemaphoreNV"));
-  glWeightPathsNV = PFNGLWEIGHTPATHSNVPROC(glfwGetProcAddress("glWeightPathsNV"));
-  glWindowRectanglesEXT = PFNGLWINDOWRECTANGLESEXTPROC(glfwGetProcAddress("glWindowRectanglesEXT"));
+  const auto start(std::chrono::steady_clock::now());
+  GG_GET_PROC(PFNGLACTIVEPROGRAMEXTPROC, glActiveProgramEXT);
+  GG_GET_PROC(PFNGLACTIVESHADERPROGRAMPROC, glActiveShaderProgram);
+  GG_GET_PROC(PFNGLACTIVETEXTUREPROC, glActiveTexture);
+  GG_GET_PROC(PFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC, glApplyFramebufferAttachmentCMAAINTEL);
+  GG_GET_PROC(PFNGLATTACHSHADERPROC, glAttachShader);
+  GG_GET_PROC(PFNGLBEGINCONDITIONALRENDERPROC, glBeginConditionalRender);
+  GG_GET_PROC(PFNGLBEGINCONDITIONALRENDERNVPROC, glBeginConditionalRenderNV);
+  GG_GET_PROC(PFNGLBEGINPERFMONITORAMDPROC, glBeginPerfMonitorAMD);
+  GG_GET_PROC(PFNGLBEGINPERFQUERYINTELPROC, glBeginPerfQueryINTEL);
+  GG_GET_PROC(PFNGLBEGINQUERYPROC, glBeginQuery);
+  GG_GET_PROC(PFNGLBEGINQUERYINDEXEDPROC, glBeginQueryIndexed);
+  GG_GET_PROC(PFNGLBEGINTRANSFORMFEEDBACKPROC, glBeginTransformFeedback);
+  GG_GET_PROC(PFNGLBINDATTRIBLOCATIONPROC, glBindAttribLocation);
+  GG_GET_PROC(PFNGLBINDBUFFERPROC, glBindBuffer);
+  GG_GET_PROC(PFNGLBINDBUFFERBASEPROC, glBindBufferBase);
+  GG_GET_PROC(PFNGLBINDBUFFERRANGEPROC, glBindBufferRange);
+  GG_GET_PROC(PFNGLBINDBUFFERSBASEPROC, glBindBuffersBase);
+  GG_GET_PROC(PFNGLBINDBUFFERSRANGEPROC, glBindBuffersRange);
+  GG_GET_PROC(PFNGLBINDFRAGDATALOCATIONPROC, glBindFragDataLocation);
+  GG_GET_PROC(PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, glBindFragDataLocationIndexed);
+  GG_GET_PROC(PFNGLBINDFRAMEBUFFERPROC, glBindFramebuffer);
+  GG_GET_PROC(PFNGLBINDIMAGETEXTUREPROC, glBindImageTexture);
+  GG_GET_PROC(PFNGLBINDIMAGETEXTURESPROC, glBindImageTextures);
+  GG_GET_PROC(PFNGLBINDMULTITEXTUREEXTPROC, glBindMultiTextureEXT);
+  GG_GET_PROC(PFNGLBINDPROGRAMPIPELINEPROC, glBindProgramPipeline);
+  GG_GET_PROC(PFNGLBINDRENDERBUFFERPROC, glBindRenderbuffer);
+  GG_GET_PROC(PFNGLBINDSAMPLERPROC, glBindSampler);
+  GG_GET_PROC(PFNGLBINDSAMPLERSPROC, glBindSamplers);
+  GG_GET_PROC(PFNGLBINDTEXTUREPROC, glBindTexture);
+  GG_GET_PROC(PFNGLBINDTEXTUREUNITPROC, glBindTextureUnit);
+  GG_GET_PROC(PFNGLBINDTEXTURESPROC, glBindTextures);
+  GG_GET_PROC(PFNGLBINDTRANSFORMFEEDBACKPROC, glBindTransformFeedback);
+  GG_GET_PROC(PFNGLBINDVERTEXARRAYPROC, glBindVertexArray);
+  GG_GET_PROC(PFNGLBINDVERTEXBUFFERPROC, glBindVertexBuffer);
+  GG_GET_PROC(PFNGLBINDVERTEXBUFFERSPROC, glBindVertexBuffers);
+  GG_GET_PROC(PFNGLBLENDBARRIERKHRPROC, glBlendBarrierKHR);
+  GG_GET_PROC(PFNGLBLENDBARRIERNVPROC, glBlendBarrierNV);
+  GG_GET_PROC(PFNGLBLENDCOLORPROC, glBlendColor);
+  GG_GET_PROC(PFNGLBLENDEQUATIONPROC, glBlendEquation);
+  GG_GET_PROC(PFNGLBLENDEQUATIONSEPARATEPROC, glBlendEquationSeparate);
+  GG_GET_PROC(PFNGLBLENDEQUATIONSEPARATEIPROC, glBlendEquationSeparatei);
+  GG_GET_PROC(PFNGLBLENDEQUATIONSEPARATEIARBPROC, glBlendEquationSeparateiARB);
+  GG_GET_PROC(PFNGLBLENDEQUATIONIPROC, glBlendEquationi);
+  GG_GET_PROC(PFNGLBLENDEQUATIONIARBPROC, glBlendEquationiARB);
+  GG_GET_PROC(PFNGLBLENDFUNCPROC, glBlendFunc);
+  GG_GET_PROC(PFNGLBLENDFUNCSEPARATEPROC, glBlendFuncSeparate);
+  GG_GET_PROC(PFNGLBLENDFUNCSEPARATEIPROC, glBlendFuncSeparatei);
+  GG_GET_PROC(PFNGLBLENDFUNCSEPARATEIARBPROC, glBlendFuncSeparateiARB);
+  GG_GET_PROC(PFNGLBLENDFUNCIPROC, glBlendFunci);
+  GG_GET_PROC(PFNGLBLENDFUNCIARBPROC, glBlendFunciARB);
+  GG_GET_PROC(PFNGLBLENDPARAMETERINVPROC, glBlendParameteriNV);
+  GG_GET_PROC(PFNGLBLITFRAMEBUFFERPROC, glBlitFramebuffer);
+  GG_GET_PROC(PFNGLBLITNAMEDFRAMEBUFFERPROC, glBlitNamedFramebuffer);
+  GG_GET_PROC(PFNGLBUFFERADDRESSRANGENVPROC, glBufferAddressRangeNV);
+  GG_GET_PROC(PFNGLBUFFERDATAPROC, glBufferData);
+  GG_GET_PROC(PFNGLBUFFERPAGECOMMITMENTARBPROC, glBufferPageCommitmentARB);
+  GG_GET_PROC(PFNGLBUFFERSTORAGEPROC, glBufferStorage);
+  GG_GET_PROC(PFNGLBUFFERSUBDATAPROC, glBufferSubData);
+  GG_GET_PROC(PFNGLCALLCOMMANDLISTNVPROC, glCallCommandListNV);
+  GG_GET_PROC(PFNGLCHECKFRAMEBUFFERSTATUSPROC, glCheckFramebufferStatus);
+  GG_GET_PROC(PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC, glCheckNamedFramebufferStatus);
+  GG_GET_PROC(PFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC, glCheckNamedFramebufferStatusEXT);
+  GG_GET_PROC(PFNGLCLAMPCOLORPROC, glClampColor);
+  GG_GET_PROC(PFNGLCLEARPROC, glClear);
+  GG_GET_PROC(PFNGLCLEARBUFFERDATAPROC, glClearBufferData);
+  GG_GET_PROC(PFNGLCLEARBUFFERSUBDATAPROC, glClearBufferSubData);
+  GG_GET_PROC(PFNGLCLEARBUFFERFIPROC, glClearBufferfi);
+  GG_GET_PROC(PFNGLCLEARBUFFERFVPROC, glClearBufferfv);
+  GG_GET_PROC(PFNGLCLEARBUFFERIVPROC, glClearBufferiv);
+  GG_GET_PROC(PFNGLCLEARBUFFERUIVPROC, glClearBufferuiv);
+  GG_GET_PROC(PFNGLCLEARCOLORPROC, glClearColor);
+  GG_GET_PROC(PFNGLCLEARDEPTHPROC, glClearDepth);
+  GG_GET_PROC(PFNGLCLEARDEPTHFPROC, glClearDepthf);
+  GG_GET_PROC(PFNGLCLEARNAMEDBUFFERDATAPROC, glClearNamedBufferData);
+  GG_GET_PROC(PFNGLCLEARNAMEDBUFFERDATAEXTPROC, glClearNamedBufferDataEXT);
+  GG_GET_PROC(PFNGLCLEARNAMEDBUFFERSUBDATAPROC, glClearNamedBufferSubData);
+  GG_GET_PROC(PFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC, glClearNamedBufferSubDataEXT);
+  GG_GET_PROC(PFNGLCLEARNAMEDFRAMEBUFFERFIPROC, glClearNamedFramebufferfi);
+  GG_GET_PROC(PFNGLCLEARNAMEDFRAMEBUFFERFVPROC, glClearNamedFramebufferfv);
+  GG_GET_PROC(PFNGLCLEARNAMEDFRAMEBUFFERIVPROC, glClearNamedFramebufferiv);
+  GG_GET_PROC(PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC, glClearNamedFramebufferuiv);
+  GG_GET_PROC(PFNGLCLEARSTENCILPROC, glClearStencil);
+  GG_GET_PROC(PFNGLCLEARTEXIMAGEPROC, glClearTexImage);
+  GG_GET_PROC(PFNGLCLEARTEXSUBIMAGEPROC, glClearTexSubImage);
+  GG_GET_PROC(PFNGLCLIENTATTRIBDEFAULTEXTPROC, glClientAttribDefaultEXT);
+  GG_GET_PROC(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync);
+  GG_GET_PROC(PFNGLCLIPCONTROLPROC, glClipControl);
+  GG_GET_PROC(PFNGLCOLORFORMATNVPROC, glColorFormatNV);
+  GG_GET_PROC(PFNGLCOLORMASKPROC, glColorMask);
+  GG_GET_PROC(PFNGLCOLORMASKIPROC, glColorMaski);
+  GG_GET_PROC(PFNGLCOMMANDLISTSEGMENTSNVPROC, glCommandListSegmentsNV);
+  GG_GET_PROC(PFNGLCOMPILECOMMANDLISTNVPROC, glCompileCommandListNV);
+  GG_GET_PROC(PFNGLCOMPILESHADERPROC, glCompileShader);
+  GG_GET_PROC(PFNGLCOMPILESHADERINCLUDEARBPROC, glCompileShaderIncludeARB);
+  GG_GET_PROC(PFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC, glCompressedMultiTexImage1DEXT);
+  GG_GET_PROC(PFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC, glCompressedMultiTexImage2DEXT);
+  GG_GET_PROC(PFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC, glCompressedMultiTexImage3DEXT);
+  GG_GET_PROC(PFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC, glCompressedMultiTexSubImage1DEXT);
+  GG_GET_PROC(PFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC, glCompressedMultiTexSubImage2DEXT);
+  GG_GET_PROC(PFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC, glCompressedMultiTexSubImage3DEXT);
+  GG_GET_PROC(PFNGLCOMPRESSEDTEXIMAGE1DPROC, glCompressedTexImage1D);
+  GG_GET_PROC(PFNGLCOMPRESSEDTEXIMAGE2DPROC, glCompressedTexImage2D);
+  GG_GET_PROC(PFNGLCOMPRESSEDTEXIMAGE3DPROC, glCompressedTexImage3D);
+  GG_GET_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, glCompressedTexSubImage1D);
+  GG_GET_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);
+  GG_GET_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);
+  GG_GET_PROC(PFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC, glCompressedTextureImage1DEXT);
+  GG_GET_PROC(PFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC, glCompressedTextureImage2DEXT);
+  GG_GET_PROC(PFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC, glCompressedTextureImage3DEXT);
+  GG_GET_PROC(PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC, glCompressedTextureSubImage1D);
+  GG_GET_PROC(PFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC, glCompressedTextureSubImage1DEXT);
+  GG_GET_PROC(PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC, glCompressedTextureSubImage2D);
+  GG_GET_PROC(PFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC, glCompressedTextureSubImage2DEXT);
+  GG_GET_PROC(PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC, glCompressedTextureSubImage3D);
+  GG_GET_PROC(PFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC, glCompressedTextureSubImage3DEXT);
+  GG_GET_PROC(PFNGLCONSERVATIVERASTERPARAMETERFNVPROC, glConservativeRasterParameterfNV);
+  GG_GET_PROC(PFNGLCONSERVATIVERASTERPARAMETERINVPROC, glConservativeRasterParameteriNV);
+  GG_GET_PROC(PFNGLCOPYBUFFERSUBDATAPROC, glCopyBufferSubData);
+  GG_GET_PROC(PFNGLCOPYIMAGESUBDATAPROC, glCopyImageSubData);
+  GG_GET_PROC(PFNGLCOPYMULTITEXIMAGE1DEXTPROC, glCopyMultiTexImage1DEXT);
+  GG_GET_PROC(PFNGLCOPYMULTITEXIMAGE2DEXTPROC, glCopyMultiTexImage2DEXT);
+  GG_GET_PROC(PFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC, glCopyMultiTexSubImage1DEXT);
+  GG_GET_PROC(PFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC, glCopyMultiTexSubImage2DEXT);
+  GG_GET_PROC(PFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC, glCopyMultiTexSubImage3DEXT);
+  GG_GET_PROC(PFNGLCOPYNAMEDBUFFERSUBDATAPROC, glCopyNamedBufferSubData);
+  GG_GET_PROC(PFNGLCOPYPATHNVPROC, glCopyPathNV);
+  GG_GET_PROC(PFNGLCOPYTEXIMAGE1DPROC, glCopyTexImage1D);
+  GG_GET_PROC(PFNGLCOPYTEXIMAGE2DPROC, glCopyTexImage2D);
+  GG_GET_PROC(PFNGLCOPYTEXSUBIMAGE1DPROC, glCopyTexSubImage1D);
+  GG_GET_PROC(PFNGLCOPYTEXSUBIMAGE2DPROC, glCopyTexSubImage2D);
+  GG_GET_PROC(PFNGLCOPYTEXSUBIMAGE3DPROC, glCopyTexSubImage3D);
+  GG_GET_PROC(PFNGLCOPYTEXTUREIMAGE1DEXTPROC, glCopyTextureImage1DEXT);
+  GG_GET_PROC(PFNGLCOPYTEXTUREIMAGE2DEXTPROC, glCopyTextureImage2DEXT);
+  GG_GET_PROC(PFNGLCOPYTEXTURESUBIMAGE1DPROC, glCopyTextureSubImage1D);
+  GG_GET_PROC(PFNGLCOPYTEXTURESUBIMAGE1DEXTPROC, glCopyTextureSubImage1DEXT);
+  GG_GET_PROC(PFNGLCOPYTEXTURESUBIMAGE2DPROC, glCopyTextureSubImage2D);
+  GG_GET_PROC(PFNGLCOPYTEXTURESUBIMAGE2DEXTPROC, glCopyTextureSubImage2DEXT);
+  GG_GET_PROC(PFNGLCOPYTEXTURESUBIMAGE3DPROC, glCopyTextureSubImage3D);
+  GG_GET_PROC(PFNGLCOPYTEXTURESUBIMAGE3DEXTPROC, glCopyTextureSubImage3DEXT);
+  GG_GET_PROC(PFNGLCOVERFILLPATHINSTANCEDNVPROC, glCoverFillPathInstancedNV);
+  GG_GET_PROC(PFNGLCOVERFILLPATHNVPROC, glCoverFillPathNV);
+  GG_GET_PROC(PFNGLCOVERSTROKEPATHINSTANCEDNVPROC, glCoverStrokePathInstancedNV);
+  GG_GET_PROC(PFNGLCOVERSTROKEPATHNVPROC, glCoverStrokePathNV);
+  GG_GET_PROC(PFNGLCOVERAGEMODULATIONNVPROC, glCoverageModulationNV);
+  GG_GET_PROC(PFNGLCOVERAGEMODULATIONTABLENVPROC, glCoverageModulationTableNV);
+  GG_GET_PROC(PFNGLCREATEBUFFERSPROC, glCreateBuffers);
+  GG_GET_PROC(PFNGLCREATECOMMANDLISTSNVPROC, glCreateCommandListsNV);
+  GG_GET_PROC(PFNGLCREATEFRAMEBUFFERSPROC, glCreateFramebuffers);
+  GG_GET_PROC(PFNGLCREATEPERFQUERYINTELPROC, glCreatePerfQueryINTEL);
+  GG_GET_PROC(PFNGLCREATEPROGRAMPROC, glCreateProgram);
+  GG_GET_PROC(PFNGLCREATEPROGRAMPIPELINESPROC, glCreateProgramPipelines);
+  GG_GET_PROC(PFNGLCREATEQUERIESPROC, glCreateQueries);
+  GG_GET_PROC(PFNGLCREATERENDERBUFFERSPROC, glCreateRenderbuffers);
+  GG_GET_PROC(PFNGLCREATESAMPLERSPROC, glCreateSamplers);
+  GG_GET_PROC(PFNGLCREATESHADERPROC, glCreateShader);
+  GG_GET_PROC(PFNGLCREATESHADERPROGRAMEXTPROC, glCreateShaderProgramEXT);
+  GG_GET_PROC(PFNGLCREATESHADERPROGRAMVPROC, glCreateShaderProgramv);
+  GG_GET_PROC(PFNGLCREATESTATESNVPROC, glCreateStatesNV);
+  GG_GET_PROC(PFNGLCREATESYNCFROMCLEVENTARBPROC, glCreateSyncFromCLeventARB);
+  GG_GET_PROC(PFNGLCREATETEXTURESPROC, glCreateTextures);
+  GG_GET_PROC(PFNGLCREATETRANSFORMFEEDBACKSPROC, glCreateTransformFeedbacks);
+  GG_GET_PROC(PFNGLCREATEVERTEXARRAYSPROC, glCreateVertexArrays);
+  GG_GET_PROC(PFNGLCULLFACEPROC, glCullFace);
+  GG_GET_PROC(PFNGLDEBUGMESSAGECALLBACKPROC, glDebugMessageCallback);
+  GG_GET_PROC(PFNGLDEBUGMESSAGECALLBACKARBPROC, glDebugMessageCallbackARB);
+  GG_GET_PROC(PFNGLDEBUGMESSAGECONTROLPROC, glDebugMessageControl);
+  GG_GET_PROC(PFNGLDEBUGMESSAGECONTROLARBPROC, glDebugMessageControlARB);
+  GG_GET_PROC(PFNGLDEBUGMESSAGEINSERTPROC, glDebugMessageInsert);
+  GG_GET_PROC(PFNGLDEBUGMESSAGEINSERTARBPROC, glDebugMessageInsertARB);
+  GG_GET_PROC(PFNGLDELETEBUFFERSPROC, glDeleteBuffers);
+  GG_GET_PROC(PFNGLDELETECOMMANDLISTSNVPROC, glDeleteCommandListsNV);
+  GG_GET_PROC(PFNGLDELETEFRAMEBUFFERSPROC, glDeleteFramebuffers);
+  GG_GET_PROC(PFNGLDELETENAMEDSTRINGARBPROC, glDeleteNamedStringARB);
+  GG_GET_PROC(PFNGLDELETEPATHSNVPROC, glDeletePathsNV);
+  GG_GET_PROC(PFNGLDELETEPERFMONITORSAMDPROC, glDeletePerfMonitorsAMD);
+  GG_GET_PROC(PFNGLDELETEPERFQUERYINTELPROC, glDeletePerfQueryINTEL);
+  GG_GET_PROC(PFNGLDELETEPROGRAMPROC, glDeleteProgram);
+  GG_GET_PROC(PFNGLDELETEPROGRAMPIPELINESPROC, glDeleteProgramPipelines);
+  GG_GET_PROC(PFNGLDELETEQUERIESPROC, glDeleteQueries);
+  GG_GET_PROC(PFNGLDELETERENDERBUFFERSPROC, glDeleteRenderbuffers);
+  GG_GET_PROC(PFNGLDELETESAMPLERSPROC, glDeleteSamplers);
+  GG_GET_PROC(PFNGLDELETESHADERPROC, glDeleteShader);
+  GG_GET_PROC(PFNGLDELETESTATESNVPROC, glDeleteStatesNV);
+  GG_GET_PROC(PFNGLDELETESYNCPROC, glDeleteSync);
+  GG_GET_PROC(PFNGLDELETETEXTURESPROC, glDeleteTextures);
+  GG_GET_PROC(PFNGLDELETETRANSFORMFEEDBACKSPROC, glDeleteTransformFeedbacks);
+  GG_GET_PROC(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays);
+  GG_GET_PROC(PFNGLDEPTHFUNCPROC, glDepthFunc);
+  GG_GET_PROC(PFNGLDEPTHMASKPROC, glDepthMask);
+  GG_GET_PROC(PFNGLDEPTHRANGEPROC, glDepthRange);
+  GG_GET_PROC(PFNGLDEPTHRANGEARRAYVPROC, glDepthRangeArrayv);
+  GG_GET_PROC(PFNGLDEPTHRANGEINDEXEDPROC, glDepthRangeIndexed);
+  GG_GET_PROC(PFNGLDEPTHRANGEFPROC, glDepthRangef);
+  GG_GET_PROC(PFNGLDETACHSHADERPROC, glDetachShader);
+  GG_GET_PROC(PFNGLDISABLEPROC, glDisable);
+  GG_GET_PROC(PFNGLDISABLECLIENTSTATEINDEXEDEXTPROC, glDisableClientStateIndexedEXT);
+  GG_GET_PROC(PFNGLDISABLECLIENTSTATEIEXTPROC, glDisableClientStateiEXT);
+  GG_GET_PROC(PFNGLDISABLEINDEXEDEXTPROC, glDisableIndexedEXT);
+  GG_GET_PROC(PFNGLDISABLEVERTEXARRAYATTRIBPROC, glDisableVertexArrayAttrib);
+  GG_GET_PROC(PFNGLDISABLEVERTEXARRAYATTRIBEXTPROC, glDisableVertexArrayAttribEXT);
+  GG_GET_PROC(PFNGLDISABLEVERTEXARRAYEXTPROC, glDisableVertexArrayEXT);
+  GG_GET_PROC(PFNGLDISABLEVERTEXATTRIBARRAYPROC, glDisableVertexAttribArray);
+  GG_GET_PROC(PFNGLDISABLEIPROC, glDisablei);
+  GG_GET_PROC(PFNGLDISPATCHCOMPUTEPROC, glDispatchCompute);
+  GG_GET_PROC(PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC, glDispatchComputeGroupSizeARB);
+  GG_GET_PROC(PFNGLDISPATCHCOMPUTEINDIRECTPROC, glDispatchComputeIndirect);
+  GG_GET_PROC(PFNGLDRAWARRAYSPROC, glDrawArrays);
+  GG_GET_PROC(PFNGLDRAWARRAYSINDIRECTPROC, glDrawArraysIndirect);
+  GG_GET_PROC(PFNGLDRAWARRAYSINSTANCEDPROC, glDrawArraysInstanced);
+  GG_GET_PROC(PFNGLDRAWARRAYSINSTANCEDARBPROC, glDrawArraysInstancedARB);
+  GG_GET_PROC(PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC, glDrawArraysInstancedBaseInstance);
+  GG_GET_PROC(PFNGLDRAWARRAYSINSTANCEDEXTPROC, glDrawArraysInstancedEXT);
+  GG_GET_PROC(PFNGLDRAWBUFFERPROC, glDrawBuffer);
+  GG_GET_PROC(PFNGLDRAWBUFFERSPROC, glDrawBuffers);
+  GG_GET_PROC(PFNGLDRAWCOMMANDSADDRESSNVPROC, glDrawCommandsAddressNV);
+  GG_GET_PROC(PFNGLDRAWCOMMANDSNVPROC, glDrawCommandsNV);
+  GG_GET_PROC(PFNGLDRAWCOMMANDSSTATESADDRESSNVPROC, glDrawCommandsStatesAddressNV);
+  GG_GET_PROC(PFNGLDRAWCOMMANDSSTATESNVPROC, glDrawCommandsStatesNV);
+  GG_GET_PROC(PFNGLDRAWELEMENTSPROC, glDrawElements);
+  GG_GET_PROC(PFNGLDRAWELEMENTSBASEVERTEXPROC, glDrawElementsBaseVertex);
+  GG_GET_PROC(PFNGLDRAWELEMENTSINDIRECTPROC, glDrawElementsIndirect);
+  GG_GET_PROC(PFNGLDRAWELEMENTSINSTANCEDPROC, glDrawElementsInstanced);
+  GG_GET_PROC(PFNGLDRAWELEMENTSINSTANCEDARBPROC, glDrawElementsInstancedARB);
+  GG_GET_PROC(PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC, glDrawElementsInstancedBaseInstance);
+  GG_GET_PROC(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, glDrawElementsInstancedBaseVertex);
+  GG_GET_PROC(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC, glDrawElementsInstancedBaseVertexBaseInstance);
+  GG_GET_PROC(PFNGLDRAWELEMENTSINSTANCEDEXTPROC, glDrawElementsInstancedEXT);
+  GG_GET_PROC(PFNGLDRAWRANGEELEMENTSPROC, glDrawRangeElements);
+  GG_GET_PROC(PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, glDrawRangeElementsBaseVertex);
+  GG_GET_PROC(PFNGLDRAWTRANSFORMFEEDBACKPROC, glDrawTransformFeedback);
+  GG_GET_PROC(PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC, glDrawTransformFeedbackInstanced);
+  GG_GET_PROC(PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC, glDrawTransformFeedbackStream);
+  GG_GET_PROC(PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC, glDrawTransformFeedbackStreamInstanced);
+  GG_GET_PROC(PFNGLDRAWVKIMAGENVPROC, glDrawVkImageNV);
+  GG_GET_PROC(PFNGLEDGEFLAGFORMATNVPROC, glEdgeFlagFormatNV);
+  GG_GET_PROC(PFNGLENABLEPROC, glEnable);
+  GG_GET_PROC(PFNGLENABLECLIENTSTATEINDEXEDEXTPROC, glEnableClientStateIndexedEXT);
+  GG_GET_PROC(PFNGLENABLECLIENTSTATEIEXTPROC, glEnableClientStateiEXT);
+  GG_GET_PROC(PFNGLENABLEINDEXEDEXTPROC, glEnableIndexedEXT);
+  GG_GET_PROC(PFNGLENABLEVERTEXARRAYATTRIBPROC, glEnableVertexArrayAttrib);
+  GG_GET_PROC(PFNGLENABLEVERTEXARRAYATTRIBEXTPROC, glEnableVertexArrayAttribEXT);
+  GG_GET_PROC(PFNGLENABLEVERTEXARRAYEXTPROC, glEnableVertexArrayEXT);
+  GG_GET_PROC(PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray);
+  GG_GET_PROC(PFNGLENABLEIPROC, glEnablei);
+  GG_GET_PROC(PFNGLENDCONDITIONALRENDERPROC, glEndConditionalRender);
+  GG_GET_PROC(PFNGLENDCONDITIONALRENDERNVPROC, glEndConditionalRenderNV);
+  GG_GET_PROC(PFNGLENDPERFMONITORAMDPROC, glEndPerfMonitorAMD);
+  GG_GET_PROC(PFNGLENDPERFQUERYINTELPROC, glEndPerfQueryINTEL);
+  GG_GET_PROC(PFNGLENDQUERYPROC, glEndQuery);
+  GG_GET_PROC(PFNGLENDQUERYINDEXEDPROC, glEndQueryIndexed);
+  GG_GET_PROC(PFNGLENDTRANSFORMFEEDBACKPROC, glEndTransformFeedback);
+  GG_GET_PROC(PFNGLEVALUATEDEPTHVALUESARBPROC, glEvaluateDepthValuesARB);
+  GG_GET_PROC(PFNGLFENCESYNCPROC, glFenceSync);
+  GG_GET_PROC(PFNGLFINISHPROC, glFinish);
+  GG_GET_PROC(PFNGLFLUSHPROC, glFlush);
+  GG_GET_PROC(PFNGLFLUSHMAPPEDBUFFERRANGEPROC, glFlushMappedBufferRange);
+  GG_GET_PROC(PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC, glFlushMappedNamedBufferRange);
+  GG_GET_PROC(PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC, glFlushMappedNamedBufferRangeEXT);
+  GG_GET_PROC(PFNGLFOGCOORDFORMATNVPROC, glFogCoordFormatNV);
+  GG_GET_PROC(PFNGLFRAGMENTCOVERAGECOLORNVPROC, glFragmentCoverageColorNV);
+  GG_GET_PROC(PFNGLFRAMEBUFFERDRAWBUFFEREXTPROC, glFramebufferDrawBufferEXT);
+  GG_GET_PROC(PFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC, glFramebufferDrawBuffersEXT);
+  GG_GET_PROC(PFNGLFRAMEBUFFERPARAMETERIPROC, glFramebufferParameteri);
+  GG_GET_PROC(PFNGLFRAMEBUFFERREADBUFFEREXTPROC, glFramebufferReadBufferEXT);
+  GG_GET_PROC(PFNGLFRAMEBUFFERRENDERBUFFERPROC, glFramebufferRenderbuffer);
+  GG_GET_PROC(PFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC, glFramebufferSampleLocationsfvARB);
+  GG_GET_PROC(PFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC, glFramebufferSampleLocationsfvNV);
+  GG_GET_PROC(PFNGLFRAMEBUFFERTEXTUREPROC, glFramebufferTexture);
+  GG_GET_PROC(PFNGLFRAMEBUFFERTEXTURE1DPROC, glFramebufferTexture1D);
+  GG_GET_PROC(PFNGLFRAMEBUFFERTEXTURE2DPROC, glFramebufferTexture2D);
+  GG_GET_PROC(PFNGLFRAMEBUFFERTEXTURE3DPROC, glFramebufferTexture3D);
+  GG_GET_PROC(PFNGLFRAMEBUFFERTEXTUREARBPROC, glFramebufferTextureARB);
+  GG_GET_PROC(PFNGLFRAMEBUFFERTEXTUREFACEARBPROC, glFramebufferTextureFaceARB);
+  GG_GET_PROC(PFNGLFRAMEBUFFERTEXTURELAYERPROC, glFramebufferTextureLayer);
+  GG_GET_PROC(PFNGLFRAMEBUFFERTEXTURELAYERARBPROC, glFramebufferTextureLayerARB);
+  GG_GET_PROC(PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC, glFramebufferTextureMultiviewOVR);
+  GG_GET_PROC(PFNGLFRONTFACEPROC, glFrontFace);
+  GG_GET_PROC(PFNGLGENBUFFERSPROC, glGenBuffers);
+  GG_GET_PROC(PFNGLGENFRAMEBUFFERSPROC, glGenFramebuffers);
+  GG_GET_PROC(PFNGLGENPATHSNVPROC, glGenPathsNV);
+  GG_GET_PROC(PFNGLGENPERFMONITORSAMDPROC, glGenPerfMonitorsAMD);
+  GG_GET_PROC(PFNGLGENPROGRAMPIPELINESPROC, glGenProgramPipelines);
+  GG_GET_PROC(PFNGLGENQUERIESPROC, glGenQueries);
+  GG_GET_PROC(PFNGLGENRENDERBUFFERSPROC, glGenRenderbuffers);
+  GG_GET_PROC(PFNGLGENSAMPLERSPROC, glGenSamplers);
+  GG_GET_PROC(PFNGLGENTEXTURESPROC, glGenTextures);
+  GG_GET_PROC(PFNGLGENTRANSFORMFEEDBACKSPROC, glGenTransformFeedbacks);
+  GG_GET_PROC(PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays);
+  GG_GET_PROC(PFNGLGENERATEMIPMAPPROC, glGenerateMipmap);
+  GG_GET_PROC(PFNGLGENERATEMULTITEXMIPMAPEXTPROC, glGenerateMultiTexMipmapEXT);
+  GG_GET_PROC(PFNGLGENERATETEXTUREMIPMAPPROC, glGenerateTextureMipmap);
+  GG_GET_PROC(PFNGLGENERATETEXTUREMIPMAPEXTPROC, glGenerateTextureMipmapEXT);
+  GG_GET_PROC(PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC, glGetActiveAtomicCounterBufferiv);
+  GG_GET_PROC(PFNGLGETACTIVEATTRIBPROC, glGetActiveAttrib);
+  GG_GET_PROC(PFNGLGETACTIVESUBROUTINENAMEPROC, glGetActiveSubroutineName);
+  GG_GET_PROC(PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC, glGetActiveSubroutineUniformName);
+  GG_GET_PROC(PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC, glGetActiveSubroutineUniformiv);
+  GG_GET_PROC(PFNGLGETACTIVEUNIFORMPROC, glGetActiveUniform);
+  GG_GET_PROC(PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, glGetActiveUniformBlockName);
+  GG_GET_PROC(PFNGLGETACTIVEUNIFORMBLOCKIVPROC, glGetActiveUniformBlockiv);
+  GG_GET_PROC(PFNGLGETACTIVEUNIFORMNAMEPROC, glGetActiveUniformName);
+  GG_GET_PROC(PFNGLGETACTIVEUNIFORMSIVPROC, glGetActiveUniformsiv);
+  GG_GET_PROC(PFNGLGETATTACHEDSHADERSPROC, glGetAttachedShaders);
+  GG_GET_PROC(PFNGLGETATTRIBLOCATIONPROC, glGetAttribLocation);
+  GG_GET_PROC(PFNGLGETBOOLEANINDEXEDVEXTPROC, glGetBooleanIndexedvEXT);
+  GG_GET_PROC(PFNGLGETBOOLEANI_VPROC, glGetBooleani_v);
+  GG_GET_PROC(PFNGLGETBOOLEANVPROC, glGetBooleanv);
+  GG_GET_PROC(PFNGLGETBUFFERPARAMETERI64VPROC, glGetBufferParameteri64v);
+  GG_GET_PROC(PFNGLGETBUFFERPARAMETERIVPROC, glGetBufferParameteriv);
+  GG_GET_PROC(PFNGLGETBUFFERPARAMETERUI64VNVPROC, glGetBufferParameterui64vNV);
+  GG_GET_PROC(PFNGLGETBUFFERPOINTERVPROC, glGetBufferPointerv);
+  GG_GET_PROC(PFNGLGETBUFFERSUBDATAPROC, glGetBufferSubData);
+  GG_GET_PROC(PFNGLGETCOMMANDHEADERNVPROC, glGetCommandHeaderNV);
+  GG_GET_PROC(PFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC, glGetCompressedMultiTexImageEXT);
+  GG_GET_PROC(PFNGLGETCOMPRESSEDTEXIMAGEPROC, glGetCompressedTexImage);
+  GG_GET_PROC(PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC, glGetCompressedTextureImage);
+  GG_GET_PROC(PFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC, glGetCompressedTextureImageEXT);
+  GG_GET_PROC(PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC, glGetCompressedTextureSubImage);
+  GG_GET_PROC(PFNGLGETCOVERAGEMODULATIONTABLENVPROC, glGetCoverageModulationTableNV);
+  GG_GET_PROC(PFNGLGETDEBUGMESSAGELOGPROC, glGetDebugMessageLog);
+  GG_GET_PROC(PFNGLGETDEBUGMESSAGELOGARBPROC, glGetDebugMessageLogARB);
+  GG_GET_PROC(PFNGLGETDOUBLEINDEXEDVEXTPROC, glGetDoubleIndexedvEXT);
+  GG_GET_PROC(PFNGLGETDOUBLEI_VPROC, glGetDoublei_v);
+  GG_GET_PROC(PFNGLGETDOUBLEI_VEXTPROC, glGetDoublei_vEXT);
+  GG_GET_PROC(PFNGLGETDOUBLEVPROC, glGetDoublev);
+  GG_GET_PROC(PFNGLGETERRORPROC, glGetError);
+  GG_GET_PROC(PFNGLGETFIRSTPERFQUERYIDINTELPROC, glGetFirstPerfQueryIdINTEL);
+  GG_GET_PROC(PFNGLGETFLOATINDEXEDVEXTPROC, glGetFloatIndexedvEXT);
+  GG_GET_PROC(PFNGLGETFLOATI_VPROC, glGetFloati_v);
+  GG_GET_PROC(PFNGLGETFLOATI_VEXTPROC, glGetFloati_vEXT);
+  GG_GET_PROC(PFNGLGETFLOATVPROC, glGetFloatv);
+  GG_GET_PROC(PFNGLGETFRAGDATAINDEXPROC, glGetFragDataIndex);
+  GG_GET_PROC(PFNGLGETFRAGDATALOCATIONPROC, glGetFragDataLocation);
+  GG_GET_PROC(PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, glGetFramebufferAttachmentParameteriv);
+  GG_GET_PROC(PFNGLGETFRAMEBUFFERPARAMETERIVPROC, glGetFramebufferParameteriv);
+  GG_GET_PROC(PFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC, glGetFramebufferParameterivEXT);
+  GG_GET_PROC(PFNGLGETGRAPHICSRESETSTATUSPROC, glGetGraphicsResetStatus);
+  GG_GET_PROC(PFNGLGETGRAPHICSRESETSTATUSARBPROC, glGetGraphicsResetStatusARB);
+  GG_GET_PROC(PFNGLGETIMAGEHANDLEARBPROC, glGetImageHandleARB);
+  GG_GET_PROC(PFNGLGETIMAGEHANDLENVPROC, glGetImageHandleNV);
+  GG_GET_PROC(PFNGLGETINTEGER64I_VPROC, glGetInteger64i_v);
+  GG_GET_PROC(PFNGLGETINTEGER64VPROC, glGetInteger64v);
+  GG_GET_PROC(PFNGLGETINTEGERINDEXEDVEXTPROC, glGetIntegerIndexedvEXT);
+  GG_GET_PROC(PFNGLGETINTEGERI_VPROC, glGetIntegeri_v);
+  GG_GET_PROC(PFNGLGETINTEGERUI64I_VNVPROC, glGetIntegerui64i_vNV);
+  GG_GET_PROC(PFNGLGETINTEGERUI64VNVPROC, glGetIntegerui64vNV);
+  GG_GET_PROC(PFNGLGETINTEGERVPROC, glGetIntegerv);
+  GG_GET_PROC(PFNGLGETINTERNALFORMATSAMPLEIVNVPROC, glGetInternalformatSampleivNV);
+  GG_GET_PROC(PFNGLGETINTERNALFORMATI64VPROC, glGetInternalformati64v);
+  GG_GET_PROC(PFNGLGETINTERNALFORMATIVPROC, glGetInternalformativ);
+  GG_GET_PROC(PFNGLGETMULTITEXENVFVEXTPROC, glGetMultiTexEnvfvEXT);
+  GG_GET_PROC(PFNGLGETMULTITEXENVIVEXTPROC, glGetMultiTexEnvivEXT);
+  GG_GET_PROC(PFNGLGETMULTITEXGENDVEXTPROC, glGetMultiTexGendvEXT);
+  GG_GET_PROC(PFNGLGETMULTITEXGENFVEXTPROC, glGetMultiTexGenfvEXT);
+  GG_GET_PROC(PFNGLGETMULTITEXGENIVEXTPROC, glGetMultiTexGenivEXT);
+  GG_GET_PROC(PFNGLGETMULTITEXIMAGEEXTPROC, glGetMultiTexImageEXT);
+  GG_GET_PROC(PFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC, glGetMultiTexLevelParameterfvEXT);
+  GG_GET_PROC(PFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC, glGetMultiTexLevelParameterivEXT);
+  GG_GET_PROC(PFNGLGETMULTITEXPARAMETERIIVEXTPROC, glGetMultiTexParameterIivEXT);
+  GG_GET_PROC(PFNGLGETMULTITEXPARAMETERIUIVEXTPROC, glGetMultiTexParameterIuivEXT);
+  GG_GET_PROC(PFNGLGETMULTITEXPARAMETERFVEXTPROC, glGetMultiTexParameterfvEXT);
+  GG_GET_PROC(PFNGLGETMULTITEXPARAMETERIVEXTPROC, glGetMultiTexParameterivEXT);
+  GG_GET_PROC(PFNGLGETMULTISAMPLEFVPROC, glGetMultisamplefv);
+  GG_GET_PROC(PFNGLGETNAMEDBUFFERPARAMETERI64VPROC, glGetNamedBufferParameteri64v);
+  GG_GET_PROC(PFNGLGETNAMEDBUFFERPARAMETERIVPROC, glGetNamedBufferParameteriv);
+  GG_GET_PROC(PFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC, glGetNamedBufferParameterivEXT);
+  GG_GET_PROC(PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC, glGetNamedBufferParameterui64vNV);
+  GG_GET_PROC(PFNGLGETNAMEDBUFFERPOINTERVPROC, glGetNamedBufferPointerv);
+  GG_GET_PROC(PFNGLGETNAMEDBUFFERPOINTERVEXTPROC, glGetNamedBufferPointervEXT);
+  GG_GET_PROC(PFNGLGETNAMEDBUFFERSUBDATAPROC, glGetNamedBufferSubData);
+  GG_GET_PROC(PFNGLGETNAMEDBUFFERSUBDATAEXTPROC, glGetNamedBufferSubDataEXT);
+  GG_GET_PROC(PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC, glGetNamedFramebufferAttachmentParameteriv);
+  GG_GET_PROC(PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC, glGetNamedFramebufferAttachmentParameterivEXT);
+  GG_GET_PROC(PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC, glGetNamedFramebufferParameteriv);
+  GG_GET_PROC(PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC, glGetNamedFramebufferParameterivEXT);
+  GG_GET_PROC(PFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC, glGetNamedProgramLocalParameterIivEXT);
+  GG_GET_PROC(PFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC, glGetNamedProgramLocalParameterIuivEXT);
+  GG_GET_PROC(PFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC, glGetNamedProgramLocalParameterdvEXT);
+  GG_GET_PROC(PFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC, glGetNamedProgramLocalParameterfvEXT);
+  GG_GET_PROC(PFNGLGETNAMEDPROGRAMSTRINGEXTPROC, glGetNamedProgramStringEXT);
+  GG_GET_PROC(PFNGLGETNAMEDPROGRAMIVEXTPROC, glGetNamedProgramivEXT);
+  GG_GET_PROC(PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC, glGetNamedRenderbufferParameteriv);
+  GG_GET_PROC(PFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC, glGetNamedRenderbufferParameterivEXT);
+  GG_GET_PROC(PFNGLGETNAMEDSTRINGARBPROC, glGetNamedStringARB);
+  GG_GET_PROC(PFNGLGETNAMEDSTRINGIVARBPROC, glGetNamedStringivARB);
+  GG_GET_PROC(PFNGLGETNEXTPERFQUERYIDINTELPROC, glGetNextPerfQueryIdINTEL);
+  GG_GET_PROC(PFNGLGETOBJECTLABELPROC, glGetObjectLabel);
+  GG_GET_PROC(PFNGLGETOBJECTLABELEXTPROC, glGetObjectLabelEXT);
+  GG_GET_PROC(PFNGLGETOBJECTPTRLABELPROC, glGetObjectPtrLabel);
+  GG_GET_PROC(PFNGLGETPATHCOMMANDSNVPROC, glGetPathCommandsNV);
+  GG_GET_PROC(PFNGLGETPATHCOORDSNVPROC, glGetPathCoordsNV);
+  GG_GET_PROC(PFNGLGETPATHDASHARRAYNVPROC, glGetPathDashArrayNV);
+  GG_GET_PROC(PFNGLGETPATHLENGTHNVPROC, glGetPathLengthNV);
+  GG_GET_PROC(PFNGLGETPATHMETRICRANGENVPROC, glGetPathMetricRangeNV);
+  GG_GET_PROC(PFNGLGETPATHMETRICSNVPROC, glGetPathMetricsNV);
+  GG_GET_PROC(PFNGLGETPATHPARAMETERFVNVPROC, glGetPathParameterfvNV);
+  GG_GET_PROC(PFNGLGETPATHPARAMETERIVNVPROC, glGetPathParameterivNV);
+  GG_GET_PROC(PFNGLGETPATHSPACINGNVPROC, glGetPathSpacingNV);
+  GG_GET_PROC(PFNGLGETPERFCOUNTERINFOINTELPROC, glGetPerfCounterInfoINTEL);
+  GG_GET_PROC(PFNGLGETPERFMONITORCOUNTERDATAAMDPROC, glGetPerfMonitorCounterDataAMD);
+  GG_GET_PROC(PFNGLGETPERFMONITORCOUNTERINFOAMDPROC, glGetPerfMonitorCounterInfoAMD);
+  GG_GET_PROC(PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC, glGetPerfMonitorCounterStringAMD);
+  GG_GET_PROC(PFNGLGETPERFMONITORCOUNTERSAMDPROC, glGetPerfMonitorCountersAMD);
+  GG_GET_PROC(PFNGLGETPERFMONITORGROUPSTRINGAMDPROC, glGetPerfMonitorGroupStringAMD);
+  GG_GET_PROC(PFNGLGETPERFMONITORGROUPSAMDPROC, glGetPerfMonitorGroupsAMD);
+  GG_GET_PROC(PFNGLGETPERFQUERYDATAINTELPROC, glGetPerfQueryDataINTEL);
+  GG_GET_PROC(PFNGLGETPERFQUERYIDBYNAMEINTELPROC, glGetPerfQueryIdByNameINTEL);
+  GG_GET_PROC(PFNGLGETPERFQUERYINFOINTELPROC, glGetPerfQueryInfoINTEL);
+  GG_GET_PROC(PFNGLGETPOINTERINDEXEDVEXTPROC, glGetPointerIndexedvEXT);
+  GG_GET_PROC(PFNGLGETPOINTERI_VEXTPROC, glGetPointeri_vEXT);
+  GG_GET_PROC(PFNGLGETPOINTERVPROC, glGetPointerv);
+  GG_GET_PROC(PFNGLGETPROGRAMBINARYPROC, glGetProgramBinary);
+  GG_GET_PROC(PFNGLGETPROGRAMINFOLOGPROC, glGetProgramInfoLog);
+  GG_GET_PROC(PFNGLGETPROGRAMINTERFACEIVPROC, glGetProgramInterfaceiv);
+  GG_GET_PROC(PFNGLGETPROGRAMPIPELINEINFOLOGPROC, glGetProgramPipelineInfoLog);
+  GG_GET_PROC(PFNGLGETPROGRAMPIPELINEIVPROC, glGetProgramPipelineiv);
+  GG_GET_PROC(PFNGLGETPROGRAMRESOURCEINDEXPROC, glGetProgramResourceIndex);
+  GG_GET_PROC(PFNGLGETPROGRAMRESOURCELOCATIONPROC, glGetProgramResourceLocation);
+  GG_GET_PROC(PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC, glGetProgramResourceLocationIndex);
+  GG_GET_PROC(PFNGLGETPROGRAMRESOURCENAMEPROC, glGetProgramResourceName);
+  GG_GET_PROC(PFNGLGETPROGRAMRESOURCEFVNVPROC, glGetProgramResourcefvNV);
+  GG_GET_PROC(PFNGLGETPROGRAMRESOURCEIVPROC, glGetProgramResourceiv);
+  GG_GET_PROC(PFNGLGETPROGRAMSTAGEIVPROC, glGetProgramStageiv);
+  GG_GET_PROC(PFNGLGETPROGRAMIVPROC, glGetProgramiv);
+  GG_GET_PROC(PFNGLGETQUERYBUFFEROBJECTI64VPROC, glGetQueryBufferObjecti64v);
+  GG_GET_PROC(PFNGLGETQUERYBUFFEROBJECTIVPROC, glGetQueryBufferObjectiv);
+  GG_GET_PROC(PFNGLGETQUERYBUFFEROBJECTUI64VPROC, glGetQueryBufferObjectui64v);
+  GG_GET_PROC(PFNGLGETQUERYBUFFEROBJECTUIVPROC, glGetQueryBufferObjectuiv);
+  GG_GET_PROC(PFNGLGETQUERYINDEXEDIVPROC, glGetQueryIndexediv);
+  GG_GET_PROC(PFNGLGETQUERYOBJECTI64VPROC, glGetQueryObjecti64v);
+  GG_GET_PROC(PFNGLGETQUERYOBJECTIVPROC, glGetQueryObjectiv);
+  GG_GET_PROC(PFNGLGETQUERYOBJECTUI64VPROC, glGetQueryObjectui64v);
+  GG_GET_PROC(PFNGLGETQUERYOBJECTUIVPROC, glGetQueryObjectuiv);
+  GG_GET_PROC(PFNGLGETQUERYIVPROC, glGetQueryiv);
+  GG_GET_PROC(PFNGLGETRENDERBUFFERPARAMETERIVPROC, glGetRenderbufferParameteriv);
+  GG_GET_PROC(PFNGLGETSAMPLERPARAMETERIIVPROC, glGetSamplerParameterIiv);
+  GG_GET_PROC(PFNGLGETSAMPLERPARAMETERIUIVPROC, glGetSamplerParameterIuiv);
+  GG_GET_PROC(PFNGLGETSAMPLERPARAMETERFVPROC, glGetSamplerParameterfv);
+  GG_GET_PROC(PFNGLGETSAMPLERPARAMETERIVPROC, glGetSamplerParameteriv);
+  GG_GET_PROC(PFNGLGETSHADERINFOLOGPROC, glGetShaderInfoLog);
+  GG_GET_PROC(PFNGLGETSHADERPRECISIONFORMATPROC, glGetShaderPrecisionFormat);
+  GG_GET_PROC(PFNGLGETSHADERSOURCEPROC, glGetShaderSource);
+  GG_GET_PROC(PFNGLGETSHADERIVPROC, glGetShaderiv);
+  GG_GET_PROC(PFNGLGETSTAGEINDEXNVPROC, glGetStageIndexNV);
+  GG_GET_PROC(PFNGLGETSTRINGPROC, glGetString);
+  GG_GET_PROC(PFNGLGETSTRINGIPROC, glGetStringi);
+  GG_GET_PROC(PFNGLGETSUBROUTINEINDEXPROC, glGetSubroutineIndex);
+  GG_GET_PROC(PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC, glGetSubroutineUniformLocation);
+  GG_GET_PROC(PFNGLGETSYNCIVPROC, glGetSynciv);
+  GG_GET_PROC(PFNGLGETTEXIMAGEPROC, glGetTexImage);
+  GG_GET_PROC(PFNGLGETTEXLEVELPARAMETERFVPROC, glGetTexLevelParameterfv);
+  GG_GET_PROC(PFNGLGETTEXLEVELPARAMETERIVPROC, glGetTexLevelParameteriv);
+  GG_GET_PROC(PFNGLGETTEXPARAMETERIIVPROC, glGetTexParameterIiv);
+  GG_GET_PROC(PFNGLGETTEXPARAMETERIUIVPROC, glGetTexParameterIuiv);
+  GG_GET_PROC(PFNGLGETTEXPARAMETERFVPROC, glGetTexParameterfv);
+  GG_GET_PROC(PFNGLGETTEXPARAMETERIVPROC, glGetTexParameteriv);
+  GG_GET_PROC(PFNGLGETTEXTUREHANDLEARBPROC, glGetTextureHandleARB);
+  GG_GET_PROC(PFNGLGETTEXTUREHANDLENVPROC, glGetTextureHandleNV);
+  GG_GET_PROC(PFNGLGETTEXTUREIMAGEPROC, glGetTextureImage);
+  GG_GET_PROC(PFNGLGETTEXTUREIMAGEEXTPROC, glGetTextureImageEXT);
+  GG_GET_PROC(PFNGLGETTEXTURELEVELPARAMETERFVPROC, glGetTextureLevelParameterfv);
+  GG_GET_PROC(PFNGLGETTEXTURELEVELPARAMETERFVEXTPROC, glGetTextureLevelParameterfvEXT);
+  GG_GET_PROC(PFNGLGETTEXTURELEVELPARAMETERIVPROC, glGetTextureLevelParameteriv);
+  GG_GET_PROC(PFNGLGETTEXTURELEVELPARAMETERIVEXTPROC, glGetTextureLevelParameterivEXT);
+  GG_GET_PROC(PFNGLGETTEXTUREPARAMETERIIVPROC, glGetTextureParameterIiv);
+  GG_GET_PROC(PFNGLGETTEXTUREPARAMETERIIVEXTPROC, glGetTextureParameterIivEXT);
+  GG_GET_PROC(PFNGLGETTEXTUREPARAMETERIUIVPROC, glGetTextureParameterIuiv);
+  GG_GET_PROC(PFNGLGETTEXTUREPARAMETERIUIVEXTPROC, glGetTextureParameterIuivEXT);
+  GG_GET_PROC(PFNGLGETTEXTUREPARAMETERFVPROC, glGetTextureParameterfv);
+  GG_GET_PROC(PFNGLGETTEXTUREPARAMETERFVEXTPROC, glGetTextureParameterfvEXT);
+  GG_GET_PROC(PFNGLGETTEXTUREPARAMETERIVPROC, glGetTextureParameteriv);
+  GG_GET_PROC(PFNGLGETTEXTUREPARAMETERIVEXTPROC, glGetTextureParameterivEXT);
+  GG_GET_PROC(PFNGLGETTEXTURESAMPLERHANDLEARBPROC, glGetTextureSamplerHandleARB);
+  GG_GET_PROC(PFNGLGETTEXTURESAMPLERHANDLENVPROC, glGetTextureSamplerHandleNV);
+  GG_GET_PROC(PFNGLGETTEXTURESUBIMAGEPROC, glGetTextureSubImage);
+  GG_GET_PROC(PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, glGetTransformFeedbackVarying);
+  GG_GET_PROC(PFNGLGETTRANSFORMFEEDBACKI64_VPROC, glGetTransformFeedbacki64_v);
+  GG_GET_PROC(PFNGLGETTRANSFORMFEEDBACKI_VPROC, glGetTransformFeedbacki_v);
+  GG_GET_PROC(PFNGLGETTRANSFORMFEEDBACKIVPROC, glGetTransformFeedbackiv);
+  GG_GET_PROC(PFNGLGETUNIFORMBLOCKINDEXPROC, glGetUniformBlockIndex);
+  GG_GET_PROC(PFNGLGETUNIFORMINDICESPROC, glGetUniformIndices);
+  GG_GET_PROC(PFNGLGETUNIFORMLOCATIONPROC, glGetUniformLocation);
+  GG_GET_PROC(PFNGLGETUNIFORMSUBROUTINEUIVPROC, glGetUniformSubroutineuiv);
+  GG_GET_PROC(PFNGLGETUNIFORMDVPROC, glGetUniformdv);
+  GG_GET_PROC(PFNGLGETUNIFORMFVPROC, glGetUniformfv);
+  GG_GET_PROC(PFNGLGETUNIFORMI64VARBPROC, glGetUniformi64vARB);
+  GG_GET_PROC(PFNGLGETUNIFORMI64VNVPROC, glGetUniformi64vNV);
+  GG_GET_PROC(PFNGLGETUNIFORMIVPROC, glGetUniformiv);
+  GG_GET_PROC(PFNGLGETUNIFORMUI64VARBPROC, glGetUniformui64vARB);
+  GG_GET_PROC(PFNGLGETUNIFORMUI64VNVPROC, glGetUniformui64vNV);
+  GG_GET_PROC(PFNGLGETUNIFORMUIVPROC, glGetUniformuiv);
+  GG_GET_PROC(PFNGLGETVERTEXARRAYINDEXED64IVPROC, glGetVertexArrayIndexed64iv);
+  GG_GET_PROC(PFNGLGETVERTEXARRAYINDEXEDIVPROC, glGetVertexArrayIndexediv);
+  GG_GET_PROC(PFNGLGETVERTEXARRAYINTEGERI_VEXTPROC, glGetVertexArrayIntegeri_vEXT);
+  GG_GET_PROC(PFNGLGETVERTEXARRAYINTEGERVEXTPROC, glGetVertexArrayIntegervEXT);
+  GG_GET_PROC(PFNGLGETVERTEXARRAYPOINTERI_VEXTPROC, glGetVertexArrayPointeri_vEXT);
+  GG_GET_PROC(PFNGLGETVERTEXARRAYPOINTERVEXTPROC, glGetVertexArrayPointervEXT);
+  GG_GET_PROC(PFNGLGETVERTEXARRAYIVPROC, glGetVertexArrayiv);
+  GG_GET_PROC(PFNGLGETVERTEXATTRIBIIVPROC, glGetVertexAttribIiv);
+  GG_GET_PROC(PFNGLGETVERTEXATTRIBIUIVPROC, glGetVertexAttribIuiv);
+  GG_GET_PROC(PFNGLGETVERTEXATTRIBLDVPROC, glGetVertexAttribLdv);
+  GG_GET_PROC(PFNGLGETVERTEXATTRIBLI64VNVPROC, glGetVertexAttribLi64vNV);
+  GG_GET_PROC(PFNGLGETVERTEXATTRIBLUI64VARBPROC, glGetVertexAttribLui64vARB);
+  GG_GET_PROC(PFNGLGETVERTEXATTRIBLUI64VNVPROC, glGetVertexAttribLui64vNV);
+  GG_GET_PROC(PFNGLGETVERTEXATTRIBPOINTERVPROC, glGetVertexAttribPointerv);
+  GG_GET_PROC(PFNGLGETVERTEXATTRIBDVPROC, glGetVertexAttribdv);
+  GG_GET_PROC(PFNGLGETVERTEXATTRIBFVPROC, glGetVertexAttribfv);
+  GG_GET_PROC(PFNGLGETVERTEXATTRIBIVPROC, glGetVertexAttribiv);
+  GG_GET_PROC(PFNGLGETVKPROCADDRNVPROC, glGetVkProcAddrNV);
+  GG_GET_PROC(PFNGLGETNCOMPRESSEDTEXIMAGEPROC, glGetnCompressedTexImage);
+  GG_GET_PROC(PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC, glGetnCompressedTexImageARB);
+  GG_GET_PROC(PFNGLGETNTEXIMAGEPROC, glGetnTexImage);
+  GG_GET_PROC(PFNGLGETNTEXIMAGEARBPROC, glGetnTexImageARB);
+  GG_GET_PROC(PFNGLGETNUNIFORMDVPROC, glGetnUniformdv);
+  GG_GET_PROC(PFNGLGETNUNIFORMDVARBPROC, glGetnUniformdvARB);
+  GG_GET_PROC(PFNGLGETNUNIFORMFVPROC, glGetnUniformfv);
+  GG_GET_PROC(PFNGLGETNUNIFORMFVARBPROC, glGetnUniformfvARB);
+  GG_GET_PROC(PFNGLGETNUNIFORMI64VARBPROC, glGetnUniformi64vARB);
+  GG_GET_PROC(PFNGLGETNUNIFORMIVPROC, glGetnUniformiv);
+  GG_GET_PROC(PFNGLGETNUNIFORMIVARBPROC, glGetnUniformivARB);
+  GG_GET_PROC(PFNGLGETNUNIFORMUI64VARBPROC, glGetnUniformui64vARB);
+  GG_GET_PROC(PFNGLGETNUNIFORMUIVPROC, glGetnUniformuiv);
+  GG_GET_PROC(PFNGLGETNUNIFORMUIVARBPROC, glGetnUniformuivARB);
+  GG_GET_PROC(PFNGLHINTPROC, glHint);
+  GG_GET_PROC(PFNGLINDEXFORMATNVPROC, glIndexFormatNV);
+  GG_GET_PROC(PFNGLINSERTEVENTMARKEREXTPROC, glInsertEventMarkerEXT);
+  GG_GET_PROC(PFNGLINTERPOLATEPATHSNVPROC, glInterpolatePathsNV);
+  GG_GET_PROC(PFNGLINVALIDATEBUFFERDATAPROC, glInvalidateBufferData);
+  GG_GET_PROC(PFNGLINVALIDATEBUFFERSUBDATAPROC, glInvalidateBufferSubData);
+  GG_GET_PROC(PFNGLINVALIDATEFRAMEBUFFERPROC, glInvalidateFramebuffer);
+  GG_GET_PROC(PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC, glInvalidateNamedFramebufferData);
+  GG_GET_PROC(PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC, glInvalidateNamedFramebufferSubData);
+  GG_GET_PROC(PFNGLINVALIDATESUBFRAMEBUFFERPROC, glInvalidateSubFramebuffer);
+  GG_GET_PROC(PFNGLINVALIDATETEXIMAGEPROC, glInvalidateTexImage);
+  GG_GET_PROC(PFNGLINVALIDATETEXSUBIMAGEPROC, glInvalidateTexSubImage);
+  GG_GET_PROC(PFNGLISBUFFERPROC, glIsBuffer);
+  GG_GET_PROC(PFNGLISBUFFERRESIDENTNVPROC, glIsBufferResidentNV);
+  GG_GET_PROC(PFNGLISCOMMANDLISTNVPROC, glIsCommandListNV);
+  GG_GET_PROC(PFNGLISENABLEDPROC, glIsEnabled);
+  GG_GET_PROC(PFNGLISENABLEDINDEXEDEXTPROC, glIsEnabledIndexedEXT);
+  GG_GET_PROC(PFNGLISENABLEDIPROC, glIsEnabledi);
+  GG_GET_PROC(PFNGLISFRAMEBUFFERPROC, glIsFramebuffer);
+  GG_GET_PROC(PFNGLISIMAGEHANDLERESIDENTARBPROC, glIsImageHandleResidentARB);
+  GG_GET_PROC(PFNGLISIMAGEHANDLERESIDENTNVPROC, glIsImageHandleResidentNV);
+  GG_GET_PROC(PFNGLISNAMEDBUFFERRESIDENTNVPROC, glIsNamedBufferResidentNV);
+  GG_GET_PROC(PFNGLISNAMEDSTRINGARBPROC, glIsNamedStringARB);
+  GG_GET_PROC(PFNGLISPATHNVPROC, glIsPathNV);
+  GG_GET_PROC(PFNGLISPOINTINFILLPATHNVPROC, glIsPointInFillPathNV);
+  GG_GET_PROC(PFNGLISPOINTINSTROKEPATHNVPROC, glIsPointInStrokePathNV);
+  GG_GET_PROC(PFNGLISPROGRAMPROC, glIsProgram);
+  GG_GET_PROC(PFNGLISPROGRAMPIPELINEPROC, glIsProgramPipeline);
+  GG_GET_PROC(PFNGLISQUERYPROC, glIsQuery);
+  GG_GET_PROC(PFNGLISRENDERBUFFERPROC, glIsRenderbuffer);
+  GG_GET_PROC(PFNGLISSAMPLERPROC, glIsSampler);
+  GG_GET_PROC(PFNGLISSHADERPROC, glIsShader);
+  GG_GET_PROC(PFNGLISSTATENVPROC, glIsStateNV);
+  GG_GET_PROC(PFNGLISSYNCPROC, glIsSync);
+  GG_GET_PROC(PFNGLISTEXTUREPROC, glIsTexture);
+  GG_GET_PROC(PFNGLISTEXTUREHANDLERESIDENTARBPROC, glIsTextureHandleResidentARB);
+  GG_GET_PROC(PFNGLISTEXTUREHANDLERESIDENTNVPROC, glIsTextureHandleResidentNV);
+  GG_GET_PROC(PFNGLISTRANSFORMFEEDBACKPROC, glIsTransformFeedback);
+  GG_GET_PROC(PFNGLISVERTEXARRAYPROC, glIsVertexArray);
+  GG_GET_PROC(PFNGLLABELOBJECTEXTPROC, glLabelObjectEXT);
+  GG_GET_PROC(PFNGLLINEWIDTHPROC, glLineWidth);
+  GG_GET_PROC(PFNGLLINKPROGRAMPROC, glLinkProgram);
+  GG_GET_PROC(PFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC, glListDrawCommandsStatesClientNV);
+  GG_GET_PROC(PFNGLLOGICOPPROC, glLogicOp);
+  GG_GET_PROC(PFNGLMAKEBUFFERNONRESIDENTNVPROC, glMakeBufferNonResidentNV);
+  GG_GET_PROC(PFNGLMAKEBUFFERRESIDENTNVPROC, glMakeBufferResidentNV);
+  GG_GET_PROC(PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC, glMakeImageHandleNonResidentARB);
+  GG_GET_PROC(PFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC, glMakeImageHandleNonResidentNV);
+  GG_GET_PROC(PFNGLMAKEIMAGEHANDLERESIDENTARBPROC, glMakeImageHandleResidentARB);
+  GG_GET_PROC(PFNGLMAKEIMAGEHANDLERESIDENTNVPROC, glMakeImageHandleResidentNV);
+  GG_GET_PROC(PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC, glMakeNamedBufferNonResidentNV);
+  GG_GET_PROC(PFNGLMAKENAMEDBUFFERRESIDENTNVPROC, glMakeNamedBufferResidentNV);
+  GG_GET_PROC(PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC, glMakeTextureHandleNonResidentARB);
+  GG_GET_PROC(PFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC, glMakeTextureHandleNonResidentNV);
+  GG_GET_PROC(PFNGLMAKETEXTUREHANDLERESIDENTARBPROC, glMakeTextureHandleResidentARB);
+  GG_GET_PROC(PFNGLMAKETEXTUREHANDLERESIDENTNVPROC, glMakeTextureHandleResidentNV);
+  GG_GET_PROC(PFNGLMAPBUFFERPROC, glMapBuffer);
+  GG_GET_PROC(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange);
+  GG_GET_PROC(PFNGLMAPNAMEDBUFFERPROC, glMapNamedBuffer);
+  GG_GET_PROC(PFNGLMAPNAMEDBUFFEREXTPROC, glMapNamedBufferEXT);
+  GG_GET_PROC(PFNGLMAPNAMEDBUFFERRANGEPROC, glMapNamedBufferRange);
+  GG_GET_PROC(PFNGLMAPNAMEDBUFFERRANGEEXTPROC, glMapNamedBufferRangeEXT);
+  GG_GET_PROC(PFNGLMATRIXFRUSTUMEXTPROC, glMatrixFrustumEXT);
+  GG_GET_PROC(PFNGLMATRIXLOAD3X2FNVPROC, glMatrixLoad3x2fNV);
+  GG_GET_PROC(PFNGLMATRIXLOAD3X3FNVPROC, glMatrixLoad3x3fNV);
+  GG_GET_PROC(PFNGLMATRIXLOADIDENTITYEXTPROC, glMatrixLoadIdentityEXT);
+  GG_GET_PROC(PFNGLMATRIXLOADTRANSPOSE3X3FNVPROC, glMatrixLoadTranspose3x3fNV);
+  GG_GET_PROC(PFNGLMATRIXLOADTRANSPOSEDEXTPROC, glMatrixLoadTransposedEXT);
+  GG_GET_PROC(PFNGLMATRIXLOADTRANSPOSEFEXTPROC, glMatrixLoadTransposefEXT);
+  GG_GET_PROC(PFNGLMATRIXLOADDEXTPROC, glMatrixLoaddEXT);
+  GG_GET_PROC(PFNGLMATRIXLOADFEXTPROC, glMatrixLoadfEXT);
+  GG_GET_PROC(PFNGLMATRIXMULT3X2FNVPROC, glMatrixMult3x2fNV);
+  GG_GET_PROC(PFNGLMATRIXMULT3X3FNVPROC, glMatrixMult3x3fNV);
+  GG_GET_PROC(PFNGLMATRIXMULTTRANSPOSE3X3FNVPROC, glMatrixMultTranspose3x3fNV);
+  GG_GET_PROC(PFNGLMATRIXMULTTRANSPOSEDEXTPROC, glMatrixMultTransposedEXT);
+  GG_GET_PROC(PFNGLMATRIXMULTTRANSPOSEFEXTPROC, glMatrixMultTransposefEXT);
+  GG_GET_PROC(PFNGLMATRIXMULTDEXTPROC, glMatrixMultdEXT);
+  GG_GET_PROC(PFNGLMATRIXMULTFEXTPROC, glMatrixMultfEXT);
+  GG_GET_PROC(PFNGLMATRIXORTHOEXTPROC, glMatrixOrthoEXT);
+  GG_GET_PROC(PFNGLMATRIXPOPEXTPROC, glMatrixPopEXT);
+  GG_GET_PROC(PFNGLMATRIXPUSHEXTPROC, glMatrixPushEXT);
+  GG_GET_PROC(PFNGLMATRIXROTATEDEXTPROC, glMatrixRotatedEXT);
+  GG_GET_PROC(PFNGLMATRIXROTATEFEXTPROC, glMatrixRotatefEXT);
+  GG_GET_PROC(PFNGLMATRIXSCALEDEXTPROC, glMatrixScaledEXT);
+  GG_GET_PROC(PFNGLMATRIXSCALEFEXTPROC, glMatrixScalefEXT);
+  GG_GET_PROC(PFNGLMATRIXTRANSLATEDEXTPROC, glMatrixTranslatedEXT);
+  GG_GET_PROC(PFNGLMATRIXTRANSLATEFEXTPROC, glMatrixTranslatefEXT);
+  GG_GET_PROC(PFNGLMAXSHADERCOMPILERTHREADSARBPROC, glMaxShaderCompilerThreadsARB);
+  GG_GET_PROC(PFNGLMEMORYBARRIERPROC, glMemoryBarrier);
+  GG_GET_PROC(PFNGLMEMORYBARRIERBYREGIONPROC, glMemoryBarrierByRegion);
+  GG_GET_PROC(PFNGLMINSAMPLESHADINGPROC, glMinSampleShading);
+  GG_GET_PROC(PFNGLMINSAMPLESHADINGARBPROC, glMinSampleShadingARB);
+  GG_GET_PROC(PFNGLMULTIDRAWARRAYSPROC, glMultiDrawArrays);
+  GG_GET_PROC(PFNGLMULTIDRAWARRAYSINDIRECTPROC, glMultiDrawArraysIndirect);
+  GG_GET_PROC(PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC, glMultiDrawArraysIndirectBindlessCountNV);
+  GG_GET_PROC(PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC, glMultiDrawArraysIndirectBindlessNV);
+  GG_GET_PROC(PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC, glMultiDrawArraysIndirectCountARB);
+  GG_GET_PROC(PFNGLMULTIDRAWELEMENTSPROC, glMultiDrawElements);
+  GG_GET_PROC(PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, glMultiDrawElementsBaseVertex);
+  GG_GET_PROC(PFNGLMULTIDRAWELEMENTSINDIRECTPROC, glMultiDrawElementsIndirect);
+  GG_GET_PROC(PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC, glMultiDrawElementsIndirectBindlessCountNV);
+  GG_GET_PROC(PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC, glMultiDrawElementsIndirectBindlessNV);
+  GG_GET_PROC(PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC, glMultiDrawElementsIndirectCountARB);
+  GG_GET_PROC(PFNGLMULTITEXBUFFEREXTPROC, glMultiTexBufferEXT);
+  GG_GET_PROC(PFNGLMULTITEXCOORDPOINTEREXTPROC, glMultiTexCoordPointerEXT);
+  GG_GET_PROC(PFNGLMULTITEXENVFEXTPROC, glMultiTexEnvfEXT);
+  GG_GET_PROC(PFNGLMULTITEXENVFVEXTPROC, glMultiTexEnvfvEXT);
+  GG_GET_PROC(PFNGLMULTITEXENVIEXTPROC, glMultiTexEnviEXT);
+  GG_GET_PROC(PFNGLMULTITEXENVIVEXTPROC, glMultiTexEnvivEXT);
+  GG_GET_PROC(PFNGLMULTITEXGENDEXTPROC, glMultiTexGendEXT);
+  GG_GET_PROC(PFNGLMULTITEXGENDVEXTPROC, glMultiTexGendvEXT);
+  GG_GET_PROC(PFNGLMULTITEXGENFEXTPROC, glMultiTexGenfEXT);
+  GG_GET_PROC(PFNGLMULTITEXGENFVEXTPROC, glMultiTexGenfvEXT);
+  GG_GET_PROC(PFNGLMULTITEXGENIEXTPROC, glMultiTexGeniEXT);
+  GG_GET_PROC(PFNGLMULTITEXGENIVEXTPROC, glMultiTexGenivEXT);
+  GG_GET_PROC(PFNGLMULTITEXIMAGE1DEXTPROC, glMultiTexImage1DEXT);
+  GG_GET_PROC(PFNGLMULTITEXIMAGE2DEXTPROC, glMultiTexImage2DEXT);
+  GG_GET_PROC(PFNGLMULTITEXIMAGE3DEXTPROC, glMultiTexImage3DEXT);
+  GG_GET_PROC(PFNGLMULTITEXPARAMETERIIVEXTPROC, glMultiTexParameterIivEXT);
+  GG_GET_PROC(PFNGLMULTITEXPARAMETERIUIVEXTPROC, glMultiTexParameterIuivEXT);
+  GG_GET_PROC(PFNGLMULTITEXPARAMETERFEXTPROC, glMultiTexParameterfEXT);
+  GG_GET_PROC(PFNGLMULTITEXPARAMETERFVEXTPROC, glMultiTexParameterfvEXT);
+  GG_GET_PROC(PFNGLMULTITEXPARAMETERIEXTPROC, glMultiTexParameteriEXT);
+  GG_GET_PROC(PFNGLMULTITEXPARAMETERIVEXTPROC, glMultiTexParameterivEXT);
+  GG_GET_PROC(PFNGLMULTITEXRENDERBUFFEREXTPROC, glMultiTexRenderbufferEXT);
+  GG_GET_PROC(PFNGLMULTITEXSUBIMAGE1DEXTPROC, glMultiTexSubImage1DEXT);
+  GG_GET_PROC(PFNGLMULTITEXSUBIMAGE2DEXTPROC, glMultiTexSubImage2DEXT);
+  GG_GET_PROC(PFNGLMULTITEXSUBIMAGE3DEXTPROC, glMultiTexSubImage3DEXT);
+  GG_GET_PROC(PFNGLNAMEDBUFFERDATAPROC, glNamedBufferData);
+  GG_GET_PROC(PFNGLNAMEDBUFFERDATAEXTPROC, glNamedBufferDataEXT);
+  GG_GET_PROC(PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC, glNamedBufferPageCommitmentARB);
+  GG_GET_PROC(PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC, glNamedBufferPageCommitmentEXT);
+  GG_GET_PROC(PFNGLNAMEDBUFFERSTORAGEPROC, glNamedBufferStorage);
+  GG_GET_PROC(PFNGLNAMEDBUFFERSTORAGEEXTPROC, glNamedBufferStorageEXT);
+  GG_GET_PROC(PFNGLNAMEDBUFFERSUBDATAPROC, glNamedBufferSubData);
+  GG_GET_PROC(PFNGLNAMEDBUFFERSUBDATAEXTPROC, glNamedBufferSubDataEXT);
+  GG_GET_PROC(PFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC, glNamedCopyBufferSubDataEXT);
+  GG_GET_PROC(PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC, glNamedFramebufferDrawBuffer);
+  GG_GET_PROC(PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC, glNamedFramebufferDrawBuffers);
+  GG_GET_PROC(PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC, glNamedFramebufferParameteri);
+  GG_GET_PROC(PFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC, glNamedFramebufferParameteriEXT);
+  GG_GET_PROC(PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC, glNamedFramebufferReadBuffer);
+  GG_GET_PROC(PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC, glNamedFramebufferRenderbuffer);
+  GG_GET_PROC(PFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC, glNamedFramebufferRenderbufferEXT);
+  GG_GET_PROC(PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC, glNamedFramebufferSampleLocationsfvARB);
+  GG_GET_PROC(PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC, glNamedFramebufferSampleLocationsfvNV);
+  GG_GET_PROC(PFNGLNAMEDFRAMEBUFFERTEXTUREPROC, glNamedFramebufferTexture);
+  GG_GET_PROC(PFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC, glNamedFramebufferTexture1DEXT);
+  GG_GET_PROC(PFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC, glNamedFramebufferTexture2DEXT);
+  GG_GET_PROC(PFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC, glNamedFramebufferTexture3DEXT);
+  GG_GET_PROC(PFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC, glNamedFramebufferTextureEXT);
+  GG_GET_PROC(PFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC, glNamedFramebufferTextureFaceEXT);
+  GG_GET_PROC(PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC, glNamedFramebufferTextureLayer);
+  GG_GET_PROC(PFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC, glNamedFramebufferTextureLayerEXT);
+  GG_GET_PROC(PFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC, glNamedProgramLocalParameter4dEXT);
+  GG_GET_PROC(PFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC, glNamedProgramLocalParameter4dvEXT);
+  GG_GET_PROC(PFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC, glNamedProgramLocalParameter4fEXT);
+  GG_GET_PROC(PFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC, glNamedProgramLocalParameter4fvEXT);
+  GG_GET_PROC(PFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC, glNamedProgramLocalParameterI4iEXT);
+  GG_GET_PROC(PFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC, glNamedProgramLocalParameterI4ivEXT);
+  GG_GET_PROC(PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC, glNamedProgramLocalParameterI4uiEXT);
+  GG_GET_PROC(PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC, glNamedProgramLocalParameterI4uivEXT);
+  GG_GET_PROC(PFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC, glNamedProgramLocalParameters4fvEXT);
+  GG_GET_PROC(PFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC, glNamedProgramLocalParametersI4ivEXT);
+  GG_GET_PROC(PFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC, glNamedProgramLocalParametersI4uivEXT);
+  GG_GET_PROC(PFNGLNAMEDPROGRAMSTRINGEXTPROC, glNamedProgramStringEXT);
+  GG_GET_PROC(PFNGLNAMEDRENDERBUFFERSTORAGEPROC, glNamedRenderbufferStorage);
+  GG_GET_PROC(PFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC, glNamedRenderbufferStorageEXT);
+  GG_GET_PROC(PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC, glNamedRenderbufferStorageMultisample);
+  GG_GET_PROC(PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC, glNamedRenderbufferStorageMultisampleCoverageEXT);
+  GG_GET_PROC(PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC, glNamedRenderbufferStorageMultisampleEXT);
+  GG_GET_PROC(PFNGLNAMEDSTRINGARBPROC, glNamedStringARB);
+  GG_GET_PROC(PFNGLNORMALFORMATNVPROC, glNormalFormatNV);
+  GG_GET_PROC(PFNGLOBJECTLABELPROC, glObjectLabel);
+  GG_GET_PROC(PFNGLOBJECTPTRLABELPROC, glObjectPtrLabel);
+  GG_GET_PROC(PFNGLPATCHPARAMETERFVPROC, glPatchParameterfv);
+  GG_GET_PROC(PFNGLPATCHPARAMETERIPROC, glPatchParameteri);
+  GG_GET_PROC(PFNGLPATHCOMMANDSNVPROC, glPathCommandsNV);
+  GG_GET_PROC(PFNGLPATHCOORDSNVPROC, glPathCoordsNV);
+  GG_GET_PROC(PFNGLPATHCOVERDEPTHFUNCNVPROC, glPathCoverDepthFuncNV);
+  GG_GET_PROC(PFNGLPATHDASHARRAYNVPROC, glPathDashArrayNV);
+  GG_GET_PROC(PFNGLPATHGLYPHINDEXARRAYNVPROC, glPathGlyphIndexArrayNV);
+  GG_GET_PROC(PFNGLPATHGLYPHINDEXRANGENVPROC, glPathGlyphIndexRangeNV);
+  GG_GET_PROC(PFNGLPATHGLYPHRANGENVPROC, glPathGlyphRangeNV);
+  GG_GET_PROC(PFNGLPATHGLYPHSNVPROC, glPathGlyphsNV);
+  GG_GET_PROC(PFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC, glPathMemoryGlyphIndexArrayNV);
+  GG_GET_PROC(PFNGLPATHPARAMETERFNVPROC, glPathParameterfNV);
+  GG_GET_PROC(PFNGLPATHPARAMETERFVNVPROC, glPathParameterfvNV);
+  GG_GET_PROC(PFNGLPATHPARAMETERINVPROC, glPathParameteriNV);
+  GG_GET_PROC(PFNGLPATHPARAMETERIVNVPROC, glPathParameterivNV);
+  GG_GET_PROC(PFNGLPATHSTENCILDEPTHOFFSETNVPROC, glPathStencilDepthOffsetNV);
+  GG_GET_PROC(PFNGLPATHSTENCILFUNCNVPROC, glPathStencilFuncNV);
+  GG_GET_PROC(PFNGLPATHSTRINGNVPROC, glPathStringNV);
+  GG_GET_PROC(PFNGLPATHSUBCOMMANDSNVPROC, glPathSubCommandsNV);
+  GG_GET_PROC(PFNGLPATHSUBCOORDSNVPROC, glPathSubCoordsNV);
+  GG_GET_PROC(PFNGLPAUSETRANSFORMFEEDBACKPROC, glPauseTransformFeedback);
+  GG_GET_PROC(PFNGLPIXELSTOREFPROC, glPixelStoref);
+  GG_GET_PROC(PFNGLPIXELSTOREIPROC, glPixelStorei);
+  GG_GET_PROC(PFNGLPOINTALONGPATHNVPROC, glPointAlongPathNV);
+  GG_GET_PROC(PFNGLPOINTPARAMETERFPROC, glPointParameterf);
+  GG_GET_PROC(PFNGLPOINTPARAMETERFVPROC, glPointParameterfv);
+  GG_GET_PROC(PFNGLPOINTPARAMETERIPROC, glPointParameteri);
+  GG_GET_PROC(PFNGLPOINTPARAMETERIVPROC, glPointParameteriv);
+  GG_GET_PROC(PFNGLPOINTSIZEPROC, glPointSize);
+  GG_GET_PROC(PFNGLPOLYGONMODEPROC, glPolygonMode);
+  GG_GET_PROC(PFNGLPOLYGONOFFSETPROC, glPolygonOffset);
+  GG_GET_PROC(PFNGLPOLYGONOFFSETCLAMPEXTPROC, glPolygonOffsetClampEXT);
+  GG_GET_PROC(PFNGLPOPDEBUGGROUPPROC, glPopDebugGroup);
+  GG_GET_PROC(PFNGLPOPGROUPMARKEREXTPROC, glPopGroupMarkerEXT);
+  GG_GET_PROC(PFNGLPRIMITIVEBOUNDINGBOXARBPROC, glPrimitiveBoundingBoxARB);
+  GG_GET_PROC(PFNGLPRIMITIVERESTARTINDEXPROC, glPrimitiveRestartIndex);
+  GG_GET_PROC(PFNGLPROGRAMBINARYPROC, glProgramBinary);
+  GG_GET_PROC(PFNGLPROGRAMPARAMETERIPROC, glProgramParameteri);
+  GG_GET_PROC(PFNGLPROGRAMPARAMETERIARBPROC, glProgramParameteriARB);
+  GG_GET_PROC(PFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC, glProgramPathFragmentInputGenNV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1DPROC, glProgramUniform1d);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1DEXTPROC, glProgramUniform1dEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1DVPROC, glProgramUniform1dv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1DVEXTPROC, glProgramUniform1dvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1FPROC, glProgramUniform1f);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1FEXTPROC, glProgramUniform1fEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1FVPROC, glProgramUniform1fv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1FVEXTPROC, glProgramUniform1fvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1IPROC, glProgramUniform1i);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1I64ARBPROC, glProgramUniform1i64ARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1I64NVPROC, glProgramUniform1i64NV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1I64VARBPROC, glProgramUniform1i64vARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1I64VNVPROC, glProgramUniform1i64vNV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1IEXTPROC, glProgramUniform1iEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1IVPROC, glProgramUniform1iv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1IVEXTPROC, glProgramUniform1ivEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1UIPROC, glProgramUniform1ui);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1UI64ARBPROC, glProgramUniform1ui64ARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1UI64NVPROC, glProgramUniform1ui64NV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1UI64VARBPROC, glProgramUniform1ui64vARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1UI64VNVPROC, glProgramUniform1ui64vNV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1UIEXTPROC, glProgramUniform1uiEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1UIVPROC, glProgramUniform1uiv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM1UIVEXTPROC, glProgramUniform1uivEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2DPROC, glProgramUniform2d);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2DEXTPROC, glProgramUniform2dEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2DVPROC, glProgramUniform2dv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2DVEXTPROC, glProgramUniform2dvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2FPROC, glProgramUniform2f);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2FEXTPROC, glProgramUniform2fEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2FVPROC, glProgramUniform2fv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2FVEXTPROC, glProgramUniform2fvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2IPROC, glProgramUniform2i);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2I64ARBPROC, glProgramUniform2i64ARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2I64NVPROC, glProgramUniform2i64NV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2I64VARBPROC, glProgramUniform2i64vARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2I64VNVPROC, glProgramUniform2i64vNV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2IEXTPROC, glProgramUniform2iEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2IVPROC, glProgramUniform2iv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2IVEXTPROC, glProgramUniform2ivEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2UIPROC, glProgramUniform2ui);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2UI64ARBPROC, glProgramUniform2ui64ARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2UI64NVPROC, glProgramUniform2ui64NV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2UI64VARBPROC, glProgramUniform2ui64vARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2UI64VNVPROC, glProgramUniform2ui64vNV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2UIEXTPROC, glProgramUniform2uiEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2UIVPROC, glProgramUniform2uiv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM2UIVEXTPROC, glProgramUniform2uivEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3DPROC, glProgramUniform3d);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3DEXTPROC, glProgramUniform3dEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3DVPROC, glProgramUniform3dv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3DVEXTPROC, glProgramUniform3dvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3FPROC, glProgramUniform3f);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3FEXTPROC, glProgramUniform3fEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3FVPROC, glProgramUniform3fv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3FVEXTPROC, glProgramUniform3fvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3IPROC, glProgramUniform3i);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3I64ARBPROC, glProgramUniform3i64ARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3I64NVPROC, glProgramUniform3i64NV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3I64VARBPROC, glProgramUniform3i64vARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3I64VNVPROC, glProgramUniform3i64vNV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3IEXTPROC, glProgramUniform3iEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3IVPROC, glProgramUniform3iv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3IVEXTPROC, glProgramUniform3ivEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3UIPROC, glProgramUniform3ui);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3UI64ARBPROC, glProgramUniform3ui64ARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3UI64NVPROC, glProgramUniform3ui64NV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3UI64VARBPROC, glProgramUniform3ui64vARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3UI64VNVPROC, glProgramUniform3ui64vNV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3UIEXTPROC, glProgramUniform3uiEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3UIVPROC, glProgramUniform3uiv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM3UIVEXTPROC, glProgramUniform3uivEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4DPROC, glProgramUniform4d);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4DEXTPROC, glProgramUniform4dEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4DVPROC, glProgramUniform4dv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4DVEXTPROC, glProgramUniform4dvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4FPROC, glProgramUniform4f);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4FEXTPROC, glProgramUniform4fEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4FVPROC, glProgramUniform4fv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4FVEXTPROC, glProgramUniform4fvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4IPROC, glProgramUniform4i);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4I64ARBPROC, glProgramUniform4i64ARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4I64NVPROC, glProgramUniform4i64NV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4I64VARBPROC, glProgramUniform4i64vARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4I64VNVPROC, glProgramUniform4i64vNV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4IEXTPROC, glProgramUniform4iEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4IVPROC, glProgramUniform4iv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4IVEXTPROC, glProgramUniform4ivEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4UIPROC, glProgramUniform4ui);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4UI64ARBPROC, glProgramUniform4ui64ARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4UI64NVPROC, glProgramUniform4ui64NV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4UI64VARBPROC, glProgramUniform4ui64vARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4UI64VNVPROC, glProgramUniform4ui64vNV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4UIEXTPROC, glProgramUniform4uiEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4UIVPROC, glProgramUniform4uiv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORM4UIVEXTPROC, glProgramUniform4uivEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC, glProgramUniformHandleui64ARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMHANDLEUI64NVPROC, glProgramUniformHandleui64NV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC, glProgramUniformHandleui64vARB);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC, glProgramUniformHandleui64vNV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX2DVPROC, glProgramUniformMatrix2dv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC, glProgramUniformMatrix2dvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX2FVPROC, glProgramUniformMatrix2fv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC, glProgramUniformMatrix2fvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC, glProgramUniformMatrix2x3dv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC, glProgramUniformMatrix2x3dvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC, glProgramUniformMatrix2x3fv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC, glProgramUniformMatrix2x3fvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC, glProgramUniformMatrix2x4dv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC, glProgramUniformMatrix2x4dvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC, glProgramUniformMatrix2x4fv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC, glProgramUniformMatrix2x4fvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX3DVPROC, glProgramUniformMatrix3dv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC, glProgramUniformMatrix3dvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX3FVPROC, glProgramUniformMatrix3fv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC, glProgramUniformMatrix3fvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC, glProgramUniformMatrix3x2dv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC, glProgramUniformMatrix3x2dvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC, glProgramUniformMatrix3x2fv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC, glProgramUniformMatrix3x2fvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC, glProgramUniformMatrix3x4dv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC, glProgramUniformMatrix3x4dvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC, glProgramUniformMatrix3x4fv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC, glProgramUniformMatrix3x4fvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX4DVPROC, glProgramUniformMatrix4dv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC, glProgramUniformMatrix4dvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX4FVPROC, glProgramUniformMatrix4fv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC, glProgramUniformMatrix4fvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC, glProgramUniformMatrix4x2dv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC, glProgramUniformMatrix4x2dvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC, glProgramUniformMatrix4x2fv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC, glProgramUniformMatrix4x2fvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC, glProgramUniformMatrix4x3dv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC, glProgramUniformMatrix4x3dvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC, glProgramUniformMatrix4x3fv);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC, glProgramUniformMatrix4x3fvEXT);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMUI64NVPROC, glProgramUniformui64NV);
+  GG_GET_PROC(PFNGLPROGRAMUNIFORMUI64VNVPROC, glProgramUniformui64vNV);
+  GG_GET_PROC(PFNGLPROVOKINGVERTEXPROC, glProvokingVertex);
+  GG_GET_PROC(PFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC, glPushClientAttribDefaultEXT);
+  GG_GET_PROC(PFNGLPUSHDEBUGGROUPPROC, glPushDebugGroup);
+  GG_GET_PROC(PFNGLPUSHGROUPMARKEREXTPROC, glPushGroupMarkerEXT);
+  GG_GET_PROC(PFNGLQUERYCOUNTERPROC, glQueryCounter);
+  GG_GET_PROC(PFNGLRASTERSAMPLESEXTPROC, glRasterSamplesEXT);
+  GG_GET_PROC(PFNGLREADBUFFERPROC, glReadBuffer);
+  GG_GET_PROC(PFNGLREADPIXELSPROC, glReadPixels);
+  GG_GET_PROC(PFNGLREADNPIXELSPROC, glReadnPixels);
+  GG_GET_PROC(PFNGLREADNPIXELSARBPROC, glReadnPixelsARB);
+  GG_GET_PROC(PFNGLRELEASESHADERCOMPILERPROC, glReleaseShaderCompiler);
+  GG_GET_PROC(PFNGLRENDERBUFFERSTORAGEPROC, glRenderbufferStorage);
+  GG_GET_PROC(PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, glRenderbufferStorageMultisample);
+  GG_GET_PROC(PFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC, glRenderbufferStorageMultisampleCoverageNV);
+  GG_GET_PROC(PFNGLRESOLVEDEPTHVALUESNVPROC, glResolveDepthValuesNV);
+  GG_GET_PROC(PFNGLRESUMETRANSFORMFEEDBACKPROC, glResumeTransformFeedback);
+  GG_GET_PROC(PFNGLSAMPLECOVERAGEPROC, glSampleCoverage);
+  GG_GET_PROC(PFNGLSAMPLEMASKIPROC, glSampleMaski);
+  GG_GET_PROC(PFNGLSAMPLERPARAMETERIIVPROC, glSamplerParameterIiv);
+  GG_GET_PROC(PFNGLSAMPLERPARAMETERIUIVPROC, glSamplerParameterIuiv);
+  GG_GET_PROC(PFNGLSAMPLERPARAMETERFPROC, glSamplerParameterf);
+  GG_GET_PROC(PFNGLSAMPLERPARAMETERFVPROC, glSamplerParameterfv);
+  GG_GET_PROC(PFNGLSAMPLERPARAMETERIPROC, glSamplerParameteri);
+  GG_GET_PROC(PFNGLSAMPLERPARAMETERIVPROC, glSamplerParameteriv);
+  GG_GET_PROC(PFNGLSCISSORPROC, glScissor);
+  GG_GET_PROC(PFNGLSCISSORARRAYVPROC, glScissorArrayv);
+  GG_GET_PROC(PFNGLSCISSORINDEXEDPROC, glScissorIndexed);
+  GG_GET_PROC(PFNGLSCISSORINDEXEDVPROC, glScissorIndexedv);
+  GG_GET_PROC(PFNGLSECONDARYCOLORFORMATNVPROC, glSecondaryColorFormatNV);
+  GG_GET_PROC(PFNGLSELECTPERFMONITORCOUNTERSAMDPROC, glSelectPerfMonitorCountersAMD);
+  GG_GET_PROC(PFNGLSHADERBINARYPROC, glShaderBinary);
+  GG_GET_PROC(PFNGLSHADERSOURCEPROC, glShaderSource);
+  GG_GET_PROC(PFNGLSHADERSTORAGEBLOCKBINDINGPROC, glShaderStorageBlockBinding);
+  GG_GET_PROC(PFNGLSIGNALVKFENCENVPROC, glSignalVkFenceNV);
+  GG_GET_PROC(PFNGLSIGNALVKSEMAPHORENVPROC, glSignalVkSemaphoreNV);
+  GG_GET_PROC(PFNGLSPECIALIZESHADERARBPROC, glSpecializeShaderARB);
+  GG_GET_PROC(PFNGLSTATECAPTURENVPROC, glStateCaptureNV);
+  GG_GET_PROC(PFNGLSTENCILFILLPATHINSTANCEDNVPROC, glStencilFillPathInstancedNV);
+  GG_GET_PROC(PFNGLSTENCILFILLPATHNVPROC, glStencilFillPathNV);
+  GG_GET_PROC(PFNGLSTENCILFUNCPROC, glStencilFunc);
+  GG_GET_PROC(PFNGLSTENCILFUNCSEPARATEPROC, glStencilFuncSeparate);
+  GG_GET_PROC(PFNGLSTENCILMASKPROC, glStencilMask);
+  GG_GET_PROC(PFNGLSTENCILMASKSEPARATEPROC, glStencilMaskSeparate);
+  GG_GET_PROC(PFNGLSTENCILOPPROC, glStencilOp);
+  GG_GET_PROC(PFNGLSTENCILOPSEPARATEPROC, glStencilOpSeparate);
+  GG_GET_PROC(PFNGLSTENCILSTROKEPATHINSTANCEDNVPROC, glStencilStrokePathInstancedNV);
+  GG_GET_PROC(PFNGLSTENCILSTROKEPATHNVPROC, glStencilStrokePathNV);
+  GG_GET_PROC(PFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC, glStencilThenCoverFillPathInstancedNV);
+  GG_GET_PROC(PFNGLSTENCILTHENCOVERFILLPATHNVPROC, glStencilThenCoverFillPathNV);
+  GG_GET_PROC(PFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC, glStencilThenCoverStrokePathInstancedNV);
+  GG_GET_PROC(PFNGLSTENCILTHENCOVERSTROKEPATHNVPROC, glStencilThenCoverStrokePathNV);
+  GG_GET_PROC(PFNGLSUBPIXELPRECISIONBIASNVPROC, glSubpixelPrecisionBiasNV);
+  GG_GET_PROC(PFNGLTEXBUFFERPROC, glTexBuffer);
+  GG_GET_PROC(PFNGLTEXBUFFERARBPROC, glTexBufferARB);
+  GG_GET_PROC(PFNGLTEXBUFFERRANGEPROC, glTexBufferRange);
+  GG_GET_PROC(PFNGLTEXCOORDFORMATNVPROC, glTexCoordFormatNV);
+  GG_GET_PROC(PFNGLTEXIMAGE1DPROC, glTexImage1D);
+  GG_GET_PROC(PFNGLTEXIMAGE2DPROC, glTexImage2D);
+  GG_GET_PROC(PFNGLTEXIMAGE2DMULTISAMPLEPROC, glTexImage2DMultisample);
+  GG_GET_PROC(PFNGLTEXIMAGE3DPROC, glTexImage3D);
+  GG_GET_PROC(PFNGLTEXIMAGE3DMULTISAMPLEPROC, glTexImage3DMultisample);
+  GG_GET_PROC(PFNGLTEXPAGECOMMITMENTARBPROC, glTexPageCommitmentARB);
+  GG_GET_PROC(PFNGLTEXPARAMETERIIVPROC, glTexParameterIiv);
+  GG_GET_PROC(PFNGLTEXPARAMETERIUIVPROC, glTexParameterIuiv);
+  GG_GET_PROC(PFNGLTEXPARAMETERFPROC, glTexParameterf);
+  GG_GET_PROC(PFNGLTEXPARAMETERFVPROC, glTexParameterfv);
+  GG_GET_PROC(PFNGLTEXPARAMETERIPROC, glTexParameteri);
+  GG_GET_PROC(PFNGLTEXPARAMETERIVPROC, glTexParameteriv);
+  GG_GET_PROC(PFNGLTEXSTORAGE1DPROC, glTexStorage1D);
+  GG_GET_PROC(PFNGLTEXSTORAGE2DPROC, glTexStorage2D);
+  GG_GET_PROC(PFNGLTEXSTORAGE2DMULTISAMPLEPROC, glTexStorage2DMultisample);
+  GG_GET_PROC(PFNGLTEXSTORAGE3DPROC, glTexStorage3D);
+  GG_GET_PROC(PFNGLTEXSTORAGE3DMULTISAMPLEPROC, glTexStorage3DMultisample);
+  GG_GET_PROC(PFNGLTEXSUBIMAGE1DPROC, glTexSubImage1D);
+  GG_GET_PROC(PFNGLTEXSUBIMAGE2DPROC, glTexSubImage2D);
+  GG_GET_PROC(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D);
+  GG_GET_PROC(PFNGLTEXTUREBARRIERPROC, glTextureBarrier);
+  GG_GET_PROC(PFNGLTEXTUREBARRIERNVPROC, glTextureBarrierNV);
+  GG_GET_PROC(PFNGLTEXTUREBUFFERPROC, glTextureBuffer);
+  GG_GET_PROC(PFNGLTEXTUREBUFFEREXTPROC, glTextureBufferEXT);
+  GG_GET_PROC(PFNGLTEXTUREBUFFERRANGEPROC, glTextureBufferRange);
+  GG_GET_PROC(PFNGLTEXTUREBUFFERRANGEEXTPROC, glTextureBufferRangeEXT);
+  GG_GET_PROC(PFNGLTEXTUREIMAGE1DEXTPROC, glTextureImage1DEXT);
+  GG_GET_PROC(PFNGLTEXTUREIMAGE2DEXTPROC, glTextureImage2DEXT);
+  GG_GET_PROC(PFNGLTEXTUREIMAGE3DEXTPROC, glTextureImage3DEXT);
+  GG_GET_PROC(PFNGLTEXTUREPAGECOMMITMENTEXTPROC, glTexturePageCommitmentEXT);
+  GG_GET_PROC(PFNGLTEXTUREPARAMETERIIVPROC, glTextureParameterIiv);
+  GG_GET_PROC(PFNGLTEXTUREPARAMETERIIVEXTPROC, glTextureParameterIivEXT);
+  GG_GET_PROC(PFNGLTEXTUREPARAMETERIUIVPROC, glTextureParameterIuiv);
+  GG_GET_PROC(PFNGLTEXTUREPARAMETERIUIVEXTPROC, glTextureParameterIuivEXT);
+  GG_GET_PROC(PFNGLTEXTUREPARAMETERFPROC, glTextureParameterf);
+  GG_GET_PROC(PFNGLTEXTUREPARAMETERFEXTPROC, glTextureParameterfEXT);
+  GG_GET_PROC(PFNGLTEXTUREPARAMETERFVPROC, glTextureParameterfv);
+  GG_GET_PROC(PFNGLTEXTUREPARAMETERFVEXTPROC, glTextureParameterfvEXT);
+  GG_GET_PROC(PFNGLTEXTUREPARAMETERIPROC, glTextureParameteri);
+  GG_GET_PROC(PFNGLTEXTUREPARAMETERIEXTPROC, glTextureParameteriEXT);
+  GG_GET_PROC(PFNGLTEXTUREPARAMETERIVPROC, glTextureParameteriv);
+  GG_GET_PROC(PFNGLTEXTUREPARAMETERIVEXTPROC, glTextureParameterivEXT);
+  GG_GET_PROC(PFNGLTEXTURERENDERBUFFEREXTPROC, glTextureRenderbufferEXT);
+  GG_GET_PROC(PFNGLTEXTURESTORAGE1DPROC, glTextureStorage1D);
+  GG_GET_PROC(PFNGLTEXTURESTORAGE1DEXTPROC, glTextureStorage1DEXT);
+  GG_GET_PROC(PFNGLTEXTURESTORAGE2DPROC, glTextureStorage2D);
+  GG_GET_PROC(PFNGLTEXTURESTORAGE2DEXTPROC, glTextureStorage2DEXT);
+  GG_GET_PROC(PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC, glTextureStorage2DMultisample);
+  GG_GET_PROC(PFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC, glTextureStorage2DMultisampleEXT);
+  GG_GET_PROC(PFNGLTEXTURESTORAGE3DPROC, glTextureStorage3D);
+  GG_GET_PROC(PFNGLTEXTURESTORAGE3DEXTPROC, glTextureStorage3DEXT);
+  GG_GET_PROC(PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC, glTextureStorage3DMultisample);
+  GG_GET_PROC(PFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC, glTextureStorage3DMultisampleEXT);
+  GG_GET_PROC(PFNGLTEXTURESUBIMAGE1DPROC, glTextureSubImage1D);
+  GG_GET_PROC(PFNGLTEXTURESUBIMAGE1DEXTPROC, glTextureSubImage1DEXT);
+  GG_GET_PROC(PFNGLTEXTURESUBIMAGE2DPROC, glTextureSubImage2D);
+  GG_GET_PROC(PFNGLTEXTURESUBIMAGE2DEXTPROC, glTextureSubImage2DEXT);
+  GG_GET_PROC(PFNGLTEXTURESUBIMAGE3DPROC, glTextureSubImage3D);
+  GG_GET_PROC(PFNGLTEXTURESUBIMAGE3DEXTPROC, glTextureSubImage3DEXT);
+  GG_GET_PROC(PFNGLTEXTUREVIEWPROC, glTextureView);
+  GG_GET_PROC(PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC, glTransformFeedbackBufferBase);
+  GG_GET_PROC(PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC, glTransformFeedbackBufferRange);
+  GG_GET_PROC(PFNGLTRANSFORMFEEDBACKVARYINGSPROC, glTransformFeedbackVaryings);
+  GG_GET_PROC(PFNGLTRANSFORMPATHNVPROC, glTransformPathNV);
+  GG_GET_PROC(PFNGLUNIFORM1DPROC, glUniform1d);
+  GG_GET_PROC(PFNGLUNIFORM1DVPROC, glUniform1dv);
+  GG_GET_PROC(PFNGLUNIFORM1FPROC, glUniform1f);
+  GG_GET_PROC(PFNGLUNIFORM1FVPROC, glUniform1fv);
+  GG_GET_PROC(PFNGLUNIFORM1IPROC, glUniform1i);
+  GG_GET_PROC(PFNGLUNIFORM1I64ARBPROC, glUniform1i64ARB);
+  GG_GET_PROC(PFNGLUNIFORM1I64NVPROC, glUniform1i64NV);
+  GG_GET_PROC(PFNGLUNIFORM1I64VARBPROC, glUniform1i64vARB);
+  GG_GET_PROC(PFNGLUNIFORM1I64VNVPROC, glUniform1i64vNV);
+  GG_GET_PROC(PFNGLUNIFORM1IVPROC, glUniform1iv);
+  GG_GET_PROC(PFNGLUNIFORM1UIPROC, glUniform1ui);
+  GG_GET_PROC(PFNGLUNIFORM1UI64ARBPROC, glUniform1ui64ARB);
+  GG_GET_PROC(PFNGLUNIFORM1UI64NVPROC, glUniform1ui64NV);
+  GG_GET_PROC(PFNGLUNIFORM1UI64VARBPROC, glUniform1ui64vARB);
+  GG_GET_PROC(PFNGLUNIFORM1UI64VNVPROC, glUniform1ui64vNV);
+  GG_GET_PROC(PFNGLUNIFORM1UIVPROC, glUniform1uiv);
+  GG_GET_PROC(PFNGLUNIFORM2DPROC, glUniform2d);
+  GG_GET_PROC(PFNGLUNIFORM2DVPROC, glUniform2dv);
+  GG_GET_PROC(PFNGLUNIFORM2FPROC, glUniform2f);
+  GG_GET_PROC(PFNGLUNIFORM2FVPROC, glUniform2fv);
+  GG_GET_PROC(PFNGLUNIFORM2IPROC, glUniform2i);
+  GG_GET_PROC(PFNGLUNIFORM2I64ARBPROC, glUniform2i64ARB);
+  GG_GET_PROC(PFNGLUNIFORM2I64NVPROC, glUniform2i64NV);
+  GG_GET_PROC(PFNGLUNIFORM2I64VARBPROC, glUniform2i64vARB);
+  GG_GET_PROC(PFNGLUNIFORM2I64VNVPROC, glUniform2i64vNV);
+  GG_GET_PROC(PFNGLUNIFORM2IVPROC, glUniform2iv);
+  GG_GET_PROC(PFNGLUNIFORM2UIPROC, glUniform2ui);
+  GG_GET_PROC(PFNGLUNIFORM2UI64ARBPROC, glUniform2ui64ARB);
+  GG_GET_PROC(PFNGLUNIFORM2UI64NVPROC, glUniform2ui64NV);
+  GG_GET_PROC(PFNGLUNIFORM2UI64VARBPROC, glUniform2ui64vARB);
+  GG_GET_PROC(PFNGLUNIFORM2UI64VNVPROC, glUniform2ui64vNV);
+  GG_GET_PROC(PFNGLUNIFORM2UIVPROC, glUniform2uiv);
+  GG_GET_PROC(PFNGLUNIFORM3DPROC, glUniform3d);
+  GG_GET_PROC(PFNGLUNIFORM3DVPROC, glUniform3dv);
+  GG_GET_PROC(PFNGLUNIFORM3FPROC, glUniform3f);
+  GG_GET_PROC(PFNGLUNIFORM3FVPROC, glUniform3fv);
+  GG_GET_PROC(PFNGLUNIFORM3IPROC, glUniform3i);
+  GG_GET_PROC(PFNGLUNIFORM3I64ARBPROC, glUniform3i64ARB);
+  GG_GET_PROC(PFNGLUNIFORM3I64NVPROC, glUniform3i64NV);
+  GG_GET_PROC(PFNGLUNIFORM3I64VARBPROC, glUniform3i64vARB);
+  GG_GET_PROC(PFNGLUNIFORM3I64VNVPROC, glUniform3i64vNV);
+  GG_GET_PROC(PFNGLUNIFORM3IVPROC, glUniform3iv);
+  GG_GET_PROC(PFNGLUNIFORM3UIPROC, glUniform3ui);
+  GG_GET_PROC(PFNGLUNIFORM3UI64ARBPROC, glUniform3ui64ARB);
+  GG_GET_PROC(PFNGLUNIFORM3UI64NVPROC, glUniform3ui64NV);
+  GG_GET_PROC(PFNGLUNIFORM3UI64VARBPROC, glUniform3ui64vARB);
+  GG_GET_PROC(PFNGLUNIFORM3UI64VNVPROC, glUniform3ui64vNV);
+  GG_GET_PROC(PFNGLUNIFORM3UIVPROC, glUniform3uiv);
+  GG_GET_PROC(PFNGLUNIFORM4DPROC, glUniform4d);
+  GG_GET_PROC(PFNGLUNIFORM4DVPROC, glUniform4dv);
+  GG_GET_PROC(PFNGLUNIFORM4FPROC, glUniform4f);
+  GG_GET_PROC(PFNGLUNIFORM4FVPROC, glUniform4fv);
+  GG_GET_PROC(PFNGLUNIFORM4IPROC, glUniform4i);
+  GG_GET_PROC(PFNGLUNIFORM4I64ARBPROC, glUniform4i64ARB);
+  GG_GET_PROC(PFNGLUNIFORM4I64NVPROC, glUniform4i64NV);
+  GG_GET_PROC(PFNGLUNIFORM4I64VARBPROC, glUniform4i64vARB);
+  GG_GET_PROC(PFNGLUNIFORM4I64VNVPROC, glUniform4i64vNV);
+  GG_GET_PROC(PFNGLUNIFORM4IVPROC, glUniform4iv);
+  GG_GET_PROC(PFNGLUNIFORM4UIPROC, glUniform4ui);
+  GG_GET_PROC(PFNGLUNIFORM4UI64ARBPROC, glUniform4ui64ARB);
+  GG_GET_PROC(PFNGLUNIFORM4UI64NVPROC, glUniform4ui64NV);
+  GG_GET_PROC(PFNGLUNIFORM4UI64VARBPROC, glUniform4ui64vARB);
+  GG_GET_PROC(PFNGLUNIFORM4UI64VNVPROC, glUniform4ui64vNV);
+  GG_GET_PROC(PFNGLUNIFORM4UIVPROC, glUniform4uiv);
+  GG_GET_PROC(PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding);
+  GG_GET_PROC(PFNGLUNIFORMHANDLEUI64ARBPROC, glUniformHandleui64ARB);
+  GG_GET_PROC(PFNGLUNIFORMHANDLEUI64NVPROC, glUniformHandleui64NV);
+  GG_GET_PROC(PFNGLUNIFORMHANDLEUI64VARBPROC, glUniformHandleui64vARB);
+  GG_GET_PROC(PFNGLUNIFORMHANDLEUI64VNVPROC, glUniformHandleui64vNV);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX2DVPROC, glUniformMatrix2dv);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX2FVPROC, glUniformMatrix2fv);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX2X3DVPROC, glUniformMatrix2x3dv);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX2X3FVPROC, glUniformMatrix2x3fv);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX2X4DVPROC, glUniformMatrix2x4dv);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX2X4FVPROC, glUniformMatrix2x4fv);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX3DVPROC, glUniformMatrix3dv);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX3FVPROC, glUniformMatrix3fv);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX3X2DVPROC, glUniformMatrix3x2dv);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX3X2FVPROC, glUniformMatrix3x2fv);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX3X4DVPROC, glUniformMatrix3x4dv);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX3X4FVPROC, glUniformMatrix3x4fv);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX4DVPROC, glUniformMatrix4dv);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX4FVPROC, glUniformMatrix4fv);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX4X2DVPROC, glUniformMatrix4x2dv);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX4X2FVPROC, glUniformMatrix4x2fv);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX4X3DVPROC, glUniformMatrix4x3dv);
+  GG_GET_PROC(PFNGLUNIFORMMATRIX4X3FVPROC, glUniformMatrix4x3fv);
+  GG_GET_PROC(PFNGLUNIFORMSUBROUTINESUIVPROC, glUniformSubroutinesuiv);
+  GG_GET_PROC(PFNGLUNIFORMUI64NVPROC, glUniformui64NV);
+  GG_GET_PROC(PFNGLUNIFORMUI64VNVPROC, glUniformui64vNV);
+  GG_GET_PROC(PFNGLUNMAPBUFFERPROC, glUnmapBuffer);
+  GG_GET_PROC(PFNGLUNMAPNAMEDBUFFERPROC, glUnmapNamedBuffer);
+  GG_GET_PROC(PFNGLUNMAPNAMEDBUFFEREXTPROC, glUnmapNamedBufferEXT);
+  GG_GET_PROC(PFNGLUSEPROGRAMPROC, glUseProgram);
+  GG_GET_PROC(PFNGLUSEPROGRAMSTAGESPROC, glUseProgramStages);
+  GG_GET_PROC(PFNGLUSESHADERPROGRAMEXTPROC, glUseShaderProgramEXT);
+  GG_GET_PROC(PFNGLVALIDATEPROGRAMPROC, glValidateProgram);
+  GG_GET_PROC(PFNGLVALIDATEPROGRAMPIPELINEPROC, glValidateProgramPipeline);
+  GG_GET_PROC(PFNGLVERTEXARRAYATTRIBBINDINGPROC, glVertexArrayAttribBinding);
+  GG_GET_PROC(PFNGLVERTEXARRAYATTRIBFORMATPROC, glVertexArrayAttribFormat);
+  GG_GET_PROC(PFNGLVERTEXARRAYATTRIBIFORMATPROC, glVertexArrayAttribIFormat);
+  GG_GET_PROC(PFNGLVERTEXARRAYATTRIBLFORMATPROC, glVertexArrayAttribLFormat);
+  GG_GET_PROC(PFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC, glVertexArrayBindVertexBufferEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYBINDINGDIVISORPROC, glVertexArrayBindingDivisor);
+  GG_GET_PROC(PFNGLVERTEXARRAYCOLOROFFSETEXTPROC, glVertexArrayColorOffsetEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC, glVertexArrayEdgeFlagOffsetEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYELEMENTBUFFERPROC, glVertexArrayElementBuffer);
+  GG_GET_PROC(PFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC, glVertexArrayFogCoordOffsetEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYINDEXOFFSETEXTPROC, glVertexArrayIndexOffsetEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC, glVertexArrayMultiTexCoordOffsetEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYNORMALOFFSETEXTPROC, glVertexArrayNormalOffsetEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC, glVertexArraySecondaryColorOffsetEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC, glVertexArrayTexCoordOffsetEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC, glVertexArrayVertexAttribBindingEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC, glVertexArrayVertexAttribDivisorEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC, glVertexArrayVertexAttribFormatEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC, glVertexArrayVertexAttribIFormatEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC, glVertexArrayVertexAttribIOffsetEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC, glVertexArrayVertexAttribLFormatEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC, glVertexArrayVertexAttribLOffsetEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC, glVertexArrayVertexAttribOffsetEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC, glVertexArrayVertexBindingDivisorEXT);
+  GG_GET_PROC(PFNGLVERTEXARRAYVERTEXBUFFERPROC, glVertexArrayVertexBuffer);
+  GG_GET_PROC(PFNGLVERTEXARRAYVERTEXBUFFERSPROC, glVertexArrayVertexBuffers);
+  GG_GET_PROC(PFNGLVERTEXARRAYVERTEXOFFSETEXTPROC, glVertexArrayVertexOffsetEXT);
+  GG_GET_PROC(PFNGLVERTEXATTRIB1DPROC, glVertexAttrib1d);
+  GG_GET_PROC(PFNGLVERTEXATTRIB1DVPROC, glVertexAttrib1dv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB1FPROC, glVertexAttrib1f);
+  GG_GET_PROC(PFNGLVERTEXATTRIB1FVPROC, glVertexAttrib1fv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB1SPROC, glVertexAttrib1s);
+  GG_GET_PROC(PFNGLVERTEXATTRIB1SVPROC, glVertexAttrib1sv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB2DPROC, glVertexAttrib2d);
+  GG_GET_PROC(PFNGLVERTEXATTRIB2DVPROC, glVertexAttrib2dv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB2FPROC, glVertexAttrib2f);
+  GG_GET_PROC(PFNGLVERTEXATTRIB2FVPROC, glVertexAttrib2fv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB2SPROC, glVertexAttrib2s);
+  GG_GET_PROC(PFNGLVERTEXATTRIB2SVPROC, glVertexAttrib2sv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB3DPROC, glVertexAttrib3d);
+  GG_GET_PROC(PFNGLVERTEXATTRIB3DVPROC, glVertexAttrib3dv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB3FPROC, glVertexAttrib3f);
+  GG_GET_PROC(PFNGLVERTEXATTRIB3FVPROC, glVertexAttrib3fv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB3SPROC, glVertexAttrib3s);
+  GG_GET_PROC(PFNGLVERTEXATTRIB3SVPROC, glVertexAttrib3sv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4NBVPROC, glVertexAttrib4Nbv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4NIVPROC, glVertexAttrib4Niv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4NSVPROC, glVertexAttrib4Nsv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4NUBPROC, glVertexAttrib4Nub);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4NUBVPROC, glVertexAttrib4Nubv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4NUIVPROC, glVertexAttrib4Nuiv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4NUSVPROC, glVertexAttrib4Nusv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4BVPROC, glVertexAttrib4bv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4DPROC, glVertexAttrib4d);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4DVPROC, glVertexAttrib4dv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4FPROC, glVertexAttrib4f);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4FVPROC, glVertexAttrib4fv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4IVPROC, glVertexAttrib4iv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4SPROC, glVertexAttrib4s);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4SVPROC, glVertexAttrib4sv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4UBVPROC, glVertexAttrib4ubv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4UIVPROC, glVertexAttrib4uiv);
+  GG_GET_PROC(PFNGLVERTEXATTRIB4USVPROC, glVertexAttrib4usv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBBINDINGPROC, glVertexAttribBinding);
+  GG_GET_PROC(PFNGLVERTEXATTRIBDIVISORPROC, glVertexAttribDivisor);
+  GG_GET_PROC(PFNGLVERTEXATTRIBDIVISORARBPROC, glVertexAttribDivisorARB);
+  GG_GET_PROC(PFNGLVERTEXATTRIBFORMATPROC, glVertexAttribFormat);
+  GG_GET_PROC(PFNGLVERTEXATTRIBFORMATNVPROC, glVertexAttribFormatNV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI1IPROC, glVertexAttribI1i);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI1IVPROC, glVertexAttribI1iv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI1UIPROC, glVertexAttribI1ui);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI1UIVPROC, glVertexAttribI1uiv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI2IPROC, glVertexAttribI2i);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI2IVPROC, glVertexAttribI2iv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI2UIPROC, glVertexAttribI2ui);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI2UIVPROC, glVertexAttribI2uiv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI3IPROC, glVertexAttribI3i);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI3IVPROC, glVertexAttribI3iv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI3UIPROC, glVertexAttribI3ui);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI3UIVPROC, glVertexAttribI3uiv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI4BVPROC, glVertexAttribI4bv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI4IPROC, glVertexAttribI4i);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI4IVPROC, glVertexAttribI4iv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI4SVPROC, glVertexAttribI4sv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI4UBVPROC, glVertexAttribI4ubv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI4UIPROC, glVertexAttribI4ui);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI4UIVPROC, glVertexAttribI4uiv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBI4USVPROC, glVertexAttribI4usv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBIFORMATPROC, glVertexAttribIFormat);
+  GG_GET_PROC(PFNGLVERTEXATTRIBIFORMATNVPROC, glVertexAttribIFormatNV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBIPOINTERPROC, glVertexAttribIPointer);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL1DPROC, glVertexAttribL1d);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL1DVPROC, glVertexAttribL1dv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL1I64NVPROC, glVertexAttribL1i64NV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL1I64VNVPROC, glVertexAttribL1i64vNV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL1UI64ARBPROC, glVertexAttribL1ui64ARB);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL1UI64NVPROC, glVertexAttribL1ui64NV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL1UI64VARBPROC, glVertexAttribL1ui64vARB);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL1UI64VNVPROC, glVertexAttribL1ui64vNV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL2DPROC, glVertexAttribL2d);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL2DVPROC, glVertexAttribL2dv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL2I64NVPROC, glVertexAttribL2i64NV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL2I64VNVPROC, glVertexAttribL2i64vNV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL2UI64NVPROC, glVertexAttribL2ui64NV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL2UI64VNVPROC, glVertexAttribL2ui64vNV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL3DPROC, glVertexAttribL3d);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL3DVPROC, glVertexAttribL3dv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL3I64NVPROC, glVertexAttribL3i64NV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL3I64VNVPROC, glVertexAttribL3i64vNV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL3UI64NVPROC, glVertexAttribL3ui64NV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL3UI64VNVPROC, glVertexAttribL3ui64vNV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL4DPROC, glVertexAttribL4d);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL4DVPROC, glVertexAttribL4dv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL4I64NVPROC, glVertexAttribL4i64NV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL4I64VNVPROC, glVertexAttribL4i64vNV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL4UI64NVPROC, glVertexAttribL4ui64NV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBL4UI64VNVPROC, glVertexAttribL4ui64vNV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBLFORMATPROC, glVertexAttribLFormat);
+  GG_GET_PROC(PFNGLVERTEXATTRIBLFORMATNVPROC, glVertexAttribLFormatNV);
+  GG_GET_PROC(PFNGLVERTEXATTRIBLPOINTERPROC, glVertexAttribLPointer);
+  GG_GET_PROC(PFNGLVERTEXATTRIBP1UIPROC, glVertexAttribP1ui);
+  GG_GET_PROC(PFNGLVERTEXATTRIBP1UIVPROC, glVertexAttribP1uiv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBP2UIPROC, glVertexAttribP2ui);
+  GG_GET_PROC(PFNGLVERTEXATTRIBP2UIVPROC, glVertexAttribP2uiv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBP3UIPROC, glVertexAttribP3ui);
+  GG_GET_PROC(PFNGLVERTEXATTRIBP3UIVPROC, glVertexAttribP3uiv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBP4UIPROC, glVertexAttribP4ui);
+  GG_GET_PROC(PFNGLVERTEXATTRIBP4UIVPROC, glVertexAttribP4uiv);
+  GG_GET_PROC(PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer);
+  GG_GET_PROC(PFNGLVERTEXBINDINGDIVISORPROC, glVertexBindingDivisor);
+  GG_GET_PROC(PFNGLVERTEXFORMATNVPROC, glVertexFormatNV);
+  GG_GET_PROC(PFNGLVIEWPORTPROC, glViewport);
+  GG_GET_PROC(PFNGLVIEWPORTARRAYVPROC, glViewportArrayv);
+  GG_GET_PROC(PFNGLVIEWPORTINDEXEDFPROC, glViewportIndexedf);
+  GG_GET_PROC(PFNGLVIEWPORTINDEXEDFVPROC, glViewportIndexedfv);
+  GG_GET_PROC(PFNGLVIEWPORTPOSITIONWSCALENVPROC, glViewportPositionWScaleNV);
+  GG_GET_PROC(PFNGLVIEWPORTSWIZZLENVPROC, glViewportSwizzleNV);
+  GG_GET_PROC(PFNGLWAITSYNCPROC, glWaitSync);
+  GG_GET_PROC(PFNGLWAITVKSEMAPHORENVPROC, glWaitVkSemaphoreNV);
+  GG_GET_PROC(PFNGLWEIGHTPATHSNVPROC, glWeightPathsNV);
+  GG_GET_PROC(PFNGLWINDOWRECTANGLESEXTPROC, glWindowRectanglesEXT);
+  initProcTime = elapsed(start);
 #endif
+#undef GG_GET_PROC
 
   // 使用している GPU のバッファアライメントを調べる
   glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &ggBufferAlignment);
+
+#if !defined(__APPLE__)
+  // 永続的にマップするバッファオブジェクトが使えるか調べる
+  GLint major(0), minor(0);
+  glGetIntegerv(GL_MAJOR_VERSION, &major);
+  glGetIntegerv(GL_MINOR_VERSION, &minor);
+  ggBufferStorage = ggHasProc("glBufferStorage") && (major > 4 || (major == 4 && minor >= 4));
+#endif
+}
+
+/*
+** OpenGL の API が使えるかどうか調べる
+*/
+bool gg::ggHasProc(const char *name)
+{
+  return glfwGetProcAddress(name) != nullptr;
+}
+
+/*
+** 最初の呼び出しを待っている API のアドレスをすべて取得する
+*/
+void gg::ggResolveProcs()
+{
+#if !defined(GL3_PROTOTYPES) && GG_LAZY_PROC
+  for (const auto resolve : lazyProcResolvers) resolve();
+  std::vector<void (*)()>().swap(lazyProcResolvers);
+#endif
+}
+
+/*
+** API のアドレスの取得に要した時間の報告を得る
+*/
+std::string gg::ggInitReport()
+{
+  std::ostringstream report;
+  report << "ggInit: " << initProcCount << (GG_LAZY_PROC ? " deferred" : " resolved")
+    << " entry points in " << initProcTime * 1.0e-6 << " ms, "
+    << lazyProcCount.load() << " resolved later in " << lazyProcTime.load() * 1.0e-6 << " ms";
+  return report.str();
 }
 
 /*
@@ -2637,3056 +2818,7685 @@ void gg::_ggFBOError(const char *name, unsigned int line)
   }
 }
 
+// \cond
 /*
-** 配列に格納された画像の内容を TGA ファイルに保存する
-**
-**   name ファイル名
-**   buffer 画像データ
-**   width 画像の横の画素数
-**   height 画像の縦の画素数
-**   depth 画像の 1 画素のバイト数
-**   戻り値 保存に成功すれば true, 失敗すれば false
+** デバッグ出力に使うデータと関数
 */
-bool gg::ggSaveTga(const char *name, const void *buffer,
-  unsigned int width, unsigned int height, unsigned int depth)
+namespace gg
 {
-  // ファイルを開く
-  std::ofstream file(name, std::ios::binary);
+  // 同じメッセージを 1 秒間に表示する最大の回数
+  static unsigned int debugLimit(10);
 
-  // ファイルが開けなかったら戻る
-  if (!file) return false;
-
-  // 画像のヘッダ
-  const unsigned char type(depth == 0 ? 0 : depth < 3 ? 3 : 2);
-  const unsigned char alpha(depth == 2 || depth == 4 ? 8 : 0);
-  const unsigned char header[18] =
+  // メッセージごとの表示の回数
+  struct DebugCount
   {
-    0,          // ID length
-    0,          // Color map type (none)
-    type,       // Image Type (2:RGB, 3:Grayscale)
-    0, 0,       // Offset into the color map table
-    0, 0,       // Number of color map entries
-    0,          // Number of a color map entry bits per pixel
-    0, 0,       // Horizontal image position
-    0, 0,       // Vertical image position
-    static_cast<unsigned char>(width & 0xff),
-    static_cast<unsigned char>(width >> 8),
-    static_cast<unsigned char>(height & 0xff),
-    static_cast<unsigned char>(height >> 8),
-    static_cast<unsigned char>(depth * 8),
-    alpha       // Image descriptor
+    std::chrono::steady_clock::time_point start;  // 回数を数え始めた時刻
+    unsigned int count;                           // 表示した回数
+    unsigned int suppressed;                      // 表示しなかった回数
   };
 
-  // ヘッダを書き込む
-  file.write(reinterpret_cast<const char *>(header), sizeof header);
+  // 発生元・種類・番号をキーにしたメッセージごとの表示の回数
+  static std::map<std::array<GLuint, 3>, DebugCount> debugCount;
 
-  // ヘッダの書き込みに失敗したら戻る
-  if (file.bad())
+  // 非同期の通知はドライバのスレッドから呼び出されることがあるので排他制御する
+  static std::mutex debugMutex;
+
+  // メッセージの発生元の名前
+  static const char *debugSource(GLenum source)
   {
-    file.close();
-    return false;
+    switch (source)
+    {
+    case GL_DEBUG_SOURCE_API:
+      return "API";
+    case GL_DEBUG_SOURCE_WINDOW_SYSTEM:
+      return "Window system";
+    case GL_DEBUG_SOURCE_SHADER_COMPILER:
+      return "Shader compiler";
+    case GL_DEBUG_SOURCE_THIRD_PARTY:
+      return "Third party";
+    case GL_DEBUG_SOURCE_APPLICATION:
+      return "Application";
+    default:
+      return "Other";
+    }
   }
 
-  // データを書き込む
-  unsigned int size(width * height * depth);
-  if (type == 2)
+  // メッセージの種類の名前
+  static const char *debugType(GLenum type)
   {
-    // フルカラー
-    std::vector<char> temp(size);
-    for (GLuint i = 0; i < size; i += depth)
+    switch (type)
     {
-      temp[i + 2] = static_cast<const char *>(buffer)[i + 0];
-      temp[i + 1] = static_cast<const char *>(buffer)[i + 1];
-      temp[i + 0] = static_cast<const char *>(buffer)[i + 2];
-      if (depth == 4) temp[i + 3] = static_cast<const char *>(buffer)[i + 3];
+    case GL_DEBUG_TYPE_ERROR:
+      return "error";
+    case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR:
+      return "deprecated behavior";
+    case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:
+      return "undefined behavior";
+    case GL_DEBUG_TYPE_PORTABILITY:
+      return "portability";
+    case GL_DEBUG_TYPE_PERFORMANCE:
+      return "performance";
+    default:
+      return "message";
     }
-    file.write(&temp[0], size);
   }
-  else if (type == 3)
+
+  // メッセージの重要度の名前
+  static const char *debugSeverity(GLenum severity)
   {
-    // グレースケール
-    file.write(static_cast<const char *>(buffer), size);
+    switch (severity)
+    {
+    case GL_DEBUG_SEVERITY_HIGH:
+      return "high";
+    case GL_DEBUG_SEVERITY_MEDIUM:
+      return "medium";
+    case GL_DEBUG_SEVERITY_LOW:
+      return "low";
+    default:
+      return "notification";
+    }
   }
 
-  // フッタを書き込む
-  constexpr char footer[] = "\0\0\0\0\0\0\0\0TRUEVISION-XFILE.";
-  file.write(footer, sizeof footer);
-
-  // データの書き込みに失敗したら戻る
-  if (file.bad())
+  // デバッグ出力のコールバック
+  static void APIENTRY debugCallback(GLenum source, GLenum type, GLuint id, GLenum severity,
+    GLsizei length, const GLchar *message, const void *userParam)
   {
-    file.close();
-    return false;
-  }
+    std::lock_guard<std::mutex> lock(debugMutex);
 
-  // ファイルを閉じる
-  file.close();
-  return true;
+    // このメッセージの表示の回数
+    DebugCount &c(debugCount.insert(std::make_pair(std::array<GLuint, 3>{ { source, type, id } },
+      DebugCount{ std::chrono::steady_clock::time_point(), 0, 0 })).first->second);
+
+    // 1 秒経っていたら数え直す
+    const auto now(std::chrono::steady_clock::now());
+    if (now - c.start >= std::chrono::seconds(1))
+    {
+      if (c.suppressed > 0)
+        std::cerr << "OpenGL " << debugSource(source) << " " << debugType(type)
+          << " (" << id << "): " << c.suppressed << " similar messages suppressed" << std::endl;
+      c.start = now;
+      c.count = c.suppressed = 0;
+    }
+
+    // 1 秒間に debugLimit 回を超えたら表示しない
+    if (++c.count > debugLimit)
+    {
+      ++c.suppressed;
+      return;
+    }
+
+    std::cerr << "OpenGL " << debugSource(source) << " " << debugType(type)
+      << " [" << debugSeverity(severity) << "] (" << id << "): ";
+    if (length < 0) std::cerr << message; else std::cerr.write(message, length);
+    std::cerr << std::endl;
+  }
 }
+// \endcond
+
+//! OpenGL のデバッグ出力を使っているか
+bool gg::ggDebugOutput(false);
 
 /*
-** カラーバッファの内容を TGA ファイルに保存する
+** OpenGL のデバッグ出力のコールバックを現在のコンテキストに登録する
 **
-**   name 保存するファイル名
-**   戻り値 保存に成功すれば true, 失敗すれば false
+**   synchronous true ならエラーの発生した API の呼び出しの中でメッセージを通知する
+**   verbose true なら重要度が GL_DEBUG_SEVERITY_LOW のメッセージも受け取る
+**   limit 同じメッセージを 1 秒間に表示する最大の回数
+**   戻り値 デバッグ出力が使えなければ false
 */
-bool gg::ggSaveColor(const char *name)
+bool gg::ggEnableDebugOutput(bool synchronous, bool verbose, unsigned int limit)
 {
-  // 現在のビューポートのサイズを得る
-  GLint viewport[4];
-  glGetIntegerv(GL_VIEWPORT, viewport);
+#if defined(__APPLE__)
+  // macOS の OpenGL 4.1 では使えない
+  return false;
+#else
+  // OpenGL 4.3 以降か KHR_debug 拡張機能があれば使える
+  if (!ggHasProc("glDebugMessageCallback") || !ggHasProc("glDebugMessageControl")) return false;
+  GLint major(0), minor(0);
+  glGetIntegerv(GL_MAJOR_VERSION, &major);
+  glGetIntegerv(GL_MINOR_VERSION, &minor);
+  if (major < 4 || (major == 4 && minor < 3))
+  {
+    GLint count(0);
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    GLint i(0);
+    while (i < count && strcmp(reinterpret_cast<const char *>(glGetStringi(GL_EXTENSIONS, i)), "GL_KHR_debug") != 0) ++i;
+    if (i >= count) return false;
+  }
 
-  // ビューポートのサイズ分のメモリを確保する
-  std::vector<GLubyte> buffer(viewport[2] * viewport[3] * 3);
+  // 同じメッセージを表示する回数の上限
+  debugLimit = limit;
 
-  // 画面表示の完了を待つ
-  glFinish();
+  // 重要度の低いメッセージは受け取らない
+  glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_FALSE);
+  glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_HIGH, 0, nullptr, GL_TRUE);
+  glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_MEDIUM, 0, nullptr, GL_TRUE);
+  if (verbose) glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_LOW, 0, nullptr, GL_TRUE);
 
-  // カラーバッファを読み込む
-  glReadPixels(viewport[0], viewport[1], viewport[2], viewport[3],
-    GL_BGR, GL_UNSIGNED_BYTE, buffer.data());
+  // コールバックを登録してデバッグ出力を有効にする
+  glDebugMessageCallback(debugCallback, nullptr);
+  ggEnable(GL_DEBUG_OUTPUT);
+  if (synchronous) ggEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS); else ggDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
 
-  // 読み込んだデータをファイルに書き込む
-  return ggSaveTga(name, buffer.data(), viewport[2], viewport[3], 3);
+  return ggDebugOutput = true;
+#endif
 }
 
+// \cond
 /*
-** デプスバッファの内容を TGA ファイルに保存する
-**
-**   name 保存するファイル名
-**   戻り値 保存に成功すれば true, 失敗すれば false
+** 状態設定の重複を省くために記録するデータと関数
 */
-bool gg::ggSaveDepth(const char *name)
+namespace gg
 {
-  // 現在のビューポートのサイズを得る
-  GLint viewport[4];
-  glGetIntegerv(GL_VIEWPORT, viewport);
+  // 記録していない状態のオブジェクト名
+  const GLuint unknownName(~0u);
 
-  // ビューポートのサイズ分のメモリを確保する
-  std::vector<GLubyte> buffer(viewport[2] * viewport[3]);
+  // 結合を記録するテクスチャユニットの数
+  const int stateTextureUnits(32);
 
-  // 画面表示の完了を待つ
-  glFinish();
+  // 結合を記録するテクスチャのターゲット
+  const GLenum stateTextureTargets[] =
+  {
+    GL_TEXTURE_1D,
+    GL_TEXTURE_2D,
+    GL_TEXTURE_3D,
+    GL_TEXTURE_1D_ARRAY,
+    GL_TEXTURE_2D_ARRAY,
+    GL_TEXTURE_RECTANGLE,
+    GL_TEXTURE_CUBE_MAP,
+    GL_TEXTURE_BUFFER,
+    GL_TEXTURE_2D_MULTISAMPLE
+  };
+  const int stateTextureTargetCount(sizeof stateTextureTargets / sizeof stateTextureTargets[0]);
 
-  // デプスバッファを読み込む
-  glReadPixels(viewport[0], viewport[1], viewport[2], viewport[3],
-    GL_DEPTH_COMPONENT, GL_UNSIGNED_BYTE, buffer.data());
+  // 結合を記録するユニフォームバッファオブジェクトの結合ポイントの数
+  const GLuint stateUniformBindings(36);
 
-  // 読み込んだデータをファイルに書き込む
-  return ggSaveTga(name, buffer.data(), viewport[2], viewport[3], 1);
-}
+  // 結合ポイントに結合したバッファオブジェクトの範囲
+  struct BufferRange
+  {
+    GLuint buffer;
+    GLintptr offset;
+    GLsizeiptr size;
+  };
 
-/*
-** TGA ファイル (8/16/24/32bit) を読み込む
-**
-**   name 読み込むファイル名
-**   pWidth 読み込んだファイルの横の画素数の格納先のポインタ (nullptr なら格納しない)
-**   pHeight 読み込んだファイルの縦の画素数の格納先のポインタ (nullptr なら格納しない)
-**   pFormat 読み込んだファイルのフォーマットの格納先のポインタ (nullptr なら格納しない)
-**   image 読み込んだ画像を格納する vector
-**   戻り値 読み込みに成功すれば true, 失敗すれば false
-*/
-bool gg::ggReadImage(const char *name, std::vector<GLubyte> &image, GLsizei *pWidth, GLsizei *pHeight, GLenum *pFormat)
-{
-  // ファイルを開く
-  std::ifstream file(name, std::ios::binary);
+  // スレッドのコンテキストの状態の記録
+  struct StateCache
+  {
+    // 使用中のプログラム名
+    GLuint program;
 
-  // ファイルが開けなかったら戻る
-  if (!file) return false;
+    // 結合している頂点配列オブジェクト名
+    GLuint vao;
 
-  // ヘッダを読み込む
-  unsigned char header[18];
-  file.read(reinterpret_cast<char *>(header), sizeof header);
+    // 選択しているテクスチャユニット (0 なら記録していない)
+    GLenum activeTexture;
 
-  // ヘッダの読み込みに失敗したら戻る
-  if (file.bad())
-  {
-    file.close();
-    return false;
-  }
+    // テクスチャユニットとターゲットごとに結合しているテクスチャ名
+    GLuint texture[stateTextureUnits][stateTextureTargetCount];
 
-  // 深度
-  const int depth(header[16] / 8);
-  switch (depth)
-  {
-  case 1:
-    *pFormat = GL_RED;
-    break;
-  case 2:
-    *pFormat = GL_RG;
-    break;
-  case 3:
-    *pFormat = GL_BGR;
-    break;
-  case 4:
-    *pFormat = GL_BGRA;
-    break;
-  default:
-    // 取り扱えないフォーマットだったら戻る
-    file.close();
-    return false;
-  }
+    // ユニフォームバッファオブジェクトの結合ポイントごとに結合している範囲
+    BufferRange uniform[stateUniformBindings];
 
-  // 画像の縦横の画素数
-  *pWidth = header[13] << 8 | header[12];
-  *pHeight = header[15] << 8 | header[14];
+    // 機能ごとの有効・無効
+    std::vector<std::pair<GLenum, bool>> capability;
 
-  // データサイズ
-  const int size(*pWidth * *pHeight * depth);
-  if (size < 2) return false;
+    // 状態設定の呼び出しと省略の回数
+    GgStateCount count;
 
-  // 読み込みに使うメモリを確保する
-  image.resize(size);
+    // コンストラクタ
+    StateCache()
+      : count{ 0, 0 }
+    {
+      reset();
+    }
 
-  // データを読み込む
-  if (header[2] & 8)
-  {
-    // RLE
-    int p(0);
-    char c;
-    while (file.get(c))
+    // 記録している状態を破棄する
+    void reset()
     {
-      if (c & 0x80)
-      {
-        // run-length packet
-        const int count((c & 0x7f) + 1);
-        if (p + depth * count > size) break;
-        char temp[4];
-        file.read(temp, depth);
-        for (int i = 0; i < count; ++i)
-        {
-          for (int j = 0; j < depth;) image[p++] = temp[j++];
-        }
-      }
-      else
-      {
-        // raw packet
-        const int count((c + 1) * depth);
-        if (p + count > size) break;
-        file.read(reinterpret_cast<char *>(&image[p]), count);
-        p += count;
-      }
+      program = vao = unknownName;
+      activeTexture = 0;
+      for (auto &unit : texture) for (auto &t : unit) t = unknownName;
+      for (auto &u : uniform) u.buffer = unknownName;
+      capability.clear();
     }
-  }
-  else
+
+    // OpenGL の API を呼び出したことを記録する
+    void issue()
+    {
+#if GG_COUNT_STATE
+      ++count.issued;
+#endif
+    }
+
+    // 呼び出しを省いたことを記録して true を返す
+    bool elide()
+    {
+#if GG_COUNT_STATE
+      ++count.elided;
+#endif
+      return true;
+    }
+  };
+
+  // スレッドごとのコンテキストの状態の記録
+  static StateCache &stateCache()
   {
-    // 非圧縮
-    file.read(reinterpret_cast<char *>(image.data()), size);
+    thread_local StateCache cache;
+    return cache;
   }
 
-  // 読み込みに失敗したら戻る
-  if (file.bad())
+  // テクスチャのターゲットの記録の番号を求める (記録しないターゲットなら -1)
+  static int stateTextureTarget(GLenum target)
   {
-    file.close();
-    return false;
+    for (int i = 0; i < stateTextureTargetCount; ++i) if (stateTextureTargets[i] == target) return i;
+    return -1;
   }
 
-  // ファイルを閉じる
-  file.close();
-  return true;
+  // 機能の有効・無効を設定する
+  static void setCapability(GLenum cap, bool enable)
+  {
+    StateCache &cache(stateCache());
+
+    // 記録している機能なら同じ設定を省く
+    auto c(cache.capability.begin());
+    while (c != cache.capability.end() && c->first != cap) ++c;
+    if (c != cache.capability.end())
+    {
+      if (c->second == enable && cache.elide()) return;
+      c->second = enable;
+    }
+    else
+      cache.capability.emplace_back(cap, enable);
+
+    if (enable) glEnable(cap); else glDisable(cap);
+    cache.issue();
+  }
 }
+// \endcond
 
 /*
-** テクスチャメモリを確保して画像を読み込む
+** プログラムオブジェクトの使用を開始する
 **
-**   image 画像データ, nullptr ならメモリの確保だけを行う
-**   width 画像の横の画素数
-**   height 画像の縦の画素数
-**   format 画像データのフォーマット
-**   type 画像のデータ型
-**   internal テクスチャの内部フォーマット
-**   wrap テクスチャのラッピングモード, デフォルトは GL_CLAMP_TO_EDGE
-**   戻り値 テクスチャ名
+**   program プログラム名 (0 なら使用を終了する)
 */
-GLuint gg::ggLoadTexture(const GLvoid *image, GLsizei width, GLsizei height,
-  GLenum format, GLenum type, GLenum internal, GLenum wrap)
+void gg::ggUseProgram(GLuint program)
 {
-  // テクスチャオブジェクト
-  const GLuint tex([] { GLuint tex; glGenTextures(1, &tex); return tex; } ());
-  glBindTexture(GL_TEXTURE_2D, tex);
-
-  // アルファチャンネルがついていれば 4 バイト境界に設定する
-  glPixelStorei(GL_UNPACK_ALIGNMENT, (format == GL_BGRA || format == GL_RGBA) ? 4 : 1);
-
-  // テクスチャを割り当てる
-  glTexImage2D(GL_TEXTURE_2D, 0, internal, width, height, 0, format, type, image);
-
-  // バイリニア（ミップマップなし），エッジでクランプ
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrap);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrap);
+  StateCache &cache(stateCache());
+  if (cache.program == program && cache.elide()) return;
 
-  // テクスチャ名を返す
-  return tex;
+  glUseProgram(program);
+  cache.program = program;
+  cache.issue();
 }
 
 /*
-** TGA ファイルをテクスチャメモリに読み込む
+** 頂点配列オブジェクトを結合する
 **
-**   name TGA ファイル名
-**   pWidth 読みだした画像ファイルの横の画素数の格納先のポインタ (nullptr なら格納しない)
-++   pHeight 読みだした画像ファイルの縦の画素数の格納先のポインタ (nullptr なら格納しない)
-**   internal テクスチャの内部フォーマット， 0 なら外部フォーマットに合わせる.
-**   wrap テクスチャのラッピングモード, デフォルトは GL_CLAMP_TO_EDGE
-**   戻り値 テクスチャ名
+**   vao 頂点配列オブジェクト名 (0 なら解放する)
 */
-GLuint gg::ggLoadImage(const char *name, GLsizei *pWidth, GLsizei *pHeight, GLenum internal, GLenum wrap)
+void gg::ggBindVertexArray(GLuint vao)
 {
-  // 画像データ
-  std::vector<GLubyte> image;
-
-  // 画像サイズ
-  GLsizei width, height;
-
-  // 画像フォーマット
-  GLenum format;
-
-  // 画像を読み込む
-  ggReadImage(name, image, &width, &height, &format);
-
-  // 画像が読み込めなかったら戻る
-  if (image.empty()) return 0;
-
-  // internal == 0 なら内部フォーマットを読み込んだファイルに合わせる
-  if (internal == 0)
-  {
-    switch (format)
-    {
-    case GL_BGR:
-      internal = GL_RGB;
-      break;
-    case GL_BGRA:
-      internal = GL_RGBA;
-      break;
-    default:
-      internal = format;
-      break;
-    }
-  }
-
-  // テクスチャメモリに読み込む
-  const GLuint tex(ggLoadTexture(image.data(), width, height, format, GL_UNSIGNED_BYTE, internal, wrap));
-
-  // 画像サイズを返す
-  if (pWidth) *pWidth = width;
-  if (pHeight) *pHeight = height;
+  StateCache &cache(stateCache());
+  if (cache.vao == vao && cache.elide()) return;
 
-  // テクスチャ名を返す
-  return tex;
+  glBindVertexArray(vao);
+  cache.vao = vao;
+  cache.issue();
 }
 
 /*
-** グレースケール画像 (8bit) から法線マップのデータを作成する
+** テクスチャユニットを選択する
 **
-**   width 高さマップのグレースケール画像 hmap の横の画素数
-**   height 高さマップのグレースケール画像のデータ hmap の縦の画素数
-**   stride データの間隔
-**   hmap グレースケール画像のデータ
-**   nz 法線の z 成分の割合
-**   internal テクスチャの内部フォーマット
-**   nmap 法線マップを格納する vector
+**   unit テクスチャユニット (GL_TEXTURE0 〜)
 */
-void gg::ggCreateNormalMap(const GLubyte *hmap, GLsizei width, GLsizei height, GLenum format, GLfloat nz,
-  GLenum internal, std::vector<GgVector> &nmap)
+void gg::ggActiveTexture(GLenum unit)
 {
-  // メモリサイズ
-  const GLsizei size(width * height);
-
-  // 法線マップのメモリを確保する
-  nmap.resize(size);
-
-  // 画素のバイト数
-  GLint stride;
-  switch (format)
-  {
-  case GL_RED:
-    stride = 1;
-    break;
-  case GL_RG:
-    stride = 2;
-    break;
-  case GL_BGR:
-    stride = 3;
-    break;
-  case GL_BGRA:
-    stride = 4;
-    break;
-  default:
-    stride = 1;
-    break;
-  }
-
-  // 法線マップの作成
-  for (GLsizei i = 0; i < size; ++i)
-  {
-    const int x(i % width);
-    const int y(i - x);
-    const int u0((y + (x - 1 + width) % width) * stride);
-    const int u1((y + (x + 1) % width) * stride);
-    const int v0(((y - width + size) % size + x) * stride);
-    const int v1(((y + width) % size + x) * stride);
-
-    // 隣接する画素との値の差を法線の成分に用いる
-    nmap[i][0] = static_cast<GLfloat>(hmap[u1] - hmap[u0]);
-    nmap[i][1] = static_cast<GLfloat>(hmap[v1] - hmap[v0]);
-    nmap[i][2] = nz;
-    nmap[i][3] = hmap[i * stride];
-
-    // 法線ベクトルを正規化する
-    ggNormalize3(nmap[i].data());
-  }
+  StateCache &cache(stateCache());
+  if (cache.activeTexture == unit && cache.elide()) return;
 
-  // 内部フォーマットが浮動小数点テクスチャでなければ [0,1] に正規化する
-  if (
-    internal != GL_RGB16F &&
-    internal != GL_RGBA16F &&
-    internal != GL_RGB32F &&
-    internal != GL_RGBA32F
-    )
-  {
-    for (GLsizei i = 0; i < size; ++i)
-    {
-      nmap[i][0] = nmap[i][0] * 0.5f + 0.5f;
-      nmap[i][1] = nmap[i][1] * 0.5f + 0.5f;
-      nmap[i][2] = nmap[i][2] * 0.5f + 0.5f;
-      nmap[i][3] *= 0.0039215686f; // == 1/255
-    }
-  }
+  glActiveTexture(unit);
+  cache.activeTexture = unit;
+  cache.issue();
 }
 
 /*
-** TGA 画像ファイルの高さマップ読み込んでテクスチャメモリに法線マップを作成する
+** 選択しているテクスチャユニットにテクスチャを結合する
 **
-**   name TGA ファイル名
-**   nz 作成した法線の z 成分の割合
-**   pWidth 読み込んだ画像の横の画素数の格納先のポインタ (nullptr なら格納しない)
-**   pHeight 読み込んだ画像の縦の画素数の格納先のポインタ (nullptr なら格納しない)
-**   internal テクスチャの内部フォーマット
-**   戻り値 テクスチャ名
+**   target テクスチャのターゲット
+**   texture テクスチャ名 (0 なら解放する)
 */
-GLuint gg::ggLoadHeight(const char *name, float nz, GLsizei *pWidth, GLsizei *pHeight, GLenum internal)
+void gg::ggBindTexture(GLenum target, GLuint texture)
 {
-  // 画像データ
-  std::vector<GLubyte> hmap;
-
-  // 画像サイズ
-  GLsizei width, height;
-
-  // 画像フォーマット
-  GLenum format;
-
-  // 高さマップの画像を読み込む
-  ggReadImage(name, hmap, &width, &height, &format);
-
-  // 画像が読み込めなかったら戻る
-  if (hmap.empty()) return 0;
-
-  // 法線マップ
-  std::vector<GgVector> nmap;
-
-  // 法線マップを作成する
-  ggCreateNormalMap(hmap.data(), width, height, format, nz, internal, nmap);
-
-  // 画像サイズを返す
-  if (pWidth) *pWidth = width;
-  if (pHeight) *pHeight = height;
-
-  // テクスチャを作成して返す
-  return ggLoadTexture(nmap.data(), width, height, GL_RGBA, GL_FLOAT, internal, GL_REPEAT);
+  StateCache &cache(stateCache());
+
+  // 選択しているテクスチャユニットが分かっていて記録するターゲットなら同じ結合を省く
+  const GLint unit(static_cast<GLint>(cache.activeTexture) - GL_TEXTURE0);
+  const int t(stateTextureTarget(target));
+  GLuint *const bound(cache.activeTexture != 0 && unit < stateTextureUnits && t >= 0
+    ? &cache.texture[unit][t] : nullptr);
+  if (bound && *bound == texture && cache.elide()) return;
+
+  glBindTexture(target, texture);
+  if (bound) *bound = texture;
+  cache.issue();
 }
 
 /*
-** テクスチャを作成してファイルからデータを読み込む
+** バッファオブジェクトの範囲をインデックス付きのターゲットの結合ポイントに結合する
 **
-**   name 読み込むファイル名
-**   internal glTexImage2D() に指定するテクスチャの内部フォーマット. 0 なら外部フォーマットに合わせる
-**   戻り値 テクスチャの作成に成功すれば true, 失敗すれば false
+**   target バッファオブジェクトのターゲット
+**   index 結合ポイント
+**   buffer バッファオブジェクト名
+**   offset 結合する範囲のバッファオブジェクトの先頭からのバイトオフセット
+**   size 結合する範囲のバイト数
 */
-void gg::GgColorTexture::load(const char *name, GLenum internal, GLenum wrap)
+void gg::ggBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
 {
-  // 画像データ
-  std::vector<GLubyte> image;
-
-  // 画像サイズ
-  GLsizei width, height;
+  StateCache &cache(stateCache());
 
-  // 画像フォーマット
-  GLenum format;
+  // ユニフォームバッファオブジェクトなら同じ範囲の結合を省く
+  BufferRange *const bound(target == GL_UNIFORM_BUFFER && index < stateUniformBindings
+    ? &cache.uniform[index] : nullptr);
+  if (bound && bound->buffer == buffer && bound->offset == offset && bound->size == size && cache.elide()) return;
 
-  // 画像を読み込む
-  ggReadImage(name, image, &width, &height, &format);
+  glBindBufferRange(target, index, buffer, offset, size);
+  if (bound) *bound = { buffer, offset, size };
+  cache.issue();
+}
 
-  // internal == 0 なら内部フォーマットを読み込んだファイルに合わせる
-  if (internal == 0)
-  {
-    switch (format)
-    {
-    case GL_BGR:
-      internal = GL_RGB;
-      break;
-    case GL_BGRA:
-      internal = GL_RGBA;
-      break;
-    default:
-      internal = format;
-      break;
-    }
-  }
+/*
+** 機能を有効にする
+**
+**   cap 有効にする機能
+*/
+void gg::ggEnable(GLenum cap)
+{
+  setCapability(cap, true);
+}
 
-  // テクスチャを作成する
-  texture.reset(new GgTexture(image.data(), width, height, format, GL_UNSIGNED_BYTE, internal, wrap));
+/*
+** 機能を無効にする
+**
+**   cap 無効にする機能
+*/
+void gg::ggDisable(GLenum cap)
+{
+  setCapability(cap, false);
 }
 
 /*
-** ファイルからデータを読み込んで法線マップのテクスチャを作成する
+** テクスチャを削除して記録している結合を解除する
 **
-**   name 画像ファイル名
-**   width テクスチャとして用いる画像データの横幅
-**   height テクスチャとして用いる画像データの高さ
-**   format テクスチャとして用いる画像データのフォーマット (GL_RED, GL_RG, GL_RGB, GL_RGBA)
-**   nz 法線マップの z 成分の値
-**   internal テクスチャの内部フォーマット
+**   n 削除するテクスチャの数
+**   textures 削除するテクスチャ名の配列
 */
-void gg::GgNormalTexture::load(const char *name, float nz, GLenum internal)
+void gg::ggDeleteTextures(GLsizei n, const GLuint *textures)
 {
-  // 高さマップ
-  std::vector<GLubyte> hmap;
+  // 削除したテクスチャは全てのテクスチャユニットから解放される
+  StateCache &cache(stateCache());
+  for (GLsizei i = 0; i < n; ++i)
+    if (textures[i] != 0)
+      for (auto &unit : cache.texture) for (auto &t : unit) if (t == textures[i]) t = 0;
 
-  // 画像サイズ
-  GLsizei width, height;
+  glDeleteTextures(n, textures);
+}
 
-  // 画像フォーマット
-  GLenum format;
+/*
+** バッファオブジェクトを削除して記録している結合を解除する
+**
+**   n 削除するバッファオブジェクトの数
+**   buffers 削除するバッファオブジェクト名の配列
+*/
+void gg::ggDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+  // 削除したバッファオブジェクトは全ての結合ポイントから解放される
+  StateCache &cache(stateCache());
+  for (GLsizei i = 0; i < n; ++i)
+    if (buffers[i] != 0)
+      for (auto &u : cache.uniform) if (u.buffer == buffers[i]) u = { 0, 0, 0 };
 
-  // 高さマップの画像を読み込む
-  ggReadImage(name, hmap, &width, &height, &format);
+  glDeleteBuffers(n, buffers);
+}
 
-  // 法線マップ
-  std::vector<GgVector> nmap;
+/*
+** 現在のスレッドで記録している状態を破棄する
+*/
+void gg::ggResetState()
+{
+  stateCache().reset();
+}
 
-  // 法線マップを作成する
-  ggCreateNormalMap(hmap.data(), width, height, format, nz, internal, nmap);
+/*
+** 現在のスレッドの状態設定の呼び出しの回数を取り出す
+**
+**   reset true なら取り出した後に回数を 0 にする
+**   戻り値 前回 0 にしてからの呼び出しの回数
+*/
+gg::GgStateCount gg::ggGetStateCount(bool reset)
+{
+  StateCache &cache(stateCache());
+  const GgStateCount count(cache.count);
+  if (reset) cache.count = { 0, 0 };
+  return count;
 }
 
+#if GG_USE_TRACE
 // \cond
 /*
-** OBJ ファイルの読み込みに使うデータ型と関数
+** CPU 側の処理区間のトレースに使うデータ型と関数
 */
 namespace gg
 {
-  // GLfloat 型の 2 要素のベクトル
-  using  vec2 = std::array<GLfloat, 2>;
-
-  // GLfloat 型の 3 要素のベクトル
-  using vec3 = std::array<GLfloat, 3>;
+  // スレッドごとに記録できる処理区間の数
+  const size_t traceCapacity(65536);
 
-  // 三角形データ
-  struct fidx
+  // 処理区間の記録
+  struct TraceEvent
   {
-    GLuint p[3];        // 頂点座標番号
-    GLuint n[3];        // 頂点法線番号
-    GLuint t[3];        // テクスチャ座標番号
-    bool smooth;        // スムーズシェーディングの有無
+    // 区間名
+    const char *name;
+
+    // 開始時刻と所要時間 (マイクロ秒)
+    long long start, duration;
   };
 
-  // ポリゴングループ
-  struct fgrp
+  // スレッドごとのトレースのバッファ
+  struct TraceBuffer
   {
-    GLuint nextgroup;   // 次のポリゴングループの最初の三角形番号
-    GLuint mtlno;       // このポリゴングループの材質番号
+    // スレッド番号
+    const unsigned int tid;
+
+    // スレッド名
+    std::atomic<const char *> name;
+
+    // 処理区間の記録
+    std::unique_ptr<TraceEvent[]> event;
+
+    // 格納済みの記録の数 (書き込むのはこのスレッドのみ)
+    std::atomic<size_t> count;
 
     // コンストラクタ
-    fgrp(GLuint nextgroup, GLuint mtlno)
-      : nextgroup(nextgroup), mtlno(mtlno) {}
+    TraceBuffer(unsigned int tid)
+      : tid(tid), name(nullptr), event(new TraceEvent[traceCapacity]), count(0)
+    {
+    }
   };
 
-  // デフォルトの材質
-  constexpr GgSimpleShader::Material defaultMaterial =
+  // 全スレッドのトレースのバッファ (スレッドの終了後も保存まで保持する)
+  static std::vector<std::shared_ptr<TraceBuffer>> &traceBuffers()
   {
-    { 0.1f, 0.1f, 0.1f, 1.0f },
-    { 0.6f, 0.6f, 0.6f, 0.0f },
-    { 0.3f, 0.3f, 0.3f, 0.0f },
-    60.0f
-  };
+    static std::vector<std::shared_ptr<TraceBuffer>> buffers;
+    return buffers;
+  }
 
-  // デフォルトの材質名
-  constexpr char defaultMaterialName[] = "_default_";
+  // バッファの登録と保存の排他制御 (記録時には使わない)
+  static std::mutex &traceMutex()
+  {
+    static std::mutex mtx;
+    return mtx;
+  }
 
-  /*
-  ** Alias OBJ 形式の MTL ファイルを読み込む
-  **
-  **   mtlpath MTL ファイルのパス名
-  **   mtl 読み込んだ材質名をキー，材質番号を値にした map
-  **   material 材質データ
-  */
-  static bool ggLoadMtl(const std::string &mtlpath,
-    std::map<std::string, GLuint> &mtl,
-    std::vector<GgSimpleShader::Material> &material)
+  // 計測の基準時刻からの経過時間 (マイクロ秒)
+  static long long traceNow()
   {
-    // MTL ファイルが無ければ戻る
-    std::ifstream mtlfile(mtlpath.c_str(), std::ios::binary);
-    if (!mtlfile)
+    static const std::chrono::steady_clock::time_point epoch(std::chrono::steady_clock::now());
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - epoch).count();
+  }
+
+  // 現在のスレッドのトレースのバッファ
+  static TraceBuffer *traceBuffer()
+  {
+    // スレッドごとのバッファは最初に使うときに登録する
+    thread_local TraceBuffer *buffer(nullptr);
+    if (!buffer)
     {
-#if defined(DEBUG)
-      std::cerr << "Warning: Can't open MTL file: " << mtlpath << std::endl;
-#endif
-      return false;
+      std::lock_guard<std::mutex> lock(traceMutex());
+      auto &buffers(traceBuffers());
+      buffers.emplace_back(std::make_shared<TraceBuffer>(static_cast<unsigned int>(buffers.size())));
+      buffer = buffers.back().get();
     }
+    return buffer;
+  }
+}
+// \endcond
 
-    // 一行読み込み用のバッファ
-    std::string mtlline;
+/*
+** CPU 側の処理区間の記録：コンストラクタ
+*/
+gg::GgTraceZone::GgTraceZone(const char *name)
+  : name(name)
+  , start(traceNow())
+{
+}
 
-    // 材質名（ループの外に置く）
-    std::string mtlname(defaultMaterialName);
+/*
+** CPU 側の処理区間の記録：デストラクタ
+*/
+gg::GgTraceZone::~GgTraceZone()
+{
+  // このスレッドのバッファ
+  TraceBuffer *const buffer(traceBuffer());
 
-    // 現在の材質番号を登録する
-    mtl[mtlname] = static_cast<GLuint>(material.size());
-
-    // 現在の材質にデフォルトの材質を設定する
-    material.emplace_back(defaultMaterial);
-
-    // 材質データを読み込む
-    while (std::getline(mtlfile, mtlline))
-    {
-      // 空行は読み飛ばす
-      if (mtlline == "") continue;
-
-      // 最後の文字が '\r' なら
-      if (*(mtlline.end() - 1) == '\r')
-      {
-        // 最後の文字を削除する
-        mtlline.erase(mtlline.end() - 1, mtlline.end());
-
-        // 空行になったら読み飛ばす
-        if (mtlline == "") continue;
-      }
-
-      // 読み込んだ行を文字列ストリームにする
-      std::istringstream mtlstr(mtlline);
+  // バッファに空きがあれば記録する (満杯なら捨てる)
+  const size_t n(buffer->count.load(std::memory_order_relaxed));
+  if (n < traceCapacity)
+  {
+    TraceEvent &e(buffer->event[n]);
+    e.name = name;
+    e.start = start;
+    e.duration = traceNow() - start;
 
-      // オペレータ
-      std::string mtlop;
+    // 記録を書き終えてから記録数を更新する
+    buffer->count.store(n + 1, std::memory_order_release);
+  }
+}
 
-      // 文字列ストリームから材質パラメータの種類を取り出す
-      mtlstr >> mtlop;
+/*
+** 現在のスレッドのトレース上の名前を設定する
+**
+**   name スレッド名
+*/
+void gg::_ggTraceThread(const char *name)
+{
+  traceBuffer()->name.store(name, std::memory_order_release);
+}
+#endif
 
-      // '#' で始まる場合はコメントとして行末まで読み飛ばす
-      if (mtlop[0] == '#') continue;
+/*
+** 記録したトレースを Chrome Trace Event 形式で保存する
+**
+**   name 保存するファイル名
+**   戻り値 保存に成功すれば true, 失敗すれば false
+*/
+bool gg::ggSaveTrace(const char *name)
+{
+#if GG_USE_TRACE
+  // 保存先のファイルを開く
+  std::ofstream file(name);
+  if (!file)
+  {
+#  if defined(DEBUG)
+    std::cerr << "Warning: Can't open file: " << name << std::endl;
+#  endif
+    return false;
+  }
 
-      if (mtlop == "newmtl")
-      {
-        // 新規作成する材質名を取り出す
-        mtlstr >> mtlname;
+  // 保存中にバッファが追加されないようにする
+  std::lock_guard<std::mutex> lock(traceMutex());
 
-        // 材質名が既に存在するかどうか調べる
-        const auto m(mtl.find(mtlname));
-        if (m == mtl.end())
-        {
-          // 存在しないので新規作成する材質の番号をその材質名に割り当てる
-          mtl[mtlname] = static_cast<GLuint>(material.size());
+  file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
 
-          // 新規作成する材質にデフォルトの材質を設定しておく
-          material.emplace_back(defaultMaterial);
-        }
+  // 最初の記録の前には区切りを出力しない
+  const char *separator("\n");
 
-#if defined(DEBUG)
-        std::cerr << "newmtl: " << mtlname << std::endl;
-#endif
-      }
-      else if (mtlop == "Ka")
-      {
-        // 環境光の反射係数を登録する
-        mtlstr
-          >> material.back().ambient[0]
-          >> material.back().ambient[1]
-          >> material.back().ambient[2];
-      }
-      else if (mtlop == "Kd")
-      {
-        // 拡散反射係数を登録する
-        mtlstr
-          >> material.back().diffuse[0]
-          >> material.back().diffuse[1]
-          >> material.back().diffuse[2];
-      }
-      else if (mtlop == "Ks")
-      {
-        // 鏡面反射係数を登録する
-        mtlstr
-          >> material.back().specular[0]
-          >> material.back().specular[1]
-          >> material.back().specular[2];
-      }
-      else if (mtlop == "Ns")
-      {
-        // 輝き係数を登録する
-        float shininess;
-        mtlstr >> shininess;
-        material.back().shininess = shininess * 0.1f;
-      }
-      else if (mtlop == "d")
-      {
-        // 不透明度を登録する
-        mtlstr >> material.back().ambient[3];
-      }
+  for (const auto &buffer : traceBuffers())
+  {
+    // スレッド名が設定されていればメタデータとして出力する
+    const char *const thread(buffer->name.load(std::memory_order_acquire));
+    if (thread)
+    {
+      file << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->tid
+        << ",\"args\":{\"name\":\"" << thread << "\"}}";
+      separator = ",\n";
     }
 
-    // MTL ファイルの読み込みに失敗したら戻る
-    if (mtlfile.bad())
+    // 書き込み済みの記録だけを出力する
+    const size_t count(buffer->count.load(std::memory_order_acquire));
+    for (size_t i = 0; i < count; ++i)
     {
-#if defined(DEBUG)
-      std::cerr << "Warning: Can't read MTL file: " << mtlpath << std::endl;
-#endif
-      mtlfile.close();
-      return false;
+      const TraceEvent &e(buffer->event[i]);
+      file << separator << "{\"name\":\"" << e.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->tid
+        << ",\"ts\":" << e.start << ",\"dur\":" << e.duration << "}";
+      separator = ",\n";
     }
-
-    // MTL ファイルを閉じて戻る
-    mtlfile.close();
-    return true;
   }
 
-  /*
-  ** Alias OBJ 形式のファイルを解析する
-  **
-  **   name Alias OBJ 形式のファイルのファイル名
-  **   group 同じ材質を割り当てるポリゴングループ
-  **   mtl 読み込んだ材質名をキーにした map
-  **   pos 頂点の位置
-  **   norm 頂点の法線
-  **   tex 頂点のテクスチャ座標
-  **   face 三角形のデータ
-  */
-  static bool ggParseObj(const char *name, std::vector<fgrp> &group,
-    std::vector<GgSimpleShader::Material> &material,
-    std::vector<vec3> &pos, std::vector<vec3> &norm, std::vector<vec2> &tex,
-    std::vector<fidx> &face,
-    bool normalize)
-  {
-    // ファイルパスからディレクトリ名を取り出す
-    const std::string path(name);
-    const size_t base(path.find_last_of("/\\"));
-    const std::string dirname((base == std::string::npos) ? "" : path.substr(base + 1));
-
-    // OBJ ファイルを読み込む
-    std::ifstream file(path.c_str());
+  file << "\n]}\n";
 
-    // 読み込みに失敗したら戻る
-    if (!file)
-    {
-#if defined(DEBUG)
-      std::cerr << "Error: Can't open OBJ file: " << path << std::endl;
+  // 書き出しに失敗していないか調べる
+  file.close();
+  return !file.fail();
+#else
+  // トレースを記録していない
+  return false;
 #endif
-      return false;
-    }
-
-    // ポリゴングループの最初の三角形番号
-    GLsizei startgroup(static_cast<GLsizei>(group.size()));
+}
 
-    // スムーズシェーディングのスイッチ
-    bool smooth(false);
+/*
+** 配列に格納された画像の内容を TGA ファイルに保存する
+**
+**   name ファイル名
+**   buffer 画像データ
+**   width 画像の横の画素数
+**   height 画像の縦の画素数
+**   depth 画像の 1 画素のバイト数
+**   戻り値 保存に成功すれば true, 失敗すれば false
+*/
+bool gg::ggSaveTga(const char *name, const void *buffer,
+  unsigned int width, unsigned int height, unsigned int depth)
+{
+  // ファイルを開く
+  std::ofstream file(name, std::ios::binary);
 
-    // 材質のテーブル
-    std::map<std::string, GLuint> mtl;
+  // ファイルが開けなかったら戻る
+  if (!file) return false;
 
-    // 現在の材質名（ループの外で宣言する）
-    std::string mtlname;
+  // 画像のヘッダ
+  const unsigned char type(depth == 0 ? 0 : depth < 3 ? 3 : 2);
+  const unsigned char alpha(depth == 2 || depth == 4 ? 8 : 0);
+  const unsigned char header[18] =
+  {
+    0,          // ID length
+    0,          // Color map type (none)
+    type,       // Image Type (2:RGB, 3:Grayscale)
+    0, 0,       // Offset into the color map table
+    0, 0,       // Number of color map entries
+    0,          // Number of a color map entry bits per pixel
+    0, 0,       // Horizontal image position
+    0, 0,       // Vertical image position
+    static_cast<unsigned char>(width & 0xff),
+    static_cast<unsigned char>(width >> 8),
+    static_cast<unsigned char>(height & 0xff),
+    static_cast<unsigned char>(height >> 8),
+    static_cast<unsigned char>(depth * 8),
+    alpha       // Image descriptor
+  };
 
-    // 座標値の最小値・最大値
-    vec3 bmin{ FLT_MAX }, bmax{ -FLT_MAX };
+  // ヘッダを書き込む
+  file.write(reinterpret_cast<const char *>(header), sizeof header);
 
-    // 一行読み込み用のバッファ
-    std::string line;
+  // ヘッダの書き込みに失敗したら戻る
+  if (file.bad())
+  {
+    file.close();
+    return false;
+  }
 
-    // データの読み込み
-    while (std::getline(file, line))
+  // データを書き込む
+  unsigned int size(width * height * depth);
+  if (type == 2)
+  {
+    // フルカラー
+    std::vector<char> temp(size);
+    for (GLuint i = 0; i < size; i += depth)
     {
-      // 空行は読み飛ばす
-      if (line == "") continue;
+      temp[i + 2] = static_cast<const char *>(buffer)[i + 0];
+      temp[i + 1] = static_cast<const char *>(buffer)[i + 1];
+      temp[i + 0] = static_cast<const char *>(buffer)[i + 2];
+      if (depth == 4) temp[i + 3] = static_cast<const char *>(buffer)[i + 3];
+    }
+    file.write(&temp[0], size);
+  }
+  else if (type == 3)
+  {
+    // グレースケール
+    file.write(static_cast<const char *>(buffer), size);
+  }
 
-      // 最後の文字が '\r' なら
-      if (*(line.end() - 1) == '\r')
-      {
-        // 最後の文字を削除する
-        line.erase(line.end() - 1, line.end());
+  // フッタを書き込む
+  constexpr char footer[] = "\0\0\0\0\0\0\0\0TRUEVISION-XFILE.";
+  file.write(footer, sizeof footer);
 
-        // 空行になったら読み飛ばす
-        if (line == "") continue;
-      }
+  // データの書き込みに失敗したら戻る
+  if (file.bad())
+  {
+    file.close();
+    return false;
+  }
 
-      // 一行を文字列ストリームに入れる
-      std::istringstream str(line);
+  // ファイルを閉じる
+  file.close();
+  return true;
+}
 
-      // 最初のトークンを命令 (op) とみなす
-      std::string op;
-      str >> op;
+/*
+** カラーバッファの内容を TGA ファイルに保存する
+**
+**   name 保存するファイル名
+**   戻り値 保存に成功すれば true, 失敗すれば false
+*/
+bool gg::ggSaveColor(const char *name)
+{
+  // 現在のビューポートのサイズを得る
+  GLint viewport[4];
+  glGetIntegerv(GL_VIEWPORT, viewport);
 
-      if (op[0] == '#') continue;
+  // ビューポートのサイズ分のメモリを確保する
+  std::vector<GLubyte> buffer(viewport[2] * viewport[3] * 3);
 
-      if (op == "v")
-      {
-        // 頂点位置
-        vec3 v;
+  // 画面表示の完了を待つ
+  glFinish();
 
-        // 頂点位置はスペースで区切られている
-        str >> v[0] >> v[1] >> v[2];
+  // カラーバッファを読み込む
+  glReadPixels(viewport[0], viewport[1], viewport[2], viewport[3],
+    GL_BGR, GL_UNSIGNED_BYTE, buffer.data());
 
-        // 頂点位置を記録する
-        pos.emplace_back(v);
+  // 読み込んだデータをファイルに書き込む
+  return ggSaveTga(name, buffer.data(), viewport[2], viewport[3], 3);
+}
 
-        // 頂点位置の最小値と最大値を求める (AABB)
-        for (int i = 0; i < 3; ++i)
-        {
-          bmin[i] = std::min(bmin[i], v[i]);
-          bmax[i] = std::max(bmax[i], v[i]);
-        }
-      }
-      else if (op == "vt")
-      {
-        // テクスチャ座標
-        vec2 t;
+/*
+** デプスバッファの内容を TGA ファイルに保存する
+**
+**   name 保存するファイル名
+**   戻り値 保存に成功すれば true, 失敗すれば false
+*/
+bool gg::ggSaveDepth(const char *name)
+{
+  // 現在のビューポートのサイズを得る
+  GLint viewport[4];
+  glGetIntegerv(GL_VIEWPORT, viewport);
 
-        // 頂点位置はスペースで区切られている
-        str >> t[0] >> t[1];
+  // ビューポートのサイズ分のメモリを確保する
+  std::vector<GLubyte> buffer(viewport[2] * viewport[3]);
 
-        // テクスチャ座標を記録する
-        tex.emplace_back(t);
-      }
-      else if (op == "vn")
-      {
-        // 頂点法線
-        vec3 n;
+  // 画面表示の完了を待つ
+  glFinish();
 
-        // 頂点法線はスペースで区切られている
-        str >> n[0] >> n[1] >> n[2];
+  // デプスバッファを読み込む
+  glReadPixels(viewport[0], viewport[1], viewport[2], viewport[3],
+    GL_DEPTH_COMPONENT, GL_UNSIGNED_BYTE, buffer.data());
 
-        // 頂点法線を記録する
-        norm.emplace_back(n);
-      }
-      else if (op == "f")
-      {
-        // 三角形データ
-        fidx f;
+  // 読み込んだデータをファイルに書き込む
+  return ggSaveTga(name, buffer.data(), viewport[2], viewport[3], 1);
+}
 
-        // スムースシェーディング
-        f.smooth = smooth;
+// \cond
+/*
+** 読み込み専用にメモリマップしたファイル
+*/
+namespace gg
+{
+  class MappedFile
+  {
+    // ファイルの内容の先頭
+    const char *data;
 
-        // 三頂点のそれぞれについて
-        for (int i = 0; i < 3; ++i)
-        {
-          // １項目取り出す
-          std::string s;
-          str >> s;
+    // ファイルの大きさ
+    std::size_t length;
 
-          // 項目の最初の要素は頂点座標番号
-          f.p[i] = atoi(s.c_str());
+#if defined(_WIN32)
+    // ファイルとファイルマッピングのハンドル
+    HANDLE file, mapping;
+#endif
 
-          // テクスチャ座標と法線の番号は未定義を表す 0 にしておく
-          f.t[i] = f.n[i] = 0;
+    // メモリマップできなかったときに読み込んだ内容
+    std::vector<char> buffer;
 
-          // 残りの項目を取り出す
-          size_t l(s.find('/', 0));
-          if (l != std::string::npos)
-          {
-            // 二つ目の項目の先頭の位置
-            ++l;
-
-            // 二つ目の項目はテクスチャ座標
-            f.t[i] = atoi(s.c_str() + l);
-
-            // 三つ目の項目
-            l = s.find('/', l);
-            if (l != std::string::npos)
-            {
-              // 三つ目の項目の先頭の位置
-              ++l;
-
-              // 三つ目の項目は法線番号
-              f.n[i] = atoi(s.c_str() + l);
-            }
-          }
-        }
+  public:
 
-        // 三角形データを登録する
-        face.emplace_back(f);
+    // コンストラクタ
+    explicit MappedFile(const char *name)
+      : data(nullptr), length(0)
+    {
+#if defined(_WIN32)
+      mapping = nullptr;
+      file = CreateFileA(name, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+      if (file == INVALID_HANDLE_VALUE) return;
+
+      LARGE_INTEGER size;
+      if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+      {
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping)
+        {
+          data = static_cast<const char *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+          if (data) length = static_cast<std::size_t>(size.QuadPart);
+        }
       }
-      else if (op == "s")
+#else
+      const int fd(open(name, O_RDONLY));
+      if (fd < 0) return;
+
+      struct stat st;
+      if (fstat(fd, &st) == 0 && st.st_size > 0)
       {
-        // '1' だったらスムースシェーディング有効
-        std::string s;
-        str >> s;
-        smooth = s == "1";
+        void *const p(mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0));
+        if (p != MAP_FAILED)
+        {
+          data = static_cast<const char *>(p);
+          length = static_cast<std::size_t>(st.st_size);
+          madvise(p, length, MADV_SEQUENTIAL);
+        }
       }
-      else if (op == "usemtl")
+      close(fd);
+#endif
+
+      // メモリマップできなければ普通に読み込む (空のファイルもここに来る)
+      if (!data)
       {
-        // 次のポリゴングループの最初の三角形番号
-        const GLsizei nextgroup(static_cast<GLsizei>(face.size()));
+        std::ifstream stream(name, std::ios::binary);
+        if (!stream) return;
+        buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        if (stream.bad()) return;
+        data = buffer.data();
+        length = buffer.size();
+
+        // 空のファイルでも開けたことがわかるようにする
+        if (!data) data = "";
+      }
+    }
 
-        // ポリゴングループに三角形が存在すれば
-        if (nextgroup > startgroup)
-        {
-          // ポリゴングループの三角形数と材質番号を記録する
-          group.emplace_back(nextgroup, mtl[mtlname]);
+    // デストラクタ
+    ~MappedFile()
+    {
+#if defined(_WIN32)
+      if (data && buffer.empty() && length > 0) UnmapViewOfFile(data);
+      if (mapping) CloseHandle(mapping);
+      if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+#else
+      if (data && buffer.empty() && length > 0) munmap(const_cast<char *>(data), length);
+#endif
+    }
 
-          // 次のポリゴングループの開始番号を保存しておく
-          startgroup = nextgroup;
-        }
+    // コピーコンストラクタを封じる
+    MappedFile(const MappedFile &o) = delete;
 
-        // 次に usemtl が来るまで材質名を保持する
-        str >> mtlname;
+    // 代入演算子を封じる
+    MappedFile &operator=(const MappedFile &o) = delete;
 
-        // 材質の存在チェック
-        if (mtl.find(mtlname) == mtl.end())
-        {
-#if defined(DEBUG)
-          std::cerr << "Warning: Undefined material: " << mtlname << std::endl;
+    // ファイルを開けたら true
+    explicit operator bool() const
+    {
+      return data != nullptr;
+    }
+
+    // ファイルの内容の先頭
+    const char *begin() const
+    {
+      return data;
+    }
+
+    // ファイルの内容の末尾の次
+    const char *end() const
+    {
+      return data + length;
+    }
+
+    // ファイルの大きさ
+    std::size_t size() const
+    {
+      return length;
+    }
+  };
+
+  // ファイルの更新時刻と大きさを調べる
+  static bool fileStamp(const char *name, std::int64_t &mtime, std::uint64_t &size)
+  {
+#if defined(_WIN32)
+    struct _stat64 st;
+    if (_stat64(name, &st) != 0) return false;
+#else
+    struct stat st;
+    if (stat(name, &st) != 0) return false;
 #endif
+    mtime = static_cast<std::int64_t>(st.st_mtime);
+    size = static_cast<std::uint64_t>(st.st_size);
+    return true;
+  }
 
-          // デフォルトの材質を割り当てておく
-          mtlname = defaultMaterialName;
-        }
+  // キャッシュファイルを書き込む一時ファイルのパス名を求める
+  //   スレッドごとに異なる名前にするので, 同じキャッシュファイルを同時に作成しても混ざらない
+  static std::string cacheTempPath(const std::string &path)
+  {
+    std::ostringstream suffix;
+    suffix << '.' << std::hash<std::thread::id>()(std::this_thread::get_id()) << ".tmp";
+    return path + suffix.str();
+  }
+
+  // 書き込みが終わった一時ファイルでキャッシュファイルを置き換える
+  //   置き換えられなければ一時ファイルを削除する
+  static void replaceCacheFile(const std::string &temp, const std::string &path)
+  {
+#if defined(_WIN32)
+    const bool renamed(MoveFileExA(temp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING) != 0);
+#else
+    const bool renamed(std::rename(temp.c_str(), path.c_str()) == 0);
+#endif
+    if (!renamed)
+    {
 #if defined(DEBUG)
-        else std::cerr << "usemtl: " << mtlname << std::endl;
+      std::cerr << "Warning: Can't rename file: " << temp << std::endl;
 #endif
-      }
-      else if (op == "mtllib")
-      {
-        // MTL ファイルのパス名を作る
-        str >> std::ws;
-        std::string mtlpath;
-        std::getline(str, mtlpath);
+      std::remove(temp.c_str());
+    }
+  }
+}
+// \endcond
 
-        // MTL ファイルを読み込む
-        ggLoadMtl(dirname + mtlpath, mtl, material);
-      }
+// \cond
+/*
+** 画素アンパックバッファを使ったテクスチャの転送に使う関数
+*/
+namespace gg
+{
+  // 画素アンパックバッファを確保して結合し, 書き込み用にマップする (失敗したら nullptr)
+  static void *mapUnpack(GLuint &pbo, std::size_t size)
+  {
+    glGenBuffers(1, &pbo);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+    return glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+  }
+
+  // 画素アンパックバッファの結合を解除して削除する (転送が終わるまでは実際には削除されない)
+  static void releaseUnpack(GLuint pbo)
+  {
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    ggDeleteBuffers(1, &pbo);
+  }
+
+  // 画素アンパックバッファのマップを解除し, 結合したまま返す (マップできなかったか内容が失われたら削除して 0)
+  static GLuint unmapUnpack(GLuint pbo, void *buffer)
+  {
+    if (buffer && glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE) return pbo;
+    releaseUnpack(pbo);
+    return 0;
+  }
+}
+// \endcond
+
+// \cond
+/*
+** TGA ファイルの読み込みに使うデータ型と関数
+*/
+namespace gg
+{
+  // メモリマップした TGA ファイル
+  struct TgaImage
+  {
+    const GLubyte *data;  // 画素データの先頭
+    const GLubyte *end;   // ファイルの末尾の次
+    GLsizei width;        // 横の画素数
+    GLsizei height;       // 縦の画素数
+    GLenum format;        // 画素のフォーマット
+    int depth;            // 画素のバイト数
+    bool rle;             // ランレングス圧縮されていれば true
+
+    // 展開後のデータサイズ
+    std::size_t size() const
+    {
+      return static_cast<std::size_t>(width) * height * depth;
     }
+  };
 
-    // OBJ ファイルの読み込みに失敗したら戻る
-    if (file.bad())
+  // メモリマップした TGA ファイルのヘッダを解析する
+  static bool parseTga(const MappedFile &file, TgaImage &tga)
+  {
+    // ヘッダが読めなかったら戻る
+    if (!file || file.size() < 18) return false;
+    const GLubyte *const header(reinterpret_cast<const GLubyte *>(file.begin()));
+
+    // 深度
+    tga.depth = header[16] / 8;
+    switch (tga.depth)
     {
-#if defined(DEBUG)
-      std::cerr << "Error: Can't read OBJ file: " << path << std::endl;
-#endif
-      file.close();
+    case 1:
+      tga.format = GL_RED;
+      break;
+    case 2:
+      tga.format = GL_RG;
+      break;
+    case 3:
+      tga.format = GL_BGR;
+      break;
+    case 4:
+      tga.format = GL_BGRA;
+      break;
+    default:
+      // 取り扱えないフォーマットだったら戻る
       return false;
     }
 
-    // ファイルを閉じる
-    file.close();
+    // 画像の縦横の画素数
+    tga.width = header[13] << 8 | header[12];
+    tga.height = header[15] << 8 | header[14];
+    if (tga.size() < 2) return false;
 
-    // 最後のポリゴングループの次の三角形番号
-    const GLsizei nextgroup(static_cast<GLsizei>(face.size()));
-    if (nextgroup > startgroup)
+    // 画素データはヘッダと画像 ID の後にある
+    tga.data = header + 18 + header[0];
+    tga.end = reinterpret_cast<const GLubyte *>(file.end());
+    if (tga.data > tga.end) tga.data = tga.end;
+    tga.rle = (header[2] & 8) != 0;
+
+    return true;
+  }
+
+  // 同じ画素を count 個並べる (書き込み先は読み出さないので書き込み結合のメモリでもよい)
+  static GLubyte *splat(GLubyte *dst, const GLubyte *pixel, int depth, int count)
+  {
+    // 画素を最大 16 個並べたブロックを倍々に作る
+    GLubyte block[16 * 4];
+    const int n(std::min(count, 16) * depth);
+    std::memcpy(block, pixel, depth);
+    for (int i = depth; i < n; i *= 2) std::memcpy(block + i, block, std::min(i, n - i));
+
+    // ブロックをまとめて複写する
+    for (int i = count * depth; i > 0; i -= n)
     {
-      // 最後のポリゴングループの三角形数と材質を記録する
-      group.emplace_back(nextgroup, static_cast<GLuint>(mtl[mtlname]));
+      const int bytes(std::min(i, n));
+      std::memcpy(dst, block, bytes);
+      dst += bytes;
     }
+    return dst;
+  }
 
-    // スムーズシェーディングしない三角形の頂点を追加する
-    for (auto &f : face)
+  // TGA ファイルの画素データを展開する (データが足りなければ残りを 0 で埋める)
+  static void decodeTga(const TgaImage &tga, GLubyte *image)
+  {
+    const GLubyte *src(tga.data);
+    GLubyte *dst(image);
+    GLubyte *const last(image + tga.size());
+
+    if (tga.rle)
     {
-      if (!f.smooth)
+      // RLE
+      while (src < tga.end)
       {
-        // 三頂点のそれぞれについて
-        for (int i = 0; i < 3; ++i)
+        const int c(*src++);
+        if (c & 0x80)
         {
-          // 新しい頂点座標を生成する (std::array の要素は emplace_back できない)
-          pos.push_back(pos[f.p[i] - 1]);
-          f.p[i] = static_cast<int>(pos.size());
+          // run-length packet
+          const int count((c & 0x7f) + 1);
+          if (dst + tga.depth * count > last || src + tga.depth > tga.end) break;
+          dst = splat(dst, src, tga.depth, count);
+          src += tga.depth;
+        }
+        else
+        {
+          // raw packet
+          const std::size_t count((c + 1) * tga.depth);
+          if (dst + count > last) break;
+          const std::size_t bytes(std::min(count, static_cast<std::size_t>(tga.end - src)));
+          std::memcpy(dst, src, bytes);
+          dst += bytes;
+          src += bytes;
+        }
+      }
+    }
+    else
+    {
+      // 非圧縮
+      const std::size_t bytes(std::min(tga.size(), static_cast<std::size_t>(tga.end - src)));
+      std::memcpy(dst, src, bytes);
+      dst += bytes;
+    }
 
-          if (f.t[i] > 0)
-          {
-            // 新しいテクスチャ座標を生成する
-            tex.push_back(tex[f.t[i] - 1]);
-            f.t[i] = static_cast<int>(tex.size());
-          }
+    // 足りなかったところは 0 で埋める
+    std::fill(dst, last, GLubyte(0));
+  }
 
-          if (f.n[i] > 0)
-          {
-            // 新しい法線を生成する
-            norm.push_back(norm[f.n[i] - 1]);
-            f.n[i] = static_cast<int>(norm.size());
-          }
-        }
+  // TGA ファイルを画素アンパックバッファに直接展開し, それを結合したまま返す (失敗したら 0)
+  static GLuint unpackTga(const char *name, GLsizei &width, GLsizei &height, GLenum &format)
+  {
+    // ファイルをメモリマップしてヘッダを解析する
+    const MappedFile file(name);
+    TgaImage tga;
+    if (!parseTga(file, tga)) return 0;
+
+    // 画素アンパックバッファをマップして展開する
+    GLuint pbo;
+    void *const buffer(mapUnpack(pbo, tga.size()));
+    if (buffer) decodeTga(tga, static_cast<GLubyte *>(buffer));
+
+    // 画像の縦横の画素数とフォーマット
+    width = tga.width;
+    height = tga.height;
+    format = tga.format;
+
+    return unmapUnpack(pbo, buffer);
+  }
+}
+// \endcond
+
+// \cond
+/*
+** ブロック圧縮テクスチャの作成に使うデータ型と関数
+*/
+namespace gg
+{
+  // RGBA 各 8 bit の画素
+  using Rgba = std::array<GLubyte, 4>;
+
+  // 圧縮テクスチャの内部フォーマットの一ブロックのバイト数 (圧縮テクスチャでなければ 0)
+  static GLsizei compressedBlockBytes(GLenum internal)
+  {
+    switch (internal)
+    {
+    case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+    case GL_COMPRESSED_RED_RGTC1:
+      return 8;
+    case GL_COMPRESSED_RG_RGTC2:
+    case GL_COMPRESSED_RGBA_BPTC_UNORM:
+      return 16;
+    default:
+      return 0;
+    }
+  }
+
+  // 圧縮テクスチャの内部フォーマットの基本フォーマットとキャッシュファイルの拡張子
+  static GLenum compressedBaseFormat(GLenum internal, const char *&suffix)
+  {
+    switch (internal)
+    {
+    case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+      suffix = ".bc1.ktx";
+      return GL_RGB;
+    case GL_COMPRESSED_RED_RGTC1:
+      suffix = ".bc4.ktx";
+      return GL_RED;
+    case GL_COMPRESSED_RG_RGTC2:
+      suffix = ".bc5.ktx";
+      return GL_RG;
+    default:
+      suffix = ".bc7.ktx";
+      return GL_RGBA;
+    }
+  }
+
+  // この環境で使えない圧縮テクスチャの内部フォーマットを非圧縮のものに置き換える
+  //   RGTC (BC4 / BC5) は OpenGL 3.0 から使えるが, S3TC (BC1) は拡張機能,
+  //   BPTC (BC7) は OpenGL 4.2 か拡張機能が必要になる (macOS の OpenGL 4.1 は BPTC を扱えない).
+  //   描画するスレッドで呼び出し, 結果は最初の呼び出しで調べたものを使い続ける
+  static GLenum supportedInternal(GLenum internal)
+  {
+    switch (internal)
+    {
+    case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+    {
+      static const bool s3tc(glfwExtensionSupported("GL_EXT_texture_compression_s3tc") == GLFW_TRUE);
+      return s3tc ? internal : GL_RGB;
+    }
+    case GL_COMPRESSED_RGBA_BPTC_UNORM:
+    {
+      static const bool bptc([]
+      {
+        GLint major(0), minor(0);
+        glGetIntegerv(GL_MAJOR_VERSION, &major);
+        glGetIntegerv(GL_MINOR_VERSION, &minor);
+        return major > 4 || (major == 4 && minor >= 2)
+          || glfwExtensionSupported("GL_ARB_texture_compression_bptc") == GLFW_TRUE;
+      } ());
+      return bptc ? internal : GL_RGBA;
+    }
+    default:
+      return internal;
+    }
+  }
+
+  // TGA ファイルの画素を RGBA に並べ替える (GL_RED なら (r, 0, 0, 255) のように glTexImage2D() と同じにする)
+  static void expandRgba(const GLubyte *src, GLenum format, std::size_t count, Rgba *dst)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      switch (format)
+      {
+      case GL_RED:
+        dst[i] = Rgba{ src[0], 0, 0, 255 };
+        src += 1;
+        break;
+      case GL_RG:
+        dst[i] = Rgba{ src[0], src[1], 0, 255 };
+        src += 2;
+        break;
+      case GL_BGR:
+        dst[i] = Rgba{ src[2], src[1], src[0], 255 };
+        src += 3;
+        break;
+      default:
+        dst[i] = Rgba{ src[2], src[1], src[0], src[3] };
+        src += 4;
+        break;
       }
     }
+  }
 
-    // 法線データがなければ算出しておく
-    if (norm.empty())
+  // 縦横を半分にした画像を作る (奇数のときは端の画素を繰り返す)
+  static void halveRgba(const std::vector<Rgba> &src, GLsizei width, GLsizei height, std::vector<Rgba> &dst)
+  {
+    const GLsizei w(std::max(width / 2, 1)), h(std::max(height / 2, 1));
+    dst.resize(w * h);
+
+    for (GLsizei y = 0; y < h; ++y)
     {
-      // 法線データ数の初期値は頂点数と同じでスムーズシェーディングのために初期値は 0
-      norm.resize(pos.size(), { 0.0f, 0.0f, 0.0f });
+      const Rgba *const r0(src.data() + std::min(y * 2, height - 1) * width);
+      const Rgba *const r1(src.data() + std::min(y * 2 + 1, height - 1) * width);
 
-      // 面の法線の算出と頂点法線の算出
-      for (auto &f : face)
+      for (GLsizei x = 0; x < w; ++x)
       {
-        // 頂点座標番号
-        const int v0(f.p[0] - 1);
-        const int v1(f.p[1] - 1);
-        const int v2(f.p[2] - 1);
+        const GLsizei x0(std::min(x * 2, width - 1)), x1(std::min(x * 2 + 1, width - 1));
+        for (int c = 0; c < 4; ++c)
+          dst[y * w + x][c] = static_cast<GLubyte>((r0[x0][c] + r0[x1][c] + r1[x0][c] + r1[x1][c] + 2) >> 2);
+      }
+    }
+  }
 
-        // v1 - v0, v2 - v0 を求める
-        const GLfloat d1[] = { pos[v1][0] - pos[v0][0], pos[v1][1] - pos[v0][1], pos[v1][2] - pos[v0][2] };
-        const GLfloat d2[] = { pos[v2][0] - pos[v0][0], pos[v2][1] - pos[v0][1], pos[v2][2] - pos[v0][2] };
+  // 4x4 の画素のブロックを取り出す (画像からはみ出すところは端の画素を繰り返す)
+  static void fetchBlock(const Rgba *image, GLsizei width, GLsizei height, GLsizei bx, GLsizei by, Rgba *block)
+  {
+    for (int y = 0; y < 4; ++y)
+    {
+      const Rgba *const row(image + std::min(by * 4 + y, height - 1) * width);
+      for (int x = 0; x < 4; ++x) block[y * 4 + x] = row[std::min(bx * 4 + x, width - 1)];
+    }
+  }
+
+  // ブロックの画素の n 個の成分の主軸上で両端にある画素を求める
+  static void principalExtremes(const Rgba *block, int n, int &lo, int &hi)
+  {
+    // 平均
+    GLfloat mean[4] = { 0.0f };
+    for (int i = 0; i < 16; ++i) for (int c = 0; c < n; ++c) mean[c] += block[i][c];
+    for (int c = 0; c < n; ++c) mean[c] /= 16.0f;
+
+    // 共分散行列
+    GLfloat cov[4][4] = { { 0.0f } };
+    for (int i = 0; i < 16; ++i)
+    {
+      GLfloat d[4];
+      for (int c = 0; c < n; ++c) d[c] = block[i][c] - mean[c];
+      for (int j = 0; j < n; ++j) for (int k = 0; k < n; ++k) cov[j][k] += d[j] * d[k];
+    }
+
+    // べき乗法で主軸を求める
+    GLfloat axis[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    for (int iteration = 0; iteration < 8; ++iteration)
+    {
+      GLfloat t[4], l(0.0f);
+      for (int j = 0; j < n; ++j)
+      {
+        t[j] = 0.0f;
+        for (int k = 0; k < n; ++k) t[j] += cov[j][k] * axis[k];
+        l = std::max(l, std::fabs(t[j]));
+      }
+      if (l <= 0.0f) break;
+      for (int j = 0; j < n; ++j) axis[j] = t[j] / l;
+    }
+
+    // 主軸に投影して両端の画素を選ぶ
+    GLfloat tmin(0.0f), tmax(0.0f);
+    lo = hi = 0;
+    for (int i = 0; i < 16; ++i)
+    {
+      GLfloat t(0.0f);
+      for (int c = 0; c < n; ++c) t += (block[i][c] - mean[c]) * axis[c];
+      if (i == 0 || t < tmin)
+      {
+        tmin = t;
+        lo = i;
+      }
+      if (i == 0 || t > tmax)
+      {
+        tmax = t;
+        hi = i;
+      }
+    }
+  }
+
+  // BC4 で一つの成分を圧縮する
+  static void encodeBc4(const Rgba *block, int channel, GLubyte *dst)
+  {
+    GLubyte lo(255), hi(0);
+    for (int i = 0; i < 16; ++i)
+    {
+      lo = std::min(lo, block[i][channel]);
+      hi = std::max(hi, block[i][channel]);
+    }
+
+    // 最大値と最小値を端点にした 8 段階の補間値の番号を選ぶ
+    std::uint64_t bits(0);
+    if (hi > lo)
+    {
+      const int range(hi - lo);
+      for (int i = 0; i < 16; ++i)
+      {
+        const int k(((hi - block[i][channel]) * 14 + range) / (range * 2));
+        bits |= static_cast<std::uint64_t>(k == 0 ? 0 : k == 7 ? 1 : k + 1) << (3 * i);
+      }
+    }
+
+    dst[0] = hi;
+    dst[1] = lo;
+    for (int i = 0; i < 6; ++i) dst[2 + i] = static_cast<GLubyte>(bits >> (8 * i));
+  }
+
+  // RGB565 に量子化する
+  static std::uint16_t packRgb565(const Rgba &c)
+  {
+    return static_cast<std::uint16_t>(((c[0] * 31 + 127) / 255) << 11 | ((c[1] * 63 + 127) / 255) << 5 | (c[2] * 31 + 127) / 255);
+  }
+
+  // RGB565 を元に戻す
+  static void unpackRgb565(std::uint16_t c, int *rgb)
+  {
+    const int r(c >> 11), g((c >> 5) & 63), b(c & 31);
+    rgb[0] = r << 3 | r >> 2;
+    rgb[1] = g << 2 | g >> 4;
+    rgb[2] = b << 3 | b >> 2;
+  }
+
+  // BC1 で RGB を圧縮する
+  static void encodeBc1(const Rgba *block, GLubyte *dst)
+  {
+    // 主軸の両端の色を端点にする
+    int lo, hi;
+    principalExtremes(block, 3, lo, hi);
+    std::uint16_t c0(packRgb565(block[hi])), c1(packRgb565(block[lo]));
+    if (c0 < c1) std::swap(c0, c1);
+
+    // 端点とその間を三等分した 4 色のうち最も近いものを選ぶ (端点が同じならすべて c0)
+    std::uint32_t bits(0);
+    if (c0 > c1)
+    {
+      int palette[4][3];
+      unpackRgb565(c0, palette[0]);
+      unpackRgb565(c1, palette[1]);
+      for (int c = 0; c < 3; ++c)
+      {
+        palette[2][c] = (palette[0][c] * 2 + palette[1][c]) / 3;
+        palette[3][c] = (palette[0][c] + palette[1][c] * 2) / 3;
+      }
+
+      for (int i = 0; i < 16; ++i)
+      {
+        int best(0), error(INT_MAX);
+        for (int j = 0; j < 4; ++j)
+        {
+          int e(0);
+          for (int c = 0; c < 3; ++c) e += (block[i][c] - palette[j][c]) * (block[i][c] - palette[j][c]);
+          if (e < error)
+          {
+            error = e;
+            best = j;
+          }
+        }
+        bits |= static_cast<std::uint32_t>(best) << (2 * i);
+      }
+    }
+
+    dst[0] = static_cast<GLubyte>(c0);
+    dst[1] = static_cast<GLubyte>(c0 >> 8);
+    dst[2] = static_cast<GLubyte>(c1);
+    dst[3] = static_cast<GLubyte>(c1 >> 8);
+    for (int i = 0; i < 4; ++i) dst[4 + i] = static_cast<GLubyte>(bits >> (8 * i));
+  }
+
+  // BC7 のモード 6 で RGBA を圧縮する
+  static void encodeBc7(const Rgba *block, GLubyte *dst)
+  {
+    // 主軸の両端の色を端点にする
+    int lo, hi;
+    principalExtremes(block, 4, lo, hi);
+    const Rgba *const endpoint[] = { &block[lo], &block[hi] };
+
+    // 端点を 7 bit と共通の p bit に量子化する (誤差の小さい p bit を選ぶ)
+    int q[2][4], p[2], e[2][4];
+    for (int k = 0; k < 2; ++k)
+    {
+      int error[2] = { 0, 0 }, t[2][4];
+      for (int b = 0; b < 2; ++b)
+      {
+        for (int c = 0; c < 4; ++c)
+        {
+          t[b][c] = std::min(std::max(((*endpoint[k])[c] - b + 1) >> 1, 0), 127);
+          const int d(t[b][c] * 2 + b - (*endpoint[k])[c]);
+          error[b] += d * d;
+        }
+      }
+      p[k] = error[1] < error[0] ? 1 : 0;
+      for (int c = 0; c < 4; ++c)
+      {
+        q[k][c] = t[p[k]][c];
+        e[k][c] = q[k][c] * 2 + p[k];
+      }
+    }
+
+    // 16 段階の補間値のうち最も近いものを選ぶ
+    static const int weight[] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+    int palette[16][4];
+    for (int j = 0; j < 16; ++j)
+      for (int c = 0; c < 4; ++c) palette[j][c] = ((64 - weight[j]) * e[0][c] + weight[j] * e[1][c] + 32) >> 6;
+
+    int index[16];
+    for (int i = 0; i < 16; ++i)
+    {
+      int error(INT_MAX);
+      for (int j = 0; j < 16; ++j)
+      {
+        int d(0);
+        for (int c = 0; c < 4; ++c) d += (block[i][c] - palette[j][c]) * (block[i][c] - palette[j][c]);
+        if (d < error)
+        {
+          error = d;
+          index[i] = j;
+        }
+      }
+    }
+
+    // 最初の画素の番号の最上位ビットは省略されるので 0 になるように端点を入れ替える
+    if (index[0] & 8)
+    {
+      std::swap(q[0], q[1]);
+      std::swap(p[0], p[1]);
+      for (auto &i : index) i = 15 - i;
+    }
+
+    // 下位ビットから順に詰める
+    std::uint64_t bits[2] = { 0, 0 };
+    int position(0);
+    const auto put([&](std::uint64_t value, int count)
+    {
+      for (int i = 0; i < count; ++i, ++position)
+        bits[position >> 6] |= ((value >> i) & 1) << (position & 63);
+    });
+    put(1 << 6, 7);
+    for (int c = 0; c < 4; ++c)
+    {
+      put(q[0][c], 7);
+      put(q[1][c], 7);
+    }
+    put(p[0], 1);
+    put(p[1], 1);
+    put(index[0], 3);
+    for (int i = 1; i < 16; ++i) put(index[i], 4);
+
+    for (int i = 0; i < 16; ++i) dst[i] = static_cast<GLubyte>(bits[i >> 3] >> (8 * (i & 7)));
+  }
+
+  // ブロックの行の first から last の手前までを圧縮する
+  static void compressRows(const Rgba *image, GLsizei width, GLsizei height, GLenum internal,
+    GLubyte *dst, GLsizei first, GLsizei last)
+  {
+    const GLsizei bw((width + 3) / 4), bytes(compressedBlockBytes(internal));
+    Rgba block[16];
+
+    for (GLsizei by = first; by < last; ++by)
+    {
+      for (GLsizei bx = 0; bx < bw; ++bx)
+      {
+        GLubyte *const d(dst + (static_cast<std::size_t>(by) * bw + bx) * bytes);
+        fetchBlock(image, width, height, bx, by, block);
+
+        switch (internal)
+        {
+        case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+          encodeBc1(block, d);
+          break;
+        case GL_COMPRESSED_RED_RGTC1:
+          encodeBc4(block, 0, d);
+          break;
+        case GL_COMPRESSED_RG_RGTC2:
+          encodeBc4(block, 0, d);
+          encodeBc4(block, 1, d + 8);
+          break;
+        default:
+          encodeBc7(block, d);
+          break;
+        }
+      }
+    }
+  }
+
+  // 一つのミップマップレベルを圧縮する (ブロックの行をいくつかに分けて並列に処理する)
+  static void compressLevel(const std::vector<Rgba> &image, GLsizei width, GLsizei height, GLenum internal,
+    std::vector<GLubyte> &level)
+  {
+    const GLsizei bw((width + 3) / 4), bh((height + 3) / 4);
+    level.resize(static_cast<std::size_t>(bw) * bh * compressedBlockBytes(internal));
+
+    // ブロックの行を分割する数 (16K ブロック未満なら分割しない)
+    unsigned int count(std::max(1u, std::thread::hardware_concurrency()));
+    count = static_cast<unsigned int>(std::min<std::size_t>(count, static_cast<std::size_t>(bw) * bh / 0x4000 + 1));
+    count = std::min(count, static_cast<unsigned int>(bh));
+
+    std::vector<std::thread> worker;
+    for (unsigned int i = 1; i < count; ++i)
+      worker.emplace_back(compressRows, image.data(), width, height, internal, level.data(),
+        static_cast<GLsizei>(bh * i / count), static_cast<GLsizei>(bh * (i + 1) / count));
+    compressRows(image.data(), width, height, internal, level.data(), 0, static_cast<GLsizei>(bh / count));
+    for (auto &w : worker) w.join();
+  }
+
+  // KTX ファイルの識別子
+  const GLubyte ktxIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+  // 元の画像の更新時刻と大きさを格納するキーと値
+  const char ktxSourceKey[] = "GgSource";
+  struct KtxSource
+  {
+    std::int64_t mtime;         // 元のファイルの更新時刻
+    std::uint64_t size;         // 元のファイルの大きさ
+  };
+
+  // KTX ファイルのヘッダ
+  struct KtxHeader
+  {
+    GLubyte identifier[12];
+    std::uint32_t endianness;
+    std::uint32_t glType;
+    std::uint32_t glTypeSize;
+    std::uint32_t glFormat;
+    std::uint32_t glInternalFormat;
+    std::uint32_t glBaseInternalFormat;
+    std::uint32_t pixelWidth;
+    std::uint32_t pixelHeight;
+    std::uint32_t pixelDepth;
+    std::uint32_t numberOfArrayElements;
+    std::uint32_t numberOfFaces;
+    std::uint32_t numberOfMipmapLevels;
+    std::uint32_t bytesOfKeyValueData;
+  };
+
+  // 圧縮テクスチャのミップマップのレベル数
+  static GLsizei compressedLevels(GLsizei width, GLsizei height)
+  {
+    GLsizei levels(1);
+    while (width > 1 || height > 1)
+    {
+      width = std::max(width / 2, 1);
+      height = std::max(height / 2, 1);
+      ++levels;
+    }
+    return levels;
+  }
+
+  // ミップマップ付きの圧縮テクスチャを作成する
+  static GLuint createCompressedTexture(GLenum internal, GLsizei width, GLsizei height, GLenum wrap,
+    const std::vector<std::pair<const GLubyte *, GLsizei>> &level)
+  {
+    const GLuint tex([] { GLuint tex; glGenTextures(1, &tex); return tex; } ());
+    ggBindTexture(GL_TEXTURE_2D, tex);
+
+    for (GLsizei i = 0; i < static_cast<GLsizei>(level.size()); ++i)
+    {
+      glCompressedTexImage2D(GL_TEXTURE_2D, i, internal, width, height, 0, level[i].second, level[i].first);
+      width = std::max(width / 2, 1);
+      height = std::max(height / 2, 1);
+    }
+
+    // トライリニア，エッジの処理は wrap に従う
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(level.size()) - 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrap);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrap);
+
+    return tex;
+  }
+
+  // メモリマップした KTX ファイルから各レベルのデータを取り出す (使えなければ false)
+  static bool parseKtx(const MappedFile &file, GLenum internal, const KtxSource &source,
+    GLsizei &width, GLsizei &height, std::vector<std::pair<const GLubyte *, GLsizei>> &level)
+  {
+    if (!file || file.size() < sizeof(KtxHeader)) return false;
+    KtxHeader header;
+    std::memcpy(&header, file.begin(), sizeof header);
+
+    if (std::memcmp(header.identifier, ktxIdentifier, sizeof ktxIdentifier) != 0
+      || header.endianness != 0x04030201u
+      || header.glInternalFormat != internal
+      || header.pixelWidth == 0 || header.pixelHeight == 0 || header.pixelWidth > 0x8000 || header.pixelHeight > 0x8000
+      || header.numberOfMipmapLevels != static_cast<std::uint32_t>(compressedLevels(header.pixelWidth, header.pixelHeight))
+      || header.bytesOfKeyValueData > file.size() - sizeof header) return false;
+
+    // 元の画像の更新時刻と大きさが一致するか調べる
+    const char *p(file.begin() + sizeof header);
+    const char *const kvEnd(p + header.bytesOfKeyValueData);
+    bool fresh(false);
+    while (p + 4 <= kvEnd)
+    {
+      std::uint32_t bytes;
+      std::memcpy(&bytes, p, sizeof bytes);
+      const char *const kv(p + 4);
+      if (bytes > static_cast<std::size_t>(kvEnd - kv)) return false;
+      if (bytes == sizeof ktxSourceKey + sizeof source && std::memcmp(kv, ktxSourceKey, sizeof ktxSourceKey) == 0)
+        fresh = std::memcmp(kv + sizeof ktxSourceKey, &source, sizeof source) == 0;
+      p = kv + ((bytes + 3) & ~3u);
+    }
+    if (!fresh) return false;
+
+    // 各レベルのデータを確かめる
+    level.clear();
+    GLsizei w(header.pixelWidth), h(header.pixelHeight);
+    p = kvEnd;
+    for (std::uint32_t i = 0; i < header.numberOfMipmapLevels; ++i)
+    {
+      const std::size_t expected(static_cast<std::size_t>((w + 3) / 4) * ((h + 3) / 4) * compressedBlockBytes(internal));
+      std::uint32_t bytes;
+      if (file.end() - p < 4) return false;
+      std::memcpy(&bytes, p, sizeof bytes);
+      if (bytes != expected || static_cast<std::size_t>(file.end() - p - 4) < bytes) return false;
+      level.emplace_back(reinterpret_cast<const GLubyte *>(p + 4), static_cast<GLsizei>(bytes));
+      p += 4 + ((bytes + 3) & ~3u);
+      w = std::max(w / 2, 1);
+      h = std::max(h / 2, 1);
+    }
+
+    width = header.pixelWidth;
+    height = header.pixelHeight;
+    return true;
+  }
+
+  // 圧縮したミップマップを KTX ファイルに保存する
+  static void saveKtx(const std::string &path, GLenum internal, GLenum base, const KtxSource &source,
+    GLsizei width, GLsizei height, const std::vector<std::vector<GLubyte>> &level)
+  {
+    // 一時ファイルに書き込んでから置き換えるので, 他のスレッドがメモリマップしているキャッシュファイルは書き換わらない
+    const std::string temp(cacheTempPath(path));
+    std::ofstream file(temp.c_str(), std::ios::binary);
+    if (!file)
+    {
+#if defined(DEBUG)
+      std::cerr << "Warning: Can't open file: " << temp << std::endl;
+#endif
+      return;
+    }
+
+    // 元の画像の更新時刻と大きさを格納するキーと値 (4 バイト境界に揃える)
+    const std::uint32_t kvBytes(sizeof ktxSourceKey + sizeof source);
+    const std::uint32_t kvPadding((4 - kvBytes % 4) % 4);
+
+    KtxHeader header = {};
+    std::memcpy(header.identifier, ktxIdentifier, sizeof ktxIdentifier);
+    header.endianness = 0x04030201u;
+    header.glTypeSize = 1;
+    header.glInternalFormat = internal;
+    header.glBaseInternalFormat = base;
+    header.pixelWidth = width;
+    header.pixelHeight = height;
+    header.numberOfFaces = 1;
+    header.numberOfMipmapLevels = static_cast<std::uint32_t>(level.size());
+    header.bytesOfKeyValueData = sizeof kvBytes + kvBytes + kvPadding;
+
+    const char zero[4] = {};
+    file.write(reinterpret_cast<const char *>(&header), sizeof header);
+    file.write(reinterpret_cast<const char *>(&kvBytes), sizeof kvBytes);
+    file.write(ktxSourceKey, sizeof ktxSourceKey);
+    file.write(reinterpret_cast<const char *>(&source), sizeof source);
+    file.write(zero, kvPadding);
+    for (const auto &l : level)
+    {
+      const std::uint32_t bytes(static_cast<std::uint32_t>(l.size()));
+      file.write(reinterpret_cast<const char *>(&bytes), sizeof bytes);
+      file.write(reinterpret_cast<const char *>(l.data()), bytes);
+    }
+
+    // 書き込みに失敗したら壊れたキャッシュファイルを残さない
+    file.close();
+    if (file.fail())
+    {
+      std::remove(temp.c_str());
+      return;
+    }
+
+    // 書き込みが終わったキャッシュファイルで置き換える
+    replaceCacheFile(temp, path);
+  }
+
+  // TGA ファイルを読み込んでブロック圧縮したミップマップを作成し, KTX ファイルに保存する (失敗したら false)
+  static bool encodeCompressedTga(const char *name, GLenum internal, const KtxSource &source, const std::string &path,
+    GLsizei &width, GLsizei &height, std::vector<std::vector<GLubyte>> &level)
+  {
+    // 元のファイルを読み込む
+    ggTrace("compressTexture");
+    const MappedFile file(name);
+    TgaImage tga;
+    if (!parseTga(file, tga)) return false;
+    std::vector<GLubyte> pixel(tga.size());
+    decodeTga(tga, pixel.data());
+    std::vector<Rgba> image(static_cast<std::size_t>(tga.width) * tga.height);
+    expandRgba(pixel.data(), tga.format, image.size(), image.data());
+
+    // 縮小しながら各レベルを圧縮する
+    level.assign(compressedLevels(tga.width, tga.height), std::vector<GLubyte>());
+    std::vector<Rgba> half;
+    GLsizei w(tga.width), h(tga.height);
+    for (auto &l : level)
+    {
+      compressLevel(image, w, h, internal, l);
+      if (&l == &level.back()) break;
+      halveRgba(image, w, h, half);
+      image.swap(half);
+      w = std::max(w / 2, 1);
+      h = std::max(h / 2, 1);
+    }
+    width = tga.width;
+    height = tga.height;
+
+    // 次回からはキャッシュファイルを使う
+    const char *suffix;
+    saveKtx(path, internal, compressedBaseFormat(internal, suffix), source, width, height, level);
+
+    return true;
+  }
+
+  // ブロック圧縮したテクスチャのキャッシュファイルのパス名と元のファイルの更新時刻と大きさを求める (失敗したら false)
+  static bool compressedCache(const char *name, GLenum internal, std::string &path, KtxSource &source)
+  {
+    if (!fileStamp(name, source.mtime, source.size)) return false;
+    const char *suffix;
+    compressedBaseFormat(internal, suffix);
+    path = std::string(name) + suffix;
+    return true;
+  }
+
+  // TGA ファイルをブロック圧縮したミップマップ付きのテクスチャにする (失敗したら 0)
+  //   圧縮したものは元のファイルと同じ場所に KTX ファイルとして保存し, 次回からはそれを使う
+  static GLuint loadCompressedTga(const char *name, GLenum internal, GLenum wrap, GLsizei &width, GLsizei &height)
+  {
+    std::string path;
+    KtxSource source;
+    if (!compressedCache(name, internal, path, source)) return 0;
+
+    // キャッシュファイルが使えればメモリマップしたまま転送する
+    std::vector<std::pair<const GLubyte *, GLsizei>> data;
+    {
+      ggTrace("compressedCache");
+      const MappedFile cache(path.c_str());
+      if (parseKtx(cache, internal, source, width, height, data))
+        return createCompressedTexture(internal, width, height, wrap, data);
+    }
+
+    // 圧縮してテクスチャを作成する
+    std::vector<std::vector<GLubyte>> level;
+    if (!encodeCompressedTga(name, internal, source, path, width, height, level)) return 0;
+    for (const auto &l : level) data.emplace_back(l.data(), static_cast<GLsizei>(l.size()));
+    return createCompressedTexture(internal, width, height, wrap, data);
+  }
+
+  // TGA ファイルをブロック圧縮したミップマップをメモリに読み込む (失敗したら false)
+  //   GgLoader のワーカースレッドで使うので OpenGL の関数は呼ばない
+  static bool readCompressedTga(const char *name, GLenum internal, GLsizei &width, GLsizei &height,
+    std::vector<std::vector<GLubyte>> &level)
+  {
+    std::string path;
+    KtxSource source;
+    if (!compressedCache(name, internal, path, source)) return false;
+
+    // キャッシュファイルが使えればそれを読み込む
+    {
+      ggTrace("compressedCache");
+      const MappedFile cache(path.c_str());
+      std::vector<std::pair<const GLubyte *, GLsizei>> data;
+      if (parseKtx(cache, internal, source, width, height, data))
+      {
+        level.clear();
+        for (const auto &l : data) level.emplace_back(l.first, l.first + l.second);
+        return true;
+      }
+    }
+
+    // 圧縮する
+    return encodeCompressedTga(name, internal, source, path, width, height, level);
+  }
+}
+// \endcond
+
+/*
+** TGA ファイル (8/16/24/32bit) を読み込む
+**
+**   name 読み込むファイル名
+**   pWidth 読み込んだファイルの横の画素数の格納先のポインタ (nullptr なら格納しない)
+**   pHeight 読み込んだファイルの縦の画素数の格納先のポインタ (nullptr なら格納しない)
+**   pFormat 読み込んだファイルのフォーマットの格納先のポインタ (nullptr なら格納しない)
+**   image 読み込んだ画像を格納する vector
+**   戻り値 読み込みに成功すれば true, 失敗すれば false
+*/
+bool gg::ggReadImage(const char *name, std::vector<GLubyte> &image, GLsizei *pWidth, GLsizei *pHeight, GLenum *pFormat)
+{
+  // ファイルをメモリマップしてヘッダを解析する
+  const MappedFile file(name);
+  TgaImage tga;
+  if (!parseTga(file, tga)) return false;
+
+  // 画像の縦横の画素数とフォーマット
+  *pWidth = tga.width;
+  *pHeight = tga.height;
+  *pFormat = tga.format;
+
+  // 読み込みに使うメモリを確保して展開する
+  image.resize(tga.size());
+  decodeTga(tga, image.data());
+
+  return true;
+}
+
+/*
+** テクスチャメモリを確保して画像を読み込む
+**
+**   image 画像データ, nullptr ならメモリの確保だけを行う
+**   width 画像の横の画素数
+**   height 画像の縦の画素数
+**   format 画像データのフォーマット
+**   type 画像のデータ型
+**   internal テクスチャの内部フォーマット
+**   wrap テクスチャのラッピングモード, デフォルトは GL_CLAMP_TO_EDGE
+**   戻り値 テクスチャ名
+*/
+GLuint gg::ggLoadTexture(const GLvoid *image, GLsizei width, GLsizei height,
+  GLenum format, GLenum type, GLenum internal, GLenum wrap)
+{
+  // テクスチャオブジェクト
+  const GLuint tex([] { GLuint tex; glGenTextures(1, &tex); return tex; } ());
+  ggBindTexture(GL_TEXTURE_2D, tex);
+
+  // アルファチャンネルがついていれば 4 バイト境界に設定する
+  glPixelStorei(GL_UNPACK_ALIGNMENT, (format == GL_BGRA || format == GL_RGBA) ? 4 : 1);
+
+  // テクスチャを割り当てる
+  glTexImage2D(GL_TEXTURE_2D, 0, internal, width, height, 0, format, type, image);
+
+  // バイリニア（ミップマップなし），エッジでクランプ
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrap);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrap);
+
+  // テクスチャ名を返す
+  return tex;
+}
+
+/*
+** TGA ファイルをテクスチャメモリに読み込む
+**
+**   name TGA ファイル名
+**   pWidth 読みだした画像ファイルの横の画素数の格納先のポインタ (nullptr なら格納しない)
+++   pHeight 読みだした画像ファイルの縦の画素数の格納先のポインタ (nullptr なら格納しない)
+**   internal テクスチャの内部フォーマット， 0 なら外部フォーマットに合わせる.
+**   wrap テクスチャのラッピングモード, デフォルトは GL_CLAMP_TO_EDGE
+**   戻り値 テクスチャ名
+*/
+GLuint gg::ggLoadImage(const char *name, GLsizei *pWidth, GLsizei *pHeight, GLenum internal, GLenum wrap)
+{
+  // 画像サイズ
+  GLsizei width, height;
+
+  // 圧縮テクスチャの内部フォーマットならブロック圧縮したミップマップを作成する
+  internal = supportedInternal(internal);
+  if (compressedBlockBytes(internal) > 0)
+  {
+    const GLuint tex(loadCompressedTga(name, internal, wrap, width, height));
+    if (tex == 0) return 0;
+
+    // 画像サイズを返す
+    if (pWidth) *pWidth = width;
+    if (pHeight) *pHeight = height;
+
+    return tex;
+  }
+
+  // 画像フォーマット
+  GLenum format;
+
+  // 画像を画素アンパックバッファに読み込む
+  const GLuint pbo(unpackTga(name, width, height, format));
+
+  // 画像が読み込めなかったら戻る
+  if (pbo == 0) return 0;
+
+  // internal == 0 なら内部フォーマットを読み込んだファイルに合わせる
+  if (internal == 0)
+  {
+    switch (format)
+    {
+    case GL_BGR:
+      internal = GL_RGB;
+      break;
+    case GL_BGRA:
+      internal = GL_RGBA;
+      break;
+    default:
+      internal = format;
+      break;
+    }
+  }
+
+  // 画素アンパックバッファの先頭からテクスチャメモリに転送する (転送の完了は待たない)
+  const GLuint tex(ggLoadTexture(nullptr, width, height, format, GL_UNSIGNED_BYTE, internal, wrap));
+  releaseUnpack(pbo);
+
+  // 画像サイズを返す
+  if (pWidth) *pWidth = width;
+  if (pHeight) *pHeight = height;
+
+  // テクスチャ名を返す
+  return tex;
+}
+
+// \cond
+/*
+** 法線マップの作成に使うデータ型と関数
+*/
+namespace gg
+{
+  // 法線マップの出力形式
+  enum NormalMapType
+  {
+    NormalMapFloat,   // GgVector (法線は [-1, 1], 高さは [0, 255])
+    NormalMapScaled,  // GgVector (いずれも [0, 1] に正規化)
+    NormalMapByte,    // RGBA8 (いずれも [0, 255] に正規化)
+    NormalMapHalf     // RG16F (法線の xy だけを [0, 1] に正規化)
+  };
+
+  // 出力形式ごとの一画素のバイト数
+  const std::size_t normalMapBytes[] = { sizeof(GgVector), sizeof(GgVector), 4, 2 * sizeof(GLhalf) };
+
+  // テクスチャの内部フォーマットに合わせて転送する法線マップの出力形式を選ぶ
+  //   値の範囲は ggCreateNormalMap() と同じく GL_RGB16F, GL_RGBA16F, GL_RGB32F, GL_RGBA32F のときだけ
+  //   法線を [-1, 1] のまま格納し, それ以外は [0, 1] に正規化する.
+  //   8bit の内部フォーマットはバイトで, GL_RG16F は半精度で転送し, それ以外は精度を落とさないよう
+  //   単精度で転送する.
+  static NormalMapType normalMapType(GLenum internal, GLenum &format, GLenum &type)
+  {
+    switch (internal)
+    {
+    case GL_RGB16F:
+    case GL_RGBA16F:
+    case GL_RGB32F:
+    case GL_RGBA32F:
+      format = GL_RGBA;
+      type = GL_FLOAT;
+      return NormalMapFloat;
+    case GL_RG16F:
+      format = GL_RG;
+      type = GL_HALF_FLOAT;
+      return NormalMapHalf;
+    case GL_RED:
+    case GL_RG:
+    case GL_RGB:
+    case GL_RGBA:
+    case GL_R8:
+    case GL_RG8:
+    case GL_RGB8:
+    case GL_RGBA8:
+      format = GL_RGBA;
+      type = GL_UNSIGNED_BYTE;
+      return NormalMapByte;
+    default:
+      format = GL_RGBA;
+      type = GL_FLOAT;
+      return NormalMapScaled;
+    }
+  }
+
+  // 勾配を法線ベクトルにして正規化する (ggNormalize3() と同じ結果になる)
+  static void normalizeGradient(GLfloat *gx, GLfloat *gy, GLfloat *gz, GLfloat nz, GLsizei count)
+  {
+    const GLfloat zz(nz * nz);
+    GLsizei x(0);
+
+#if defined(GG_SIMD_SSE)
+    const __m128 z(_mm_set1_ps(nz)), z2(_mm_set1_ps(zz));
+    const __m128 zero(_mm_setzero_ps()), one(_mm_set1_ps(1.0f));
+    for (; x + 4 <= count; x += 4)
+    {
+      const __m128 u(_mm_loadu_ps(gx + x)), v(_mm_loadu_ps(gy + x));
+      const __m128 l(_mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(u, u), _mm_mul_ps(v, v)), z2)));
+
+      // 長さが 0 なら割らない
+      const __m128 m(_mm_cmpgt_ps(l, zero));
+      const __m128 s(_mm_or_ps(_mm_and_ps(m, l), _mm_andnot_ps(m, one)));
+      _mm_storeu_ps(gx + x, _mm_div_ps(u, s));
+      _mm_storeu_ps(gy + x, _mm_div_ps(v, s));
+      _mm_storeu_ps(gz + x, _mm_div_ps(z, s));
+    }
+#endif
+
+    for (; x < count; ++x)
+    {
+      const GLfloat l(sqrt(gx[x] * gx[x] + gy[x] * gy[x] + zz));
+      const GLfloat s(l > 0.0f ? l : 1.0f);
+      gx[x] /= s;
+      gy[x] /= s;
+      gz[x] = nz / s;
+    }
+  }
+
+  // 高さマップの first 行から last 行の手前までの法線マップを作成する
+  static void normalMapRows(const GLubyte *hmap, GLsizei width, GLsizei height, GLint stride, GLfloat nz,
+    NormalMapType type, GLubyte *nmap, GLsizei first, GLsizei last)
+  {
+    // 一行分の勾配
+    std::vector<GLfloat> work(width * 3);
+    GLfloat *const gx(work.data()), *const gy(gx + width), *const gz(gy + width);
+
+    // 高さマップの一行のバイト数
+    const std::size_t pitch(static_cast<std::size_t>(width) * stride);
+
+    for (GLsizei y = first; y < last; ++y)
+    {
+      // 対象の行と上下の行 (上下の端は反対側の端の行を使う)
+      const GLubyte *const row(hmap + y * pitch);
+      const GLubyte *const up(hmap + (y > 0 ? y - 1 : height - 1) * pitch);
+      const GLubyte *const down(hmap + (y + 1 < height ? y + 1 : 0) * pitch);
+
+      // 隣接する画素との値の差を法線の成分に用いる (左右の端は反対側の端の画素を使う)
+      gx[0] = static_cast<GLfloat>(row[(1 % width) * stride] - row[(width - 1) * stride]);
+      for (GLsizei x = 1; x < width - 1; ++x) gx[x] = static_cast<GLfloat>(row[(x + 1) * stride] - row[(x - 1) * stride]);
+      if (width > 1) gx[width - 1] = static_cast<GLfloat>(row[0] - row[(width - 2) * stride]);
+      for (GLsizei x = 0; x < width; ++x) gy[x] = static_cast<GLfloat>(down[x * stride] - up[x * stride]);
+
+      // 法線ベクトルを正規化する
+      normalizeGradient(gx, gy, gz, nz, width);
+
+      // この行の出力先
+      GLubyte *const dst(nmap + static_cast<std::size_t>(y) * width * normalMapBytes[type]);
+
+      switch (type)
+      {
+      case NormalMapFloat:
+        for (GLsizei x = 0; x < width; ++x)
+        {
+          GLfloat *const n(reinterpret_cast<GLfloat *>(dst) + x * 4);
+          n[0] = gx[x];
+          n[1] = gy[x];
+          n[2] = gz[x];
+          n[3] = row[x * stride];
+        }
+        break;
+      case NormalMapScaled:
+        for (GLsizei x = 0; x < width; ++x)
+        {
+          GLfloat *const n(reinterpret_cast<GLfloat *>(dst) + x * 4);
+          n[0] = gx[x] * 0.5f + 0.5f;
+          n[1] = gy[x] * 0.5f + 0.5f;
+          n[2] = gz[x] * 0.5f + 0.5f;
+          n[3] = static_cast<GLfloat>(row[x * stride]) * 0.0039215686f; // == 1/255
+        }
+        break;
+      case NormalMapByte:
+        for (GLsizei x = 0; x < width; ++x)
+        {
+          GLubyte *const n(dst + x * 4);
+          n[0] = static_cast<GLubyte>((gx[x] * 0.5f + 0.5f) * 255.0f + 0.5f);
+          n[1] = static_cast<GLubyte>((gy[x] * 0.5f + 0.5f) * 255.0f + 0.5f);
+          n[2] = static_cast<GLubyte>((gz[x] * 0.5f + 0.5f) * 255.0f + 0.5f);
+          n[3] = row[x * stride];
+        }
+        break;
+      case NormalMapHalf:
+        for (GLsizei x = 0; x < width; ++x)
+        {
+          GLhalf *const n(reinterpret_cast<GLhalf *>(dst) + x * 2);
+          n[0] = ggHalf(gx[x] * 0.5f + 0.5f);
+          n[1] = ggHalf(gy[x] * 0.5f + 0.5f);
+        }
+        break;
+      }
+    }
+  }
+
+  // 高さマップから法線マップを作成する (行をいくつかのブロックに分けて並列に処理する)
+  static void createNormalMap(const GLubyte *hmap, GLsizei width, GLsizei height, GLenum format, GLfloat nz,
+    NormalMapType type, GLvoid *nmap)
+  {
+    if (width <= 0 || height <= 0) return;
+
+    // 画素のバイト数
+    GLint stride;
+    switch (format)
+    {
+    case GL_RED:
+      stride = 1;
+      break;
+    case GL_RG:
+      stride = 2;
+      break;
+    case GL_BGR:
+      stride = 3;
+      break;
+    case GL_BGRA:
+      stride = 4;
+      break;
+    default:
+      stride = 1;
+      break;
+    }
+
+    // 行を分割する数 (256K 画素未満なら分割しない)
+    unsigned int count(std::max(1u, std::thread::hardware_concurrency()));
+    count = static_cast<unsigned int>(std::min<std::size_t>(count,
+      static_cast<std::size_t>(width) * height / 0x40000 + 1));
+    count = std::min(count, static_cast<unsigned int>(height));
+
+    // 分割した行を並列に処理する
+    std::vector<std::thread> worker;
+    GLubyte *const dst(static_cast<GLubyte *>(nmap));
+    for (unsigned int i = 1; i < count; ++i)
+      worker.emplace_back(normalMapRows, hmap, width, height, stride, nz, type, dst,
+        static_cast<GLsizei>(height * i / count), static_cast<GLsizei>(height * (i + 1) / count));
+    normalMapRows(hmap, width, height, stride, nz, type, dst, 0, static_cast<GLsizei>(height / count));
+    for (auto &w : worker) w.join();
+  }
+
+  // 法線マップを画素アンパックバッファに直接作成し, それを結合したまま返す (失敗したら 0)
+  static GLuint unpackNormalMap(const GLubyte *hmap, GLsizei width, GLsizei height, GLenum format, GLfloat nz,
+    GLenum internal, GLenum &external, GLenum &type)
+  {
+    // テクスチャの内部フォーマットに合わせて出力形式を選ぶ
+    const NormalMapType t(normalMapType(internal, external, type));
+
+    // 画素アンパックバッファをマップして作成する
+    GLuint pbo;
+    void *const buffer(mapUnpack(pbo, static_cast<std::size_t>(width) * height * normalMapBytes[t]));
+    if (buffer) createNormalMap(hmap, width, height, format, nz, t, buffer);
+    return unmapUnpack(pbo, buffer);
+  }
+}
+// \endcond
+
+/*
+** グレースケール画像 (8bit) から法線マップのデータを作成する
+**
+**   width 高さマップのグレースケール画像 hmap の横の画素数
+**   height 高さマップのグレースケール画像のデータ hmap の縦の画素数
+**   stride データの間隔
+**   hmap グレースケール画像のデータ
+**   nz 法線の z 成分の割合
+**   internal テクスチャの内部フォーマット
+**   nmap 法線マップを格納する vector
+*/
+void gg::ggCreateNormalMap(const GLubyte *hmap, GLsizei width, GLsizei height, GLenum format, GLfloat nz,
+  GLenum internal, std::vector<GgVector> &nmap)
+{
+  // 法線マップのメモリを確保する
+  nmap.resize(width * height);
+
+  // 内部フォーマットが浮動小数点テクスチャでなければ [0,1] に正規化する
+  const bool scale(
+    internal != GL_RGB16F &&
+    internal != GL_RGBA16F &&
+    internal != GL_RGB32F &&
+    internal != GL_RGBA32F
+    );
+
+  // 法線マップを作成する
+  createNormalMap(hmap, width, height, format, nz, scale ? NormalMapScaled : NormalMapFloat, nmap.data());
+}
+
+/*
+** TGA 画像ファイルの高さマップ読み込んでテクスチャメモリに法線マップを作成する
+**
+**   name TGA ファイル名
+**   nz 作成した法線の z 成分の割合
+**   pWidth 読み込んだ画像の横の画素数の格納先のポインタ (nullptr なら格納しない)
+**   pHeight 読み込んだ画像の縦の画素数の格納先のポインタ (nullptr なら格納しない)
+**   internal テクスチャの内部フォーマット
+**   戻り値 テクスチャ名
+*/
+GLuint gg::ggLoadHeight(const char *name, float nz, GLsizei *pWidth, GLsizei *pHeight, GLenum internal)
+{
+  // 画像データ
+  std::vector<GLubyte> hmap;
+
+  // 画像サイズ
+  GLsizei width, height;
+
+  // 画像フォーマット
+  GLenum format;
+
+  // 高さマップの画像を読み込む
+  ggReadImage(name, hmap, &width, &height, &format);
+
+  // 画像が読み込めなかったら戻る
+  if (hmap.empty()) return 0;
+
+  // 法線マップを画素アンパックバッファに作成する
+  GLenum external, type;
+  const GLuint pbo(unpackNormalMap(hmap.data(), width, height, format, nz, internal, external, type));
+  if (pbo == 0) return 0;
+
+  // 画像サイズを返す
+  if (pWidth) *pWidth = width;
+  if (pHeight) *pHeight = height;
+
+  // 画素アンパックバッファの先頭からテクスチャを作成して返す
+  const GLuint tex(ggLoadTexture(nullptr, width, height, external, type, internal, GL_REPEAT));
+  releaseUnpack(pbo);
+  return tex;
+}
+
+/*
+** テクスチャを作成してファイルからデータを読み込む
+**
+**   name 読み込むファイル名
+**   internal glTexImage2D() に指定するテクスチャの内部フォーマット. 0 なら外部フォーマットに合わせる
+**   戻り値 テクスチャの作成に成功すれば true, 失敗すれば false
+*/
+void gg::GgColorTexture::load(const char *name, GLenum internal, GLenum wrap)
+{
+  // 画像サイズ
+  GLsizei width, height;
+
+  // 圧縮テクスチャの内部フォーマットならブロック圧縮したミップマップを作成する
+  internal = supportedInternal(internal);
+  if (compressedBlockBytes(internal) > 0)
+  {
+    const GLuint tex(loadCompressedTga(name, internal, wrap, width, height));
+    if (tex == 0) return;
+
+    // 作成したテクスチャを引き取る
+    const GLsizei size[] = { width, height };
+    texture.reset(new GgTexture(tex, size));
+    return;
+  }
+
+  // 画像フォーマット
+  GLenum format;
+
+  // 画像を画素アンパックバッファに読み込む
+  const GLuint pbo(unpackTga(name, width, height, format));
+
+  // 画像が読み込めなかったら戻る
+  if (pbo == 0) return;
+
+  // internal == 0 なら内部フォーマットを読み込んだファイルに合わせる
+  if (internal == 0)
+  {
+    switch (format)
+    {
+    case GL_BGR:
+      internal = GL_RGB;
+      break;
+    case GL_BGRA:
+      internal = GL_RGBA;
+      break;
+    default:
+      internal = format;
+      break;
+    }
+  }
+
+  // 画素アンパックバッファの先頭からテクスチャを作成する (転送の完了は待たない)
+  texture.reset(new GgTexture(nullptr, width, height, format, GL_UNSIGNED_BYTE, internal, wrap));
+  releaseUnpack(pbo);
+}
+
+/*
+** ファイルからデータを読み込んで法線マップのテクスチャを作成する
+**
+**   name 画像ファイル名
+**   width テクスチャとして用いる画像データの横幅
+**   height テクスチャとして用いる画像データの高さ
+**   format テクスチャとして用いる画像データのフォーマット (GL_RED, GL_RG, GL_RGB, GL_RGBA)
+**   nz 法線マップの z 成分の値
+**   internal テクスチャの内部フォーマット
+*/
+void gg::GgNormalTexture::load(const char *name, float nz, GLenum internal)
+{
+  // 高さマップ
+  std::vector<GLubyte> hmap;
+
+  // 画像サイズ
+  GLsizei width, height;
+
+  // 画像フォーマット
+  GLenum format;
+
+  // 高さマップの画像を読み込む
+  if (!ggReadImage(name, hmap, &width, &height, &format)) return;
+
+  // 法線マップのテクスチャを作成する
+  load(hmap.data(), width, height, format, nz, internal);
+}
+
+/*
+** メモリ上のデータから法線マップのテクスチャを作成する
+**
+**   hmap テクスチャとして用いる画像データ, nullptr ならデータを読み込まない
+**   width テクスチャとして用いる画像データの横幅
+**   height テクスチャとして用いる画像データの高さ
+**   format テクスチャとして用いる画像データのフォーマット
+**   nz 法線マップの z 成分の値
+**   internal テクスチャの内部フォーマット
+*/
+void gg::GgNormalTexture::load(const GLubyte *hmap, GLsizei width, GLsizei height, GLenum format, float nz,
+  GLenum internal)
+{
+  // 転送するデータのフォーマット
+  GLenum external, type;
+
+  // 高さマップがなければテクスチャメモリの確保だけを行う
+  if (!hmap)
+  {
+    normalMapType(internal, external, type);
+    texture.reset(new GgTexture(nullptr, width, height, external, type, internal, GL_REPEAT));
+    return;
+  }
+
+  // 法線マップを画素アンパックバッファに作成する
+  const GLuint pbo(unpackNormalMap(hmap, width, height, format, nz, internal, external, type));
+  if (pbo == 0) return;
+
+  // 画素アンパックバッファの先頭からテクスチャを作成する
+  texture.reset(new GgTexture(nullptr, width, height, external, type, internal, GL_REPEAT));
+  releaseUnpack(pbo);
+}
+
+// \cond
+/*
+** OBJ ファイルの読み込みに使うデータ型と関数
+*/
+namespace gg
+{
+  // GLfloat 型の 2 要素のベクトル
+  using  vec2 = std::array<GLfloat, 2>;
+
+  // GLfloat 型の 3 要素のベクトル
+  using vec3 = std::array<GLfloat, 3>;
+
+  // 三角形データ
+  struct fidx
+  {
+    GLuint p[3];        // 頂点座標番号
+    GLuint n[3];        // 頂点法線番号
+    GLuint t[3];        // テクスチャ座標番号
+    bool smooth;        // スムーズシェーディングの有無
+  };
+
+  // ポリゴングループ
+  struct fgrp
+  {
+    GLuint nextgroup;   // 次のポリゴングループの最初の三角形番号
+    GLuint mtlno;       // このポリゴングループの材質番号
+
+    // コンストラクタ
+    fgrp(GLuint nextgroup, GLuint mtlno)
+      : nextgroup(nextgroup), mtlno(mtlno) {}
+  };
+
+  // デフォルトの材質
+  constexpr GgSimpleShader::Material defaultMaterial =
+  {
+    { 0.1f, 0.1f, 0.1f, 1.0f },
+    { 0.6f, 0.6f, 0.6f, 0.0f },
+    { 0.3f, 0.3f, 0.3f, 0.0f },
+    60.0f
+  };
+
+  // デフォルトの材質名
+  constexpr char defaultMaterialName[] = "_default_";
+
+  /*
+  ** Alias OBJ 形式の MTL ファイルを読み込む
+  **
+  **   mtlpath MTL ファイルのパス名
+  **   mtl 読み込んだ材質名をキー，材質番号を値にした map
+  **   material 材質データ
+  */
+  static bool ggLoadMtl(const std::string &mtlpath,
+    std::map<std::string, GLuint> &mtl,
+    std::vector<GgSimpleShader::Material> &material)
+  {
+    // MTL ファイルが無ければ戻る
+    std::ifstream mtlfile(mtlpath.c_str(), std::ios::binary);
+    if (!mtlfile)
+    {
+#if defined(DEBUG)
+      std::cerr << "Warning: Can't open MTL file: " << mtlpath << std::endl;
+#endif
+      return false;
+    }
+
+    // 一行読み込み用のバッファ
+    std::string mtlline;
+
+    // 材質名（ループの外に置く）
+    std::string mtlname(defaultMaterialName);
+
+    // 現在の材質番号を登録する
+    mtl[mtlname] = static_cast<GLuint>(material.size());
+
+    // 現在の材質にデフォルトの材質を設定する
+    material.emplace_back(defaultMaterial);
+
+    // 材質データを読み込む
+    while (std::getline(mtlfile, mtlline))
+    {
+      // 空行は読み飛ばす
+      if (mtlline == "") continue;
+
+      // 最後の文字が '\r' なら
+      if (*(mtlline.end() - 1) == '\r')
+      {
+        // 最後の文字を削除する
+        mtlline.erase(mtlline.end() - 1, mtlline.end());
+
+        // 空行になったら読み飛ばす
+        if (mtlline == "") continue;
+      }
+
+      // 読み込んだ行を文字列ストリームにする
+      std::istringstream mtlstr(mtlline);
+
+      // オペレータ
+      std::string mtlop;
+
+      // 文字列ストリームから材質パラメータの種類を取り出す
+      mtlstr >> mtlop;
+
+      // '#' で始まる場合はコメントとして行末まで読み飛ばす
+      if (mtlop[0] == '#') continue;
+
+      if (mtlop == "newmtl")
+      {
+        // 新規作成する材質名を取り出す
+        mtlstr >> mtlname;
+
+        // 材質名が既に存在するかどうか調べる
+        const auto m(mtl.find(mtlname));
+        if (m == mtl.end())
+        {
+          // 存在しないので新規作成する材質の番号をその材質名に割り当てる
+          mtl[mtlname] = static_cast<GLuint>(material.size());
+
+          // 新規作成する材質にデフォルトの材質を設定しておく
+          material.emplace_back(defaultMaterial);
+        }
+
+#if defined(DEBUG)
+        std::cerr << "newmtl: " << mtlname << std::endl;
+#endif
+      }
+      else if (mtlop == "Ka")
+      {
+        // 環境光の反射係数を登録する
+        mtlstr
+          >> material.back().ambient[0]
+          >> material.back().ambient[1]
+          >> material.back().ambient[2];
+      }
+      else if (mtlop == "Kd")
+      {
+        // 拡散反射係数を登録する
+        mtlstr
+          >> material.back().diffuse[0]
+          >> material.back().diffuse[1]
+          >> material.back().diffuse[2];
+      }
+      else if (mtlop == "Ks")
+      {
+        // 鏡面反射係数を登録する
+        mtlstr
+          >> material.back().specular[0]
+          >> material.back().specular[1]
+          >> material.back().specular[2];
+      }
+      else if (mtlop == "Ns")
+      {
+        // 輝き係数を登録する
+        float shininess;
+        mtlstr >> shininess;
+        material.back().shininess = shininess * 0.1f;
+      }
+      else if (mtlop == "d")
+      {
+        // 不透明度を登録する
+        mtlstr >> material.back().ambient[3];
+      }
+    }
+
+    // MTL ファイルの読み込みに失敗したら戻る
+    if (mtlfile.bad())
+    {
+#if defined(DEBUG)
+      std::cerr << "Warning: Can't read MTL file: " << mtlpath << std::endl;
+#endif
+      mtlfile.close();
+      return false;
+    }
+
+    // MTL ファイルを閉じて戻る
+    mtlfile.close();
+    return true;
+  }
+
+  // 行内の空白を読み飛ばす
+  static inline const char *skipSpace(const char *p, const char *end)
+  {
+    while (p < end && (*p == ' ' || *p == '\t')) ++p;
+    return p;
+  }
+
+  // 次の空白か行末まで読み飛ばす
+  static inline const char *skipToken(const char *p, const char *end)
+  {
+    while (p < end && *p != ' ' && *p != '\t') ++p;
+    return p;
+  }
+
+  // 整数を読み取る (atoi() と同様に数字がなければ 0)
+  static inline int parseInt(const char *&p, const char *end)
+  {
+    bool negative(false);
+    if (p < end && (*p == '-' || *p == '+')) negative = *p++ == '-';
+
+    int value(0);
+    while (p < end && *p >= '0' && *p <= '9') value = value * 10 + (*p++ - '0');
+
+    return negative ? -value : value;
+  }
+
+  // 実数を読み取る
+  //   仮数が double で正確に表せる 2^53 以下で 10 のべき乗の指数が ±22 以内なら double の乗除算一回で
+  //   正しく丸めた値が得られる. これを float に丸めても, double の値がちょうど隣り合う float の中点に
+  //   なっていなければ正しく丸めた値になるので, それ以外のときだけ strtof() を使う
+  static inline GLfloat parseFloat(const char *&p, const char *end)
+  {
+    // 10 のべき乗のうち double で正確に表せるもの
+    static const double power[] =
+    {
+      1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    p = skipSpace(p, end);
+    const char *const token(p);
+
+    bool negative(false);
+    if (p < end && (*p == '-' || *p == '+')) negative = *p++ == '-';
+
+    // 仮数を 2^53 まで整数として読み取る
+    std::uint64_t mantissa(0);
+    int exponent(0);
+    bool exact(true);
+    const auto digit([&](int d)
+    {
+      if (!exact) return;
+      mantissa = mantissa * 10 + d;
+      if (mantissa > 0x20000000000000ull) exact = false;
+    });
+    for (; p < end && *p >= '0' && *p <= '9'; ++p) digit(*p - '0');
+    if (p < end && *p == '.')
+    {
+      for (++p; p < end && *p >= '0' && *p <= '9'; ++p) digit(*p - '0'), --exponent;
+    }
+
+    // 指数部
+    if (p < end && (*p == 'e' || *p == 'E'))
+    {
+      ++p;
+      exponent += parseInt(p, end);
+    }
+
+    // 正しく丸めた値が直接求められるとき
+    if (exact && exponent >= -22 && exponent <= 22)
+    {
+      const double value(exponent < 0
+        ? static_cast<double>(mantissa) / power[-exponent]
+        : static_cast<double>(mantissa) * power[exponent]);
+
+      // float の仮数より下の 29 bit が中点でなければ float に丸める
+      std::uint64_t bits;
+      std::memcpy(&bits, &value, sizeof bits);
+      if ((bits & 0x1fffffffu) != 0x10000000u) return static_cast<GLfloat>(negative ? -value : value);
+    }
+
+    // それ以外は字句をスタック上に複写して strtof() で変換する
+    char buffer[64];
+    const std::size_t length(static_cast<std::size_t>(p - token));
+    if (length >= sizeof buffer) return std::strtof(std::string(token, p).c_str(), nullptr);
+    std::memcpy(buffer, token, length);
+    buffer[length] = '\0';
+    return std::strtof(buffer, nullptr);
+  }
+
+  // OBJ ファイルの一部分を解析した結果
+  struct ObjChunk
+  {
+    // 頂点の位置, 法線, テクスチャ座標, 三角形
+    std::vector<vec3> pos, norm;
+    std::vector<vec2> tex;
+    std::vector<fidx> face;
+
+    // 頂点の位置の最小値と最大値
+    vec3 bmin, bmax;
+
+    // 最初の s 命令より前の三角形の数 (前の部分のスムーズシェーディングの設定に従う)
+    std::size_t inherit;
+
+    // s 命令があったかどうかとこの部分の最後のスムーズシェーディングの設定
+    bool smoothSet, smooth;
+
+    // usemtl と mtllib 命令
+    struct Command
+    {
+      bool usemtl;      // usemtl なら true, mtllib なら false
+      std::size_t face; // 命令までにこの部分で読み込んだ三角形の数
+      std::string arg;  // 命令の引数
+    };
+    std::vector<Command> command;
+
+    // コンストラクタ
+    ObjChunk()
+      : bmin{ { FLT_MAX, FLT_MAX, FLT_MAX } }, bmax{ { -FLT_MAX, -FLT_MAX, -FLT_MAX } }
+      , inherit(0), smoothSet(false), smooth(false)
+    {}
+  };
+
+  // OBJ ファイルの begin から end までの行を解析する
+  static void parseObjChunk(const char *begin, const char *end, ObjChunk &chunk)
+  {
+    while (begin < end)
+    {
+      // 行末を探す
+      const char *eol(static_cast<const char *>(memchr(begin, '\n', end - begin)));
+      if (!eol) eol = end;
+      const char *const next(eol < end ? eol + 1 : end);
+
+      // 最後の文字が '\r' なら除く
+      if (eol > begin && eol[-1] == '\r') --eol;
+
+      // 最初のトークンを命令 (op) とみなす
+      const char *const op(skipSpace(begin, eol));
+      const char *p(skipToken(op, eol));
+      const std::size_t oplen(p - op);
+      begin = next;
+
+      // 空行とコメントは読み飛ばす
+      if (oplen == 0 || *op == '#') continue;
+
+      if (oplen == 1 && op[0] == 'v')
+      {
+        // 頂点位置はスペースで区切られている
+        vec3 v;
+        v[0] = parseFloat(p, eol);
+        v[1] = parseFloat(p, eol);
+        v[2] = parseFloat(p, eol);
+        chunk.pos.emplace_back(v);
+
+        // 頂点位置の最小値と最大値を求める (AABB)
+        for (int i = 0; i < 3; ++i)
+        {
+          chunk.bmin[i] = std::min(chunk.bmin[i], v[i]);
+          chunk.bmax[i] = std::max(chunk.bmax[i], v[i]);
+        }
+      }
+      else if (oplen == 2 && op[0] == 'v' && op[1] == 't')
+      {
+        // テクスチャ座標
+        vec2 t;
+        t[0] = parseFloat(p, eol);
+        t[1] = parseFloat(p, eol);
+        chunk.tex.emplace_back(t);
+      }
+      else if (oplen == 2 && op[0] == 'v' && op[1] == 'n')
+      {
+        // 頂点法線
+        vec3 n;
+        n[0] = parseFloat(p, eol);
+        n[1] = parseFloat(p, eol);
+        n[2] = parseFloat(p, eol);
+        chunk.norm.emplace_back(n);
+      }
+      else if (oplen == 1 && op[0] == 'f')
+      {
+        // 三角形データ
+        fidx f;
+
+        // スムースシェーディング
+        f.smooth = chunk.smooth;
+
+        // 三頂点のそれぞれについて 頂点座標番号/テクスチャ座標番号/法線番号 を取り出す
+        for (int i = 0; i < 3; ++i)
+        {
+          p = skipSpace(p, eol);
+          f.p[i] = parseInt(p, eol);
+          f.t[i] = f.n[i] = 0;
+          if (p < eol && *p == '/')
+          {
+            f.t[i] = parseInt(++p, eol);
+            if (p < eol && *p == '/') f.n[i] = parseInt(++p, eol);
+          }
+          p = skipToken(p, eol);
+        }
+
+        // 三角形データを登録する
+        chunk.face.emplace_back(f);
+        if (!chunk.smoothSet) ++chunk.inherit;
+      }
+      else if (oplen == 1 && op[0] == 's')
+      {
+        // '1' だったらスムースシェーディング有効
+        const char *const s(skipSpace(p, eol));
+        chunk.smooth = skipToken(s, eol) - s == 1 && *s == '1';
+        chunk.smoothSet = true;
+      }
+      else if (oplen == 6 && memcmp(op, "usemtl", 6) == 0)
+      {
+        // 材質名は次のトークン
+        const char *const s(skipSpace(p, eol));
+        chunk.command.push_back({ true, chunk.face.size(), std::string(s, skipToken(s, eol)) });
+      }
+      else if (oplen == 6 && memcmp(op, "mtllib", 6) == 0)
+      {
+        // MTL ファイルのパス名は行末まで
+        const char *const s(skipSpace(p, eol));
+        chunk.command.push_back({ false, chunk.face.size(), std::string(s, eol) });
+      }
+    }
+  }
+
+  /*
+  ** Alias OBJ 形式のファイルを解析する
+  **
+  **   name Alias OBJ 形式のファイルのファイル名
+  **   group 同じ材質を割り当てるポリゴングループ
+  **   mtl 読み込んだ材質名をキーにした map
+  **   pos 頂点の位置
+  **   norm 頂点の法線
+  **   tex 頂点のテクスチャ座標
+  **   face 三角形のデータ
+  **   mtllib 読み込んだ MTL ファイルのパス名 (nullptr なら記録しない)
+  */
+  static bool ggParseObj(const char *name, std::vector<fgrp> &group,
+    std::vector<GgSimpleShader::Material> &material,
+    std::vector<vec3> &pos, std::vector<vec3> &norm, std::vector<vec2> &tex,
+    std::vector<fidx> &face,
+    bool normalize, std::vector<std::string> *mtllib = nullptr)
+  {
+    // ファイルパスからディレクトリ名を取り出す
+    const std::string path(name);
+    const size_t base(path.find_last_of("/\\"));
+    const std::string dirname((base == std::string::npos) ? "" : path.substr(base + 1));
+
+    // OBJ ファイルをメモリマップする
+    const MappedFile file(name);
+
+    // 読み込みに失敗したら戻る
+    if (!file)
+    {
+#if defined(DEBUG)
+      std::cerr << "Error: Can't open OBJ file: " << path << std::endl;
+#endif
+      return false;
+    }
+
+    // ファイルを行の区切りで分割する数 (1 MB 未満なら分割しない)
+    unsigned int count(std::max(1u, std::thread::hardware_concurrency()));
+    count = static_cast<unsigned int>(std::min<std::size_t>(count, file.size() / 0x100000 + 1));
+
+    // 分割した部分の境界
+    std::vector<const char *> bound(count + 1, file.end());
+    bound[0] = file.begin();
+    for (unsigned int i = 1; i < count; ++i)
+    {
+      const char *p(std::max(bound[i - 1], file.begin() + file.size() / count * i));
+      p = static_cast<const char *>(memchr(p, '\n', file.end() - p));
+      bound[i] = p ? p + 1 : file.end();
+    }
+
+    // 分割した部分を並列に解析する
+    std::vector<ObjChunk> chunk(count);
+    std::vector<std::thread> worker;
+    for (unsigned int i = 1; i < count; ++i)
+      worker.emplace_back(parseObjChunk, bound[i], bound[i + 1], std::ref(chunk[i]));
+    parseObjChunk(bound[0], bound[1], chunk[0]);
+    for (auto &w : worker) w.join();
+
+    // 結果を格納する場所を確保する
+    std::size_t npos(pos.size()), nnorm(norm.size()), ntex(tex.size()), nface(face.size());
+    for (const auto &c : chunk)
+    {
+      npos += c.pos.size();
+      nnorm += c.norm.size();
+      ntex += c.tex.size();
+      nface += c.face.size();
+    }
+    pos.reserve(npos);
+    norm.reserve(nnorm);
+    tex.reserve(ntex);
+    face.reserve(nface);
+
+    // ポリゴングループの最初の三角形番号
+    GLsizei startgroup(static_cast<GLsizei>(group.size()));
+
+    // スムーズシェーディングのスイッチ
+    bool smooth(false);
+
+    // 材質のテーブル
+    std::map<std::string, GLuint> mtl;
+
+    // 現在の材質名
+    std::string mtlname;
+
+    // 座標値の最小値・最大値
+    vec3 bmin{ { FLT_MAX, FLT_MAX, FLT_MAX } }, bmax{ { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
+
+    // 分割した部分の結果をファイル中の順に結合する
+    for (auto &c : chunk)
+    {
+      // この部分の最初の三角形番号
+      const std::size_t base(face.size());
+
+      // 最初の s 命令より前の三角形は直前のスムーズシェーディングの設定に従う
+      for (std::size_t i = 0; i < c.inherit; ++i) c.face[i].smooth = smooth;
+      if (c.smoothSet) smooth = c.smooth;
+
+      // 頂点と三角形を追加する
+      pos.insert(pos.end(), c.pos.begin(), c.pos.end());
+      norm.insert(norm.end(), c.norm.begin(), c.norm.end());
+      tex.insert(tex.end(), c.tex.begin(), c.tex.end());
+      face.insert(face.end(), c.face.begin(), c.face.end());
+
+      // 頂点位置の最小値と最大値を求める (AABB)
+      for (int i = 0; i < 3; ++i)
+      {
+        bmin[i] = std::min(bmin[i], c.bmin[i]);
+        bmax[i] = std::max(bmax[i], c.bmax[i]);
+      }
+
+      // usemtl と mtllib 命令を順に処理する
+      for (const auto &command : c.command)
+      {
+        if (command.usemtl)
+        {
+          // 次のポリゴングループの最初の三角形番号
+          const GLsizei nextgroup(static_cast<GLsizei>(base + command.face));
+
+          // ポリゴングループに三角形が存在すれば
+          if (nextgroup > startgroup)
+          {
+            // ポリゴングループの三角形数と材質番号を記録する
+            group.emplace_back(nextgroup, mtl[mtlname]);
+
+            // 次のポリゴングループの開始番号を保存しておく
+            startgroup = nextgroup;
+          }
+
+          // 次に usemtl が来るまで材質名を保持する
+          mtlname = command.arg;
+
+          // 材質の存在チェック
+          if (mtl.find(mtlname) == mtl.end())
+          {
+#if defined(DEBUG)
+            std::cerr << "Warning: Undefined material: " << mtlname << std::endl;
+#endif
+
+            // デフォルトの材質を割り当てておく
+            mtlname = defaultMaterialName;
+          }
+#if defined(DEBUG)
+          else std::cerr << "usemtl: " << mtlname << std::endl;
+#endif
+        }
+        else
+        {
+          // MTL ファイルを読み込む
+          const std::string mtlpath(dirname + command.arg);
+          ggLoadMtl(mtlpath, mtl, material);
+          if (mtllib) mtllib->push_back(mtlpath);
+        }
+      }
+
+      // 結合した部分のメモリを解放する
+      c = ObjChunk();
+    }
+
+    // 最後のポリゴングループの次の三角形番号
+    const GLsizei nextgroup(static_cast<GLsizei>(face.size()));
+    if (nextgroup > startgroup)
+    {
+      // 最後のポリゴングループの三角形数と材質を記録する
+      group.emplace_back(nextgroup, static_cast<GLuint>(mtl[mtlname]));
+    }
+
+    // スムーズシェーディングしない三角形の頂点を追加する
+    for (auto &f : face)
+    {
+      if (!f.smooth)
+      {
+        // 三頂点のそれぞれについて
+        for (int i = 0; i < 3; ++i)
+        {
+          // 新しい頂点座標を生成する (std::array の要素は emplace_back できない)
+          pos.push_back(pos[f.p[i] - 1]);
+          f.p[i] = static_cast<int>(pos.size());
+
+          if (f.t[i] > 0)
+          {
+            // 新しいテクスチャ座標を生成する
+            tex.push_back(tex[f.t[i] - 1]);
+            f.t[i] = static_cast<int>(tex.size());
+          }
+
+          if (f.n[i] > 0)
+          {
+            // 新しい法線を生成する
+            norm.push_back(norm[f.n[i] - 1]);
+            f.n[i] = static_cast<int>(norm.size());
+          }
+        }
+      }
+    }
+
+    // 法線データがなければ算出しておく
+    if (norm.empty())
+    {
+      // 法線データ数の初期値は頂点数と同じでスムーズシェーディングのために初期値は 0
+      norm.resize(pos.size(), { 0.0f, 0.0f, 0.0f });
+
+      // 面の法線の算出と頂点法線の算出
+      for (auto &f : face)
+      {
+        // 頂点座標番号
+        const int v0(f.p[0] - 1);
+        const int v1(f.p[1] - 1);
+        const int v2(f.p[2] - 1);
+
+        // v1 - v0, v2 - v0 を求める
+        const GLfloat d1[] = { pos[v1][0] - pos[v0][0], pos[v1][1] - pos[v0][1], pos[v1][2] - pos[v0][2] };
+        const GLfloat d2[] = { pos[v2][0] - pos[v0][0], pos[v2][1] - pos[v0][1], pos[v2][2] - pos[v0][2] };
+
+        // 外積により面法線を求める
+        vec3 n;
+        ggCross(n.data(), d1, d2);
+
+        if (f.smooth)
+        {
+          // スムースシェーディングを行うときは
+          for (int i = 0; i < 3; ++i)
+          {
+            // 面法線を頂点法線に積算する
+            norm[v0][i] += n[i];
+            norm[v1][i] += n[i];
+            norm[v2][i] += n[i];
+
+            // 面の各頂点の法線番号は頂点番号と同じにする
+            f.n[i] = f.p[i];
+          }
+        }
+        else
+        {
+          // 面法線を最初の頂点に保存する
+          norm[v0] = n;
+          f.n[0] = f.p[0];
+
+          // 2 頂点追加
+          for (int i = 1; i < 3; ++i)
+          {
+            norm.emplace_back(n);
+            f.n[i] = static_cast<GLuint>(norm.size());
+          }
+        }
+      }
+
+      // 頂点の法線ベクトルを正規化する
+      for (auto &n : norm) ggNormalize3(n.data());
+    }
+
+    // 図形の正規化
+    if (normalize)
+    {
+      // 図形の大きさ
+      const GLfloat sx(bmax[0] - bmin[0]);
+      const GLfloat sy(bmax[1] - bmin[1]);
+      const GLfloat sz(bmax[2] - bmin[2]);
+
+      // 図形のスケール
+      GLfloat s(sx);
+      if (sy > s) s = sy;
+      if (sz > s) s = sz;
+      const GLfloat scale((s != 0.0f) ? 2.0f / s : 1.0f);
+
+      // 図形の中心位置
+      const GLfloat cx((bmax[0] + bmin[0]) * 0.5f);
+      const GLfloat cy((bmax[1] + bmin[1]) * 0.5f);
+      const GLfloat cz((bmax[2] + bmin[2]) * 0.5f);
+
+      // 図形の大きさと位置を正規化する
+      for (auto &p : pos)
+      {
+        p[0] = (p[0] - cx) * scale;
+        p[1] = (p[1] - cy) * scale;
+        p[2] = (p[2] - cz) * scale;
+      }
+    }
+
+#if defined(DEBUG)
+    std::cerr
+      << "[" << name << "]\n(Parsed) Group: " << group.size() << ", Material: " << mtl.size()
+      << ", Pos: " << pos.size() << ", Norm: " << norm.size() << ", Tex: " << tex.size()
+      << ", Face: " << face.size() << "\n";
+#endif
+
+    // OBJ ファイルの読み込み成功
+    return true;
+  }
+}
+// \endcond
+
+/*
+** 三角形分割された Alias OBJ 形式のファイルと MTL ファイルを読み込む (Arrays 形式)
+**
+**   name 読み込むOBJ ファイル名
+**   group 読み込んだデータの各ポリゴングループの最初の三角形番号と三角形数
+**   material 読み込んだデータのポリゴングループごとの材質
+**   vert 読み込んだデータの頂点属性
+**   normalize true ならサイズを正規化する
+**   戻り値 読み込みに成功したら true
+*/
+bool gg::ggLoadSimpleObj(const char *name,
+  std::vector< std::array<GLuint, 3> > &group,
+  std::vector<GgSimpleShader::Material> &material,
+  std::vector<GgVertex> &vert,
+  bool normalize)
+{
+  // OBJ ファイルの読み込みの区間を記録する
+  ggTrace("ggLoadSimpleObj");
+
+  // 読み込み用の一時記憶領域
+  std::vector<fgrp> tgroup;
+  std::vector<vec3> tpos;
+  std::vector<vec3> tnorm;
+  std::vector<vec2> ttex;
+  std::vector<fidx> tface;
+
+  // OBJ ファイルを解析する
+  if (!ggParseObj(name, tgroup, material, tpos, tnorm, ttex, tface, normalize)) return false;
+
+  // 頂点属性データのメモリを確保する
+  vert.reserve(vert.size() + tface.size() * 3);
+
+  // ポリゴングループデータのメモリを確保する
+  group.reserve(group.size() + tgroup.size());
+  material.reserve(material.size() + tgroup.size());
+
+  // ポリゴングループの最初の三角形番号
+  GLuint startgroup(0);
+
+  // ポリゴングループデータの作成
+  for (auto &g : tgroup)
+  {
+    // このポリゴングループの最初の頂点番号と頂点数・材質番号
+    std::array<GLuint, 3> v;
+
+    // このポリゴングループの最初の頂点番号を保存する
+    v[0] = static_cast<GLuint>(vert.size());
+
+    // 三角形ごとの頂点データの作成
+    for (GLuint j = startgroup; j < g.nextgroup; ++j)
+    {
+      // 処理対象の三角形
+      auto &f = tface[j];
+
+      // 三頂点のそれぞれについて
+      for (int i = 0; i < 3; ++i)
+      {
+        // テクスチャ座標
+        vec2 tex = { 0.0f };
+        if (f.t[i] > 0) tex = ttex[f.t[i] - 1];
+
+        // 頂点法線
+        vec3 norm = { 0.0f };
+        if (f.n[i] > 0) norm = tnorm[f.n[i] - 1];
+
+        // 頂点属性の追加
+        vert.emplace_back(tpos[f.p[i] - 1].data(), norm.data());
+      }
+    }
+
+    // このポリゴングループの頂点数を保存する
+    v[1] = static_cast<GLuint>(vert.size()) - v[0];
+    v[2] = g.mtlno;
+
+    // このポリゴングループの最初の頂点番号と頂点数・材質番号を登録する
+    group.emplace_back(v);
+
+    // 次のポリゴングループの最初の三角形番号を求める
+    startgroup = g.nextgroup;
+  }
+
+#if defined(DEBUG)
+  std::cerr
+    << "(Stored) Group: " << group.size() << ", Material: " << material.size()
+    << ", Vertex: " << vert.size() << "\n";
+#endif
+
+  // OBJ ファイルの読み込み成功
+  return true;
+}
+
+/*
+** 三角形分割された Alias OBJ 形式のファイルと MTL ファイルを読み込む (Elements 形式)
+**
+**   name 読み込むOBJ ファイル名
+**   group 読み込んだデータの各ポリゴングループの最初の三角形番号と三角形数
+**   material 読み込んだデータのポリゴングループごとの材質
+**   vert 読み込んだデータの頂点属性
+**   face 読み込んだデータの三角形の頂点インデックス
+**   normalize true ならサイズを正規化する
+**   mtllib 読み込んだ MTL ファイルのパス名を追加する vector のポインタ (nullptr なら追加しない)
+**   戻り値 読み込みに成功したら true
+*/
+bool gg::ggLoadSimpleObj(const char *name,
+  std::vector< std::array<GLuint, 3> > &group,
+  std::vector<GgSimpleShader::Material> &material,
+  std::vector<GgVertex> &vert,
+  std::vector<GLuint> &face,
+  bool normalize,
+  std::vector<std::string> *mtllib)
+{
+  // OBJ ファイルの読み込みの区間を記録する
+  ggTrace("ggLoadSimpleObj");
+
+  // 読み込み用の一時記憶領域
+  std::vector<fgrp> tgroup;
+  std::vector<vec3> tpos;
+  std::vector<vec3> tnorm;
+  std::vector<vec2> ttex;
+  std::vector<fidx> tface;
+
+  // OBJ ファイルを解析する
+  if (!ggParseObj(name, tgroup, material, tpos, tnorm, ttex, tface, normalize, mtllib)) return false;
+
+  // 頂点属性データの最初の頂点番号
+  const int vertbase(static_cast<int>(vert.size()));
+
+  // 頂点属性データのメモリを確保する
+  vert.resize(vertbase + tpos.size());
+
+  // 三角形データのメモリを確保する
+  face.reserve(face.size() + tface.size());
+
+  // ポリゴングループデータのメモリを確保する
+  group.reserve(group.size() + tgroup.size());
+  material.reserve(material.size() + tgroup.size());
+
+  // ポリゴングループの最初の三角形番号
+  GLuint startgroup(0);
+
+  // ポリゴングループデータの作成
+  for (auto &g : tgroup)
+  {
+    // このポリゴングループの最初の頂点番号と頂点数・材質番号
+    std::array<GLuint, 3> v;
+
+    // このポリゴングループの最初の三角形番号を保存する
+    v[0] = static_cast<GLuint>(face.size());
+
+    // 三角形ごとの頂点データの作成
+    for (GLuint j = startgroup; j < g.nextgroup; ++j)
+    {
+      // 処理対象の三角形
+      auto &f = tface[j];
+
+      // 三頂点のそれぞれについて
+      for (int i = 0; i < 3; ++i)
+      {
+        // 追加する三角形データの頂点番号
+        const int q(f.p[i] - 1 + vertbase);
+
+        // 三角形データの追加
+        face.emplace_back(q);
+
+        // テクスチャ座標番号
+        vec2 tex = { 0.0f };
+        if (f.t[i] > 0) tex = ttex[f.t[i] - 1];
+
+        // 頂点法線番号
+        vec3 norm = { 0.0f };
+        if (f.n[i] > 0) norm = tnorm[f.n[i] - 1];
+
+        // 頂点の格納
+        vert[q] = GgVertex(tpos[f.p[i] - 1].data(), norm.data());
+      }
+    }
+
+    // このポリゴングループの三角形数を保存する
+    v[1] = static_cast<GLuint>(face.size()) - v[0];
+    v[2] = g.mtlno;
+
+    // このポリゴングループの最初の三角形番号と三角形数・材質番号を登録する
+    group.emplace_back(v);
+
+    // 次のポリゴングループの最初の三角形番号を求める
+    startgroup = g.nextgroup;
+  }
+
+#if defined(DEBUG)
+  std::cerr
+    << "(Stored) Group: " << group.size() << ", Material: " << material.size()
+    << ", Vertex: " << vert.size() << ", Face: " << face.size() << "\n";
+#endif
+
+  // OBJ ファイルの読み込み成功
+  return true;
+}
+
+// \cond
+/*
+** 形状データの最適化に使う関数
+*/
+namespace gg
+{
+  // 頂点の内容のハッシュ値を求める
+  static std::uint32_t hashVertex(const GgVertex &v)
+  {
+    std::uint32_t word[sizeof v / sizeof(std::uint32_t)];
+    std::memcpy(word, &v, sizeof word);
+    std::uint32_t hash(2166136261u);
+    for (const auto w : word) hash = (hash ^ w) * 16777619u;
+    return hash ^ (hash >> 15);
+  }
+
+  // 内容が同じ頂点を一つにまとめ, 参照されている頂点だけを残す
+  static void weldVertices(std::vector<GgVertex> &vert, std::vector<GLuint> &face)
+  {
+    // 開番地法のハッシュ表 (空きは ~0u)
+    std::size_t size(16);
+    while (size < face.size() * 2) size <<= 1;
+    std::vector<GLuint> table(size, ~0u);
+
+    // まとめた頂点
+    std::vector<GgVertex> welded;
+    welded.reserve(std::min(vert.size(), face.size()));
+
+    for (auto &i : face)
+    {
+      const GgVertex &v(vert[i]);
+
+      // 内容が同じ頂点を探す
+      std::size_t h(hashVertex(v) & (size - 1));
+      while (table[h] != ~0u && std::memcmp(&welded[table[h]], &v, sizeof v) != 0) h = (h + 1) & (size - 1);
+
+      // 見つからなければ追加する
+      if (table[h] == ~0u)
+      {
+        table[h] = static_cast<GLuint>(welded.size());
+        welded.push_back(v);
+      }
+
+      // まとめた頂点を参照する
+      i = table[h];
+    }
+
+    vert.swap(welded);
+  }
+
+  // Tipsify 法でポリゴングループ内の三角形を並べ替える
+  //   source 並べ替える前の頂点インデックス
+  //   offset, adjacency 頂点ごとにその頂点を共有する三角形の番号のリスト
+  //   live, stamp, emitted, time 作業用
+  static void tipsify(std::vector<GLuint> &face, GLuint first, GLuint count, GLuint cache,
+    const std::vector<GLuint> &source, const std::vector<GLuint> &offset, const std::vector<GLuint> &adjacency,
+    std::vector<GLuint> &live, std::vector<GLuint> &stamp, std::vector<char> &emitted, GLuint &time)
+  {
+    // このポリゴングループの頂点インデックスの終わり
+    const GLuint last(first + count);
+
+    // 各頂点を共有する未出力の三角形の数を求め, このポリゴングループの三角形を未出力にする
+    for (GLuint i = first; i < last; ++i) ++live[source[i]];
+    for (GLuint t = first / 3; t < last / 3; ++t) emitted[t] = 0;
+
+    // 最近出力した頂点と次の扇の中心の候補
+    std::vector<GLuint> dead, candidate;
+
+    // 出力先と行き止まりのときに未出力の三角形を探す位置
+    GLuint out(first), cursor(first);
+
+    // 扇の中心の頂点
+    GLuint fan(count > 0 ? source[first] : ~0u);
+
+    while (fan != ~0u)
+    {
+      candidate.clear();
+
+      // 扇の中心の頂点を共有する未出力の三角形を出力する
+      for (GLuint a = offset[fan]; a < offset[fan + 1]; ++a)
+      {
+        const GLuint t(adjacency[a]);
+        if (emitted[t]) continue;
+        emitted[t] = 1;
+
+        for (GLuint k = 0; k < 3; ++k)
+        {
+          const GLuint v(source[t * 3 + k]);
+          face[out++] = v;
+          dead.push_back(v);
+          candidate.push_back(v);
+          --live[v];
+
+          // キャッシュに入っていなければ入れる
+          if (time - stamp[v] > cache) stamp[v] = time++;
+        }
+      }
+
+      // 未出力の三角形が残っていてキャッシュから追い出されない頂点のうち, 最も古いものを次の扇の中心にする
+      fan = ~0u;
+      GLuint best(0);
+      for (const auto v : candidate)
+      {
+        if (live[v] == 0) continue;
+        const GLuint priority(time - stamp[v] + 2 * live[v] <= cache ? time - stamp[v] : 0);
+        if (fan == ~0u || priority > best)
+        {
+          best = priority;
+          fan = v;
+        }
+      }
+
+      if (fan == ~0u)
+      {
+        // 行き止まりなら最近出力した頂点から未出力の三角形が残っているものを探す
+        while (!dead.empty())
+        {
+          const GLuint d(dead.back());
+          dead.pop_back();
+          if (live[d] > 0)
+          {
+            fan = d;
+            break;
+          }
+        }
+
+        // それもなければポリゴングループの頂点インデックスを先頭から探す
+        while (fan == ~0u && cursor < last)
+        {
+          if (live[source[cursor]] > 0) fan = source[cursor];
+          else ++cursor;
+        }
+      }
+    }
+  }
+}
+// \endcond
+
+// \cond
+/*
+** 頂点データの量子化に使う関数
+*/
+namespace gg
+{
+  // 八面体写像した法線を復元する (simple.vert と同じ計算)
+  static void decodeOctahedron(GLbyte ex, GLbyte ey, GLfloat *n)
+  {
+    n[0] = static_cast<GLfloat>(ex) / 127.0f;
+    n[1] = static_cast<GLfloat>(ey) / 127.0f;
+    n[2] = 1.0f - fabs(n[0]) - fabs(n[1]);
+    const GLfloat t(std::max(-n[2], 0.0f));
+    n[0] += n[0] >= 0.0f ? -t : t;
+    n[1] += n[1] >= 0.0f ? -t : t;
+  }
+
+  // 法線を八面体写像して 8 bit に量子化する (復元したときの誤差が最小になるように丸める)
+  static void encodeOctahedron(const GgVector &normal, GLbyte *e)
+  {
+    const GLfloat l1(fabs(normal[0]) + fabs(normal[1]) + fabs(normal[2]));
+    if (l1 <= 0.0f)
+    {
+      e[0] = e[1] = 0;
+      return;
+    }
+
+    // 八面体に投影して下半分を折り返す
+    GLfloat x(normal[0] / l1), y(normal[1] / l1);
+    if (normal[2] < 0.0f)
+    {
+      const GLfloat t(x);
+      x = (1.0f - fabs(y)) * (t >= 0.0f ? 1.0f : -1.0f);
+      y = (1.0f - fabs(t)) * (y >= 0.0f ? 1.0f : -1.0f);
+    }
+
+    // 切り捨てと切り上げの組み合わせのうち元の法線に最も近いものを選ぶ
+    const GLfloat length(ggLength3(normal.data()));
+    const GLfloat fx(floor(x * 127.0f)), fy(floor(y * 127.0f));
+    GLfloat best(-2.0f);
+    for (int i = 0; i < 4; ++i)
+    {
+      const GLbyte qx(static_cast<GLbyte>(std::min(std::max(fx + (i & 1), -127.0f), 127.0f)));
+      const GLbyte qy(static_cast<GLbyte>(std::min(std::max(fy + (i >> 1), -127.0f), 127.0f)));
+      GLfloat n[3];
+      decodeOctahedron(qx, qy, n);
+      const GLfloat d(ggDot3(n, normal.data()) / (ggLength3(n) * length));
+      if (d > best)
+      {
+        best = d;
+        e[0] = qx;
+        e[1] = qy;
+      }
+    }
+  }
+}
+// \endcond
+
+/*
+** 頂点データを量子化する
+**
+**   vert 量子化する GgVertex 型の頂点データ
+**   count 頂点数
+**   compact 量子化した頂点データの格納先
+**   戻り値 量子化した位置を元に戻す係数 (xyz がバウンディングボックスの最小値, w が倍率)
+*/
+gg::GgVector gg::ggCompactVertex(const GgVertex *vert, GLsizei count, std::vector<GgCompactVertex> &compact)
+{
+  compact.resize(count);
+  if (count <= 0) return GgVector{ 0.0f, 0.0f, 0.0f, 1.0f };
+
+  // バウンディングボックスを求める
+  GLfloat bmin[3], bmax[3];
+  for (int k = 0; k < 3; ++k) bmin[k] = bmax[k] = vert[0].position[k];
+  for (GLsizei i = 1; i < count; ++i)
+  {
+    for (int k = 0; k < 3; ++k)
+    {
+      bmin[k] = std::min(bmin[k], vert[i].position[k]);
+      bmax[k] = std::max(bmax[k], vert[i].position[k]);
+    }
+  }
+
+  // 法線の変換が変わらないように全ての軸で同じ倍率を使う
+  const GLfloat extent(std::max(std::max(bmax[0] - bmin[0], bmax[1] - bmin[1]), bmax[2] - bmin[2]));
+  const GLfloat scale(extent > 0.0f ? extent / 65535.0f : 1.0f);
+
+  for (GLsizei i = 0; i < count; ++i)
+  {
+    for (int k = 0; k < 3; ++k)
+    {
+      const GLfloat q(floor((vert[i].position[k] - bmin[k]) / scale + 0.5f));
+      compact[i].position[k] = static_cast<GLushort>(std::min(std::max(q, 0.0f), 65535.0f));
+    }
+    encodeOctahedron(vert[i].normal, compact[i].normal);
+  }
+
+  return GgVector{ bmin[0], bmin[1], bmin[2], scale };
+}
+
+/*
+** 単精度浮動小数点数を半精度浮動小数点数に変換する
+*/
+GLhalf gg::ggHalf(GLfloat f)
+{
+  std::uint32_t x;
+  std::memcpy(&x, &f, sizeof x);
+  const std::uint32_t sign((x >> 16) & 0x8000u);
+  const std::uint32_t a(x & 0x7fffffffu);
+
+  // 無限大と NaN
+  if (a >= 0x7f800000u) return static_cast<GLhalf>(sign | 0x7c00u | (a > 0x7f800000u ? 0x0200u : 0u));
+
+  // 桁あふれ
+  if (a >= 0x477ff000u) return static_cast<GLhalf>(sign | 0x7c00u);
+
+  // 非正規化数
+  if (a < 0x38800000u)
+  {
+    GLfloat v;
+    std::memcpy(&v, &a, sizeof v);
+    return static_cast<GLhalf>(sign | static_cast<std::uint32_t>(std::lrint(v * 16777216.0f)));
+  }
+
+  // 正規化数は指数のバイアスを付け替えて仮数を最近接偶数に丸める
+  return static_cast<GLhalf>(sign | ((a + 0xc8000fffu + ((a >> 13) & 1u)) >> 13));
+}
+
+/*
+** 三角形の頂点インデックスの ACMR を求める
+**
+**   face 三角形の頂点インデックス
+**   count 三角形の頂点数
+**   cache シミュレートする FIFO 頂点キャッシュの大きさ
+**   戻り値 三角形あたりの頂点キャッシュのミス数
+*/
+GLfloat gg::ggAcmr(const GLuint *face, GLsizei count, GLsizei cache)
+{
+  if (count < 3 || cache < 1) return 0.0f;
+
+  // 頂点がキャッシュに入った時刻
+  std::vector<GLuint> stamp(*std::max_element(face, face + count) + 1, 0);
+
+  // 時刻はキャッシュミスのたびに進める
+  const GLuint size(static_cast<GLuint>(cache));
+  GLuint time(size + 1);
+
+  for (GLsizei i = 0; i < count; ++i)
+  {
+    GLuint &s(stamp[face[i]]);
+    if (time - s > size) s = time++;
+  }
+
+  return static_cast<GLfloat>(time - size - 1) * 3.0f / static_cast<GLfloat>(count - count % 3);
+}
+
+/*
+** 三角形分割された形状データ (Elements 形式) を描画用に最適化する
+**
+**   group ポリゴングループごとの最初の頂点インデックスの位置と頂点数・材質番号
+**   vert 頂点属性
+**   face 三角形の頂点インデックス
+**   cache 最適化の対象にする頂点キャッシュの大きさ
+*/
+void gg::ggOptimizeMesh(const std::vector<std::array<GLuint, 3>> &group,
+  std::vector<GgVertex> &vert,
+  std::vector<GLuint> &face,
+  GLsizei cache)
+{
+  // 形状データの最適化の区間を記録する
+  ggTrace("ggOptimizeMesh");
+
+  if (face.size() < 3 || cache < 1) return;
+
+#if defined(DEBUG)
+  // 最適化前の ACMR とメモリ使用量
+  const GLfloat acmr(ggAcmr(face.data(), static_cast<GLsizei>(face.size()), cache));
+  const std::size_t nvert(vert.size());
+  const std::size_t bytes(vert.size() * sizeof(GgVertex) + face.size() * sizeof(GLuint));
+#endif
+
+  // 内容が同じ頂点を一つにまとめる
+  weldVertices(vert, face);
+  const GLuint nv(static_cast<GLuint>(vert.size()));
+
+  // 頂点ごとにその頂点を共有する三角形の番号のリストを作る
+  std::vector<GLuint> offset(nv + 1, 0);
+  for (const auto v : face) ++offset[v + 1];
+  for (GLuint v = 0; v < nv; ++v) offset[v + 1] += offset[v];
+  std::vector<GLuint> adjacency(face.size());
+  {
+    std::vector<GLuint> fill(offset.begin(), offset.end() - 1);
+    for (std::size_t i = 0; i < face.size(); ++i) adjacency[fill[face[i]]++] = static_cast<GLuint>(i / 3);
+  }
+
+  // ポリゴングループごとに三角形を並べ替える (他のポリゴングループの三角形は出力済みとして扱う)
+  const std::vector<GLuint> source(face);
+  std::vector<GLuint> live(nv, 0), stamp(nv, 0);
+  std::vector<char> emitted(face.size() / 3, 1);
+  GLuint time(static_cast<GLuint>(cache) + 1);
+  for (const auto &g : group)
+    tipsify(face, g[0], g[1], static_cast<GLuint>(cache), source, offset, adjacency, live, stamp, emitted, time);
+
+  // 頂点を最初に参照される順に並べ替える
+  std::vector<GLuint> remap(nv, ~0u);
+  std::vector<GgVertex> sorted;
+  sorted.reserve(nv);
+  for (auto &i : face)
+  {
+    if (remap[i] == ~0u)
+    {
+      remap[i] = static_cast<GLuint>(sorted.size());
+      sorted.push_back(vert[i]);
+    }
+    i = remap[i];
+  }
+  vert.swap(sorted);
+
+#if defined(DEBUG)
+  std::cerr
+    << "(Optimized) Vertex: " << nvert << " -> " << vert.size()
+    << ", ACMR: " << acmr << " -> " << ggAcmr(face.data(), static_cast<GLsizei>(face.size()), cache)
+    << ", Memory: " << bytes << " -> "
+    << vert.size() * sizeof(GgVertex) + face.size() * (vert.size() <= 65536 ? sizeof(GLushort) : sizeof(GLuint))
+    << " bytes\n";
+#endif
+}
+
+/*
+** シェーダオブジェクトのコンパイル結果を表示する
+*/
+static GLboolean printShaderInfoLog(GLuint shader, const char *str)
+{
+  // コンパイル結果を取得する
+  GLint status;
+  glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+#if defined(DEBUG)
+  if (status == GL_FALSE) std::cerr << "Compile Error in " << str << std::endl;
+#endif
+
+  // シェーダのコンパイル時のログの長さを取得する
+  GLsizei bufSize;
+  glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &bufSize);
+
+  if (bufSize > 1)
+  {
+    // シェーダのコンパイル時のログの内容を取得する
+    std::vector<GLchar> infoLog(bufSize);
+    GLsizei length;
+    glGetShaderInfoLog(shader, bufSize, &length, &infoLog[0]);
+#if defined(DEBUG)
+    std::cerr << &infoLog[0] << std::endl;
+#endif
+  }
+
+  // コンパイル結果を返す
+  return static_cast<GLboolean>(status);
+}
+
+/*
+** プログラムオブジェクトのリンク結果を表示する
+*/
+static GLboolean printProgramInfoLog(GLuint program)
+{
+  // リンク結果を取得する
+  GLint status;
+  glGetProgramiv(program, GL_LINK_STATUS, &status);
+#if defined(DEBUG)
+  if (status == GL_FALSE) std::cerr << "Link Error." << std::endl;
+#endif
+
+  // シェーダのリンク時のログの長さを取得する
+  GLsizei bufSize;
+  glGetProgramiv(program, GL_INFO_LOG_LENGTH, &bufSize);
+
+  // シェーダのリンク時のログの内容を取得する
+  if (bufSize > 1)
+  {
+    std::vector<GLchar> infoLog(bufSize);
+    GLsizei length;
+    glGetProgramInfoLog(program, bufSize, &length, &infoLog[0]);
+#if defined(DEBUG)
+    std::cerr << &infoLog[0] << std::endl;
+#endif
+  }
+
+  // リンク結果を返す
+  return static_cast<GLboolean>(status);
+}
+
+// \cond
+/*
+** プログラムオブジェクトのバイナリのキャッシュに使うデータと関数
+*/
+namespace gg
+{
+  // キャッシュを保存するディレクトリ (空ならキャッシュを使わない)
+  static std::string shaderCacheDir;
+
+  // キャッシュファイルの識別子と版
+  const char shaderCacheMagic[4] = { 'G', 'G', 'P', 'B' };
+  const std::uint32_t shaderCacheVersion(1);
+
+  // FNV-1a で文字列のハッシュ値を積算する (nullptr と空文字列を区別する)
+  static std::uint64_t hashString(std::uint64_t hash, const char *str)
+  {
+    if (str)
+    {
+      while (*str)
+      {
+        hash ^= static_cast<unsigned char>(*str++);
+        hash *= 1099511628211ULL;
+      }
+    }
+    else
+    {
+      hash ^= 0xff;
+    }
+    return hash * 1099511628211ULL;
+  }
+
+  // キャッシュファイルのパス名を求める (キャッシュを使わなければ空)
+  static std::string shaderCachePath(const char *vsrc, const char *fsrc, const char *gsrc,
+    GLint nvarying, const char *const varyings[])
+  {
+    // キャッシュを使わない
+    if (shaderCacheDir.empty()) return std::string();
+
+    // ドライバがプログラムオブジェクトのバイナリを扱えなければキャッシュを使わない
+    GLint formats(0);
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    if (formats <= 0) return std::string();
+
+    // ソースプログラムとドライバの情報からハッシュ値を求める
+    std::uint64_t hash(14695981039346656037ULL);
+    hash = hashString(hash, vsrc);
+    hash = hashString(hash, fsrc);
+    hash = hashString(hash, gsrc);
+    for (GLint i = 0; i < nvarying; ++i) hash = hashString(hash, varyings[i]);
+    hash = hashString(hash, reinterpret_cast<const char *>(glGetString(GL_VENDOR)));
+    hash = hashString(hash, reinterpret_cast<const char *>(glGetString(GL_RENDERER)));
+    hash = hashString(hash, reinterpret_cast<const char *>(glGetString(GL_VERSION)));
+    hash = hashString(hash, reinterpret_cast<const char *>(glGetString(GL_SHADING_LANGUAGE_VERSION)));
+
+    // ハッシュ値を 16 進数にしてファイル名にする
+    char name[17];
+    snprintf(name, sizeof name, "%016llx", static_cast<unsigned long long>(hash));
+    return shaderCacheDir + "/" + name + ".bin";
+  }
+
+  // キャッシュファイルからプログラムオブジェクトを作成する (できなければ 0)
+  static GLuint loadProgramBinary(const std::string &path)
+  {
+    // キャッシュファイルを開く
+    std::ifstream file(path.c_str(), std::ios::binary);
+    if (!file) return 0;
+
+    // ヘッダを読み込む
+    char magic[4];
+    std::uint32_t version, format, length;
+    file.read(magic, sizeof magic);
+    file.read(reinterpret_cast<char *>(&version), sizeof version);
+    file.read(reinterpret_cast<char *>(&format), sizeof format);
+    file.read(reinterpret_cast<char *>(&length), sizeof length);
+    if (!file || std::memcmp(magic, shaderCacheMagic, sizeof magic) != 0
+      || version != shaderCacheVersion || length == 0) return 0;
+
+    // バイナリを読み込む
+    std::vector<char> binary(length);
+    file.read(binary.data(), length);
+    if (!file) return 0;
+    file.close();
+
+    // バイナリからプログラムオブジェクトを作成する
+    const GLuint program(glCreateProgram());
+    glProgramBinary(program, static_cast<GLenum>(format), binary.data(), static_cast<GLsizei>(length));
+
+    // ドライバがバイナリを受け付けたか調べる
+    GLint status;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status == GL_FALSE)
+    {
+#if defined(DEBUG)
+      std::cerr << "Warning: Program binary rejected: " << path << std::endl;
+#endif
+      // 使えないキャッシュファイルは削除する
+      glDeleteProgram(program);
+      std::remove(path.c_str());
+      return 0;
+    }
+
+    return program;
+  }
+
+  // リンク済みのプログラムオブジェクトのバイナリをキャッシュファイルに保存する
+  static void saveProgramBinary(const std::string &path, GLuint program)
+  {
+    // バイナリの長さを調べる
+    GLint length(0);
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    // バイナリを取り出す
+    std::vector<char> binary(length);
+    GLenum format;
+    glGetProgramBinary(program, length, &length, &format, binary.data());
+
+    // キャッシュファイルに保存する
+    std::ofstream file(path.c_str(), std::ios::binary);
+    if (!file)
+    {
+#if defined(DEBUG)
+      std::cerr << "Warning: Can't open file: " << path << std::endl;
+#endif
+      return;
+    }
+    const std::uint32_t header[] =
+    {
+      shaderCacheVersion, static_cast<std::uint32_t>(format), static_cast<std::uint32_t>(length)
+    };
+    file.write(shaderCacheMagic, sizeof shaderCacheMagic);
+    file.write(reinterpret_cast<const char *>(header), sizeof header);
+    file.write(binary.data(), length);
+  }
+}
+// \endcond
+
+/*
+** プログラムオブジェクトのバイナリのキャッシュを設定する
+**
+**   dir キャッシュを保存するディレクトリ名 (nullptr ならキャッシュを使わない)
+*/
+void gg::ggSetShaderCache(const char *dir)
+{
+  if (dir && *dir)
+  {
+    // キャッシュを保存するディレクトリがなければ作成する
+#if defined(_WIN32)
+    _mkdir(dir);
+#else
+    mkdir(dir, 0755);
+#endif
+    shaderCacheDir = dir;
+  }
+  else
+  {
+    shaderCacheDir.clear();
+  }
+}
+
+/*
+** シェーダのソースプログラムの文字列を読み込んでプログラムオブジェクトを作成する
+**
+**   vsrc バーテックスシェーダのソースプログラムの文字列
+**   fsrc フラグメントシェーダのソースプログラムの文字列 (nullptr なら不使用)
+**   gsrc ジオメトリシェーダのソースプログラムの文字列 (nullptr なら不使用)
+**   nvarying フィードバックする varying 変数の数 (0 なら不使用)
+**   varyings フィードバックする varying 変数のリスト (nullptr なら不使用)
+**   vtext バーテックスシェーダのコンパイル時のメッセージに追加する文字列
+**   ftext フラグメントシェーダのコンパイル時のメッセージに追加する文字列
+**   gtext ジオメトリシェーダのコンパイル時のメッセージに追加する文字列
+**   戻り値 プログラムオブジェクトのプログラム名 (作成できなければ 0)
+*/
+GLuint gg::ggCreateShader(const char *vsrc, const char *fsrc, const char *gsrc,
+  GLint nvarying, const char *const varyings[],
+  const char *vtext, const char *ftext, const char *gtext)
+{
+  // プログラムオブジェクトのバイナリのキャッシュファイル
+  const std::string cache(shaderCachePath(vsrc, fsrc, gsrc, nvarying, varyings));
+
+  // キャッシュが使えればコンパイルせずにそれを使う
+  if (!cache.empty())
+  {
+    const GLuint program(loadProgramBinary(cache));
+    if (program > 0) return program;
+  }
+
+  // シェーダプログラムの作成
+  const GLuint program(glCreateProgram());
+
+  if (program > 0)
+  {
+    bool status = true;
+
+    if (vsrc)
+    {
+      // バーテックスシェーダのシェーダオブジェクトを作成する
+      const GLuint vertShader(glCreateShader(GL_VERTEX_SHADER));
+      glShaderSource(vertShader, 1, &vsrc, nullptr);
+      glCompileShader(vertShader);
+
+      // バーテックスシェーダのシェーダオブジェクトをプログラムオブジェクトに組み込む
+      if (printShaderInfoLog(vertShader, vtext))
+        glAttachShader(program, vertShader);
+      else
+        status = false;
+      glDeleteShader(vertShader);
+    }
+
+    if (fsrc)
+    {
+      // フラグメントシェーダのシェーダオブジェクトを作成する
+      const GLuint fragShader(glCreateShader(GL_FRAGMENT_SHADER));
+      glShaderSource(fragShader, 1, &fsrc, nullptr);
+      glCompileShader(fragShader);
+
+      // フラグメントシェーダのシェーダオブジェクトをプログラムオブジェクトに組み込む
+      if (printShaderInfoLog(fragShader, ftext))
+        glAttachShader(program, fragShader);
+      else
+        status = false;
+      glDeleteShader(fragShader);
+    }
+
+    if (gsrc)
+    {
+      // ジオメトリシェーダのシェーダオブジェクトを作成する
+      const GLuint geomShader(glCreateShader(GL_GEOMETRY_SHADER));
+      glShaderSource(geomShader, 1, &gsrc, nullptr);
+      glCompileShader(geomShader);
+
+      // ジオメトリシェーダのシェーダオブジェクトをプログラムオブジェクトに組み込む
+      if (printShaderInfoLog(geomShader, gtext))
+        glAttachShader(program, geomShader);
+      else
+        status = false;
+      glDeleteShader(geomShader);
+    }
+
+    // feedback に使う varying 変数を指定する
+    if (nvarying > 0)
+      glTransformFeedbackVaryings(program, nvarying, varyings, GL_SEPARATE_ATTRIBS);
+
+    // 全てのシェーダオブジェクトのコンパイルに成功したら
+    if (status)
+    {
+      // キャッシュを使うならリンク結果のバイナリを取り出せるようにする
+      if (!cache.empty()) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+      // シェーダプログラムをリンクする
+      glLinkProgram(program);
+
+      // リンクに成功したら
+      if (printProgramInfoLog(program) != GL_FALSE)
+      {
+        // キャッシュを使うならバイナリを保存する
+        if (!cache.empty()) saveProgramBinary(cache, program);
+
+        // プログラムオブジェクト名を返す
+        return program;
+      }
+    }
+  }
+
+  // プログラムオブジェクトが作成できなかった
+  glDeleteProgram(program);
+  return 0;
+}
+
+/*
+** シェーダのソースファイルを読み込んで #include を展開した文字列を追加する
+**
+**   name ソースファイル名
+**   src 読み込んだソースファイルの文字列の追加先
+**   defines #version の直後に挿入する文字列 (nullptr なら挿入しない)
+**   depth #include の入れ子の深さ
+**   戻り値 読み込みの成功すれば true, 失敗したら false
+*/
+static bool preprocessShaderSource(const std::string &name, std::string &src, const char *defines, int depth)
+{
+  // #include の入れ子が深すぎれば循環しているとみなす
+  if (depth > 16)
+  {
+#if defined(DEBUG)
+    std::cerr << "Error: Too deeply nested #include: " << name << std::endl;
+#endif
+    return false;
+  }
+
+  // ソースファイルを開く
+  std::ifstream file(name.c_str(), std::ios::binary);
+  if (!file)
+  {
+    // ファイルが開けなければエラーで戻る
+#if defined(DEBUG)
+    std::cerr << "Error: Can't open source file: " << name << std::endl;
+#endif
+    return false;
+  }
+
+  // #include のファイル名はこのファイルのあるディレクトリからの相対パスとする
+  const size_t base(name.find_last_of("/\\"));
+  const std::string dirname(base == std::string::npos ? "" : name.substr(0, base + 1));
+
+  // 挿入する文字列をまだ挿入していなければ true
+  bool inject(defines != nullptr && *defines != '\0');
+
+  // 一行読み込み用のバッファ
+  std::string line;
+
+  // 行番号
+  int number(0);
+
+  while (std::getline(file, line))
+  {
+    ++number;
+
+    // 行頭の空白を読み飛ばした位置
+    const size_t head(line.find_first_not_of(" \t"));
+
+    if (head != std::string::npos && line.compare(head, 8, "#include") == 0)
+    {
+      // #include "ファイル名" のファイル名を取り出す
+      const size_t open(line.find('"', head + 8));
+      const size_t close(open == std::string::npos ? open : line.find('"', open + 1));
+      if (close == std::string::npos)
+      {
+#if defined(DEBUG)
+        std::cerr << "Error: Bad #include in " << name << " (" << number << ")" << std::endl;
+#endif
+        return false;
+      }
+
+      // インクルードするファイルを展開する
+      src += "#line 1\n";
+      if (!preprocessShaderSource(dirname + line.substr(open + 1, close - open - 1), src, nullptr, depth + 1))
+        return false;
+
+      // 元のファイルの行番号に戻す
+      src += "#line " + std::to_string(number + 1) + "\n";
+      continue;
+    }
+
+    // 読み込んだ行を追加する
+    src += line;
+    src += '\n';
+
+    // #version の直後に挿入する
+    if (inject && head != std::string::npos && line.compare(head, 8, "#version") == 0)
+    {
+      src += defines;
+      src += "\n#line " + std::to_string(number + 1) + "\n";
+      inject = false;
+    }
+  }
+
+  // ファイルがうまく読み込めなければ戻る
+  if (file.bad())
+  {
+#if defined(DEBUG)
+    std::cerr << "Error: Could not read souce file: " << name << std::endl;
+#endif
+    return false;
+  }
+
+  // #version がなければ先頭に挿入する
+  if (inject) src.insert(0, std::string(defines) + "\n#line 1\n");
+
+  return true;
+}
+
+/*
+** シェーダのソースファイルを読み込んだ vector を返す
+**
+**   name ソースファイル名
+**   src 読み込んだソースファイルの文字列
+**   defines #version の直後に挿入する文字列 (nullptr なら挿入しない)
+**   戻り値 読み込みの成功すれば true, 失敗したら false
+*/
+static bool readShaderSource(const char *name, std::vector<GLchar> &src, const char *defines = nullptr)
+{
+  // ファイル名が nullptr ならそのまま戻る
+  if (name == nullptr) return true;
+
+  // #include を展開して #define を挿入したソースプログラム
+  std::string source;
+  if (!preprocessShaderSource(name, source, defines, 0)) return false;
+
+  // 末尾に '\0' を付けて返す
+  src.assign(source.begin(), source.end());
+  src.push_back('\0');
+  return true;
+}
+
+/*
+** シェーダのソースファイルを読み込んでプログラムオブジェクトを作成する
+**
+**   vert バーテックスシェーダのソースファイル名
+**   frag フラグメントシェーダのソースファイル名 (nullptr なら不使用)
+**   geom ジオメトリシェーダのソースファイル名 (nullptr なら不使用)
+**   nvarying フィードバックする varying 変数の数 (0 なら不使用)
+**   varyings フィードバックする varying 変数のリスト (nullptr なら不使用)
+**   defines 各シェーダの #version の直後に挿入する #define などの文字列 (nullptr なら不使用)
+**   戻り値 シェーダプログラムのプログラム名 (作成できなければ 0)
+*/
+GLuint gg::ggLoadShader(const char *vert, const char *frag, const char *geom,
+  GLint nvarying, const char *const varyings[], const char *defines)
+{
+  // シェーダの読み込みの区間を記録する
+  ggTrace("ggLoadShader");
+
+  // シェーダのソースファイルを読み込む
+  std::vector<GLchar> vsrc, fsrc, gsrc;
+  if (readShaderSource(vert, vsrc, defines) && readShaderSource(frag, fsrc, defines) && readShaderSource(geom, gsrc, defines))
+  {
+    // プログラムオブジェクトを作成する
+    return ggCreateShader(vsrc.data(), fsrc.data(), gsrc.data(), nvarying, varyings, vert, frag, geom);
+  }
+
+  // プログラムオブジェクト作成失敗
+  return 0;
+}
+
+#if !defined(__APPLE__)
+/*
+** コンピュートシェーダのソースプログラムの文字列を読み込んでプログラムオブジェクトを作成する
+**
+**   csrc コンピュートシェーダのソースプログラムの文字列
+**   戻り値 プログラムオブジェクトのプログラム名 (作成できなければ 0)
+*/
+GLuint gg::ggCreateComputeShader(const char *csrc, const char *ctext)
+{
+  // シェーダプログラムの作成
+  const GLuint program(glCreateProgram());
+
+  if (program > 0)
+  {
+    if (csrc)
+    {
+      // コンピュートシェーダのシェーダオブジェクトを作成する
+      const GLuint compShader(glCreateShader(GL_COMPUTE_SHADER));
+      glShaderSource(compShader, 1, &csrc, nullptr);
+      glCompileShader(compShader);
+
+      // コンピュートシェーダのシェーダオブジェクトをプログラムオブジェクトに組み込む
+      if (printShaderInfoLog(compShader, ctext))
+        glAttachShader(program, compShader);
+      glDeleteShader(compShader);
+    }
+
+    // シェーダプログラムをリンクする
+    glLinkProgram(program);
+
+    // プログラムオブジェクトが作成できなければ 0 を返す
+    if (printProgramInfoLog(program) == GL_FALSE)
+    {
+      glDeleteProgram(program);
+      return 0;
+    }
+  }
+
+  // プログラムオブジェクトを返す
+  return program;
+}
+
+/*
+** コンピュートシェーダのソースファイルを読み込んでプログラムオブジェクトを作成する
+**
+**   comp コンピュートシェーダのソースファイル名
+**   戻り値 プログラムオブジェクトのプログラム名 (作成できなければ 0)
+*/
+GLuint gg::ggLoadComputeShader(const char *comp)
+{
+  // シェーダのソースファイルを読み込む
+  std::vector<GLchar> csrc;
+  if (readShaderSource(comp, csrc))
+  {
+    // プログラムオブジェクトを作成する
+    return ggCreateComputeShader(csrc.data(), comp);
+  }
+
+  // プログラムオブジェクト作成失敗
+  return 0;
+}
+#endif
+
+/*
+** 3 要素の長さ
+**
+**   a GLfloat 型の 3 要素の配列
+*/
+GLfloat gg::ggLength3(const GLfloat *a)
+{
+  return sqrt(ggDot3(a, a));
+}
+
+/*
+** 4 要素の長さ
+**
+**   a GLfloat 型の 4 要素の配列
+*/
+GLfloat gg::ggLength4(const GLfloat *a)
+{
+  return sqrt(ggDot4(a, a));
+}
+
+// \cond
+/*
+** 変換行列と四元数の演算に使う SIMD のカーネル
+**
+**   どのカーネルもスカラー版と同じ順序で乗算と加算を行い (FMA は使わない),
+**   スカラー版とビット単位で同じ結果を返す.
+*/
+namespace gg
+{
+#if defined(GG_SIMD_SSE)
+  // 使用する SIMD 命令セット
+  enum SimdLevel { SimdSse, SimdAvx };
+
+  // CPU と OS が対応している SIMD 命令セットを調べる
+  static SimdLevel detectSimd()
+  {
+    // 環境変数 GG_SIMD が sse2 なら AVX を使わない (ベンチマークでの比較用)
+    const char *const env(std::getenv("GG_SIMD"));
+    if (env && std::strcmp(env, "sse2") == 0) return SimdSse;
+
+#  if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+
+    // AVX に対応していて OS が YMM レジスタを保存するなら AVX を使う
+    if ((info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6) return SimdAvx;
+#  else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx")) return SimdAvx;
+#  endif
+    return SimdSse;
+  }
+
+  // 使用する SIMD 命令セット (最初に呼び出したときに調べる)
+  static SimdLevel simdLevel()
+  {
+    static const SimdLevel level(detectSimd());
+    return level;
+  }
+
+  // 行列 a の列 a0～a3 とベクトル b の積
+  static inline __m128 transformSse(__m128 a0, __m128 a1, __m128 a2, __m128 a3, const GLfloat *b)
+  {
+    return _mm_add_ps(_mm_add_ps(_mm_add_ps(
+      _mm_mul_ps(a0, _mm_set1_ps(b[0])),
+      _mm_mul_ps(a1, _mm_set1_ps(b[1]))),
+      _mm_mul_ps(a2, _mm_set1_ps(b[2]))),
+      _mm_mul_ps(a3, _mm_set1_ps(b[3])));
+  }
+
+  // 四元数 p と q の積
+  static inline __m128 quaternionSse(__m128 p, __m128 q)
+  {
+    // x, y, z 要素
+    __m128 t(_mm_sub_ps(
+      _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 0, 2, 1)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 0, 2))),
+      _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 1, 0, 2)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 2, 1)))));
+    t = _mm_add_ps(t, _mm_mul_ps(p, _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 3, 3))));
+    t = _mm_add_ps(t, _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 3, 3)), q));
+
+    // w 要素
+    __m128 w(_mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 3, 3)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 3, 3))));
+    w = _mm_sub_ps(w, _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(0, 0, 0, 0))));
+    w = _mm_sub_ps(w, _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(1, 1, 1, 1))));
+    w = _mm_sub_ps(w, _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 2, 2)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(2, 2, 2, 2))));
+
+    // w 要素だけ差し替える
+    const __m128 mask(_mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0)));
+    return _mm_or_ps(_mm_and_ps(mask, w), _mm_andnot_ps(mask, t));
+  }
+
+  // ベクトル b と c の外積 (w 要素は 0)
+  static inline __m128 crossSse(__m128 b, __m128 c)
+  {
+    const __m128 t(_mm_sub_ps(
+      _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 1, 0, 2))),
+      _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 1, 0, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)))));
+    return _mm_and_ps(_mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)), t);
+  }
+
+  // 行列 a の列 a0～a3 とベクトル b の積を 2 本ずつ求める
+  GG_TARGET_AVX static void projectionAvx(GLfloat *c, const GLfloat *a, const GLfloat *b, std::size_t count)
+  {
+    const __m256 a0(_mm256_broadcast_ps(reinterpret_cast<const __m128 *>(a + 0)));
+    const __m256 a1(_mm256_broadcast_ps(reinterpret_cast<const __m128 *>(a + 4)));
+    const __m256 a2(_mm256_broadcast_ps(reinterpret_cast<const __m128 *>(a + 8)));
+    const __m256 a3(_mm256_broadcast_ps(reinterpret_cast<const __m128 *>(a + 12)));
+
+    for (; count >= 2; count -= 2, b += 8, c += 8)
+    {
+      const __m256 v(_mm256_loadu_ps(b));
+      _mm256_storeu_ps(c, _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+        _mm256_mul_ps(a0, _mm256_permute_ps(v, 0x00)),
+        _mm256_mul_ps(a1, _mm256_permute_ps(v, 0x55))),
+        _mm256_mul_ps(a2, _mm256_permute_ps(v, 0xaa))),
+        _mm256_mul_ps(a3, _mm256_permute_ps(v, 0xff))));
+    }
+
+    // 残り
+    if (count > 0)
+    {
+      _mm_storeu_ps(c, transformSse(_mm256_castps256_ps128(a0), _mm256_castps256_ps128(a1),
+        _mm256_castps256_ps128(a2), _mm256_castps256_ps128(a3), b));
+    }
+
+    // SSE の命令に戻る前に上位のレジスタを片付ける
+    _mm256_zeroupper();
+  }
+
+  // 四元数 p と q の積を 2 つずつ求める
+  GG_TARGET_AVX static void quaternionAvx(GLfloat *r, const GLfloat *p, const GLfloat *q, std::size_t count)
+  {
+    for (; count >= 2; count -= 2, p += 8, q += 8, r += 8)
+    {
+      const __m256 pv(_mm256_loadu_ps(p)), qv(_mm256_loadu_ps(q));
+      const __m256 pw(_mm256_permute_ps(pv, 0xff)), qw(_mm256_permute_ps(qv, 0xff));
+
+      // x, y, z 要素
+      __m256 t(_mm256_sub_ps(
+        _mm256_mul_ps(_mm256_permute_ps(pv, _MM_SHUFFLE(3, 0, 2, 1)), _mm256_permute_ps(qv, _MM_SHUFFLE(3, 1, 0, 2))),
+        _mm256_mul_ps(_mm256_permute_ps(pv, _MM_SHUFFLE(3, 1, 0, 2)), _mm256_permute_ps(qv, _MM_SHUFFLE(3, 0, 2, 1)))));
+      t = _mm256_add_ps(t, _mm256_mul_ps(pv, qw));
+      t = _mm256_add_ps(t, _mm256_mul_ps(pw, qv));
+
+      // w 要素
+      __m256 w(_mm256_mul_ps(pw, qw));
+      w = _mm256_sub_ps(w, _mm256_mul_ps(_mm256_permute_ps(pv, 0x00), _mm256_permute_ps(qv, 0x00)));
+      w = _mm256_sub_ps(w, _mm256_mul_ps(_mm256_permute_ps(pv, 0x55), _mm256_permute_ps(qv, 0x55)));
+      w = _mm256_sub_ps(w, _mm256_mul_ps(_mm256_permute_ps(pv, 0xaa), _mm256_permute_ps(qv, 0xaa)));
+
+      _mm256_storeu_ps(r, _mm256_blend_ps(t, w, 0x88));
+    }
+
+    // 残り
+    if (count > 0)
+    {
+      _mm_storeu_ps(r, quaternionSse(_mm_loadu_ps(p), _mm_loadu_ps(q)));
+    }
+
+    // SSE の命令に戻る前に上位のレジスタを片付ける
+    _mm256_zeroupper();
+  }
+#endif
+
+  // ベクトル列の変換
+  static void projectionArray(GLfloat *c, const GLfloat *a, const GLfloat *b, std::size_t count)
+  {
+#if defined(GG_SIMD_SSE)
+    if (simdLevel() >= SimdAvx) return projectionAvx(c, a, b, count);
+
+    const __m128 a0(_mm_loadu_ps(a + 0));
+    const __m128 a1(_mm_loadu_ps(a + 4));
+    const __m128 a2(_mm_loadu_ps(a + 8));
+    const __m128 a3(_mm_loadu_ps(a + 12));
+
+    for (; count > 0; --count, b += 4, c += 4)
+    {
+      _mm_storeu_ps(c, transformSse(a0, a1, a2, a3, b));
+    }
+#elif defined(GG_SIMD_NEON)
+    const float32x4_t a0(vld1q_f32(a + 0));
+    const float32x4_t a1(vld1q_f32(a + 4));
+    const float32x4_t a2(vld1q_f32(a + 8));
+    const float32x4_t a3(vld1q_f32(a + 12));
+
+    for (; count > 0; --count, b += 4, c += 4)
+    {
+      vst1q_f32(c, vaddq_f32(vaddq_f32(vaddq_f32(
+        vmulq_n_f32(a0, b[0]),
+        vmulq_n_f32(a1, b[1])),
+        vmulq_n_f32(a2, b[2])),
+        vmulq_n_f32(a3, b[3])));
+    }
+#else
+    for (; count > 0; --count, b += 4, c += 4)
+    {
+      // c と b が同じ場所でもいいように b を退避しておく
+      const GLfloat t[] = { b[0], b[1], b[2], b[3] };
+
+      for (int i = 0; i < 4; ++i)
+      {
+        c[i] = a[0 + i] * t[0] + a[4 + i] * t[1] + a[8 + i] * t[2] + a[12 + i] * t[3];
+      }
+    }
+#endif
+  }
+
+  // 四元数列の積
+  static void quaternionArray(GLfloat *r, const GLfloat *p, const GLfloat *q, std::size_t count)
+  {
+#if defined(GG_SIMD_SSE)
+    if (simdLevel() >= SimdAvx) return quaternionAvx(r, p, q, count);
+
+    for (; count > 0; --count, p += 4, q += 4, r += 4)
+    {
+      _mm_storeu_ps(r, quaternionSse(_mm_loadu_ps(p), _mm_loadu_ps(q)));
+    }
+#else
+    // NEON には任意の並べ替えがないのでスカラーで求める
+    for (; count > 0; --count, p += 4, q += 4, r += 4)
+    {
+      // r と p, q が同じ場所でもいいように結果を一旦別に求める
+      const GLfloat t[] =
+      {
+        p[1] * q[2] - p[2] * q[1] + p[0] * q[3] + p[3] * q[0],
+        p[2] * q[0] - p[0] * q[2] + p[1] * q[3] + p[3] * q[1],
+        p[0] * q[1] - p[1] * q[0] + p[2] * q[3] + p[3] * q[2],
+        p[3] * q[3] - p[0] * q[0] - p[1] * q[1] - p[2] * q[2]
+      };
+
+      r[0] = t[0];
+      r[1] = t[1];
+      r[2] = t[2];
+      r[3] = t[3];
+    }
+#endif
+  }
+}
+// \endcond
+
+/*
+** 使用している SIMD 命令セットの名前
+*/
+const char *gg::ggSimd()
+{
+#if defined(GG_SIMD_SSE)
+  return simdLevel() >= SimdAvx ? "avx" : "sse2";
+#elif defined(GG_SIMD_NEON)
+  return "neon";
+#else
+  return "none";
+#endif
+}
+
+/*
+** 変換行列：行列とベクトルの積 c ← a × b
+*/
+void gg::GgMatrix::projection(GLfloat *c, const GLfloat *a, const GLfloat *b) const
+{
+#if defined(GG_SIMD_SSE)
+  _mm_storeu_ps(c, transformSse(_mm_loadu_ps(a + 0), _mm_loadu_ps(a + 4),
+    _mm_loadu_ps(a + 8), _mm_loadu_ps(a + 12), b));
+#else
+  projectionArray(c, a, b, 1);
+#endif
+}
+
+/*
+** 変換行列：行列と行列の積 c ← a × b
+*/
+void gg::GgMatrix::multiply(GLfloat *c, const GLfloat *a, const GLfloat *b) const
+{
+#if defined(GG_SIMD_SSE)
+  const __m128 a0(_mm_loadu_ps(a + 0));
+  const __m128 a1(_mm_loadu_ps(a + 4));
+  const __m128 a2(_mm_loadu_ps(a + 8));
+  const __m128 a3(_mm_loadu_ps(a + 12));
+
+  for (int k = 0; k < 16; k += 4)
+  {
+    _mm_storeu_ps(c + k, transformSse(a0, a1, a2, a3, b + k));
+  }
+#elif defined(GG_SIMD_NEON)
+  projectionArray(c, a, b, 4);
+#else
+  for (int i = 0; i < 16; ++i)
+  {
+    int j = i & 3, k = i & ~3;
+
+    c[i] = a[0 + j] * b[k + 0] + a[4 + j] * b[k + 1] + a[8 + j] * b[k + 2] + a[12 + j] * b[k + 3];
+  }
+#endif
+}
+
+/*
+** 変換行列：ベクトルの配列 b の各要素に行列 a をかけて c に求める
+*/
+void gg::GgMatrix::projection(GgVector *c, const GgVector *b, std::size_t count) const
+{
+  projectionArray(c->data(), array.data(), b->data(), count);
+}
+
+/*
+** 変換行列：単位行列を設定する
+*/
+gg::GgMatrix &gg::GgMatrix::loadIdentity()
+{
+  array[ 1] = array[ 2] = array[ 3] = array[ 4] =
+  array[ 6] = array[ 7] = array[ 8] = array[ 9] =
+  array[11] = array[12] = array[13] = array[14] = 0.0f;
+  array[ 0] = array[ 5] = array[10] = array[15] = 1.0f;
+
+  return *this;
+}
+
+/*
+** 変換行列：平行移動変換行列を設定する
+*/
+gg::GgMatrix &gg::GgMatrix::loadTranslate(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+  array[12] = x;
+  array[13] = y;
+  array[14] = z;
+  array[ 0] = array[ 5] = array[10] = array[15] = w;
+  array[ 1] = array[ 2] = array[ 3] = array[ 4] =
+  array[ 6] = array[ 7] = array[ 8] = array[ 9] =
+  array[ 11] = 0.0f;
+
+  return *this;
+}
+
+/*
+** 変換行列：拡大縮小変換行列を設定する
+*/
+gg::GgMatrix &gg::GgMatrix::loadScale(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+  array[ 0] = x;
+  array[ 5] = y;
+  array[10] = z;
+  array[15] = w;
+  array[ 1] = array[ 2] = array[ 3] = array[ 4] =
+  array[ 6] = array[ 7] = array[ 8] = array[ 9] =
+  array[11] = array[12] = array[13] = array[14] = 0.0f;
+
+  return *this;
+}
+
+/*
+** 変換行列：x 軸中心の回転変換行列を設定する
+*/
+gg::GgMatrix &gg::GgMatrix::loadRotateX(GLfloat a)
+{
+  const GLfloat c(cos(a));
+  const GLfloat s(sin(a));
+
+  array[ 0] = 1.0f; array[ 1] = 0.0f; array[ 2] = 0.0f; array[ 3] = 0.0f;
+  array[ 4] = 0.0f; array[ 5] = c;    array[ 6] = s;    array[ 7] = 0.0f;
+  array[ 8] = 0.0f; array[ 9] = -s;   array[10] = c;    array[11] = 0.0f;
+  array[12] = 0.0f; array[13] = 0.0f; array[14] = 0.0f; array[15] = 1.0f;
+
+  return *this;
+}
+
+/*
+** 変換行列：y 軸中心の回転変換行列を設定する
+*/
+gg::GgMatrix &gg::GgMatrix::loadRotateY(GLfloat a)
+{
+  const GLfloat c(cos(a));
+  const GLfloat s(sin(a));
+
+  array[ 0] = c;    array[ 1] = 0.0f; array[ 2] = -s;   array[ 3] = 0.0f;
+  array[ 4] = 0.0f; array[ 5] = 1.0f; array[ 6] = 0.0f; array[ 7] = 0.0f;
+  array[ 8] = s;    array[ 9] = 0.0f; array[10] = c;    array[11] = 0.0f;
+  array[12] = 0.0f; array[13] = 0.0f; array[14] = 0.0f; array[15] = 1.0f;
+
+  return *this;
+}
+
+/*
+** 変換行列：z 軸中心の回転変換行列を設定する
+*/
+gg::GgMatrix &gg::GgMatrix::loadRotateZ(GLfloat a)
+{
+  const GLfloat c(cos(a));
+  const GLfloat s(sin(a));
+
+  array[ 0] = c;    array[ 1] = s;    array[ 2] = 0.0f; array[ 3] = 0.0f;
+  array[ 4] = -s;   array[ 5] = c;    array[ 6] = 0.0f; array[ 7] = 0.0f;
+  array[ 8] = 0.0f; array[ 9] = 0.0f; array[10] = 1.0f; array[11] = 0.0f;
+  array[12] = 0.0f; array[13] = 0.0f; array[14] = 0.0f; array[15] = 1.0f;
+
+  return *this;
+}
+
+/*
+** 変換行列：任意軸中心の回転変換行列を設定する
+*/
+gg::GgMatrix &gg::GgMatrix::loadRotate(GLfloat x, GLfloat y, GLfloat z, GLfloat a)
+{
+  const GLfloat d(sqrt(x * x + y * y + z * z));
+
+  if (d > 0.0f)
+  {
+    const GLfloat l(x / d), m(y / d), n(z / d);
+    const GLfloat l2(l * l), m2(m * m), n2(n * n);
+    const GLfloat lm(l * m), mn(m * n), nl(n * l);
+    const GLfloat c(cos(a)), c1(1.0f - c);
+    const GLfloat s(sin(a));
+
+    array[ 0] = (1.0f - l2) * c + l2;
+    array[ 1] = lm * c1 + n * s;
+    array[ 2] = nl * c1 - m * s;
+    array[ 3] = 0.0f;
+
+    array[ 4] = lm * c1 - n * s;
+    array[ 5] = (1.0f - m2) * c + m2;
+    array[ 6] = mn * c1 + l * s;
+    array[ 7] = 0.0f;
+
+    array[ 8] = nl * c1 + m * s;
+    array[ 9] = mn * c1 - l * s;
+    array[10] = (1.0f - n2) * c + n2;
+    array[11] = 0.0f;
+
+    array[12] = 0.0f;
+    array[13] = 0.0f;
+    array[14] = 0.0f;
+    array[15] = 1.0f;
+  }
+
+  return *this;
+}
+
+/*
+** 変換行列：転置行列を設定する
+*/
+gg::GgMatrix &gg::GgMatrix::loadTranspose(const GLfloat *marray)
+{
+  array[ 0] = marray[ 0];
+  array[ 1] = marray[ 4];
+  array[ 2] = marray[ 8];
+  array[ 3] = marray[12];
+  array[ 4] = marray[ 1];
+  array[ 5] = marray[ 5];
+  array[ 6] = marray[ 9];
+  array[ 7] = marray[13];
+  array[ 8] = marray[ 2];
+  array[ 9] = marray[ 6];
+  array[10] = marray[10];
+  array[11] = marray[14];
+  array[12] = marray[ 3];
+  array[13] = marray[ 7];
+  array[14] = marray[11];
+  array[15] = marray[15];
+
+  return *this;
+}
+
+/*
+** 変換行列：逆行列を設定する
+*/
+gg::GgMatrix &gg::GgMatrix::loadInvert(const GLfloat *marray)
+{
+  GLfloat lu[20], *plu[4];
+
+  // j 行の要素の値の絶対値の最大値を plu[j][4] に求める
+  for (int j = 0; j < 4; ++j)
+  {
+    GLfloat max(fabs(*(plu[j] = lu + 5 * j) = *(marray++)));
+
+    for (int i = 0; ++i < 4;)
+    {
+      GLfloat a(fabs(plu[j][i] = *(marray++)));
+      if (a > max) max = a;
+    }
+    if (max == 0.0f) return *this;
+    plu[j][4] = 1.0f / max;
+  }
+
+  // ピボットを考慮した LU 分解
+  for (int j = 0; j < 4; ++j)
+  {
+    GLfloat max(fabs(plu[j][j] * plu[j][4]));
+    int i = j;
+
+    for (int k = j; ++k < 4;)
+    {
+      GLfloat a(fabs(plu[k][j] * plu[k][4]));
+      if (a > max)
+      {
+        max = a;
+        i = k;
+      }
+    }
+    if (i > j)
+    {
+      GLfloat *t(plu[j]);
+      plu[j] = plu[i];
+      plu[i] = t;
+    }
+    if (plu[j][j] == 0.0f) return *this;
+    for (int k = j; ++k < 4;)
+    {
+      plu[k][j] /= plu[j][j];
+      for (int i = j; ++i < 4;)
+      {
+        plu[k][i] -= plu[j][i] * plu[k][j];
+      }
+    }
+  }
+
+  // LU 分解から逆行列を求める
+  for (int k = 0; k < 4; ++k)
+  {
+    // array に単位行列を設定する
+    for (int i = 0; i < 4; ++i)
+    {
+      array[i * 4 + k] = (plu[i] == lu + k * 5) ? 1.0f : 0.0f;
+    }
+    // lu から逆行列を求める
+    for (int i = 0; i < 4; ++i)
+    {
+      for (int j = i; ++j < 4;)
+      {
+        array[j * 4 + k] -= array[i * 4 + k] * plu[j][i];
+      }
+    }
+    for (int i = 4; --i >= 0;)
+    {
+      for (int j = i; ++j < 4;)
+      {
+        array[i * 4 + k] -= plu[i][j] * array[j * 4 + k];
+      }
+      array[i * 4 + k] /= plu[i][i];
+    }
+  }
+
+  return *this;
+}
+
+/*
+** 変換行列：法線変換行列を設定する
+*/
+gg::GgMatrix &gg::GgMatrix::loadNormal(const GLfloat *marray)
+{
+#if defined(GG_SIMD_SSE)
+  const __m128 m0(_mm_loadu_ps(marray + 0));
+  const __m128 m1(_mm_loadu_ps(marray + 4));
+  const __m128 m2(_mm_loadu_ps(marray + 8));
+
+  _mm_storeu_ps(array.data() + 0, crossSse(m1, m2));
+  _mm_storeu_ps(array.data() + 4, crossSse(m2, m0));
+  _mm_storeu_ps(array.data() + 8, crossSse(m0, m1));
+  _mm_storeu_ps(array.data() + 12, _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f));
+#else
+  array[ 0] = marray[ 5] * marray[10] - marray[ 6] * marray[ 9];
+  array[ 1] = marray[ 6] * marray[ 8] - marray[ 4] * marray[10];
+  array[ 2] = marray[ 4] * marray[ 9] - marray[ 5] * marray[ 8];
+  array[ 4] = marray[ 9] * marray[ 2] - marray[10] * marray[ 1];
+  array[ 5] = marray[10] * marray[ 0] - marray[ 8] * marray[ 2];
+  array[ 6] = marray[ 8] * marray[ 1] - marray[ 9] * marray[ 0];
+  array[ 8] = marray[ 1] * marray[ 6] - marray[ 2] * marray[ 5];
+  array[ 9] = marray[ 2] * marray[ 4] - marray[ 0] * marray[ 6];
+  array[10] = marray[ 0] * marray[ 5] - marray[ 1] * marray[ 4];
+  array[ 3] = array[ 7] = array[11] = array[12] = array[13] = array[14] = 0.0f;
+  array[15] = 1.0f;
+#endif
+
+  return *this;
+}
+
+/*
+** 変換行列：変換行列 a と b の積の法線変換行列を設定する
+*/
+gg::GgMatrix &gg::GgMatrix::loadNormal(const GgMatrix &a, const GgMatrix &b)
+{
+  const GLfloat *const aarray(a.array.data());
+  const GLfloat *const barray(b.array.data());
+
+  GLfloat m[12];
+
+#if defined(GG_SIMD_SSE) || defined(GG_SIMD_NEON)
+  // 積の第 0～2 列だけ求める
+  projectionArray(m, aarray, barray, 3);
+#else
+  // 積の左上 3×3 の部分だけ求める
+  for (int i = 0; i < 12; ++i)
+  {
+    int j = i & 3, k = i & ~3;
+
+    m[i] = j == 3 ? 0.0f
+      : aarray[0 + j] * barray[k + 0] + aarray[4 + j] * barray[k + 1] + aarray[8 + j] * barray[k + 2] + aarray[12 + j] * barray[k + 3];
+  }
+#endif
+
+  return loadNormal(m);
+}
+
+/*
+** 変換行列：ビュー変換行列を設定する
+*/
+gg::GgMatrix &gg::GgMatrix::loadLookat(GLfloat ex, GLfloat ey, GLfloat ez,
+  GLfloat tx, GLfloat ty, GLfloat tz,
+  GLfloat ux, GLfloat uy, GLfloat uz)
+{
+  // z 軸 = e - t
+  const GLfloat zx(ex - tx);
+  const GLfloat zy(ey - ty);
+  const GLfloat zz(ez - tz);
+
+  // x 軸 = u x z 軸
+  const GLfloat xx(uy * zz - uz * zy);
+  const GLfloat xy(uz * zx - ux * zz);
+  const GLfloat xz(ux * zy - uy * zx);
+
+  // y 軸 = z 軸 x x 軸
+  const GLfloat yx(zy * xz - zz * xy);
+  const GLfloat yy(zz * xx - zx * xz);
+  const GLfloat yz(zx * xy - zy * xx);
+
+  // y 軸の長さをチェック
+  GLfloat y(yx * yx + yy * yy + yz * yz);
+  if (y == 0.0f) return *this;
+
+  // x 軸の正規化
+  const GLfloat x(sqrt(xx * xx + xy * xy + xz * xz));
+  array[ 0] = xx / x;
+  array[ 4] = xy / x;
+  array[ 8] = xz / x;
+
+  // y 軸の正規化
+  y = sqrt(y);
+  array[ 1] = yx / y;
+  array[ 5] = yy / y;
+  array[ 9] = yz / y;
+
+  // z 軸の正規化
+  const GLfloat z(sqrt(zx * zx + zy * zy + zz * zz));
+  array[ 2] = zx / z;
+  array[ 6] = zy / z;
+  array[10] = zz / z;
+
+  // 平行移動
+  array[12] = -(ex * array[ 0] + ey * array[ 4] + ez * array[ 8]);
+  array[13] = -(ex * array[ 1] + ey * array[ 5] + ez * array[ 9]);
+  array[14] = -(ex * array[ 2] + ey * array[ 6] + ez * array[10]);
+
+  // 残り
+  array[ 3] = array[ 7] = array[11] = 0.0f;
+  array[15] = 1.0f;
+
+  return *this;
+}
+
+/*
+** 変換行列：平行投影変換行列を設定する
+*/
+gg::GgMatrix &gg::GgMatrix::loadOrthogonal(GLfloat left, GLfloat right,
+  GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
+{
+  const GLfloat dx(right - left);
+  const GLfloat dy(top - bottom);
+  const GLfloat dz(zFar - zNear);
+
+  if (dx != 0.0f && dy != 0.0f && dz != 0.0f)
+  {
+    array[ 0] = 2.0f / dx;
+    array[ 5] = 2.0f / dy;
+    array[10] = -2.0f / dz;
+    array[12] = -(right + left) / dx;
+    array[13] = -(top + bottom) / dy;
+    array[14] = -(zFar + zNear) / dz;
+    array[15] = 1.0f;
+    array[ 1] = array[ 2] = array[ 3] = array[ 4] =
+    array[ 6] = array[ 7] = array[ 8] = array[ 9] =
+    array[11] = 0.0f;
+  }
+
+  return *this;
+}
+
+/*
+** 変換行列：透視投影変換行列を設定する
+*/
+gg::GgMatrix &gg::GgMatrix::loadFrustum(GLfloat left, GLfloat right,
+  GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
+{
+  const GLfloat dx(right - left);
+  const GLfloat dy(top - bottom);
+  const GLfloat dz(zFar - zNear);
+
+  if (dx != 0.0f && dy != 0.0f && dz != 0.0f)
+  {
+    array[ 0] = 2.0f * zNear / dx;
+    array[ 5] = 2.0f * zNear / dy;
+    array[ 8] = (right + left) / dx;
+    array[ 9] = (top + bottom) / dy;
+    array[10] = -(zFar + zNear) / dz;
+    array[11] = -1.0f;
+    array[14] = -2.0f * zFar * zNear / dz;
+    array[ 1] = array[ 2] = array[ 3] = array[ 4] =
+    array[ 6] = array[ 7] = array[12] = array[13] =
+    array[15] = 0.0f;
+  }
+
+  return *this;
+}
+
+/*
+** 変換行列：画角から透視投影変換行列を設定する
+*/
+gg::GgMatrix &gg::GgMatrix::loadPerspective(GLfloat fovy, GLfloat aspect,
+  GLfloat zNear, GLfloat zFar)
+{
+  const GLfloat dz(zFar - zNear);
+
+  if (dz != 0.0f)
+  {
+    array[ 5] = 1.0f / tan(fovy * 0.5f);
+    array[ 0] = array[5] / aspect;
+    array[10] = -(zFar + zNear) / dz;
+    array[11] = -1.0f;
+    array[14] = -2.0f * zFar * zNear / dz;
+    array[ 1] = array[ 2] = array[ 3] = array[ 4] =
+    array[ 6] = array[ 7] = array[ 8] = array[ 9] =
+    array[12] = array[13] = array[15] = 0.0f;
+  }
+
+  return *this;
+}
+
+/*
+** 四元数：GgQuaternion 型の四元数 p, q の積を r に求める
+*/
+void gg::GgQuaternion::multiply(GLfloat *r, const GLfloat *p, const GLfloat *q) const
+{
+#if defined(GG_SIMD_SSE)
+  _mm_storeu_ps(r, quaternionSse(_mm_loadu_ps(p), _mm_loadu_ps(q)));
+#else
+  r[0] = p[1] * q[2] - p[2] * q[1] + p[0] * q[3] + p[3] * q[0];
+  r[1] = p[2] * q[0] - p[0] * q[2] + p[1] * q[3] + p[3] * q[1];
+  r[2] = p[0] * q[1] - p[1] * q[0] + p[2] * q[3] + p[3] * q[2];
+  r[3] = p[3] * q[3] - p[0] * q[0] - p[1] * q[1] - p[2] * q[2];
+#endif
+}
+
+/*
+** 四元数：GgQuaternion 型の四元数 q が表す変換行列を m に求める
+*/
+void gg::GgQuaternion::toMatrix(GLfloat *m, const GLfloat *q) const
+{
+  const GLfloat xx(q[0] * q[0] * 2.0f);
+  const GLfloat yy(q[1] * q[1] * 2.0f);
+  const GLfloat zz(q[2] * q[2] * 2.0f);
+  const GLfloat xy(q[0] * q[1] * 2.0f);
+  const GLfloat yz(q[1] * q[2] * 2.0f);
+  const GLfloat zx(q[2] * q[0] * 2.0f);
+  const GLfloat xw(q[0] * q[3] * 2.0f);
+  const GLfloat yw(q[1] * q[3] * 2.0f);
+  const GLfloat zw(q[2] * q[3] * 2.0f);
+
+  m[ 0] = 1.0f - yy - zz;
+  m[ 1] = xy + zw;
+  m[ 2] = zx - yw;
+  m[ 4] = xy - zw;
+  m[ 5] = 1.0f - zz - xx;
+  m[ 6] = yz + xw;
+  m[ 8] = zx + yw;
+  m[ 9] = yz - xw;
+  m[10] = 1.0f - xx - yy;
+  m[ 3] = m[ 7] = m[11] = m[12] = m[13] = m[14] = 0.0f;
+  m[15] = 1.0f;
+}
+
+/*
+** 四元数：回転変換行列 a が表す四元数を q に求める
+*/
+void gg::GgQuaternion::toQuaternion(GLfloat *q, const GLfloat *a) const
+{
+  const GLfloat tr(a[0] + a[5] + a[10] + a[15]);
+
+  if (tr > 0.0f)
+  {
+    q[3] = sqrt(tr) * 0.5f;
+    q[0] = (a[6] - a[9]) * 0.25f / q[3];
+    q[1] = (a[8] - a[2]) * 0.25f / q[3];
+    q[2] = (a[1] - a[4]) * 0.25f / q[3];
+  }
+}
+
+/*
+** 四元数：球面線形補間 p に q と r を t で補間した四元数を求める
+*/
+void gg::GgQuaternion::slerp(GLfloat *p, const GLfloat *q, const GLfloat *r, GLfloat t) const
+{
+  const GLfloat qr(ggDot3(q, r));
+  const GLfloat ss(1.0f - qr * qr);
+
+  if (ss == 0.0f)
+  {
+    if (p != q)
+    {
+      p[0] = q[0];
+      p[1] = q[1];
+      p[2] = q[2];
+      p[3] = q[3];
+    }
+  }
+  else
+  {
+    const GLfloat sp(sqrt(ss));
+    const GLfloat ph(acos(qr));
+    const GLfloat pt(ph * t);
+    const GLfloat t1(sin(pt) / sp);
+    const GLfloat t0(sin(ph - pt) / sp);
+
+    p[0] = q[0] * t0 + r[0] * t1;
+    p[1] = q[1] * t0 + r[1] * t1;
+    p[2] = q[2] * t0 + r[2] * t1;
+    p[3] = q[3] * t0 + r[3] * t1;
+  }
+}
+
+/*
+** 四元数：四元数の配列 p と q の要素ごとの積を r に求める
+*/
+void gg::ggMultiplyQuaternion(GgQuaternion *r, const GgQuaternion *p, const GgQuaternion *q, std::size_t count)
+{
+  quaternionArray(r->quaternion.data(), p->quaternion.data(), q->quaternion.data(), count);
+}
 
-        // 外積により面法線を求める
-        vec3 n;
-        ggCross(n.data(), d1, d2);
+/*
+** 四元数：四元数の配列 p と q の要素ごとに t で球面線形補間した四元数を r に求める
+*/
+void gg::ggSlerpQuaternion(GgQuaternion *r, const GgQuaternion *p, const GgQuaternion *q, GLfloat t, std::size_t count)
+{
+  // 三角関数が処理の大半を占めるので要素ごとにスカラーで求める
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    r[i].slerp(r[i].quaternion.data(), p[i].quaternion.data(), q[i].quaternion.data(), t);
+  }
+}
 
-        if (f.smooth)
-        {
-          // スムースシェーディングを行うときは
-          for (int i = 0; i < 3; ++i)
-          {
-            // 面法線を頂点法線に積算する
-            norm[v0][i] += n[i];
-            norm[v1][i] += n[i];
-            norm[v2][i] += n[i];
+/*
+** 四元数：(x, y, z) を軸とし角度 a 回転する四元数を求める
+*/
+gg::GgQuaternion &gg::GgQuaternion::loadRotate(GLfloat x, GLfloat y, GLfloat z, GLfloat a)
+{
+  const GLfloat l(x * x + y * y + z * z);
 
-            // 面の各頂点の法線番号は頂点番号と同じにする
-            f.n[i] = f.p[i];
-          }
-        }
-        else
-        {
-          // 面法線を最初の頂点に保存する
-          norm[v0] = n;
-          f.n[0] = f.p[0];
+  if (l != 0.0)
+  {
+    GLfloat s(sin(a *= 0.5f) / sqrt(l));
 
-          // 2 頂点追加
-          for (int i = 1; i < 3; ++i)
-          {
-            norm.emplace_back(n);
-            f.n[i] = static_cast<GLuint>(norm.size());
-          }
-        }
-      }
+    quaternion[0] = x * s;
+    quaternion[1] = y * s;
+    quaternion[2] = z * s;
+  }
+  else
+  {
+    quaternion[0] = quaternion[1] = quaternion[2] = 0.0f;
+  }
+  quaternion[3] = cos(a);
 
-      // 頂点の法線ベクトルを正規化する
-      for (auto &n : norm) ggNormalize3(n.data());
-    }
+  return *this;
+}
 
-    // 図形の正規化
-    if (normalize)
-    {
-      // 図形の大きさ
-      const GLfloat sx(bmax[0] - bmin[0]);
-      const GLfloat sy(bmax[1] - bmin[1]);
-      const GLfloat sz(bmax[2] - bmin[2]);
+/*
+** x 軸中心に角度 a 回転する四元数を格納する
+*/
+gg::GgQuaternion &gg::GgQuaternion::loadRotateX(GLfloat a)
+{
+  const GLfloat t(a * 0.5f);
 
-      // 図形のスケール
-      GLfloat s(sx);
-      if (sy > s) s = sy;
-      if (sz > s) s = sz;
-      const GLfloat scale((s != 0.0f) ? 2.0f / s : 1.0f);
+  quaternion[0] = sin(t);
+  quaternion[3] = cos(t);
+  quaternion[1] = quaternion[2] = 0.0f;
 
-      // 図形の中心位置
-      const GLfloat cx((bmax[0] + bmin[0]) * 0.5f);
-      const GLfloat cy((bmax[1] + bmin[1]) * 0.5f);
-      const GLfloat cz((bmax[2] + bmin[2]) * 0.5f);
+  return *this;
+}
 
-      // 図形の大きさと位置を正規化する
-      for (auto &p : pos)
-      {
-        p[0] = (p[0] - cx) * scale;
-        p[1] = (p[1] - cy) * scale;
-        p[2] = (p[2] - cz) * scale;
-      }
-    }
+/*
+** y 軸中心に角度 a 回転する四元数を格納する
+*/
+gg::GgQuaternion &gg::GgQuaternion::loadRotateY(GLfloat a)
+{
+  const GLfloat t(a * 0.5f);
 
-#if defined(DEBUG)
-    std::cerr
-      << "[" << name << "]\n(Parsed) Group: " << group.size() << ", Material: " << mtl.size()
-      << ", Pos: " << pos.size() << ", Norm: " << norm.size() << ", Tex: " << tex.size()
-      << ", Face: " << face.size() << "\n";
-#endif
+  quaternion[1] = sin(t);
+  quaternion[3] = cos(t);
+  quaternion[0] = quaternion[2] = 0.0f;
 
-    // OBJ ファイルの読み込み成功
-    return true;
-  }
+  return *this;
 }
-// \endcond
 
 /*
-** 三角形分割された Alias OBJ 形式のファイルと MTL ファイルを読み込む (Arrays 形式)
-**
-**   name 読み込むOBJ ファイル名
-**   group 読み込んだデータの各ポリゴングループの最初の三角形番号と三角形数
-**   material 読み込んだデータのポリゴングループごとの材質
-**   vert 読み込んだデータの頂点属性
-**   normalize true ならサイズを正規化する
-**   戻り値 読み込みに成功したら true
+** z 軸中心に角度 a 回転する四元数を格納する
 */
-bool gg::ggLoadSimpleObj(const char *name,
-  std::vector< std::array<GLuint, 3> > &group,
-  std::vector<GgSimpleShader::Material> &material,
-  std::vector<GgVertex> &vert,
-  bool normalize)
+gg::GgQuaternion &gg::GgQuaternion::loadRotateZ(GLfloat a)
 {
-  // 読み込み用の一時記憶領域
-  std::vector<fgrp> tgroup;
-  std::vector<vec3> tpos;
-  std::vector<vec3> tnorm;
-  std::vector<vec2> ttex;
-  std::vector<fidx> tface;
+  const GLfloat t(a * 0.5f);
 
-  // OBJ ファイルを解析する
-  if (!ggParseObj(name, tgroup, material, tpos, tnorm, ttex, tface, normalize)) return false;
+  quaternion[2] = sin(t);
+  quaternion[3] = cos(t);
+  quaternion[0] = quaternion[1] = 0.0f;
 
-  // 頂点属性データのメモリを確保する
-  vert.reserve(vert.size() + tface.size() * 3);
+  return *this;
+}
 
-  // ポリゴングループデータのメモリを確保する
-  group.reserve(group.size() + tgroup.size());
-  material.reserve(material.size() + tgroup.size());
+/*
+** 四元数：オイラー角 (heading, pitch, roll) にもとづいて四元数を求める
+*/
+gg::GgQuaternion &gg::GgQuaternion::loadEuler(GLfloat heading, GLfloat pitch, GLfloat roll)
+{
+  GgQuaternion h, p, r;
 
-  // ポリゴングループの最初の三角形番号
-  GLuint startgroup(0);
+  h.loadRotateY(heading);
+  p.loadRotateX(pitch);
+  r.loadRotateZ(roll);
 
-  // ポリゴングループデータの作成
-  for (auto &g : tgroup)
-  {
-    // このポリゴングループの最初の頂点番号と頂点数・材質番号
-    std::array<GLuint, 3> v;
+  *this = h * p * r;
 
-    // このポリゴングループの最初の頂点番号を保存する
-    v[0] = static_cast<GLuint>(vert.size());
+  return *this;
+}
 
-    // 三角形ごとの頂点データの作成
-    for (GLuint j = startgroup; j < g.nextgroup; ++j)
-    {
-      // 処理対象の三角形
-      auto &f = tface[j];
+/*
+** 四元数：正規化して格納する
+*/
+gg::GgQuaternion &gg::GgQuaternion::loadNormalize(const GLfloat *a)
+{
+  quaternion[0] = a[0];
+  quaternion[1] = a[1];
+  quaternion[2] = a[2];
+  quaternion[3] = a[3];
 
-      // 三頂点のそれぞれについて
-      for (int i = 0; i < 3; ++i)
-      {
-        // テクスチャ座標
-        vec2 tex = { 0.0f };
-        if (f.t[i] > 0) tex = ttex[f.t[i] - 1];
+  ggNormalize4(quaternion.data());
 
-        // 頂点法線
-        vec3 norm = { 0.0f };
-        if (f.n[i] > 0) norm = tnorm[f.n[i] - 1];
+  return *this;
+}
 
-        // 頂点属性の追加
-        vert.emplace_back(tpos[f.p[i] - 1].data(), norm.data());
-      }
-    }
+/*
+** 四元数：共役四元数を格納する
+*/
+gg::GgQuaternion &gg::GgQuaternion::loadConjugate(const GLfloat *a)
+{
+  // w 要素を反転する
+  quaternion[0] = a[0];
+  quaternion[1] = a[1];
+  quaternion[2] = a[2];
+  quaternion[3] = -a[3];
 
-    // このポリゴングループの頂点数を保存する
-    v[1] = static_cast<GLuint>(vert.size()) - v[0];
-    v[2] = g.mtlno;
+  return *this;
+}
 
-    // このポリゴングループの最初の頂点番号と頂点数・材質番号を登録する
-    group.emplace_back(v);
+/*
+** 四元数：逆元を格納する
+*/
+gg::GgQuaternion &gg::GgQuaternion::loadInvert(const GLfloat *a)
+{
+  // ノルムの二乗を求める
+  const GLfloat l(ggDot4(a, a));
 
-    // 次のポリゴングループの最初の三角形番号を求める
-    startgroup = g.nextgroup;
+  if (l > 0.0f)
+  {
+    // 共役四元数を求める
+    GgQuaternion r;
+    r.loadConjugate(a);
+
+    // ノルムの二乗で割る
+    quaternion[0] = r.quaternion[0] / l;
+    quaternion[1] = r.quaternion[1] / l;
+    quaternion[2] = r.quaternion[2] / l;
+    quaternion[3] = r.quaternion[3] / l;
   }
 
-#if defined(DEBUG)
-  std::cerr
-    << "(Stored) Group: " << group.size() << ", Material: " << material.size()
-    << ", Vertex: " << vert.size() << "\n";
-#endif
+  return *this;
+}
 
-  // OBJ ファイルの読み込み成功
-  return true;
+/*
+** 簡易トラックボール処理：リセット
+*/
+void gg::GgTrackball::reset()
+{
+  // ドラッグ中ではない
+  drag = false;
+
+  // 単位クォーターニオンで初期化する
+  tq = cq.loadIdentity();
+
+  // 回転行列を初期化する
+  tq.getMatrix(rt);
 }
 
 /*
-** 三角形分割された Alias OBJ 形式のファイルと MTL ファイルを読み込む (Elements 形式)
+** 簡易トラックボール処理：トラックボールする領域の設定
 **
-**   name 読み込むOBJ ファイル名
-**   group 読み込んだデータの各ポリゴングループの最初の三角形番号と三角形数
-**   material 読み込んだデータのポリゴングループごとの材質
-**   vert 読み込んだデータの頂点属性
-**   face 読み込んだデータの三角形の頂点インデックス
-**   normalize true ならサイズを正規化する
-**   戻り値 読み込みに成功したら true
+**   Reshape コールバック (resize) の中で実行する
+**   (w, h) ウィンドウサイズ
 */
-bool gg::ggLoadSimpleObj(const char *name,
-  std::vector< std::array<GLuint, 3> > &group,
-  std::vector<GgSimpleShader::Material> &material,
-  std::vector<GgVertex> &vert,
-  std::vector<GLuint> &face,
-  bool normalize)
+void gg::GgTrackball::region(float w, float h)
 {
-  // 読み込み用の一時記憶領域
-  std::vector<fgrp> tgroup;
-  std::vector<vec3> tpos;
-  std::vector<vec3> tnorm;
-  std::vector<vec2> ttex;
-  std::vector<fidx> tface;
-
-  // OBJ ファイルを解析する
-  if (!ggParseObj(name, tgroup, material, tpos, tnorm, ttex, tface, normalize)) return false;
-
-  // 頂点属性データの最初の頂点番号
-  const int vertbase(static_cast<int>(vert.size()));
-
-  // 頂点属性データのメモリを確保する
-  vert.resize(vertbase + tpos.size());
-
-  // 三角形データのメモリを確保する
-  face.reserve(face.size() + tface.size());
+  // マウスポインタ位置のウィンドウ内の相対的位置への換算用
+  scale[0] = 1.0f / w;
+  scale[1] = 1.0f / h;
+}
 
-  // ポリゴングループデータのメモリを確保する
-  group.reserve(group.size() + tgroup.size());
-  material.reserve(material.size() + tgroup.size());
+/*
+** 簡易トラックボール処理：ドラッグ開始時の処理
+**
+**   マウスボタンを押したときに実行する
+**   (x, y) 現在のマウス位置
+*/
+void gg::GgTrackball::begin(float x, float y)
+{
+  // ドラッグ開始
+  drag = true;
 
-  // ポリゴングループの最初の三角形番号
-  GLuint startgroup(0);
+  // ドラッグ開始点を記録する
+  start[0] = x;
+  start[1] = y;
+}
 
-  // ポリゴングループデータの作成
-  for (auto &g : tgroup)
+/*
+** 簡易トラックボール処理：ドラッグ中の処理
+**
+**   マウスのドラッグ中に実行する
+**   (x, y) 現在のマウス位置
+*/
+void gg::GgTrackball::motion(float x, float y)
+{
+  if (drag)
   {
-    // このポリゴングループの最初の頂点番号と頂点数・材質番号
-    std::array<GLuint, 3> v;
+    // マウスポインタの位置のドラッグ開始位置からの変位
+    const float d[] = { (x - start[0]) * scale[0], (y - start[1]) * scale[1] };
 
-    // このポリゴングループの最初の三角形番号を保存する
-    v[0] = static_cast<GLuint>(face.size());
+    // マウスポインタの位置のドラッグ開始位置からの距離
+    const float a(sqrt(d[0] * d[0] + d[1] * d[1]));
 
-    // 三角形ごとの頂点データの作成
-    for (GLuint j = startgroup; j < g.nextgroup; ++j)
+    if (a != 0.0)
     {
-      // 処理対象の三角形
-      auto &f = tface[j];
-
-      // 三頂点のそれぞれについて
-      for (int i = 0; i < 3; ++i)
-      {
-        // 追加する三角形データの頂点番号
-        const int q(f.p[i] - 1 + vertbase);
-
-        // 三角形データの追加
-        face.emplace_back(q);
-
-        // テクスチャ座標番号
-        vec2 tex = { 0.0f };
-        if (f.t[i] > 0) tex = ttex[f.t[i] - 1];
-
-        // 頂点法線番号
-        vec3 norm = { 0.0f };
-        if (f.n[i] > 0) norm = tnorm[f.n[i] - 1];
+      // 現在の回転の四元数に作った四元数を掛けて合成する
+      tq = ggRotateQuaternion(d[1], d[0], 0.0f, a * 6.283185f) * cq;
 
-        // 頂点の格納
-        vert[q] = GgVertex(tpos[f.p[i] - 1].data(), norm.data());
-      }
+      // 合成した四元数から回転の変換行列を求める
+      tq.getMatrix(rt);
     }
+  }
+}
 
-    // このポリゴングループの三角形数を保存する
-    v[1] = static_cast<GLuint>(face.size()) - v[0];
-    v[2] = g.mtlno;
+/*
+** 簡易トラックボール処理：回転角の修正
+**
+**   現在の回転角を修正する
+**   q 修正分の回転角を表す四元数
+*/
+void gg::GgTrackball::rotate(const GgQuaternion &q)
+{
+  if (!drag)
+  {
+    // 保存されている四元数に修正分の四元数を掛けて合成する
+    tq = q * cq;
 
-    // このポリゴングループの最初の三角形番号と三角形数・材質番号を登録する
-    group.emplace_back(v);
+    // 合成した四元数から回転の変換行列を求める
+    tq.getMatrix(rt);
 
-    // 次のポリゴングループの最初の三角形番号を求める
-    startgroup = g.nextgroup;
+    // 誤差を吸収するために正規化して保存する
+    cq = tq.normalize();
   }
-
-#if defined(DEBUG)
-  std::cerr
-    << "(Stored) Group: " << group.size() << ", Material: " << material.size()
-    << ", Vertex: " << vert.size() << ", Face: " << face.size() << "\n";
-#endif
-
-  // OBJ ファイルの読み込み成功
-  return true;
 }
 
 /*
-** シェーダオブジェクトのコンパイル結果を表示する
+** 簡易トラックボール処理：停止時の処理
+**
+**   マウスボタンを離したときに実行する
+**   (x, y) 現在のマウス位置
 */
-static GLboolean printShaderInfoLog(GLuint shader, const char *str)
+void gg::GgTrackball::end(float x, float y)
 {
-  // コンパイル結果を取得する
-  GLint status;
-  glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
-#if defined(DEBUG)
-  if (status == GL_FALSE) std::cerr << "Compile Error in " << str << std::endl;
-#endif
-
-  // シェーダのコンパイル時のログの長さを取得する
-  GLsizei bufSize;
-  glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &bufSize);
+  // ドラッグ終了点における回転を求める
+  motion(x, y);
 
-  if (bufSize > 1)
-  {
-    // シェーダのコンパイル時のログの内容を取得する
-    std::vector<GLchar> infoLog(bufSize);
-    GLsizei length;
-    glGetShaderInfoLog(shader, bufSize, &length, &infoLog[0]);
-#if defined(DEBUG)
-    std::cerr << &infoLog[0] << std::endl;
-#endif
-  }
+  // 誤差を吸収するために正規化して保存する
+  cq = tq.normalize();
 
-  // コンパイル結果を返す
-  return static_cast<GLboolean>(status);
+  // ドラッグ終了
+  drag = false;
 }
 
 /*
-** プログラムオブジェクトのリンク結果を表示する
+** 点：描画
 */
-static GLboolean printProgramInfoLog(GLuint program)
+void gg::GgPoints::draw(GLint first, GLsizei count) const
 {
-  // リンク結果を取得する
-  GLint status;
-  glGetProgramiv(program, GL_LINK_STATUS, &status);
-#if defined(DEBUG)
-  if (status == GL_FALSE) std::cerr << "Link Error." << std::endl;
-#endif
+  // 頂点配列オブジェクトを指定する
+  GgShape::draw(first, count);
 
-  // シェーダのリンク時のログの長さを取得する
-  GLsizei bufSize;
-  glGetProgramiv(program, GL_INFO_LOG_LENGTH, &bufSize);
+  // ストリーミングしていれば現在のフレームの位置から読み出す
+  const GLint base(stream ? stream->getCount() * stream->getFrame() : 0);
 
-  // シェーダのリンク時のログの内容を取得する
-  if (bufSize > 1)
-  {
-    std::vector<GLchar> infoLog(bufSize);
-    GLsizei length;
-    glGetProgramInfoLog(program, bufSize, &length, &infoLog[0]);
-#if defined(DEBUG)
-    std::cerr << &infoLog[0] << std::endl;
-#endif
-  }
+  // 図形を描画する
+  glDrawArrays(getMode(), base + first, count > 0 ? count : getCount() - first);
 
-  // リンク結果を返す
-  return static_cast<GLboolean>(status);
+  // このフレームの描画命令を発行し終えたことを記録する
+  if (stream) stream->fence();
 }
 
 /*
-** シェーダのソースプログラムの文字列を読み込んでプログラムオブジェクトを作成する
-**
-**   vsrc バーテックスシェーダのソースプログラムの文字列
-**   fsrc フラグメントシェーダのソースプログラムの文字列 (nullptr なら不使用)
-**   gsrc ジオメトリシェーダのソースプログラムの文字列 (nullptr なら不使用)
-**   nvarying フィードバックする varying 変数の数 (0 なら不使用)
-**   varyings フィードバックする varying 変数のリスト (nullptr なら不使用)
-**   vtext バーテックスシェーダのコンパイル時のメッセージに追加する文字列
-**   ftext フラグメントシェーダのコンパイル時のメッセージに追加する文字列
-**   gtext ジオメトリシェーダのコンパイル時のメッセージに追加する文字列
-**   戻り値 プログラムオブジェクトのプログラム名 (作成できなければ 0)
+** 三角形：描画
 */
-GLuint gg::ggCreateShader(const char *vsrc, const char *fsrc, const char *gsrc,
-  GLint nvarying, const char *const varyings[],
-  const char *vtext, const char *ftext, const char *gtext)
+void gg::GgTriangles::draw(GLint first, GLsizei count) const
 {
-  // シェーダプログラムの作成
-  const GLuint program(glCreateProgram());
-
-  if (program > 0)
-  {
-    bool status = true;
+  // 頂点配列オブジェクトを指定する
+  GgShape::draw(first, count);
 
-    if (vsrc)
-    {
-      // バーテックスシェーダのシェーダオブジェクトを作成する
-      const GLuint vertShader(glCreateShader(GL_VERTEX_SHADER));
-      glShaderSource(vertShader, 1, &vsrc, nullptr);
-      glCompileShader(vertShader);
+  // 図形を描画する
+  glDrawArrays(getMode(), getBaseVertex() + first, count > 0 ? count : getCount() - first);
 
-      // バーテックスシェーダのシェーダオブジェクトをプログラムオブジェクトに組み込む
-      if (printShaderInfoLog(vertShader, vtext))
-        glAttachShader(program, vertShader);
-      else
-        status = false;
-      glDeleteShader(vertShader);
-    }
+  // このフレームの描画命令を発行し終えたことを記録する
+  fence();
+}
 
-    if (fsrc)
-    {
-      // フラグメントシェーダのシェーダオブジェクトを作成する
-      const GLuint fragShader(glCreateShader(GL_FRAGMENT_SHADER));
-      glShaderSource(fragShader, 1, &fsrc, nullptr);
-      glCompileShader(fragShader);
+/*
+** オブジェクト：描画
+*/
+void gg::GgElements::draw(GLint first, GLsizei count) const
+{
+  // 頂点配列オブジェクトを指定する
+  GgShape::draw(first, count);
 
-      // フラグメントシェーダのシェーダオブジェクトをプログラムオブジェクトに組み込む
-      if (printShaderInfoLog(fragShader, ftext))
-        glAttachShader(program, fragShader);
-      else
-        status = false;
-      glDeleteShader(fragShader);
-    }
+  // 描画する最初のインデックスの位置
+  const void *const start(index16
+    ? static_cast<const void *>(static_cast<GLushort *>(0) + first) : static_cast<GLuint *>(0) + first);
 
-    if (gsrc)
-    {
-      // ジオメトリシェーダのシェーダオブジェクトを作成する
-      const GLuint geomShader(glCreateShader(GL_GEOMETRY_SHADER));
-      glShaderSource(geomShader, 1, &gsrc, nullptr);
-      glCompileShader(geomShader);
+  // 図形を描画する
+  if (isStreaming())
+  {
+    // 現在のフレームの頂点属性を参照するようにインデックスに先頭の頂点番号を加える
+    glDrawElementsBaseVertex(getMode(), count > 0 ? count : getIndexCount() - first, getIndexType(),
+      start, getBaseVertex());
+  }
+  else
+  {
+    glDrawElements(getMode(), count > 0 ? count : getIndexCount() - first, getIndexType(), start);
+  }
 
-      // ジオメトリシェーダのシェーダオブジェクトをプログラムオブジェクトに組み込む
-      if (printShaderInfoLog(geomShader, gtext))
-        glAttachShader(program, geomShader);
-      else
-        status = false;
-      glDeleteShader(geomShader);
-    }
+  // このフレームの描画命令を発行し終えたことを記録する
+  fence();
+}
 
-    // feedback に使う varying 変数を指定する
-    if (nvarying > 0)
-      glTransformFeedbackVaryings(program, nvarying, varyings, GL_SEPARATE_ATTRIBS);
+/*
+** 点群を立方体状に生成する
+*/
+gg::GgPoints *gg::ggPointsCube(GLsizei count, GLfloat length, GLfloat cx, GLfloat cy, GLfloat cz)
+{
+  // メモリを確保する
+  std::vector<GgVector> pos;
+  pos.reserve(count);
 
-    // 全てのシェーダオブジェクトのコンパイルに成功したら
-    if (status)
+  // 点を生成する
+  for (GLsizei v = 0; v < count; ++v)
+  {
+    const GgVector p =
     {
-      // シェーダプログラムをリンクする
-      glLinkProgram(program);
+      (static_cast<GLfloat>(rand()) / static_cast<float>(RAND_MAX) - 0.5f) * length + cx,
+      (static_cast<GLfloat>(rand()) / static_cast<float>(RAND_MAX) - 0.5f) * length + cy,
+      (static_cast<GLfloat>(rand()) / static_cast<float>(RAND_MAX) - 0.5f) * length + cz,
+      1.0f
+    };
 
-      // リンクに成功したらプログラムオブジェクト名を返す
-      if (printProgramInfoLog(program) != GL_FALSE) return program;
-    }
+    pos.emplace_back(p);
   }
 
-  // プログラムオブジェクトが作成できなかった
-  glDeleteProgram(program);
-  return 0;
+  // 点データの GgPoints オブジェクトを作成する
+  GgPoints *const points(new GgPoints(pos.data(), static_cast<GLuint>(pos.size()), GL_POINTS));
+
+  // GgPoints オブジェクトを返す
+  return points;
 }
 
 /*
-** シェーダのソースファイルを読み込んだ vector を返す
-**
-**   name ソースファイル名
-**   src 読み込んだソースファイルの文字列
-**   戻り値 読み込みの成功すれば true, 失敗したら false
+** 点群を球状に生成する
 */
-static bool readShaderSource(const char *name, std::vector<GLchar> &src)
+gg::GgPoints *gg::ggPointsSphere(GLsizei count, GLfloat radius,
+  GLfloat cx, GLfloat cy, GLfloat cz)
 {
-// ファイル名が nullptr ならそのまま戻る
-  if (name == nullptr) return true;
+  // メモリを確保する
+  std::vector<GgVector> pos;
+  pos.reserve(count);
 
-  // ソースファイルを開く
-  std::ifstream file(name, std::ios::binary);
-  if (!file)
+  // 点を生成する
+  for (GLsizei v = 0; v < count; ++v)
   {
-    // ファイルが開けなければエラーで戻る
-#if defined(DEBUG)
-    std::cerr << "Error: Can't open source file: " << name << std::endl;
-#endif
-    return false;
+    const float r(radius * static_cast<float>(rand()) / static_cast<float>(RAND_MAX));
+    const float t(6.2831853f * static_cast<float>(rand()) / (static_cast<float>(RAND_MAX) + 1.0f));
+    const float cp(2.0f * static_cast<float>(rand()) / static_cast<float>(RAND_MAX) - 1.0f);
+    const float sp(sqrt(1.0f - cp * cp));
+    const float ct(cos(t));
+    const float st(sin(t));
+
+    const GgVector p = { r * sp * ct + cx, r * sp * st + cy, r * cp + cz, 1.0f };
+
+    pos.emplace_back(p);
   }
 
-  // ファイルの末尾に移動する
-  file.seekg(0L, std::ios::end);
+  // 点データの GgPoints オブジェクトを作成する
+  GgPoints *const points(new GgPoints(pos.data(), static_cast<GLsizei>(pos.size()), GL_POINTS));
 
-  // ファイルサイズ (= ファイルの末尾の位置) + 1 文字のメモリを確保する
-  src.resize(static_cast<GLsizei>(file.tellg()) + 1);
+  // GgPoints オブジェクトを返す
+  return points;
+}
 
-  // ファイルを先頭から読み込む
-  file.seekg(0L, std::ios::beg);
-  file.read(src.data(), src.size());
-  src.push_back('\0');
+/*
+** 矩形状に 2 枚の三角形を生成する
+*/
+gg::GgTriangles *gg::ggRectangle(GLfloat width, GLfloat height)
+{
+  // 頂点属性
+  std::array<GgVertex, 4> vert;
 
-  // ファイルがうまく読み込めなければ戻る
-  if (file.bad())
+  // 頂点位置と法線を求める
+  for (int v = 0; v < 4; ++v)
   {
-#if defined(DEBUG)
-    std::cerr << "Error: Could not read souce file: " << name << std::endl;
-#endif
-    file.close();
-    return false;
+    const GLfloat x(((v & 1) * 2 - 1) * width);
+    const GLfloat y(((v & 2) - 1) * height);
+
+    vert[v] = GgVertex(x, y, 0.0f, 0.0f, 0.0f, 1.0f);
   }
 
-  // ファイルを閉じて戻る
-  file.close();
-  return true;
+  // 矩形の GgTrianges オブジェクトを作成する
+  return new GgTriangles(vert.data(), static_cast<GLsizei>(vert.size()), GL_TRIANGLE_STRIP);
 }
 
 /*
-** シェーダのソースファイルを読み込んでプログラムオブジェクトを作成する
-**
-**   vert バーテックスシェーダのソースファイル名
-**   frag フラグメントシェーダのソースファイル名 (nullptr なら不使用)
-**   geom ジオメトリシェーダのソースファイル名 (nullptr なら不使用)
-**   nvarying フィードバックする varying 変数の数 (0 なら不使用)
-**   varyings フィードバックする varying 変数のリスト (nullptr なら不使用)
-**   戻り値 シェーダプログラムのプログラム名 (作成できなければ 0)
+** 楕円状に三角形を生成する
 */
-GLuint gg::ggLoadShader(const char *vert, const char *frag, const char *geom,
-  GLint nvarying, const char *const varyings[])
+gg::GgTriangles *gg::ggEllipse(GLfloat width, GLfloat height, GLuint slices)
 {
-  // シェーダのソースファイルを読み込む
-  std::vector<GLchar> vsrc, fsrc, gsrc;
-  if (readShaderSource(vert, vsrc) && readShaderSource(frag, fsrc) && readShaderSource(geom, gsrc))
+  // 楕円のスケール
+  constexpr GLfloat scale(0.5f);
+
+  // 作業用のメモリ
+  std::vector<GgVertex> vert;
+  vert.reserve(slices);
+
+  // 頂点位置と法線を求める
+  for (GLuint v = 0; v < slices; ++v)
   {
-    // プログラムオブジェクトを作成する
-    return ggCreateShader(vsrc.data(), fsrc.data(), gsrc.data(), nvarying, varyings, vert, frag, geom);
+    const GLfloat t(6.2831853f * static_cast<float>(v) / static_cast<float>(slices));
+    const GLfloat x(cos(t) * width * scale);
+    const GLfloat y(sin(t) * height * scale);
+
+    vert.emplace_back(x, y, 0.0f, 0.0f, 0.0f, 1.0f);
   }
 
-  // プログラムオブジェクト作成失敗
-  return 0;
+  // GgTriangles オブジェクトを作成する
+  return new GgTriangles(vert.data(), static_cast<GLsizei>(vert.size()), GL_TRIANGLE_FAN);
 }
 
-#if !defined(__APPLE__)
 /*
-** コンピュートシェーダのソースプログラムの文字列を読み込んでプログラムオブジェクトを作成する
-**
-**   csrc コンピュートシェーダのソースプログラムの文字列
-**   戻り値 プログラムオブジェクトのプログラム名 (作成できなければ 0)
+** Wavefront OBJ ファイルを読み込む (Arrays 形式)
 */
-GLuint gg::ggCreateComputeShader(const char *csrc, const char *ctext)
+gg::GgTriangles *gg::ggArraysObj(const char *name, bool normalize)
 {
-  // シェーダプログラムの作成
-  const GLuint program(glCreateProgram());
+  std::vector< std::array<GLuint, 3> > group;
+  std::vector<GgSimpleShader::Material> material;
+  std::vector<GgVertex> vert;
 
-  if (program > 0)
+  // ファイルを読み込む
+  if (!ggLoadSimpleObj(name, group, material, vert, normalize)) return 0;
+
+  // GgTriangles オブジェクトを作成する
+  return new GgTriangles(vert.data(), static_cast<GLsizei>(vert.size()), GL_TRIANGLES);
+}
+
+/*
+** Wavefront OBJ ファイル を読み込む (Elements 形式)
+*/
+gg::GgElements *gg::ggElementsObj(const char *name, bool normalize)
+{
+  std::vector< std::array<GLuint, 3> > group;
+  std::vector<GgSimpleShader::Material> material;
+  std::vector<GgVertex> vert;
+  std::vector<GLuint> face;
+
+  // ファイルを読み込む
+  if (!ggLoadSimpleObj(name, group, material, vert, face, normalize)) return 0;
+
+  // GgElements オブジェクトを作成する
+  return new GgElements(vert.data(), static_cast<GLsizei>(vert.size()),
+    face.data(), static_cast<GLsizei>(face.size()), GL_TRIANGLES);
+}
+
+/*
+** メッシュ形状を作成する (Elements 形式)
+*/
+gg::GgElements *gg::ggElementsMesh(GLuint slices, GLuint stacks, const GLfloat (*pos)[3], const GLfloat (*norm)[3])
+{
+  // 頂点属性
+  std::vector<GgVertex> vert;
+  vert.reserve((slices + 1) * (stacks + 1));
+
+  // 頂点の法線を求める
+  for (GLuint j = 0; j <= stacks; ++j)
   {
-    if (csrc)
+    for (GLuint i = 0; i <= slices; ++i)
     {
-      // コンピュートシェーダのシェーダオブジェクトを作成する
-      const GLuint compShader(glCreateShader(GL_COMPUTE_SHADER));
-      glShaderSource(compShader, 1, &csrc, nullptr);
-      glCompileShader(compShader);
+      // 処理対象の頂点番号
+      const GLuint k(j * (slices + 1) + i);
 
-      // コンピュートシェーダのシェーダオブジェクトをプログラムオブジェクトに組み込む
-      if (printShaderInfoLog(compShader, ctext))
-        glAttachShader(program, compShader);
-      glDeleteShader(compShader);
-    }
+      // 頂点の法線
+      GgVector tnorm;
+      tnorm[3] = 0.0f;
+
+      if (norm)
+      {
+        tnorm[0] = norm[k][0];
+        tnorm[1] = norm[k][1];
+        tnorm[2] = norm[k][2];
+      }
+      else
+      {
+        // 処理対象の頂点の周囲の頂点番号
+        const GLuint kim(i > 0 ? k - 1 : k);
+        const GLuint kip(i < slices ? k + 1 : k);
+        const GLuint kjm(j > 0 ? k - slices - 1 : k);
+        const GLuint kjp(j < stacks ? k + slices + 1 : k);
+
+        // 接線ベクトル
+        const std::array<GLfloat, 3> t =
+        {
+          pos[kip][0] - pos[kim][0],
+          pos[kip][1] - pos[kim][1],
+          pos[kip][2] - pos[kim][2]
+        };
+
+        // 従接線ベクトル
+        const std::array<GLfloat, 3> b =
+        {
+          pos[kjp][0] - pos[kjm][0],
+          pos[kjp][1] - pos[kjm][1],
+          pos[kjp][2] - pos[kjm][2]
+        };
+
+        // 法線
+        tnorm[0] = t[1] * b[2] - t[2] * b[1];
+        tnorm[1] = t[2] * b[0] - t[0] * b[2];
+        tnorm[2] = t[0] * b[1] - t[1] * b[0];
 
-    // シェーダプログラムをリンクする
-    glLinkProgram(program);
+        // 法線の正規化
+        ggNormalize3(tnorm.data());
+      }
 
-    // プログラムオブジェクトが作成できなければ 0 を返す
-    if (printProgramInfoLog(program) == GL_FALSE)
-    {
-      glDeleteProgram(program);
-      return 0;
+      // 頂点の位置
+      const GgVector tpos = { pos[k][0], pos[k][1], pos[k][2], 1.0f };
+
+      // 頂点属性の保存
+      vert.emplace_back(tpos, tnorm);
     }
   }
 
-  // プログラムオブジェクトを返す
-  return program;
-}
+  // 頂点のインデックス (三角形データ)
+  std::vector<GLuint> face;
 
-/*
-** コンピュートシェーダのソースファイルを読み込んでプログラムオブジェクトを作成する
-**
-**   comp コンピュートシェーダのソースファイル名
-**   戻り値 プログラムオブジェクトのプログラム名 (作成できなければ 0)
-*/
-GLuint gg::ggLoadComputeShader(const char *comp)
-{
-  // シェーダのソースファイルを読み込む
-  std::vector<GLchar> csrc;
-  if (readShaderSource(comp, csrc))
+  // 頂点のインデックスを求める
+  for (GLuint j = 0; j < stacks; ++j)
   {
-    // プログラムオブジェクトを作成する
-    return ggCreateComputeShader(csrc.data(), comp);
-  }
+    for (GLuint i = 0; i < slices; ++i)
+    {
+      // 処理対象のマス
+      const GLuint k((slices + 1) * j + i);
 
-  // プログラムオブジェクト作成失敗
-  return 0;
-}
-#endif
+      // マスの上半分の三角形
+      face.emplace_back(k);
+      face.emplace_back(k + slices + 2);
+      face.emplace_back(k + 1);
 
-/*
-** 3 要素の長さ
-**
-**   a GLfloat 型の 3 要素の配列
-*/
-GLfloat gg::ggLength3(const GLfloat *a)
-{
-  return sqrt(ggDot3(a, a));
-}
+      // マスのお下半分の三角形
+      face.emplace_back(k);
+      face.emplace_back(k + slices + 1);
+      face.emplace_back(k + slices + 2);
+    }
+  }
 
-/*
-** 4 要素の長さ
-**
-**   a GLfloat 型の 4 要素の配列
-*/
-GLfloat gg::ggLength4(const GLfloat *a)
-{
-  return sqrt(ggDot4(a, a));
+  // GgElements オブジェクトを作成する
+  return new GgElements(vert.data(), static_cast<GLsizei>(vert.size()),
+    face.data(), static_cast<GLsizei>(face.size()), GL_TRIANGLES);
 }
 
 /*
-** 変換行列：行列とベクトルの積 c ← a × b
+** 球状に三角形データを生成する (Elements 形式)
 */
-void gg::GgMatrix::projection(GLfloat *c, const GLfloat *a, const GLfloat *b) const
+gg::GgElements *gg::ggElementsSphere(GLfloat radius, int slices, int stacks)
 {
-  for (int i = 0; i < 4; ++i)
-  {
-    c[i] = a[0 + i] * b[0] + a[4 + i] * b[1] + a[8 + i] * b[2] + a[12 + i] * b[3];
-  }
-}
+  // 頂点の位置と法線
+  std::vector<GLfloat> p, n;
 
-/*
-** 変換行列：行列と行列の積 c ← a × b
-*/
-void gg::GgMatrix::multiply(GLfloat *c, const GLfloat *a, const GLfloat *b) const
-{
-  for (int i = 0; i < 16; ++i)
+  // 頂点の位置と法線を求める
+  for (int j = 0; j <= stacks; ++j)
   {
-    int j = i & 3, k = i & ~3;
-
-    c[i] = a[0 + j] * b[k + 0] + a[4 + j] * b[k + 1] + a[8 + j] * b[k + 2] + a[12 + j] * b[k + 3];
-  }
-}
+    const float t(static_cast<float>(j) / static_cast<float>(stacks));
+    const float ph(3.141593f * t);
+    const float y(cosf(ph));
+    const float r(sinf(ph));
 
-/*
-** 変換行列：単位行列を設定する
-*/
-gg::GgMatrix &gg::GgMatrix::loadIdentity()
-{
-  array[ 1] = array[ 2] = array[ 3] = array[ 4] =
-  array[ 6] = array[ 7] = array[ 8] = array[ 9] =
-  array[11] = array[12] = array[13] = array[14] = 0.0f;
-  array[ 0] = array[ 5] = array[10] = array[15] = 1.0f;
+    for (int i = 0; i <= slices; ++i)
+    {
+      const float s(static_cast<float>(i) / static_cast<float>(slices));
+      const float th(-2.0f * 3.141593f * s);
+      const float x(r * cosf(th));
+      const float z(r * sinf(th));
 
-  return *this;
-}
+      // 頂点の座標値
+      p.push_back(x * radius);
+      p.push_back(y * radius);
+      p.push_back(z * radius);
 
-/*
-** 変換行列：平行移動変換行列を設定する
-*/
-gg::GgMatrix &gg::GgMatrix::loadTranslate(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
-{
-  array[12] = x;
-  array[13] = y;
-  array[14] = z;
-  array[ 0] = array[ 5] = array[10] = array[15] = w;
-  array[ 1] = array[ 2] = array[ 3] = array[ 4] =
-  array[ 6] = array[ 7] = array[ 8] = array[ 9] =
-  array[ 11] = 0.0f;
+      // 頂点の法線
+      n.push_back(x);
+      n.push_back(y);
+      n.push_back(z);
+    }
+  }
 
-  return *this;
+  // GgElements オブジェクトを作成する
+  return ggElementsMesh(slices, stacks, reinterpret_cast<GLfloat (*)[3]>(&p[0]),
+    reinterpret_cast<GLfloat (*)[3]>(&n[0]));
 }
 
+// \cond
 /*
-** 変換行列：拡大縮小変換行列を設定する
+** インスタンスの描画に使うデータ
 */
-gg::GgMatrix &gg::GgMatrix::loadScale(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+namespace gg
 {
-  array[ 0] = x;
-  array[ 5] = y;
-  array[10] = z;
-  array[15] = w;
-  array[ 1] = array[ 2] = array[ 3] = array[ 4] =
-  array[ 6] = array[ 7] = array[ 8] = array[ 9] =
-  array[11] = array[12] = array[13] = array[14] = 0.0f;
-
-  return *this;
+  // インスタンスの変換行列と色を入力する in 変数の最初の index
+  const GLuint instanceAttribute(5);
 }
+// \endcond
 
 /*
-** 変換行列：x 軸中心の回転変換行列を設定する
+** インスタンスごとの変換行列と色：次のフレームに切り替えて書き込み先を得る
+**
+**   戻り値 capacity 個の GgInstance を書き込める領域の先頭のポインタ (失敗したら nullptr)
 */
-gg::GgMatrix &gg::GgMatrix::loadRotateX(GLfloat a)
+gg::GgInstance *gg::GgInstances::map()
 {
-  const GLfloat c(cos(a));
-  const GLfloat s(sin(a));
-
-  array[ 0] = 1.0f; array[ 1] = 0.0f; array[ 2] = 0.0f; array[ 3] = 0.0f;
-  array[ 4] = 0.0f; array[ 5] = c;    array[ 6] = s;    array[ 7] = 0.0f;
-  array[ 8] = 0.0f; array[ 9] = -s;   array[10] = c;    array[11] = 0.0f;
-  array[12] = 0.0f; array[13] = 0.0f; array[14] = 0.0f; array[15] = 1.0f;
-
-  return *this;
+  // 次のフレームに切り替えてその領域をマップする
+  instance.next();
+  return static_cast<GgInstance *>(instance.map());
 }
 
 /*
-** 変換行列：y 軸中心の回転変換行列を設定する
+** インスタンスごとの変換行列と色：書き込みを終了する
+**
+**   count 書き込んだインスタンスの数
 */
-gg::GgMatrix &gg::GgMatrix::loadRotateY(GLfloat a)
+void gg::GgInstances::unmap(GLsizei count)
 {
-  const GLfloat c(cos(a));
-  const GLfloat s(sin(a));
-
-  array[ 0] = c;    array[ 1] = 0.0f; array[ 2] = -s;   array[ 3] = 0.0f;
-  array[ 4] = 0.0f; array[ 5] = 1.0f; array[ 6] = 0.0f; array[ 7] = 0.0f;
-  array[ 8] = s;    array[ 9] = 0.0f; array[10] = c;    array[11] = 0.0f;
-  array[12] = 0.0f; array[13] = 0.0f; array[14] = 0.0f; array[15] = 1.0f;
-
-  return *this;
+  this->count = std::min(std::max(count, 0), instance.getCount());
+  instance.unmap();
 }
 
 /*
-** 変換行列：z 軸中心の回転変換行列を設定する
+** インスタンスごとの変換行列と色：次のフレームに切り替えてデータを転送する
+**
+**   instance インスタンスのデータの配列
+**   count インスタンスの数
 */
-gg::GgMatrix &gg::GgMatrix::loadRotateZ(GLfloat a)
+void gg::GgInstances::send(const GgInstance *instance, GLsizei count)
 {
-  const GLfloat c(cos(a));
-  const GLfloat s(sin(a));
-
-  array[ 0] = c;    array[ 1] = s;    array[ 2] = 0.0f; array[ 3] = 0.0f;
-  array[ 4] = -s;   array[ 5] = c;    array[ 6] = 0.0f; array[ 7] = 0.0f;
-  array[ 8] = 0.0f; array[ 9] = 0.0f; array[10] = 1.0f; array[11] = 0.0f;
-  array[12] = 0.0f; array[13] = 0.0f; array[14] = 0.0f; array[15] = 1.0f;
+  // count が capacity を超えていたら capacity 個だけ転送する
+  this->count = std::min(std::max(count, 0), this->instance.getCount());
 
-  return *this;
+  // 次のフレームに切り替えて転送する
+  this->instance.next();
+  if (this->count > 0) this->instance.send(instance, 0, this->count);
 }
 
 /*
-** 変換行列：任意軸中心の回転変換行列を設定する
+** インスタンスごとの変換行列と色：現在のフレームのインスタンスを描画する
+**
+**   shape 各インスタンスで描画する形状
+**   first 描画する最初のインスタンスの番号
+**   count 描画するインスタンスの数, 0 なら全部のインスタンスを描画する
 */
-gg::GgMatrix &gg::GgMatrix::loadRotate(GLfloat x, GLfloat y, GLfloat z, GLfloat a)
+void gg::GgInstances::draw(const GgElements &shape, GLint first, GLsizei count)
 {
-  const GLfloat d(sqrt(x * x + y * y + z * z));
+  // 描画するインスタンスの数
+  if (first < 0 || first >= this->count) return;
+  if (count <= 0 || first + count > this->count) count = this->count - first;
 
-  if (d > 0.0f)
-  {
-    const GLfloat l(x / d), m(y / d), n(z / d);
-    const GLfloat l2(l * l), m2(m * m), n2(n * n);
-    const GLfloat lm(l * m), mn(m * n), nl(n * l);
-    const GLfloat c(cos(a)), c1(1.0f - c);
-    const GLfloat s(sin(a));
+  // 形状の頂点配列オブジェクトを指定する
+  ggBindVertexArray(shape.get());
 
-    array[ 0] = (1.0f - l2) * c + l2;
-    array[ 1] = lm * c1 + n * s;
-    array[ 2] = nl * c1 - m * s;
-    array[ 3] = 0.0f;
+  // 現在のフレームの first 番目のインスタンスの位置
+  const char *const start(static_cast<const char *>(0) + instance.getOffset(first));
 
-    array[ 4] = lm * c1 - n * s;
-    array[ 5] = (1.0f - m2) * c + m2;
-    array[ 6] = mn * c1 + l * s;
-    array[ 7] = 0.0f;
+  // インスタンスの変換行列の 4 つの列と色をインスタンスごとに一つずつ入力する
+  instance.bind();
+  for (GLuint i = 0; i < 4; ++i)
+  {
+    glVertexAttribPointer(instanceAttribute + i, 4, GL_FLOAT, GL_FALSE, sizeof (GgInstance),
+      start + offsetof(GgInstance, model) + sizeof (GLfloat) * 4 * i);
+    glVertexAttribDivisor(instanceAttribute + i, 1);
+    glEnableVertexAttribArray(instanceAttribute + i);
+  }
+  glVertexAttribPointer(instanceAttribute + 4, 4, GL_FLOAT, GL_FALSE, sizeof (GgInstance),
+    start + offsetof(GgInstance, color));
+  glVertexAttribDivisor(instanceAttribute + 4, 1);
+  glEnableVertexAttribArray(instanceAttribute + 4);
 
-    array[ 8] = nl * c1 + m * s;
-    array[ 9] = mn * c1 - l * s;
-    array[10] = (1.0f - n2) * c + n2;
-    array[11] = 0.0f;
+  // 量子化した位置を元に戻す係数は全てのインスタンスで一つのものを使う
+  if (shape.isCompact()) glVertexAttribDivisor(3, count);
 
-    array[12] = 0.0f;
-    array[13] = 0.0f;
-    array[14] = 0.0f;
-    array[15] = 1.0f;
+  // 全てのインスタンスを一度に描画する
+  if (shape.isStreaming())
+  {
+    glDrawElementsInstancedBaseVertex(shape.getMode(), shape.getIndexCount(), shape.getIndexType(), 0, count,
+      shape.getBaseVertex());
+  }
+  else
+  {
+    glDrawElementsInstanced(shape.getMode(), shape.getIndexCount(), shape.getIndexType(), 0, count);
   }
 
-  return *this;
+  // 頂点配列オブジェクトを元に戻す
+  if (shape.isCompact()) glVertexAttribDivisor(3, 1);
+  for (GLuint i = 0; i <= 4; ++i) glDisableVertexAttribArray(instanceAttribute + i);
+
+  // このフレームの描画命令を発行し終えたことを記録する
+  instance.fence();
+  shape.fence();
 }
 
 /*
-** 変換行列：転置行列を設定する
+** 三角形に単純な陰影付けを行うシェーダが参照する光源データ：光源の強度の環境光成分を設定する
+**
+**   r 光源の強度の環境光成分の赤成分
+**   g 光源の強度の環境光成分の緑成分
+**   b 光源の強度の環境光成分の青成分
+**   a 光源の強度の環境光成分の不透明度, デフォルトは 1
+**   first 値を設定する光源データの最初の番号, デフォルトは 0
+**   count 値を設定する光源データの数, デフォルトは 1
 */
-gg::GgMatrix &gg::GgMatrix::loadTranspose(const GLfloat *marray)
-{
-  array[ 0] = marray[ 0];
-  array[ 1] = marray[ 4];
-  array[ 2] = marray[ 8];
-  array[ 3] = marray[12];
-  array[ 4] = marray[ 1];
-  array[ 5] = marray[ 5];
-  array[ 6] = marray[ 9];
-  array[ 7] = marray[13];
-  array[ 8] = marray[ 2];
-  array[ 9] = marray[ 6];
-  array[10] = marray[10];
-  array[11] = marray[14];
-  array[12] = marray[ 3];
-  array[13] = marray[ 7];
-  array[14] = marray[11];
-  array[15] = marray[15];
+void gg::GgSimpleShader::LightBuffer::loadAmbient(GLfloat r, GLfloat g, GLfloat b, GLfloat a,
+  GLint first, GLsizei count) const
+{
+  // データを格納するバッファオブジェクトの先頭のポインタ
+  char *const start(static_cast<char *>(map(first, count)));
+  for (GLsizei i = 0; i < count; ++i)
+  {
+    // バッファオブジェクトの i 番目のブロックのポインタ
+    Light *const light(reinterpret_cast<Light *>(start + getStride() * i));
 
-  return *this;
+    // 光源の環境光成分を設定する
+    light->ambient[0] = r;
+    light->ambient[1] = g;
+    light->ambient[2] = b;
+    light->ambient[3] = a;
+  }
+  unmap();
 }
 
 /*
-** 変換行列：逆行列を設定する
+** 三角形に単純な陰影付けを行うシェーダが参照する光源データ：光源の強度の拡散反射光成分を設定する
+**
+**   r 光源の強度の拡散反射光成分の赤成分
+**   g 光源の強度の拡散反射光成分の緑成分
+**   b 光源の強度の拡散反射光成分の青成分
+**   a 光源の強度の拡散反射光成分の不透明度, デフォルトは 1
+**   first 値を設定する光源データの最初の番号, デフォルトは 0
+**   count 値を設定する光源データの数, デフォルトは 1
 */
-gg::GgMatrix &gg::GgMatrix::loadInvert(const GLfloat *marray)
+void gg::GgSimpleShader::LightBuffer::loadDiffuse(GLfloat r, GLfloat g, GLfloat b, GLfloat a,
+  GLint first, GLsizei count) const
 {
-  GLfloat lu[20], *plu[4];
-
-  // j 行の要素の値の絶対値の最大値を plu[j][4] に求める
-  for (int j = 0; j < 4; ++j)
+  // データを格納するバッファオブジェクトの先頭のポインタ
+  char *const start(static_cast<char *>(map(first, count)));
+  for (GLsizei i = 0; i < count; ++i)
   {
-    GLfloat max(fabs(*(plu[j] = lu + 5 * j) = *(marray++)));
+    // バッファオブジェクトの i 番目のブロックのポインタ
+    Light *const light(reinterpret_cast<Light *>(start + getStride() * i));
 
-    for (int i = 0; ++i < 4;)
-    {
-      GLfloat a(fabs(plu[j][i] = *(marray++)));
-      if (a > max) max = a;
-    }
-    if (max == 0.0f) return *this;
-    plu[j][4] = 1.0f / max;
+    // 光源の拡散反射光成分を設定する
+    light->diffuse[0] = r;
+    light->diffuse[1] = g;
+    light->diffuse[2] = b;
+    light->diffuse[3] = a;
   }
+  unmap();
+}
 
-  // ピボットを考慮した LU 分解
-  for (int j = 0; j < 4; ++j)
+/*
+** 三角形に単純な陰影付けを行うシェーダが参照する光源データ：光源の強度の鏡面反射光成分を設定する
+**
+**   r 光源の強度の鏡面反射光成分の赤成分
+**   g 光源の強度の鏡面反射光成分の緑成分
+**   b 光源の強度の鏡面反射光成分の青成分
+**   a 光源の強度の鏡面反射光成分の不透明度, デフォルトは 1
+**   first 値を設定する光源データの最初の番号, デフォルトは 0
+**   count 値を設定する光源データの数, デフォルトは 1
+*/
+void gg::GgSimpleShader::LightBuffer::loadSpecular(GLfloat r, GLfloat g, GLfloat b, GLfloat a,
+  GLint first, GLsizei count) const
+{
+  // データを格納するバッファオブジェクトの先頭のポインタ
+  char *const start(static_cast<char *>(map(first, count)));
+  for (GLsizei i = 0; i < count; ++i)
   {
-    GLfloat max(fabs(plu[j][j] * plu[j][4]));
-    int i = j;
+    // バッファオブジェクトの i 番目のブロックのポインタ
+    Light *const light(reinterpret_cast<Light *>(start + getStride() * i));
 
-    for (int k = j; ++k < 4;)
-    {
-      GLfloat a(fabs(plu[k][j] * plu[k][4]));
-      if (a > max)
-      {
-        max = a;
-        i = k;
-      }
-    }
-    if (i > j)
-    {
-      GLfloat *t(plu[j]);
-      plu[j] = plu[i];
-      plu[i] = t;
-    }
-    if (plu[j][j] == 0.0f) return *this;
-    for (int k = j; ++k < 4;)
-    {
-      plu[k][j] /= plu[j][j];
-      for (int i = j; ++i < 4;)
-      {
-        plu[k][i] -= plu[j][i] * plu[k][j];
-      }
-    }
+    // 光源の鏡面反射光成分を設定する
+    light->specular[0] = r;
+    light->specular[1] = g;
+    light->specular[2] = b;
+    light->specular[3] = a;
   }
+  unmap();
+}
 
-  // LU 分解から逆行列を求める
-  for (int k = 0; k < 4; ++k)
+/*
+** 三角形に単純な陰影付けを行うシェーダが参照する光源データ：光源の色を設定するが位置は変更しない
+**
+**   material 光源の特性の GgSimpleShader::Light 構造体
+**   first 値を設定する光源データの最初の番号, デフォルトは 0
+**   count 値を設定する光源データの数, デフォルトは 1
+*/
+void gg::GgSimpleShader::LightBuffer::loadColor(const Light &color,
+  GLint first, GLsizei count) const
+{
+  // データを格納するバッファオブジェクトの先頭のポインタ
+  char *const start(static_cast<char *>(map(first, count)));
+  for (GLsizei i = 0; i < count; ++i)
   {
-    // array に単位行列を設定する
-    for (int i = 0; i < 4; ++i)
-    {
-      array[i * 4 + k] = (plu[i] == lu + k * 5) ? 1.0f : 0.0f;
-    }
-    // lu から逆行列を求める
-    for (int i = 0; i < 4; ++i)
-    {
-      for (int j = i; ++j < 4;)
-      {
-        array[j * 4 + k] -= array[i * 4 + k] * plu[j][i];
-      }
-    }
-    for (int i = 4; --i >= 0;)
-    {
-      for (int j = i; ++j < 4;)
-      {
-        array[i * 4 + k] -= plu[i][j] * array[j * 4 + k];
-      }
-      array[i * 4 + k] /= plu[i][i];
-    }
-  }
+    // バッファオブジェクトの i 番目のブロックのポインタ
+    Light *const light(reinterpret_cast<Light *>(start + getStride() * i));
 
-  return *this;
+    // 光源の色を設定する
+    light->ambient = color.ambient;
+    light->diffuse = color.diffuse;
+    light->specular = color.specular;
+  }
+  unmap();
 }
 
 /*
-** 変換行列：法線変換行列を設定する
+** 三角形に単純な陰影付けを行うシェーダが参照する光源データ：光源の位置を設定する
+**
+**   x 光源の位置の x 座標
+**   y 光源の位置の y 座標
+**   z 光源の位置の z 座標
+**   w 光源の位置の w 座標, デフォルトは 1
+**   first 値を設定する光源データの最初の番号, デフォルトは 0
+**   count 値を設定する光源データの数, デフォルトは 1
 */
-gg::GgMatrix &gg::GgMatrix::loadNormal(const GLfloat *marray)
+void gg::GgSimpleShader::LightBuffer::loadPosition(GLfloat x, GLfloat y, GLfloat z, GLfloat w,
+  GLint first, GLsizei count) const
 {
-  array[ 0] = marray[ 5] * marray[10] - marray[ 6] * marray[ 9];
-  array[ 1] = marray[ 6] * marray[ 8] - marray[ 4] * marray[10];
-  array[ 2] = marray[ 4] * marray[ 9] - marray[ 5] * marray[ 8];
-  array[ 4] = marray[ 9] * marray[ 2] - marray[10] * marray[ 1];
-  array[ 5] = marray[10] * marray[ 0] - marray[ 8] * marray[ 2];
-  array[ 6] = marray[ 8] * marray[ 1] - marray[ 9] * marray[ 0];
-  array[ 8] = marray[ 1] * marray[ 6] - marray[ 2] * marray[ 5];
-  array[ 9] = marray[ 2] * marray[ 4] - marray[ 0] * marray[ 6];
-  array[10] = marray[ 0] * marray[ 5] - marray[ 1] * marray[ 4];
-  array[ 3] = array[ 7] = array[11] = array[12] = array[13] = array[14] = 0.0f;
-  array[15] = 1.0f;
+  // データを格納するバッファオブジェクトの先頭のポインタ
+  char *const start(static_cast<char *>(map(first, count)));
+  for (GLsizei i = 0; i < count; ++i)
+  {
+    // バッファオブジェクトの i 番目のブロックのポインタ
+    Light *const light(reinterpret_cast<Light *>(start + getStride() * i));
 
-  return *this;
+    // 光源の位置を設定する
+    light->position[0] = x;
+    light->position[1] = y;
+    light->position[2] = z;
+    light->position[3] = w;
+  }
+  unmap();
 }
 
 /*
-** 変換行列：ビュー変換行列を設定する
+** 三角形に単純な陰影付けを行うシェーダが参照する光源データ：光源の位置を設定する
+**
+**   position 光源の位置
+**   first 値を設定する光源データの最初の番号, デフォルトは 0
+**   count 値を設定する光源データの数, デフォルトは 1
 */
-gg::GgMatrix &gg::GgMatrix::loadLookat(GLfloat ex, GLfloat ey, GLfloat ez,
-  GLfloat tx, GLfloat ty, GLfloat tz,
-  GLfloat ux, GLfloat uy, GLfloat uz)
+void gg::GgSimpleShader::LightBuffer::loadPosition(const GgVector &position,
+  GLint first, GLsizei count) const
 {
-  // z 軸 = e - t
-  const GLfloat zx(ex - tx);
-  const GLfloat zy(ey - ty);
-  const GLfloat zz(ez - tz);
-
-  // x 軸 = u x z 軸
-  const GLfloat xx(uy * zz - uz * zy);
-  const GLfloat xy(uz * zx - ux * zz);
-  const GLfloat xz(ux * zy - uy * zx);
-
-  // y 軸 = z 軸 x x 軸
-  const GLfloat yx(zy * xz - zz * xy);
-  const GLfloat yy(zz * xx - zx * xz);
-  const GLfloat yz(zx * xy - zy * xx);
-
-  // y 軸の長さをチェック
-  GLfloat y(yx * yx + yy * yy + yz * yz);
-  if (y == 0.0f) return *this;
-
-  // x 軸の正規化
-  const GLfloat x(sqrt(xx * xx + xy * xy + xz * xz));
-  array[ 0] = xx / x;
-  array[ 4] = xy / x;
-  array[ 8] = xz / x;
-
-  // y 軸の正規化
-  y = sqrt(y);
-  array[ 1] = yx / y;
-  array[ 5] = yy / y;
-  array[ 9] = yz / y;
-
-  // z 軸の正規化
-  const GLfloat z(sqrt(zx * zx + zy * zy + zz * zz));
-  array[ 2] = zx / z;
-  array[ 6] = zy / z;
-  array[10] = zz / z;
+  // データを格納するバッファオブジェクトの先頭のポインタ
+  char *const start(static_cast<char *>(map(first, count)));
+  for (GLsizei i = 0; i < count; ++i)
+  {
+    // バッファオブジェクトの i 番目のブロックのポインタ
+    Light *const light(reinterpret_cast<Light *>(start + getStride() * i));
 
-  // 平行移動
-  array[12] = -(ex * array[ 0] + ey * array[ 4] + ez * array[ 8]);
-  array[13] = -(ex * array[ 1] + ey * array[ 5] + ez * array[ 9]);
-  array[14] = -(ex * array[ 2] + ey * array[ 6] + ez * array[10]);
+    // 光源の位置を設定する
+    light->position = position;
+  }
+  unmap();
+}
 
-  // 残り
-  array[ 3] = array[ 7] = array[11] = 0.0f;
-  array[15] = 1.0f;
+/*
+** 三角形に単純な陰影付けを行うシェーダが参照する材質データ：環境光に対する反射係数を設定する
+**
+**   r 環境光に対する反射係数の赤成分
+**   g 環境光に対する反射係数の緑成分
+**   b 環境光に対する反射係数の青成分
+**   a 環境光に対する反射係数の不透明度, デフォルトは 1
+**   first 値を設定する材質データの最初の番号, デフォルトは 0
+**   count 値を設定する材質データの数, デフォルトは 1
+*/
+void gg::GgSimpleShader::MaterialBuffer::loadAmbient(GLfloat r, GLfloat g, GLfloat b, GLfloat a,
+  GLint first, GLsizei count) const
+{
+  // データを格納するバッファオブジェクトの先頭のポインタ
+  char *const start(static_cast<char *>(map(first, count)));
+  for (GLsizei i = 0; i < count; ++i)
+  {
+    // バッファオブジェクトの i 番目のブロックのポインタ
+    Material *const material(reinterpret_cast<Material *>(start + getStride() * i));
 
-  return *this;
+    // 環境光に対する反射係数を設定する
+    material->ambient[0] = r;
+    material->ambient[1] = g;
+    material->ambient[2] = b;
+    material->ambient[3] = a;
+  }
+  unmap();
 }
 
 /*
-** 変換行列：平行投影変換行列を設定する
+** 三角形に単純な陰影付けを行うシェーダが参照する材質データ：拡散反射係数を設定する
+**
+**   r 拡散反射係数の赤成分
+**   g 拡散反射係数の緑成分
+**   b 拡散反射係数の青成分
+**   a 拡散反射係数の不透明度, デフォルトは 1
+**   first 値を設定する材質データの最初の番号, デフォルトは 0
+**   count 値を設定する材質データの数, デフォルトは 1
 */
-gg::GgMatrix &gg::GgMatrix::loadOrthogonal(GLfloat left, GLfloat right,
-  GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
+void gg::GgSimpleShader::MaterialBuffer::loadDiffuse(GLfloat r, GLfloat g, GLfloat b, GLfloat a,
+  GLint first, GLsizei count) const
 {
-  const GLfloat dx(right - left);
-  const GLfloat dy(top - bottom);
-  const GLfloat dz(zFar - zNear);
-
-  if (dx != 0.0f && dy != 0.0f && dz != 0.0f)
+  // データを格納するバッファオブジェクトの先頭のポインタ
+  char *const start(static_cast<char *>(map(first, count)));
+  for (GLsizei i = 0; i < count; ++i)
   {
-    array[ 0] = 2.0f / dx;
-    array[ 5] = 2.0f / dy;
-    array[10] = -2.0f / dz;
-    array[12] = -(right + left) / dx;
-    array[13] = -(top + bottom) / dy;
-    array[14] = -(zFar + zNear) / dz;
-    array[15] = 1.0f;
-    array[ 1] = array[ 2] = array[ 3] = array[ 4] =
-    array[ 6] = array[ 7] = array[ 8] = array[ 9] =
-    array[11] = 0.0f;
-  }
+    // バッファオブジェクトの i 番目のブロックのポインタ
+    Material *const material(reinterpret_cast<Material *>(start + getStride() * i));
 
-  return *this;
+    // 拡散反射係数を設定する
+    material->diffuse[0] = r;
+    material->diffuse[1] = g;
+    material->diffuse[2] = b;
+    material->diffuse[3] = a;
+  }
+  unmap();
 }
 
 /*
-** 変換行列：透視投影変換行列を設定する
+** 三角形に単純な陰影付けを行うシェーダが参照する材質データ：環境光に対する反射係数と拡散反射係数を設定する
+**
+**   r 環境光に対する反射係数と拡散反射係数の赤成分
+**   g 環境光に対する反射係数と拡散反射係数の緑成分
+**   b 環境光に対する反射係数と拡散反射係数の青成分
+**   a 環境光に対する反射係数と拡散反射係数の不透明度, デフォルトは 1
+**   first 値を設定する材質データの最初の番号, デフォルトは 0
+**   count 値を設定する材質データの数, デフォルトは 1
 */
-gg::GgMatrix &gg::GgMatrix::loadFrustum(GLfloat left, GLfloat right,
-  GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
+void gg::GgSimpleShader::MaterialBuffer::loadAmbientAndDiffuse(GLfloat r, GLfloat g, GLfloat b, GLfloat a,
+  GLint first, GLsizei count) const
 {
-  const GLfloat dx(right - left);
-  const GLfloat dy(top - bottom);
-  const GLfloat dz(zFar - zNear);
-
-  if (dx != 0.0f && dy != 0.0f && dz != 0.0f)
+  // データを格納するバッファオブジェクトの先頭のポインタ
+  char *const start(static_cast<char *>(map(first, count)));
+  for (GLsizei i = 0; i < count; ++i)
   {
-    array[ 0] = 2.0f * zNear / dx;
-    array[ 5] = 2.0f * zNear / dy;
-    array[ 8] = (right + left) / dx;
-    array[ 9] = (top + bottom) / dy;
-    array[10] = -(zFar + zNear) / dz;
-    array[11] = -1.0f;
-    array[14] = -2.0f * zFar * zNear / dz;
-    array[ 1] = array[ 2] = array[ 3] = array[ 4] =
-    array[ 6] = array[ 7] = array[12] = array[13] =
-    array[15] = 0.0f;
-  }
+    // バッファオブジェクトの i 番目のブロックのポインタ
+    Material *const material(reinterpret_cast<Material *>(start + getStride() * i));
 
-  return *this;
+    // 環境光に対する反射係数と拡散反射係数を設定する
+    material->ambient[0] = material->diffuse[0] = r;
+    material->ambient[1] = material->diffuse[1] = g;
+    material->ambient[2] = material->diffuse[2] = b;
+    material->ambient[3] = material->diffuse[3] = a;
+  }
+  unmap();
 }
 
 /*
-** 変換行列：画角から透視投影変換行列を設定する
+** 三角形に単純な陰影付けを行うシェーダが参照する材質データ：環境光に対する反射係数と拡散反射係数を設定する
+**
+**   color 環境光に対する反射係数と拡散反射係数を格納した GLfloat 型の 4 要素の配列
+**   first 値を設定する材質データの最初の番号, デフォルトは 0
+**   count 値を設定する材質データの数, デフォルトは 1
 */
-gg::GgMatrix &gg::GgMatrix::loadPerspective(GLfloat fovy, GLfloat aspect,
-  GLfloat zNear, GLfloat zFar)
+void gg::GgSimpleShader::MaterialBuffer::loadAmbientAndDiffuse(const GLfloat *color,
+  GLint first, GLsizei count) const
 {
-  const GLfloat dz(zFar - zNear);
+  // ambient 要素のバイトオフセット
+  constexpr GLint ambientOffset(offsetof(Material, ambient));
 
-  if (dz != 0.0f)
+  // ambient 要素のバイト数
+  constexpr size_t ambientSize(sizeof (Material::diffuse));
+
+  // diffuse 要素のバイトオフセット
+  constexpr GLint diffuseOffset(offsetof(Material, diffuse));
+
+  // diffuse 要素のバイト数
+  constexpr size_t diffuseSize(sizeof (Material::diffuse));
+
+  // 元のデータの先頭
+  const char *source(reinterpret_cast<const char *>(color));
+
+  // first 番目のブロックから count 個の ambient 要素と diffuse 要素に値を設定する
+  bind();
+  for (GLsizei i = 0; i < count; ++i)
   {
-    array[ 5] = 1.0f / tan(fovy * 0.5f);
-    array[ 0] = array[5] / aspect;
-    array[10] = -(zFar + zNear) / dz;
-    array[11] = -1.0f;
-    array[14] = -2.0f * zFar * zNear / dz;
-    array[ 1] = array[ 2] = array[ 3] = array[ 4] =
-    array[ 6] = array[ 7] = array[ 8] = array[ 9] =
-    array[12] = array[13] = array[15] = 0.0f;
-  }
+    // 格納先
+    const GLsizeiptr destination(getStride() * (first + i));
 
-  return *this;
+    // first + i 番目のブロックの ambient 要素に値を設定する
+    glBufferSubData(getTarget(), destination + ambientOffset, ambientSize, source + i * ambientSize);
+
+    // first + i 番目のブロックの diffuse 要素に値を設定する
+    glBufferSubData(getTarget(), destination + diffuseOffset, diffuseSize, source + i * diffuseSize);
+  }
 }
 
 /*
-** 四元数：GgQuaternion 型の四元数 p, q の積を r に求める
+** 三角形に単純な陰影付けを行うシェーダが参照する材質データ：鏡面反射係数を設定する
+**
+**   r 鏡面反射係数の赤成分
+**   g 鏡面反射係数の緑成分
+**   b 鏡面反射係数の青成分
+**   a 鏡面反射係数の不透明度, デフォルトは 1
+**   first 値を設定する材質データの最初の番号, デフォルトは 0
+**   count 値を設定する材質データの数, デフォルトは 1
 */
-void gg::GgQuaternion::multiply(GLfloat *r, const GLfloat *p, const GLfloat *q) const
+void gg::GgSimpleShader::MaterialBuffer::loadSpecular(GLfloat r, GLfloat g, GLfloat b, GLfloat a,
+  GLint first, GLsizei count) const
 {
-  r[0] = p[1] * q[2] - p[2] * q[1] + p[0] * q[3] + p[3] * q[0];
-  r[1] = p[2] * q[0] - p[0] * q[2] + p[1] * q[3] + p[3] * q[1];
-  r[2] = p[0] * q[1] - p[1] * q[0] + p[2] * q[3] + p[3] * q[2];
-  r[3] = p[3] * q[3] - p[0] * q[0] - p[1] * q[1] - p[2] * q[2];
+  // データを格納するバッファオブジェクトの先頭のポインタ
+  char *const start(static_cast<char *>(map(first, count)));
+  for (GLsizei i = 0; i < count; ++i)
+  {
+    // バッファオブジェクトの i 番目のブロックのポインタ
+    Material *const material(reinterpret_cast<Material *>(start + getStride() * i));
+
+    // 鏡面反射係数を設定する
+    material->specular[0] = r;
+    material->specular[1] = g;
+    material->specular[2] = b;
+    material->specular[3] = a;
+  }
+  unmap();
 }
 
 /*
-** 四元数：GgQuaternion 型の四元数 q が表す変換行列を m に求める
+** 三角形に単純な陰影付けを行うシェーダが参照する材質データ：輝き係数を設定する
+**
+**   shininess 輝き係数
+**   first 値を設定する材質データの最初の番号, デフォルトは 0
+**   count 値を設定する材質データの数, デフォルトは 1
 */
-void gg::GgQuaternion::toMatrix(GLfloat *m, const GLfloat *q) const
+void gg::GgSimpleShader::MaterialBuffer::loadShininess(GLfloat shininess,
+  GLint first, GLsizei count) const
 {
-  const GLfloat xx(q[0] * q[0] * 2.0f);
-  const GLfloat yy(q[1] * q[1] * 2.0f);
-  const GLfloat zz(q[2] * q[2] * 2.0f);
-  const GLfloat xy(q[0] * q[1] * 2.0f);
-  const GLfloat yz(q[1] * q[2] * 2.0f);
-  const GLfloat zx(q[2] * q[0] * 2.0f);
-  const GLfloat xw(q[0] * q[3] * 2.0f);
-  const GLfloat yw(q[1] * q[3] * 2.0f);
-  const GLfloat zw(q[2] * q[3] * 2.0f);
-
-  m[ 0] = 1.0f - yy - zz;
-  m[ 1] = xy + zw;
-  m[ 2] = zx - yw;
-  m[ 4] = xy - zw;
-  m[ 5] = 1.0f - zz - xx;
-  m[ 6] = yz + xw;
-  m[ 8] = zx + yw;
-  m[ 9] = yz - xw;
-  m[10] = 1.0f - xx - yy;
-  m[ 3] = m[ 7] = m[11] = m[12] = m[13] = m[14] = 0.0f;
-  m[15] = 1.0f;
+  // データを格納するバッファオブジェクトの先頭のポインタ
+  char *const start(static_cast<char *>(map(first, count)));
+  for (GLsizei i = 0; i < count; ++i)
+  {
+    // バッファオブジェクトの i 番目のブロックのポインタ
+    Material *const material(reinterpret_cast<Material *>(start + getStride() * i));
+    material->shininess = shininess;
+  }
+  unmap();
 }
 
 /*
-** 四元数：回転変換行列 a が表す四元数を q に求める
+** 三角形に単純な陰影付けを行うシェーダが参照する材質データ：輝き係数を設定する
+**
+**   shininess 輝き係数
+**   first 値を設定する材質データの最初の番号, デフォルトは 0
+**   count 値を設定する材質データの数, デフォルトは 1
 */
-void gg::GgQuaternion::toQuaternion(GLfloat *q, const GLfloat *a) const
+void gg::GgSimpleShader::MaterialBuffer::loadShininess(const GLfloat *shininess,
+  GLint first, GLsizei count) const
 {
-  const GLfloat tr(a[0] + a[5] + a[10] + a[15]);
-
-  if (tr > 0.0f)
+  // データを格納するバッファオブジェクトの先頭のポインタ
+  char *const start(static_cast<char *>(map(first, count)));
+  for (GLsizei i = 0; i < count; ++i)
   {
-    q[3] = sqrt(tr) * 0.5f;
-    q[0] = (a[6] - a[9]) * 0.25f / q[3];
-    q[1] = (a[8] - a[2]) * 0.25f / q[3];
-    q[2] = (a[1] - a[4]) * 0.25f / q[3];
+    // バッファオブジェクトの i 番目のブロックのポインタ
+    Material *const material(reinterpret_cast<Material *>(start + getStride() * i));
+    material->shininess = shininess[i];
   }
+  unmap();
+}
+
+/*
+** 三角形に単純な陰影付けを行うシェーダ：コンストラクタ
+*/
+gg::GgSimpleShader::GgSimpleShader(const char *vert, const char *frag,
+  const char *geom, GLint nvarying, const char **varyings, const char *defines)
+  : GgPointShader(vert, frag, geom, nvarying, varyings, defines)
+  , materialIndex(glGetUniformBlockIndex(get(), "Material"))
+  , lightIndex(glGetUniformBlockIndex(get(), "Light"))
+  , mnLoc(glGetUniformLocation(get(), "mn"))
+{
+  glUniformBlockBinding(get(), materialIndex, 1);
+  glUniformBlockBinding(get(), lightIndex, 0);
+
+  // GgSimpleObj をまとめて描画するときの材質のテクスチャバッファのテクスチャユニットを指定する
+  const GLint materialsLoc(glGetUniformLocation(get(), "materials"));
+  if (materialsLoc >= 0) glProgramUniform1i(get(), materialsLoc, MaterialTextureUnit);
 }
 
+// \cond
 /*
-** 四元数：球面線形補間 p に q と r を t で補間した四元数を求める
+** 形状データのキャッシュに使うデータと関数
 */
-void gg::GgQuaternion::slerp(GLfloat *p, const GLfloat *q, const GLfloat *r, GLfloat t) const
+namespace gg
 {
-  const GLfloat qr(ggDot3(q, r));
-  const GLfloat ss(1.0f - qr * qr);
+  // キャッシュを保存するディレクトリ (空ならキャッシュを使わない)
+  static std::string meshCacheDir;
 
-  if (ss == 0.0f)
+  // キャッシュファイルの識別子とバージョン
+  const char meshCacheMagic[4] = { 'G', 'G', 'M', 'C' };
+  const std::uint32_t meshCacheVersion(3);
+
+  // キャッシュファイルのヘッダ
+  struct MeshCacheHeader
   {
-    if (p != q)
-    {
-      p[0] = q[0];
-      p[1] = q[1];
-      p[2] = q[2];
-      p[3] = q[3];
-    }
-  }
-  else
+    char magic[4];              // 識別子
+    std::uint32_t version;      // バージョン
+    std::int64_t mtime;         // 元のファイルの更新時刻
+    std::uint64_t size;         // 元のファイルの大きさ
+    std::uint32_t normalize;    // 大きさを正規化していれば 1
+    std::uint32_t vertexSize;   // GgVertex の大きさ
+    std::uint32_t materialSize; // GgSimpleShader::Material の大きさ
+    std::uint32_t group;        // ポリゴングループ数
+    std::uint32_t material;     // 材質数
+    std::uint32_t vert;         // 頂点数
+    std::uint32_t face;         // 頂点インデックス数
+    std::uint32_t indexSize;    // 頂点インデックスの大きさ (2 か 4)
+    std::uint32_t mtllib;       // MTL ファイルの記録の大きさ
+  };
+
+  // キャッシュファイルに記録する MTL ファイルの更新時刻と大きさ (直後にパス名が続く)
+  struct MeshCacheStamp
   {
-    const GLfloat sp(sqrt(ss));
-    const GLfloat ph(acos(qr));
-    const GLfloat pt(ph * t);
-    const GLfloat t1(sin(pt) / sp);
-    const GLfloat t0(sin(ph - pt) / sp);
+    std::int64_t mtime;         // MTL ファイルの更新時刻 (なければ -1)
+    std::uint64_t size;         // MTL ファイルの大きさ
+    std::uint32_t length;       // パス名の長さ
+    std::uint32_t reserved;     // 未使用
+  };
 
-    p[0] = q[0] * t0 + r[0] * t1;
-    p[1] = q[1] * t0 + r[1] * t1;
-    p[2] = q[2] * t0 + r[2] * t1;
-    p[3] = q[3] * t0 + r[3] * t1;
+  // MTL ファイルの記録の大きさ (8 バイト境界に揃える)
+  static std::size_t meshCacheStampSize(std::size_t length)
+  {
+    return (sizeof(MeshCacheStamp) + length + 7) & ~static_cast<std::size_t>(7);
   }
-}
 
-/*
-** 四元数：(x, y, z) を軸とし角度 a 回転する四元数を求める
-*/
-gg::GgQuaternion &gg::GgQuaternion::loadRotate(GLfloat x, GLfloat y, GLfloat z, GLfloat a)
-{
-  const GLfloat l(x * x + y * y + z * z);
+  // キャッシュファイル中の各データの先頭は 16 バイト境界に揃える
+  static std::size_t meshCacheAlign(std::size_t offset)
+  {
+    return (offset + 15) & ~static_cast<std::size_t>(15);
+  }
 
-  if (l != 0.0)
+  // キャッシュファイル中の各データの位置
+  struct MeshCacheLayout
   {
-    GLfloat s(sin(a *= 0.5f) / sqrt(l));
+    std::size_t mtllib, group, material, vert, face, end;
 
-    quaternion[0] = x * s;
-    quaternion[1] = y * s;
-    quaternion[2] = z * s;
+    // コンストラクタ
+    explicit MeshCacheLayout(const MeshCacheHeader &header)
+      : mtllib(meshCacheAlign(sizeof header))
+      , group(meshCacheAlign(mtllib + header.mtllib))
+      , material(meshCacheAlign(group + header.group * sizeof(std::array<GLuint, 3>)))
+      , vert(meshCacheAlign(material + header.material * sizeof(GgSimpleShader::Material)))
+      , face(meshCacheAlign(vert + header.vert * sizeof(GgVertex)))
+      , end(face + header.face * header.indexSize)
+    {}
+  };
+
+  // キャッシュファイルのパス名を求める (キャッシュを使わなければ空)
+  static std::string meshCachePath(const char *name, bool normalize)
+  {
+    if (meshCacheDir.empty()) return std::string();
+
+    // ファイル名と正規化の有無からハッシュ値を求める
+    std::uint64_t hash(14695981039346656037ULL);
+    hash = hashString(hash, name);
+    hash = hashString(hash, normalize ? "1" : "0");
+
+    char file[32];
+    std::snprintf(file, sizeof file, "/%016llx.mesh", static_cast<unsigned long long>(hash));
+    return meshCacheDir + file;
   }
-  else
+
+  // キャッシュファイルをメモリマップしてヘッダを検証する (使えなければ nullptr)
+  static const MeshCacheHeader *openMeshCache(const MappedFile &file, const char *name, bool normalize)
   {
-    quaternion[0] = quaternion[1] = quaternion[2] = 0.0f;
+    if (!file || file.size() < sizeof(MeshCacheHeader)) return nullptr;
+    const MeshCacheHeader *const header(reinterpret_cast<const MeshCacheHeader *>(file.begin()));
+
+    // 元のファイルの更新時刻と大きさ
+    std::int64_t mtime;
+    std::uint64_t size;
+    if (!fileStamp(name, mtime, size)) return nullptr;
+
+    if (std::memcmp(header->magic, meshCacheMagic, sizeof header->magic) != 0
+      || header->version != meshCacheVersion
+      || header->mtime != mtime || header->size != size
+      || header->normalize != (normalize ? 1u : 0u)
+      || header->vertexSize != sizeof(GgVertex)
+      || header->materialSize != sizeof(GgSimpleShader::Material)
+      || (header->indexSize != sizeof(GLushort) && header->indexSize != sizeof(GLuint))
+      || MeshCacheLayout(*header).end > file.size()) return nullptr;
+
+    // 読み込んだ MTL ファイルの更新時刻と大きさも一致しなければ使わない
+    const char *p(file.begin() + MeshCacheLayout(*header).mtllib);
+    const char *const end(p + header->mtllib);
+    while (p < end)
+    {
+      if (static_cast<std::size_t>(end - p) < sizeof(MeshCacheStamp)) return nullptr;
+      const MeshCacheStamp *const stamp(reinterpret_cast<const MeshCacheStamp *>(p));
+      const std::size_t next(meshCacheStampSize(stamp->length));
+      if (static_cast<std::size_t>(end - p) < next) return nullptr;
+
+      const std::string mtlpath(p + sizeof(MeshCacheStamp), stamp->length);
+      if (!fileStamp(mtlpath.c_str(), mtime, size))
+      {
+        // 保存したときになかった MTL ファイルは今もなければよい
+        if (stamp->mtime != -1) return nullptr;
+      }
+      else if (stamp->mtime != mtime || stamp->size != size) return nullptr;
+
+      p += next;
+    }
+
+    return header;
   }
-  quaternion[3] = cos(a);
 
-  return *this;
-}
+  // 読み込んだ形状データをキャッシュファイルに保存する
+  static void saveMeshCache(const std::string &path, const char *name, bool normalize,
+    const std::vector<std::string> &mtllib,
+    const std::vector<std::array<GLuint, 3>> &group,
+    const std::vector<GgSimpleShader::Material> &material,
+    const std::vector<GgVertex> &vert,
+    const void *face, std::size_t count, std::size_t size)
+  {
+    // 読み込んだ MTL ファイルのパス名と更新時刻と大きさを記録する
+    std::vector<char> stamps;
+    for (const auto &mtlpath : mtllib)
+    {
+      MeshCacheStamp stamp = {};
+      if (!fileStamp(mtlpath.c_str(), stamp.mtime, stamp.size)) stamp.mtime = -1, stamp.size = 0;
+      stamp.length = static_cast<std::uint32_t>(mtlpath.size());
+
+      const std::size_t offset(stamps.size());
+      stamps.resize(offset + meshCacheStampSize(mtlpath.size()));
+      std::memcpy(stamps.data() + offset, &stamp, sizeof stamp);
+      std::memcpy(stamps.data() + offset + sizeof stamp, mtlpath.data(), mtlpath.size());
+    }
 
-/*
-** x 軸中心に角度 a 回転する四元数を格納する
-*/
-gg::GgQuaternion &gg::GgQuaternion::loadRotateX(GLfloat a)
-{
-  const GLfloat t(a * 0.5f);
+    MeshCacheHeader header = {};
+    std::memcpy(header.magic, meshCacheMagic, sizeof header.magic);
+    header.version = meshCacheVersion;
+    if (!fileStamp(name, header.mtime, header.size)) return;
+    header.normalize = normalize ? 1u : 0u;
+    header.vertexSize = sizeof(GgVertex);
+    header.materialSize = sizeof(GgSimpleShader::Material);
+    header.group = static_cast<std::uint32_t>(group.size());
+    header.material = static_cast<std::uint32_t>(material.size());
+    header.vert = static_cast<std::uint32_t>(vert.size());
+    header.face = static_cast<std::uint32_t>(count);
+    header.indexSize = static_cast<std::uint32_t>(size);
+    header.mtllib = static_cast<std::uint32_t>(stamps.size());
+    const MeshCacheLayout layout(header);
+
+    // 一時ファイルに書き込んでから置き換えるので, 読み込み中のキャッシュファイルが書き換わることはない
+    const std::string temp(cacheTempPath(path));
+
+    // キャッシュファイルに保存する
+    std::ofstream file(temp.c_str(), std::ios::binary);
+    if (!file)
+    {
+#if defined(DEBUG)
+      std::cerr << "Warning: Can't open file: " << temp << std::endl;
+#endif
+      return;
+    }
 
-  quaternion[0] = sin(t);
-  quaternion[3] = cos(t);
-  quaternion[1] = quaternion[2] = 0.0f;
+    // データの間を 0 で埋めながら書き込む
+    const char zero[16] = {};
+    std::size_t offset(0);
+    const auto write([&](std::size_t position, const void *data, std::size_t size)
+    {
+      file.write(zero, position - offset);
+      file.write(static_cast<const char *>(data), size);
+      offset = position + size;
+    });
+    write(0, &header, sizeof header);
+    write(layout.mtllib, stamps.data(), stamps.size());
+    write(layout.group, group.data(), group.size() * sizeof group[0]);
+    write(layout.material, material.data(), material.size() * sizeof material[0]);
+    write(layout.vert, vert.data(), vert.size() * sizeof vert[0]);
+    write(layout.face, face, count * size);
+
+    // 書き込みに失敗したら壊れたキャッシュファイルを残さない
+    file.close();
+    if (file.fail())
+    {
+      std::remove(temp.c_str());
+      return;
+    }
 
-  return *this;
-}
+    // 書き込みが終わったキャッシュファイルで置き換える
+    replaceCacheFile(temp, path);
+  }
 
-/*
-** y 軸中心に角度 a 回転する四元数を格納する
-*/
-gg::GgQuaternion &gg::GgQuaternion::loadRotateY(GLfloat a)
-{
-  const GLfloat t(a * 0.5f);
+  // 形状データの頂点バッファオブジェクトを作成する (compact が true なら頂点属性を量子化する)
+  //   dequantize には量子化した位置を元に戻す係数を格納する (量子化しなければ (0, 0, 0, 1))
+  template <typename T>
+  static GgElements *createElements(const GgVertex *vert, GLsizei countv, const T *face, GLsizei countf, bool compact,
+    GgVector &dequantize)
+  {
+    dequantize = GgVector{ 0.0f, 0.0f, 0.0f, 1.0f };
+    if (!compact) return new GgElements(vert, countv, face, countf, GL_TRIANGLES);
 
-  quaternion[1] = sin(t);
-  quaternion[3] = cos(t);
-  quaternion[0] = quaternion[2] = 0.0f;
+    std::vector<GgCompactVertex> quantized;
+    dequantize = ggCompactVertex(vert, countv, quantized);
+    return new GgElements(quantized.data(), countv, dequantize, face, countf, GL_TRIANGLES);
+  }
 
-  return *this;
-}
+  // Alias OBJ 形式のファイルを読み込んで最適化し, キャッシュファイルに保存する (失敗したら false)
+  static bool buildSimpleObj(const char *name, bool normalize, const std::string &path,
+    std::vector<std::array<GLuint, 3>> &group, std::vector<GgSimpleShader::Material> &mat,
+    std::vector<GgVertex> &vert, std::vector<GLuint> &face)
+  {
+    // ファイルを読み込む
+    std::vector<std::string> mtllib;
+    if (!ggLoadSimpleObj(name, group, mat, vert, face, normalize, &mtllib)) return false;
 
-/*
-** z 軸中心に角度 a 回転する四元数を格納する
-*/
-gg::GgQuaternion &gg::GgQuaternion::loadRotateZ(GLfloat a)
-{
-  const GLfloat t(a * 0.5f);
+    // 頂点を共有して頂点キャッシュに乗りやすい順に並べ替える
+    ggOptimizeMesh(group, vert, face);
 
-  quaternion[2] = sin(t);
-  quaternion[3] = cos(t);
-  quaternion[0] = quaternion[1] = 0.0f;
+    // 次回からはキャッシュファイルを使う (頂点数が 65536 以下なら 16 bit の頂点インデックスで保存する)
+    if (!path.empty())
+    {
+      if (vert.size() > 65536)
+        saveMeshCache(path, name, normalize, mtllib, group, mat, vert, face.data(), face.size(), sizeof(GLuint));
+      else
+      {
+        const std::vector<GLushort> face16(face.begin(), face.end());
+        saveMeshCache(path, name, normalize, mtllib, group, mat, vert, face16.data(), face16.size(), sizeof(GLushort));
+      }
+    }
 
-  return *this;
+    return true;
+  }
+
+  // キャッシュファイルがあればそれを, なければ Alias OBJ 形式のファイルを読み込む (失敗したら false)
+  //   GgLoader のワーカースレッドで使うので OpenGL の関数は呼ばない
+  static bool readSimpleObj(const char *name, bool normalize,
+    std::vector<std::array<GLuint, 3>> &group, std::vector<GgSimpleShader::Material> &mat,
+    std::vector<GgVertex> &vert, std::vector<GLuint> &face)
+  {
+    const std::string path(meshCachePath(name, normalize));
+    if (!path.empty())
+    {
+      ggTrace("meshCache");
+      const MappedFile file(path.c_str());
+      const MeshCacheHeader *const header(openMeshCache(file, name, normalize));
+      if (header)
+      {
+        const MeshCacheLayout layout(*header);
+        const auto g(reinterpret_cast<const std::array<GLuint, 3> *>(file.begin() + layout.group));
+        group.assign(g, g + header->group);
+        const auto m(reinterpret_cast<const GgSimpleShader::Material *>(file.begin() + layout.material));
+        mat.assign(m, m + header->material);
+        const auto v(reinterpret_cast<const GgVertex *>(file.begin() + layout.vert));
+        vert.assign(v, v + header->vert);
+        if (header->indexSize == sizeof(GLushort))
+        {
+          const auto f(reinterpret_cast<const GLushort *>(file.begin() + layout.face));
+          face.assign(f, f + header->face);
+        }
+        else
+        {
+          const auto f(reinterpret_cast<const GLuint *>(file.begin() + layout.face));
+          face.assign(f, f + header->face);
+        }
+        return true;
+      }
+    }
+
+    return buildSimpleObj(name, normalize, path, group, mat, vert, face);
+  }
 }
+// \endcond
 
 /*
-** 四元数：オイラー角 (heading, pitch, roll) にもとづいて四元数を求める
+** 形状データのキャッシュを設定する
 */
-gg::GgQuaternion &gg::GgQuaternion::loadEuler(GLfloat heading, GLfloat pitch, GLfloat roll)
+void gg::ggSetMeshCache(const char *dir)
 {
-  GgQuaternion h, p, r;
-
-  h.loadRotateY(heading);
-  p.loadRotateX(pitch);
-  r.loadRotateZ(roll);
-
-  *this = h * p * r;
-
-  return *this;
+  if (dir && *dir)
+  {
+    // キャッシュを保存するディレクトリがなければ作成する
+#if defined(_WIN32)
+    _mkdir(dir);
+#else
+    mkdir(dir, 0755);
+#endif
+    meshCacheDir = dir;
+  }
+  else
+  {
+    meshCacheDir.clear();
+  }
 }
 
+// \cond
 /*
-** 四元数：正規化して格納する
+** 形状データをまとめて描画するのに使うデータと関数
 */
-gg::GgQuaternion &gg::GgQuaternion::loadNormalize(const GLfloat *a)
+namespace gg
 {
-  quaternion[0] = a[0];
-  quaternion[1] = a[1];
-  quaternion[2] = a[2];
-  quaternion[3] = a[3];
+  // glMultiDrawElementsIndirect() の描画コマンド
+  struct DrawElementsIndirectCommand
+  {
+    GLuint count;               // 頂点インデックス数
+    GLuint instanceCount;       // インスタンス数
+    GLuint firstIndex;          // 最初の頂点インデックスの位置
+    GLint baseVertex;           // 頂点インデックスに加える値
+    GLuint baseInstance;        // 描画ごとの頂点属性の番号
+  };
 
-  ggNormalize4(quaternion.data());
+  // 描画ごとの頂点属性
+  struct DrawParameter
+  {
+    GgVector dequantize;        // 量子化した位置を元に戻す係数 (index == 3)
+    GLfloat material[2];        // 材質番号と材質をテクスチャバッファから取り出すことを示す 1 (index == 4)
+  };
 
-  return *this;
+  // glMultiDrawElementsIndirect() が使えるかどうか調べる
+  static bool multiDrawIndirect(const std::vector< std::array<GLuint, 3> > &group, size_t materials)
+  {
+    // 材質番号が材質の数を超えるポリゴングループがあれば使わない
+    for (const auto &g : group) if (g[2] >= materials) return false;
+
+#if defined(__APPLE__)
+    // macOS の OpenGL 4.1 では使えない
+    return false;
+#else
+    static const bool supported([]()
+    {
+      GLint major(0), minor(0);
+      glGetIntegerv(GL_MAJOR_VERSION, &major);
+      glGetIntegerv(GL_MINOR_VERSION, &minor);
+      return ggHasProc("glMultiDrawElementsIndirect") && (major > 4 || (major == 4 && minor >= 3));
+    } ());
+    return supported;
+#endif
+  }
 }
+// \endcond
 
 /*
-** 四元数：共役四元数を格納する
+** Wavefront OBJ 形式のデータ：全てのポリゴングループを一度に描画するためのデータ
+**
+**   ポリゴングループごとの描画コマンドの baseInstance に描画ごとの頂点属性の番号を入れ,
+**   divisor が 1 の頂点属性から材質番号を取り出して, 材質のテクスチャバッファを参照する.
 */
-gg::GgQuaternion &gg::GgQuaternion::loadConjugate(const GLfloat *a)
+struct gg::GgSimpleObj::Batch
 {
-  // w 要素を反転する
-  quaternion[0] = a[0];
-  quaternion[1] = a[1];
-  quaternion[2] = a[2];
-  quaternion[3] = -a[3];
+  // ポリゴングループごとの描画コマンド
+  GgBuffer<DrawElementsIndirectCommand> command;
+
+  // ポリゴングループごとの描画ごとの頂点属性
+  GgBuffer<DrawParameter> parameter;
+
+  // 材質を 4 つの vec4 にして並べたバッファ
+  GgBuffer<GgVector> material;
+
+  // 材質のテクスチャバッファ
+  const GLuint texture;
+
+  // コンストラクタ
+  Batch(const GgElements &data, const std::vector<std::array<GLuint, 3>> &group,
+    const GgSimpleShader::Material *mat, const GgVector &dequantize)
+    : command(GL_DRAW_INDIRECT_BUFFER, nullptr, sizeof(DrawElementsIndirectCommand),
+      static_cast<GLsizei>(group.size()), GL_STATIC_DRAW)
+    , parameter(GL_ARRAY_BUFFER, nullptr, sizeof(DrawParameter),
+      static_cast<GLsizei>(group.size()), GL_STATIC_DRAW)
+    , material(GL_TEXTURE_BUFFER, nullptr, sizeof(GgVector),
+      static_cast<GLsizei>(group.size()) * 4, GL_STATIC_DRAW)
+    , texture([] { GLuint texture; glGenTextures(1, &texture); return texture; } ())
+  {
+    // ポリゴングループごとの描画コマンド, 描画ごとの頂点属性, 材質を作る
+    const std::size_t count(group.size());
+    std::vector<DrawElementsIndirectCommand> c(count);
+    std::vector<DrawParameter> p(count);
+    std::vector<GgVector> m(count * 4);
+    for (std::size_t g = 0; g < count; ++g)
+    {
+      c[g].count = group[g][1];
+      c[g].instanceCount = 1;
+      c[g].firstIndex = group[g][0];
+      c[g].baseVertex = 0;
+      c[g].baseInstance = static_cast<GLuint>(g);
+
+      p[g].dequantize = dequantize;
+      p[g].material[0] = static_cast<GLfloat>(g);
+      p[g].material[1] = 1.0f;
+
+      const GgSimpleShader::Material &s(mat[group[g][2]]);
+      m[g * 4 + 0] = s.ambient;
+      m[g * 4 + 1] = s.diffuse;
+      m[g * 4 + 2] = s.specular;
+      m[g * 4 + 3] = GgVector{ s.shininess, 0.0f, 0.0f, 0.0f };
+    }
+    command.send(c.data(), 0, static_cast<GLsizei>(c.size()));
+    parameter.send(p.data(), 0, static_cast<GLsizei>(p.size()));
+    material.send(m.data(), 0, static_cast<GLsizei>(m.size()));
+
+    // 材質のバッファをテクスチャバッファにする
+    ggBindTexture(GL_TEXTURE_BUFFER, texture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, material.getBuffer());
+    ggBindTexture(GL_TEXTURE_BUFFER, 0);
+
+    // 描画ごとの頂点属性を形状データの頂点配列オブジェクトに設定する
+    ggBindVertexArray(data.get());
+    glBindBuffer(GL_ARRAY_BUFFER, parameter.getBuffer());
+
+    // 量子化した位置を元に戻す係数は描画ごとのものに置き換える
+    if (data.isCompact())
+      glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(DrawParameter),
+        static_cast<const char *>(0) + offsetof(DrawParameter, dequantize));
+
+    // 材質番号は index == 4 の in 変数に描画ごとに入力する (描画するときだけ有効にする)
+    glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(DrawParameter),
+      static_cast<const char *>(0) + offsetof(DrawParameter, material));
+    glVertexAttribDivisor(4, 1);
+  }
 
-  return *this;
-}
+  // デストラクタ
+  ~Batch()
+  {
+    ggDeleteTextures(1, &texture);
+  }
+
+  // first 番目から count 個のポリゴングループを描画する
+  void draw(const GgElements &data, GLint first, GLsizei count) const
+  {
+#if !defined(__APPLE__)
+    // 材質のテクスチャバッファを結合する
+    ggActiveTexture(GL_TEXTURE0 + MaterialTextureUnit);
+    ggBindTexture(GL_TEXTURE_BUFFER, texture);
+    ggActiveTexture(GL_TEXTURE0);
+
+    // 描画ごとの材質番号を有効にして描画する
+    ggBindVertexArray(data.get());
+    glEnableVertexAttribArray(4);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, command.getBuffer());
+    glMultiDrawElementsIndirect(data.getMode(), data.getIndexType(),
+      static_cast<const DrawElementsIndirectCommand *>(0) + first, count, 0);
+    glDisableVertexAttribArray(4);
+#endif
+  }
+};
 
 /*
-** 四元数：逆元を格納する
+** Wavefront OBJ 形式のデータ：コンストラクタ
 */
-gg::GgQuaternion &gg::GgQuaternion::loadInvert(const GLfloat *a)
+gg::GgSimpleObj::GgSimpleObj(const char *name, bool normalize, bool compact)
 {
-  // ノルムの二乗を求める
-  const GLfloat l(ggDot4(a, a));
-
-  if (l > 0.0f)
+  // キャッシュファイルがあればメモリマップしてそのまま頂点バッファオブジェクトに転送する
+  const std::string path(meshCachePath(name, normalize));
+  if (!path.empty())
   {
-    // 共役四元数を求める
-    GgQuaternion r;
-    r.loadConjugate(a);
-
-    // ノルムの二乗で割る
-    quaternion[0] = r.quaternion[0] / l;
-    quaternion[1] = r.quaternion[1] / l;
-    quaternion[2] = r.quaternion[2] / l;
-    quaternion[3] = r.quaternion[3] / l;
+    ggTrace("meshCache");
+    const MappedFile file(path.c_str());
+    const MeshCacheHeader *const header(openMeshCache(file, name, normalize));
+    if (header)
+    {
+      const MeshCacheLayout layout(*header);
+      const auto g(reinterpret_cast<const std::array<GLuint, 3> *>(file.begin() + layout.group));
+      group.assign(g, g + header->group);
+      const GgVertex *const vert(reinterpret_cast<const GgVertex *>(file.begin() + layout.vert));
+      GgVector dequantize;
+      if (header->indexSize == sizeof(GLushort))
+        data.reset(createElements(vert, static_cast<GLsizei>(header->vert),
+          reinterpret_cast<const GLushort *>(file.begin() + layout.face),
+          static_cast<GLsizei>(header->face), compact, dequantize));
+      else
+        data.reset(createElements(vert, static_cast<GLsizei>(header->vert),
+          reinterpret_cast<const GLuint *>(file.begin() + layout.face),
+          static_cast<GLsizei>(header->face), compact, dequantize));
+      const GgSimpleShader::Material *const mat(
+        reinterpret_cast<const GgSimpleShader::Material *>(file.begin() + layout.material));
+      material.reset(new GgSimpleShader::MaterialBuffer(mat, static_cast<GLsizei>(header->material)));
+      if (multiDrawIndirect(group, header->material))
+        batch = std::make_shared<Batch>(*data, group, mat, dequantize);
+      return;
+    }
   }
 
-  return *this;
+  // 作業用のメモリ
+  std::vector<GgSimpleShader::Material> mat;
+  std::vector<GgVertex> vert;
+  std::vector<GLuint> face;
+
+  // ファイルを読み込んで頂点バッファオブジェクトを作成する
+  if (buildSimpleObj(name, normalize, path, group, mat, vert, face)) create(mat, vert, face, compact);
 }
 
 /*
-** 簡易トラックボール処理：リセット
+** Wavefront OBJ 形式のデータ：読み込んだデータから頂点バッファオブジェクトと材質のユニフォームバッファを作成する
 */
-void gg::GgTrackball::reset()
+void gg::GgSimpleObj::create(const std::vector<GgSimpleShader::Material> &mat,
+  const std::vector<GgVertex> &vert, const std::vector<GLuint> &face, bool compact)
 {
-  // ドラッグ中ではない
-  drag = false;
+  // 頂点数が 65536 以下なら 16 bit の頂点インデックスを使う
+  std::vector<GLushort> face16;
+  if (vert.size() <= 65536) face16.assign(face.begin(), face.end());
+
+  // 頂点バッファオブジェクトを作成する
+  GgVector dequantize;
+  if (face16.empty())
+    data.reset(createElements(vert.data(), static_cast<GLsizei>(vert.size()),
+      face.data(), static_cast<GLsizei>(face.size()), compact, dequantize));
+  else
+    data.reset(createElements(vert.data(), static_cast<GLsizei>(vert.size()),
+      face16.data(), static_cast<GLsizei>(face16.size()), compact, dequantize));
 
-  // 単位クォーターニオンで初期化する
-  tq = cq.loadIdentity();
+  // 材質データを設定する
+  material.reset(new GgSimpleShader::MaterialBuffer(mat.data(), static_cast<GLsizei>(mat.size())));
 
-  // 回転行列を初期化する
-  tq.getMatrix(rt);
+  // 使えれば全てのポリゴングループを一度に描画する準備をする
+  if (multiDrawIndirect(group, mat.size())) batch = std::make_shared<Batch>(*data, group, mat.data(), dequantize);
 }
 
 /*
-** 簡易トラックボール処理：トラックボールする領域の設定
-**
-**   Reshape コールバック (resize) の中で実行する
-**   (w, h) ウィンドウサイズ
+** Wavefront OBJ 形式のデータ：図形の描画
 */
-void gg::GgTrackball::region(float w, float h)
+void gg::GgSimpleObj::draw(GLint first, GLsizei count) const
 {
-  // マウスポインタ位置のウィンドウ内の相対的位置への換算用
-  scale[0] = 1.0f / w;
-  scale[1] = 1.0f / h;
+  // 保持しているグループの数
+  const GLsizei ng(static_cast<GLsizei>(group.size()));
+
+  // 描画する最後のグループの次
+  GLsizei last(count <= static_cast<GLsizei>(0) ? ng : first + count);
+  if (last > ng) last = ng;
+
+  // 使えれば一回の呼び出しで描画する
+  if (batch)
+  {
+    if (last > first) batch->draw(*data, first, last - first);
+    return;
+  }
+
+  for (GLsizei g = first; g < last; ++g)
+  {
+    // 材質を設定する
+    material->select(group[g][2]);
+
+    // 図形を描画する
+    data->draw(group[g][0], group[g][1]);
+  }
 }
 
 /*
-** 簡易トラックボール処理：ドラッグ開始時の処理
-**
-**   マウスボタンを押したときに実行する
-**   (x, y) 現在のマウス位置
+** GPU の処理時間の計測：デストラクタ
 */
-void gg::GgTrackball::begin(float x, float y)
+gg::GgProfiler::~GgProfiler()
 {
-  // ドラッグ開始
-  drag = true;
-
-  // ドラッグ開始点を記録する
-  start[0] = x;
-  start[1] = y;
+  // タイムスタンプのクエリを削除する
+  for (auto &s : section) glDeleteQueries(4, *s.query);
 }
 
 /*
-** 簡易トラックボール処理：ドラッグ中の処理
+** GPU の処理時間の計測：計測区間を追加する
 **
-**   マウスのドラッグ中に実行する
-**   (x, y) 現在のマウス位置
+**   name 計測区間の名前
+**   戻り値 計測区間の番号
 */
-void gg::GgTrackball::motion(float x, float y)
+GLuint gg::GgProfiler::add(const char *name)
 {
-  if (drag)
-  {
-    // マウスポインタの位置のドラッグ開始位置からの変位
-    const float d[] = { (x - start[0]) * scale[0], (y - start[1]) * scale[1] };
+  // 計測区間を追加する
+  section.emplace_back();
+  Section &s(section.back());
 
-    // マウスポインタの位置のドラッグ開始位置からの距離
-    const float a(sqrt(d[0] * d[0] + d[1] * d[1]));
+  // 区間名を設定する
+  s.name = name;
 
-    if (a != 0.0)
-    {
-      // 現在の回転の四元数に作った四元数を掛けて合成する
-      tq = ggRotateQuaternion(d[1], d[0], 0.0f, a * 6.283185f) * cq;
+  // タイムスタンプのクエリを作成する
+  glGenQueries(4, *s.query);
 
-      // 合成した四元数から回転の変換行列を求める
-      tq.getMatrix(rt);
-    }
-  }
+  // まだクエリを発行していない
+  s.issued[0] = s.issued[1] = false;
+
+  // 計測値の履歴を確保する
+  s.sample.resize(history, 0.0);
+  s.next = s.count = 0;
+
+  // 追加した計測区間の番号を返す
+  return static_cast<GLuint>(section.size() - 1);
 }
 
 /*
-** 簡易トラックボール処理：回転角の修正
-**
-**   現在の回転角を修正する
-**   q 修正分の回転角を表す四元数
+** GPU の処理時間の計測：フレームを切り替えて前のフレームの計測結果を回収する
 */
-void gg::GgTrackball::rotate(const GgQuaternion &q)
+void gg::GgProfiler::update()
 {
-  if (!drag)
-  {
-    // 保存されている四元数に修正分の四元数を掛けて合成する
-    tq = q * cq;
+  // 次にクエリを発行するフレームに切り替える
+  frame = 1 - frame;
 
-    // 合成した四元数から回転の変換行列を求める
-    tq.getMatrix(rt);
+  for (auto &s : section)
+  {
+    // このフレームのクエリが発行されていなければ何もしない
+    if (!s.issued[frame]) continue;
+
+    // 終了時刻のクエリの結果が得られているか調べる
+    //   得られていなければ待たずにこの計測値は捨てる
+    GLint available;
+    glGetQueryObjectiv(s.query[frame][1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available)
+    {
+      // 開始時刻と終了時刻を取り出す
+      GLuint64 t0, t1;
+      glGetQueryObjectui64v(s.query[frame][0], GL_QUERY_RESULT, &t0);
+      glGetQueryObjectui64v(s.query[frame][1], GL_QUERY_RESULT, &t1);
+
+      // ナノ秒単位の差をミリ秒単位で記録する
+      s.sample[s.next] = static_cast<double>(t1 - t0) * 1.0e-6;
+      if (++s.next >= history) s.next = 0;
+      if (s.count < history) ++s.count;
+    }
 
-    // 誤差を吸収するために正規化して保存する
-    cq = tq.normalize();
+    // このフレームのクエリは再利用できる
+    s.issued[frame] = false;
   }
 }
 
 /*
-** 簡易トラックボール処理：停止時の処理
-**
-**   マウスボタンを離したときに実行する
-**   (x, y) 現在のマウス位置
+** GPU の処理時間の計測：最新の計測値を得る
 */
-void gg::GgTrackball::end(float x, float y)
+double gg::GgProfiler::getLatest(GLuint i) const
 {
-  // ドラッグ終了点における回転を求める
-  motion(x, y);
-
-  // 誤差を吸収するために正規化して保存する
-  cq = tq.normalize();
-
-  // ドラッグ終了
-  drag = false;
+  const Section &s(section[i]);
+  return s.count > 0 ? s.sample[(s.next + history - 1) % history] : 0.0;
 }
 
 /*
-** 点：描画
+** GPU の処理時間の計測：計測値の平均を得る
 */
-void gg::GgPoints::draw(GLint first, GLsizei count) const
+double gg::GgProfiler::getAverage(GLuint i) const
 {
-  // 頂点配列オブジェクトを指定する
-  GgShape::draw(first, count);
+  const Section &s(section[i]);
+  if (s.count == 0) return 0.0;
 
-  // 図形を描画する
-  glDrawArrays(getMode(), first, count > 0 ? count : getCount() - first);
+  double sum(0.0);
+  for (size_t j = 0; j < s.count; ++j) sum += s.sample[j];
+  return sum / static_cast<double>(s.count);
 }
 
 /*
-** 三角形：描画
+** GPU の処理時間の計測：計測値の最小値を得る
 */
-void gg::GgTriangles::draw(GLint first, GLsizei count) const
+double gg::GgProfiler::getMin(GLuint i) const
 {
-  // 頂点配列オブジェクトを指定する
-  GgShape::draw(first, count);
+  const Section &s(section[i]);
+  if (s.count == 0) return 0.0;
 
-  // 図形を描画する
-  glDrawArrays(getMode(), first, count > 0 ? count : getCount() - first);
+  double value(s.sample[0]);
+  for (size_t j = 1; j < s.count; ++j) if (s.sample[j] < value) value = s.sample[j];
+  return value;
 }
 
 /*
-** オブジェクト：描画
+** GPU の処理時間の計測：計測値の最大値を得る
 */
-void gg::GgElements::draw(GLint first, GLsizei count) const
+double gg::GgProfiler::getMax(GLuint i) const
 {
-  // 頂点配列オブジェクトを指定する
-  GgShape::draw(first, count);
+  const Section &s(section[i]);
+  if (s.count == 0) return 0.0;
 
-  // 図形を描画する
-  glDrawElements(getMode(), count > 0 ? count : getIndexCount() - first,
-    GL_UNSIGNED_INT, static_cast<GLuint *>(0) + first);
+  double value(s.sample[0]);
+  for (size_t j = 1; j < s.count; ++j) if (s.sample[j] > value) value = s.sample[j];
+  return value;
 }
 
 /*
-** 点群を立方体状に生成する
+** GPU の処理時間の計測：計測結果の一覧を文字列で得る
 */
-gg::GgPoints *gg::ggPointsCube(GLsizei count, GLfloat length, GLfloat cx, GLfloat cy, GLfloat cz)
+std::string gg::GgProfiler::summary() const
 {
-  // メモリを確保する
-  std::vector<GgVector> pos;
-  pos.reserve(count);
+  std::ostringstream str;
+  str.setf(std::ios::fixed);
+  str.precision(3);
 
-  // 点を生成する
-  for (GLsizei v = 0; v < count; ++v)
+  for (GLuint i = 0; i < size(); ++i)
   {
-    const GgVector p =
-    {
-      (static_cast<GLfloat>(rand()) / static_cast<float>(RAND_MAX) - 0.5f) * length + cx,
-      (static_cast<GLfloat>(rand()) / static_cast<float>(RAND_MAX) - 0.5f) * length + cy,
-      (static_cast<GLfloat>(rand()) / static_cast<float>(RAND_MAX) - 0.5f) * length + cz,
-      1.0f
-    };
-
-    pos.emplace_back(p);
+    if (i > 0) str << ", ";
+    str << section[i].name << " " << getAverage(i) << "ms";
   }
 
-  // 点データの GgPoints オブジェクトを作成する
-  GgPoints *const points(new GgPoints(pos.data(), static_cast<GLuint>(pos.size()), GL_POINTS));
-
-  // GgPoints オブジェクトを返す
-  return points;
+  return str.str();
 }
 
 /*
-** 点群を球状に生成する
+** GPU の処理時間の計測：計測結果を CSV 形式で保存する
+**
+**   name 保存するファイル名
+**   戻り値 保存に成功したら true
 */
-gg::GgPoints *gg::ggPointsSphere(GLsizei count, GLfloat radius,
-  GLfloat cx, GLfloat cy, GLfloat cz)
+bool gg::GgProfiler::saveCsv(const char *name) const
 {
-  // メモリを確保する
-  std::vector<GgVector> pos;
-  pos.reserve(count);
-
-  // 点を生成する
-  for (GLsizei v = 0; v < count; ++v)
+  // 保存先のファイルを開く
+  std::ofstream file(name);
+  if (!file)
   {
-    const float r(radius * static_cast<float>(rand()) / static_cast<float>(RAND_MAX));
-    const float t(6.2831853f * static_cast<float>(rand()) / (static_cast<float>(RAND_MAX) + 1.0f));
-    const float cp(2.0f * static_cast<float>(rand()) / static_cast<float>(RAND_MAX) - 1.0f);
-    const float sp(sqrt(1.0f - cp * cp));
-    const float ct(cos(t));
-    const float st(sin(t));
+#if defined(DEBUG)
+    std::cerr << "Warning: Can't open file: " << name << std::endl;
+#endif
+    return false;
+  }
 
-    const GgVector p = { r * sp * ct + cx, r * sp * st + cy, r * cp + cz, 1.0f };
+  // 見出しを書き出す
+  file << "pass,count,latest,average,min,max\n";
 
-    pos.emplace_back(p);
+  // 計測区間ごとの統計を書き出す
+  for (GLuint i = 0; i < size(); ++i)
+  {
+    file << section[i].name << ',' << getCount(i) << ',' << getLatest(i) << ','
+      << getAverage(i) << ',' << getMin(i) << ',' << getMax(i) << '\n';
   }
 
-  // 点データの GgPoints オブジェクトを作成する
-  GgPoints *const points(new GgPoints(pos.data(), static_cast<GLsizei>(pos.size()), GL_POINTS));
-
-  // GgPoints オブジェクトを返す
-  return points;
+  // 書き出しに失敗していないか調べる
+  file.close();
+  return !file.fail();
 }
 
 /*
-** 矩形状に 2 枚の三角形を生成する
+** GPU の処理時間の計測：計測結果を JSON 形式で保存する
+**
+**   name 保存するファイル名
+**   戻り値 保存に成功したら true
 */
-gg::GgTriangles *gg::ggRectangle(GLfloat width, GLfloat height)
+bool gg::GgProfiler::saveJson(const char *name) const
 {
-  // 頂点属性
-  std::array<GgVertex, 4> vert;
-
-  // 頂点位置と法線を求める
-  for (int v = 0; v < 4; ++v)
+  // 保存先のファイルを開く
+  std::ofstream file(name);
+  if (!file)
   {
-    const GLfloat x(((v & 1) * 2 - 1) * width);
-    const GLfloat y(((v & 2) - 1) * height);
+#if defined(DEBUG)
+    std::cerr << "Warning: Can't open file: " << name << std::endl;
+#endif
+    return false;
+  }
 
-    vert[v] = GgVertex(x, y, 0.0f, 0.0f, 0.0f, 1.0f);
+  // 計測区間ごとの統計を配列にして書き出す
+  file << "{\"unit\":\"ms\",\"passes\":[";
+  for (GLuint i = 0; i < size(); ++i)
+  {
+    if (i > 0) file << ',';
+    file << "\n{\"name\":\"" << section[i].name << "\",\"count\":" << getCount(i)
+      << ",\"latest\":" << getLatest(i) << ",\"average\":" << getAverage(i)
+      << ",\"min\":" << getMin(i) << ",\"max\":" << getMax(i) << '}';
   }
+  file << "\n]}\n";
 
-  // 矩形の GgTrianges オブジェクトを作成する
-  return new GgTriangles(vert.data(), static_cast<GLsizei>(vert.size()), GL_TRIANGLE_STRIP);
+  // 書き出しに失敗していないか調べる
+  file.close();
+  return !file.fail();
 }
 
 /*
-** 楕円状に三角形を生成する
+** GPU の処理時間の計測：計測結果を保存する
+**
+**   name 保存するファイル名 (拡張子が .json なら JSON 形式, それ以外は CSV 形式)
+**   戻り値 保存に成功したら true
 */
-gg::GgTriangles *gg::ggEllipse(GLfloat width, GLfloat height, GLuint slices)
+bool gg::GgProfiler::save(const char *name) const
 {
-  // 楕円のスケール
-  constexpr GLfloat scale(0.5f);
-
-  // 作業用のメモリ
-  std::vector<GgVertex> vert;
-  vert.reserve(slices);
+  const std::string path(name);
+  const size_t ext(path.find_last_of('.'));
+  if (ext != std::string::npos && path.compare(ext, std::string::npos, ".json") == 0) return saveJson(name);
+  return saveCsv(name);
+}
 
-  // 頂点位置と法線を求める
-  for (GLuint v = 0; v < slices; ++v)
+// \cond
+namespace gg
+{
+  // デプスバッファの内部フォーマットなら true
+  static bool isDepthFormat(GLenum format)
   {
-    const GLfloat t(6.2831853f * static_cast<float>(v) / static_cast<float>(slices));
-    const GLfloat x(cos(t) * width * scale);
-    const GLfloat y(sin(t) * height * scale);
-
-    vert.emplace_back(x, y, 0.0f, 0.0f, 0.0f, 1.0f);
+    return format == GL_DEPTH_COMPONENT16 || format == GL_DEPTH_COMPONENT24
+      || format == GL_DEPTH_COMPONENT32 || format == GL_DEPTH_COMPONENT32F
+      || format == GL_DEPTH24_STENCIL8 || format == GL_DEPTH32F_STENCIL8;
   }
 
-  // GgTriangles オブジェクトを作成する
-  return new GgTriangles(vert.data(), static_cast<GLsizei>(vert.size()), GL_TRIANGLE_FAN);
+  // ステンシルを含むデプスバッファの内部フォーマットなら true
+  static bool isStencilFormat(GLenum format)
+  {
+    return format == GL_DEPTH24_STENCIL8 || format == GL_DEPTH32F_STENCIL8;
+  }
 }
+// \endcond
 
 /*
-** Wavefront OBJ ファイルを読み込む (Arrays 形式)
+** 描画パスの依存関係にもとづく描画の手順：デストラクタ
 */
-gg::GgTriangles *gg::ggArraysObj(const char *name, bool normalize)
+gg::GgRenderGraph::~GgRenderGraph()
 {
-  std::vector< std::array<GLuint, 3> > group;
-  std::vector<GgSimpleShader::Material> material;
-  std::vector<GgVertex> vert;
-
-  // ファイルを読み込む
-  if (!ggLoadSimpleObj(name, group, material, vert, normalize)) return 0;
+  // 割り当てたテクスチャとフレームバッファオブジェクトを削除する
+  release();
 
-  // GgTriangles オブジェクトを作成する
-  return new GgTriangles(vert.data(), static_cast<GLsizei>(vert.size()), GL_TRIANGLES);
+  // 残っている同期オブジェクトを削除する
+  for (auto &r : resource) if (r.sync) glDeleteSync(r.sync);
 }
 
 /*
-** Wavefront OBJ ファイル を読み込む (Elements 形式)
+** 描画パスの依存関係にもとづく描画の手順：資源を追加する
 */
-gg::GgElements *gg::ggElementsObj(const char *name, bool normalize)
+GLuint gg::GgRenderGraph::addResource(const char *name, Kind kind, GLuint object, bool transient,
+  GLenum format, GLsizei width, GLsizei height, bool readback)
 {
-  std::vector< std::array<GLuint, 3> > group;
-  std::vector<GgSimpleShader::Material> material;
-  std::vector<GgVertex> vert;
-  std::vector<GLuint> face;
+  resource.push_back(Resource{ name, kind, object, transient, format, width, height, readback, false, nullptr });
+  dirty = true;
+  return static_cast<GLuint>(resource.size() - 1);
+}
 
-  // ファイルを読み込む
-  if (!ggLoadSimpleObj(name, group, material, vert, face, normalize)) return 0;
+/*
+** 描画パスの依存関係にもとづく描画の手順：割り当てたテクスチャとフレームバッファオブジェクトを削除する
+*/
+void gg::GgRenderGraph::release()
+{
+  if (!framebuffer.empty()) glDeleteFramebuffers(static_cast<GLsizei>(framebuffer.size()), framebuffer.data());
+  framebuffer.clear();
+  for (const auto &t : texture) ggDeleteTextures(1, &t.texture);
+  texture.clear();
 
-  // GgElements オブジェクトを作成する
-  return new GgElements(vert.data(), static_cast<GLsizei>(vert.size()),
-    face.data(), static_cast<GLsizei>(face.size()), GL_TRIANGLES);
+  // 一時的なレンダーターゲットにはテクスチャが割り当てられていない
+  for (auto &r : resource) if (r.transient) r.object = 0;
 }
 
 /*
-** メッシュ形状を作成する (Elements 形式)
+** 描画パスの依存関係にもとづく描画の手順：一時的なレンダーターゲットに割り当てるテクスチャを作成する
 */
-gg::GgElements *gg::ggElementsMesh(GLuint slices, GLuint stacks, const GLfloat (*pos)[3], const GLfloat (*norm)[3])
+gg::GgRenderGraph::Target gg::GgRenderGraph::allocate(const Resource &r, std::vector<Target> &spare)
 {
-  // 頂点属性
-  std::vector<GgVertex> vert;
-  vert.reserve((slices + 1) * (stacks + 1));
-
-  // 頂点の法線を求める
-  for (GLuint j = 0; j <= stacks; ++j)
+  // 前回割り当てた同じ形式のテクスチャがあればそれを使う
+  for (auto t = spare.begin(); t != spare.end(); ++t)
   {
-    for (GLuint i = 0; i <= slices; ++i)
+    if (t->format == r.format && t->width == r.width && t->height == r.height)
     {
-      // 処理対象の頂点番号
-      const GLuint k(j * (slices + 1) + i);
+      const Target target(*t);
+      spare.erase(t);
+      return target;
+    }
+  }
 
-      // 頂点の法線
-      GgVector tnorm;
-      tnorm[3] = 0.0f;
+  // 新しいテクスチャを作成する
+  Target target{ 0, r.format, r.width, r.height, -1 };
+  glGenTextures(1, &target.texture);
+  ggBindTexture(GL_TEXTURE_2D, target.texture);
+#if defined(__APPLE__)
+  const GLenum format(isStencilFormat(r.format) ? GL_DEPTH_STENCIL : isDepthFormat(r.format) ? GL_DEPTH_COMPONENT : GL_RGBA);
+  const GLenum type(r.format == GL_DEPTH32F_STENCIL8 ? GL_FLOAT_32_UNSIGNED_INT_24_8_REV
+    : r.format == GL_DEPTH24_STENCIL8 ? GL_UNSIGNED_INT_24_8 : isDepthFormat(r.format) ? GL_FLOAT : GL_UNSIGNED_BYTE);
+  glTexImage2D(GL_TEXTURE_2D, 0, r.format, r.width, r.height, 0, format, type, nullptr);
+#else
+  glTexStorage2D(GL_TEXTURE_2D, 1, r.format, r.width, r.height);
+#endif
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  ggBindTexture(GL_TEXTURE_2D, 0);
 
-      if (norm)
-      {
-        tnorm[0] = norm[k][0];
-        tnorm[1] = norm[k][1];
-        tnorm[2] = norm[k][2];
-      }
-      else
-      {
-        // 処理対象の頂点の周囲の頂点番号
-        const GLuint kim(i > 0 ? k - 1 : k);
-        const GLuint kip(i < slices ? k + 1 : k);
-        const GLuint kjm(j > 0 ? k - slices - 1 : k);
-        const GLuint kjp(j < stacks ? k + slices + 1 : k);
+  return target;
+}
 
-        // 接線ベクトル
-        const std::array<GLfloat, 3> t =
-        {
-          pos[kip][0] - pos[kim][0],
-          pos[kip][1] - pos[kim][1],
-          pos[kip][2] - pos[kim][2]
-        };
+/*
+** 描画パスの依存関係にもとづく描画の手順：描画パスを追加する
+*/
+GLuint gg::GgRenderGraph::addPass(const char *name, std::function<void()> execute)
+{
+  pass.emplace_back();
+  Pass &p(pass.back());
+  p.name = name;
+  p.execute = execute;
+  p.barrier = 0;
+  p.framebuffer = -1;
+  p.width = p.height = 0;
+  p.complete = true;
+  p.live = false;
+
+  // 描画パス名を計測区間名にする
+  p.section = profiler.add(name);
+
+  dirty = true;
+  return static_cast<GLuint>(pass.size() - 1);
+}
 
-        // 従接線ベクトル
-        const std::array<GLfloat, 3> b =
-        {
-          pos[kjp][0] - pos[kjm][0],
-          pos[kjp][1] - pos[kjm][1],
-          pos[kjp][2] - pos[kjm][2]
-        };
+/*
+** 描画パスの依存関係にもとづく描画の手順：描画パスの実行順を求めて一時的なレンダーターゲットを割り当てる
+**
+**   描画パスは追加した順に資源を読み書きするものとして依存関係を求める.
+*/
+bool gg::GgRenderGraph::compile()
+{
+  ggTrace("compile");
 
-        // 法線
-        tnorm[0] = t[1] * b[2] - t[2] * b[1];
-        tnorm[1] = t[2] * b[0] - t[0] * b[2];
-        tnorm[2] = t[0] * b[1] - t[1] * b[0];
+  // 前回割り当てたテクスチャは同じ形式のものに使い回す
+  std::vector<Target> spare;
+  spare.swap(texture);
+  release();
+  order.clear();
+  dirty = false;
 
-        // 法線の正規化
-        ggNormalize3(tnorm.data());
+  const size_t passes(pass.size());
+  const size_t resources(resource.size());
+
+  // 描画パスが後に実行しなければならない描画パスと, そのうち読み出す資源を書き込む描画パス
+  std::vector<std::vector<GLuint>> after(passes), source(passes);
+
+  // それぞれの資源に最後に書き込んだ描画パスと, その後に読み出した描画パス
+  std::vector<GLint> writer(resources, -1);
+  std::vector<std::vector<GLuint>> reader(resources);
+
+  for (GLuint i = 0; i < passes; ++i)
+  {
+    Pass &p(pass[i]);
+    p.live = false;
+    p.barrier = 0;
+    p.framebuffer = -1;
+    p.width = p.height = 0;
+    p.complete = true;
+    p.fence.clear();
+
+    // 読み出す資源はそれを書き込む描画パスの後に実行する
+    for (const auto &a : p.read)
+    {
+      const GLint w(writer[a.resource]);
+      if (w >= 0 && static_cast<GLuint>(w) != i)
+      {
+        after[i].push_back(w);
+        source[i].push_back(w);
       }
+      reader[a.resource].push_back(i);
+    }
 
-      // 頂点の位置
-      const GgVector tpos = { pos[k][0], pos[k][1], pos[k][2], 1.0f };
+    // 書き込む資源はそれを読み出す描画パスと前に書き込んだ描画パスの後に実行する
+    for (const auto r : p.write)
+    {
+      for (const auto q : reader[r]) if (q != i) after[i].push_back(q);
+      if (writer[r] >= 0 && static_cast<GLuint>(writer[r]) != i) after[i].push_back(writer[r]);
+      writer[r] = i;
+      reader[r].clear();
+    }
 
-      // 頂点属性の保存
-      vert.emplace_back(tpos, tnorm);
+    // 先に追加した描画パスから順に並べる
+    std::sort(after[i].begin(), after[i].end());
+    after[i].erase(std::unique(after[i].begin(), after[i].end()), after[i].end());
+  }
+
+  // 出力に最後に書き込む描画パスから読み出す資源をたどって実行する描画パスを選ぶ
+  std::vector<GLuint> root, stack;
+  for (GLuint r = 0; r < resources; ++r)
+  {
+    if (resource[r].output && writer[r] >= 0)
+    {
+      root.push_back(writer[r]);
+      stack.push_back(writer[r]);
     }
   }
+  while (!stack.empty())
+  {
+    const GLuint i(stack.back());
+    Pass &p(pass[i]);
+    stack.pop_back();
+    if (p.live) continue;
+    p.live = true;
+    for (const auto q : source[i]) if (!pass[q].live) stack.push_back(q);
+  }
 
-  // 頂点のインデックス (三角形データ)
-  std::vector<GLuint> face;
+  // 出力から深さ優先でたどり, 資源を書き込む描画パスをそれを使う描画パスの直前に置く
+  std::vector<char> state(passes, 0);
+  std::function<void(GLuint)> visit = [&](GLuint i)
+  {
+    if (state[i]) return;
+    state[i] = 1;
+    for (const auto q : after[i]) if (pass[q].live) visit(q);
+    order.push_back(i);
+  };
+  for (const auto i : root) visit(i);
 
-  // 頂点のインデックスを求める
-  for (GLuint j = 0; j < stacks; ++j)
+  // 一時的なレンダーターゲットの使用期間
+  std::vector<GLint> first(resources, -1), last(resources, -1);
+  const auto use([&](GLuint r, GLint t)
   {
-    for (GLuint i = 0; i < slices; ++i)
-    {
-      // 処理対象のマス
-      const GLuint k((slices + 1) * j + i);
+    if (first[r] < 0) first[r] = t;
+    last[r] = t;
+  });
+  for (GLint t = 0; t < static_cast<GLint>(order.size()); ++t)
+  {
+    const Pass &p(pass[order[t]]);
+    for (const auto &a : p.read) use(a.resource, t);
+    for (const auto r : p.write) use(r, t);
+  }
 
-      // マスの上半分の三角形
-      face.emplace_back(k);
-      face.emplace_back(k + slices + 2);
-      face.emplace_back(k + 1);
+  // 使用開始の早いものから順に, 使用期間が重ならない同じ形式のテクスチャを共用する
+  std::vector<GLuint> transient;
+  for (GLuint r = 0; r < resources; ++r) if (resource[r].transient && first[r] >= 0) transient.push_back(r);
+  std::stable_sort(transient.begin(), transient.end(), [&](GLuint a, GLuint b) { return first[a] < first[b]; });
+  for (const auto r : transient)
+  {
+    Resource &s(resource[r]);
 
-      // マスのお下半分の三角形
-      face.emplace_back(k);
-      face.emplace_back(k + slices + 1);
-      face.emplace_back(k + slices + 2);
+    // 使用を終えた同じ形式のテクスチャを探して, 見つからなければ新たに割り当てる
+    size_t k(0);
+    while (k < texture.size())
+    {
+      const Target &t(texture[k]);
+      if (t.until < first[r] && t.format == s.format && t.width == s.width && t.height == s.height) break;
+      ++k;
     }
-  }
+    if (k == texture.size()) texture.push_back(allocate(s, spare));
 
-  // GgElements オブジェクトを作成する
-  return new GgElements(vert.data(), static_cast<GLsizei>(vert.size()),
-    face.data(), static_cast<GLsizei>(face.size()), GL_TRIANGLES);
-}
+    // テクスチャを割り当てて使用期間の終わりを記録する
+    s.object = texture[k].texture;
+    texture[k].until = last[r];
+  }
 
-/*
-** 球状に三角形データを生成する (Elements 形式)
-*/
-gg::GgElements *gg::ggElementsSphere(GLfloat radius, int slices, int stacks)
-{
-  // 頂点の位置と法線
-  std::vector<GLfloat> p, n;
+  // 使い回さなかったテクスチャを削除する
+  for (const auto &t : spare) ggDeleteTextures(1, &t.texture);
 
-  // 頂点の位置と法線を求める
-  for (int j = 0; j <= stacks; ++j)
+  // それぞれの描画パスの描画先とメモリバリアと同期オブジェクトを決める
+  bool complete(true);
+  std::vector<char> written(resources, 0);
+  std::vector<GLint> lastWriter(resources, -1);
+  for (const auto i : order)
   {
-    const float t(static_cast<float>(j) / static_cast<float>(stacks));
-    const float ph(3.141593f * t);
-    const float y(cosf(ph));
-    const float r(sinf(ph));
+    Pass &p(pass[i]);
 
-    for (int i = 0; i <= slices; ++i)
+    // この描画パスより前に書き込まれた資源を読み出す前にメモリバリアを置く
+    for (const auto &a : p.read) if (written[a.resource]) p.barrier |= a.barrier;
+
+    // 一時的なレンダーターゲットを取り付けたフレームバッファオブジェクトを作成する
+    std::vector<GLenum> buffers;
+    GLuint fb(0);
+    for (const auto r : p.write)
     {
-      const float s(static_cast<float>(i) / static_cast<float>(slices));
-      const float th(-2.0f * 3.141593f * s);
-      const float x(r * cosf(th));
-      const float z(r * sinf(th));
+      written[r] = 1;
+      lastWriter[r] = i;
+      const Resource &s(resource[r]);
 
-      // 頂点の座標値
-      p.push_back(x * radius);
-      p.push_back(y * radius);
-      p.push_back(z * radius);
+      // 外部のフレームバッファオブジェクトに書き込むならそれを描画先にする
+      if (s.kind == Framebuffer)
+      {
+        if (p.framebuffer < 0) p.framebuffer = s.object;
+        continue;
+      }
+      if (!s.transient) continue;
 
-      // 頂点の法線
-      n.push_back(x);
-      n.push_back(y);
-      n.push_back(z);
+      // 最初の一時的なレンダーターゲットでフレームバッファオブジェクトを作成する
+      if (fb == 0)
+      {
+        glGenFramebuffers(1, &fb);
+        glBindFramebuffer(GL_FRAMEBUFFER, fb);
+        framebuffer.push_back(fb);
+        p.framebuffer = fb;
+        p.width = s.width;
+        p.height = s.height;
+      }
+
+      // デプスバッファかカラーバッファとして取り付ける
+      if (isDepthFormat(s.format))
+      {
+        glFramebufferTexture2D(GL_FRAMEBUFFER, isStencilFormat(s.format) ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT,
+          GL_TEXTURE_2D, s.object, 0);
+      }
+      else
+      {
+        const GLenum attachment(GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(buffers.size()));
+        glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, s.object, 0);
+        buffers.push_back(attachment);
+      }
+    }
+
+    // 作成したフレームバッファオブジェクトの描画先を設定して完全か調べる
+    if (fb != 0)
+    {
+      if (buffers.empty())
+      {
+        glDrawBuffer(GL_NONE);
+        glReadBuffer(GL_NONE);
+      }
+      else
+      {
+        glDrawBuffers(static_cast<GLsizei>(buffers.size()), buffers.data());
+      }
+      if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+      {
+        // 完全でないフレームバッファオブジェクトに描画する描画パスは実行しない
+        p.complete = complete = false;
+      }
     }
   }
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
-  // GgElements オブジェクトを作成する
-  return ggElementsMesh(slices, stacks, reinterpret_cast<GLfloat (*)[3]>(&p[0]),
-    reinterpret_cast<GLfloat (*)[3]>(&n[0]));
+  // CPU が読み出すバッファオブジェクトに最後に書き込む描画パスの後に同期オブジェクトを挿入する
+  for (GLuint r = 0; r < resources; ++r)
+    if (resource[r].readback && lastWriter[r] >= 0) pass[lastWriter[r]].fence.push_back(r);
+
+  return complete;
 }
 
 /*
-** 三角形に単純な陰影付けを行うシェーダが参照する光源データ：光源の強度の環境光成分を設定する
-**
-**   r 光源の強度の環境光成分の赤成分
-**   g 光源の強度の環境光成分の緑成分
-**   b 光源の強度の環境光成分の青成分
-**   a 光源の強度の環境光成分の不透明度, デフォルトは 1
-**   first 値を設定する光源データの最初の番号, デフォルトは 0
-**   count 値を設定する光源データの数, デフォルトは 1
+** 描画パスの依存関係にもとづく描画の手順：描画パスを実行順に実行する
 */
-void gg::GgSimpleShader::LightBuffer::loadAmbient(GLfloat r, GLfloat g, GLfloat b, GLfloat a,
-  GLint first, GLsizei count) const
+void gg::GgRenderGraph::execute()
 {
-  // データを格納するバッファオブジェクトの先頭のポインタ
-  char *const start(static_cast<char *>(map(first, count)));
-  for (GLsizei i = 0; i < count; ++i)
+  // 描画パスか資源が変更されていれば実行順を求め直す
+  if (dirty && !compile())
   {
-    // バッファオブジェクトの i 番目のブロックのポインタ
-    Light *const light(reinterpret_cast<Light *>(start + getStride() * i));
-
-    // 光源の環境光成分を設定する
-    light->ambient[0] = r;
-    light->ambient[1] = g;
-    light->ambient[2] = b;
-    light->ambient[3] = a;
+#if defined(DEBUG)
+    for (const auto i : order)
+    {
+      if (!pass[i].complete)
+        std::cerr << "Warning: Incomplete framebuffer, skipping render pass: " << pass[i].name << std::endl;
+    }
+#endif
   }
-  unmap();
-}
 
-/*
-** 三角形に単純な陰影付けを行うシェーダが参照する光源データ：光源の強度の拡散反射光成分を設定する
-**
-**   r 光源の強度の拡散反射光成分の赤成分
-**   g 光源の強度の拡散反射光成分の緑成分
-**   b 光源の強度の拡散反射光成分の青成分
-**   a 光源の強度の拡散反射光成分の不透明度, デフォルトは 1
-**   first 値を設定する光源データの最初の番号, デフォルトは 0
-**   count 値を設定する光源データの数, デフォルトは 1
-*/
-void gg::GgSimpleShader::LightBuffer::loadDiffuse(GLfloat r, GLfloat g, GLfloat b, GLfloat a,
-  GLint first, GLsizei count) const
-{
-  // データを格納するバッファオブジェクトの先頭のポインタ
-  char *const start(static_cast<char *>(map(first, count)));
-  for (GLsizei i = 0; i < count; ++i)
-  {
-    // バッファオブジェクトの i 番目のブロックのポインタ
-    Light *const light(reinterpret_cast<Light *>(start + getStride() * i));
+  // ビューポートが設定されていなければ一度だけ取得する
+  if (viewport[2] == 0 || viewport[3] == 0) glGetIntegerv(GL_VIEWPORT, viewport.data());
 
-    // 光源の拡散反射光成分を設定する
-    light->diffuse[0] = r;
-    light->diffuse[1] = g;
-    light->diffuse[2] = b;
-    light->diffuse[3] = a;
-  }
-  unmap();
-}
+  // 現在の描画先 (ウィンドウのフレームバッファから始まる) とビューポートの大きさ
+  GLint current(0);
+  GLsizei width(viewport[2]), height(viewport[3]);
 
-/*
-** 三角形に単純な陰影付けを行うシェーダが参照する光源データ：光源の強度の鏡面反射光成分を設定する
-**
-**   r 光源の強度の鏡面反射光成分の赤成分
-**   g 光源の強度の鏡面反射光成分の緑成分
-**   b 光源の強度の鏡面反射光成分の青成分
-**   a 光源の強度の鏡面反射光成分の不透明度, デフォルトは 1
-**   first 値を設定する光源データの最初の番号, デフォルトは 0
-**   count 値を設定する光源データの数, デフォルトは 1
-*/
-void gg::GgSimpleShader::LightBuffer::loadSpecular(GLfloat r, GLfloat g, GLfloat b, GLfloat a,
-  GLint first, GLsizei count) const
-{
-  // データを格納するバッファオブジェクトの先頭のポインタ
-  char *const start(static_cast<char *>(map(first, count)));
-  for (GLsizei i = 0; i < count; ++i)
+  for (const auto i : order)
   {
-    // バッファオブジェクトの i 番目のブロックのポインタ
-    Light *const light(reinterpret_cast<Light *>(start + getStride() * i));
+    Pass &p(pass[i]);
 
-    // 光源の鏡面反射光成分を設定する
-    light->specular[0] = r;
-    light->specular[1] = g;
-    light->specular[2] = b;
-    light->specular[3] = a;
+    // 描画先のフレームバッファオブジェクトが完全でなければ実行しない
+    if (!p.complete) continue;
+
+    ggTrace(p.name.c_str());
+
+    // 描画先を切り替える
+    if (p.framebuffer >= 0 && p.framebuffer != current)
+    {
+      glBindFramebuffer(GL_FRAMEBUFFER, p.framebuffer);
+      current = p.framebuffer;
+    }
+    if (p.framebuffer >= 0)
+    {
+      // 一時的なレンダーターゲットならその大きさ, そうでなければウィンドウのビューポートにする
+      const GLsizei w(p.width > 0 ? p.width : viewport[2]), h(p.width > 0 ? p.height : viewport[3]);
+      if (w != width || h != height)
+      {
+        if (p.width > 0) glViewport(0, 0, w, h); else glViewport(viewport[0], viewport[1], w, h);
+        width = w;
+        height = h;
+      }
+    }
+
+#if !defined(__APPLE__)
+    // 前の描画パスが image store などで書き込んだ資源を読み出せるようにする
+    if (p.barrier) glMemoryBarrier(p.barrier);
+#endif
+
+    // 描画パスの処理を計測しながら実行する
+    profiler.begin(p.section);
+    p.execute();
+    profiler.end(p.section);
+
+    // CPU が読み出すバッファオブジェクトへの書き込みの完了を記録する
+    for (const auto r : p.fence)
+    {
+      GLsync &sync(resource[r].sync);
+      if (sync) glDeleteSync(sync);
+      sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
   }
-  unmap();
+
+  // ウィンドウのフレームバッファとビューポートに戻す
+  if (current != 0) glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  if (width != viewport[2] || height != viewport[3]) glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
 }
 
 /*
-** 三角形に単純な陰影付けを行うシェーダが参照する光源データ：光源の色を設定するが位置は変更しない
-**
-**   material 光源の特性の GgSimpleShader::Light 構造体
-**   first 値を設定する光源データの最初の番号, デフォルトは 0
-**   count 値を設定する光源データの数, デフォルトは 1
+** 描画パスの依存関係にもとづく描画の手順：CPU が読み出すバッファオブジェクトへの書き込みの完了を待つ
 */
-void gg::GgSimpleShader::LightBuffer::loadColor(const Light &color,
-  GLint first, GLsizei count) const
+bool gg::GgRenderGraph::wait(GLuint i, GLuint64 timeout)
 {
-  // データを格納するバッファオブジェクトの先頭のポインタ
-  char *const start(static_cast<char *>(map(first, count)));
-  for (GLsizei i = 0; i < count; ++i)
-  {
-    // バッファオブジェクトの i 番目のブロックのポインタ
-    Light *const light(reinterpret_cast<Light *>(start + getStride() * i));
+  GLsync &sync(resource[i].sync);
+  if (!sync) return true;
 
-    // 光源の色を設定する
-    light->ambient = color.ambient;
-    light->diffuse = color.diffuse;
-    light->specular = color.specular;
-  }
-  unmap();
+  // 時間切れならまだ同期オブジェクトを残しておく
+  const GLenum status(glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, timeout));
+  if (status == GL_TIMEOUT_EXPIRED) return false;
+
+  glDeleteSync(sync);
+  sync = nullptr;
+  return status != GL_WAIT_FAILED;
 }
 
+// \cond
 /*
-** 三角形に単純な陰影付けを行うシェーダが参照する光源データ：光源の位置を設定する
-**
-**   x 光源の位置の x 座標
-**   y 光源の位置の y 座標
-**   z 光源の位置の z 座標
-**   w 光源の位置の w 座標, デフォルトは 1
-**   first 値を設定する光源データの最初の番号, デフォルトは 0
-**   count 値を設定する光源データの数, デフォルトは 1
+** 非同期の読み込みに使うデータと関数
 */
-void gg::GgSimpleShader::LightBuffer::loadPosition(GLfloat x, GLfloat y, GLfloat z, GLfloat w,
-  GLint first, GLsizei count) const
+namespace gg
 {
-  // データを格納するバッファオブジェクトの先頭のポインタ
-  char *const start(static_cast<char *>(map(first, count)));
-  for (GLsizei i = 0; i < count; ++i)
+  // 一回の転送でテクスチャに送るデータの大きさの目安
+  const std::size_t uploadChunk(1 << 20);
+
+  // テクスチャを行の帯に分けて少しずつ転送する
+  struct TextureUpload
   {
-    // バッファオブジェクトの i 番目のブロックのポインタ
-    Light *const light(reinterpret_cast<Light *>(start + getStride() * i));
+    // 転送する画素
+    std::vector<GLubyte> pixel;
+
+    // 画像の縦横の画素数
+    GLsizei width, height;
+
+    // 画素のフォーマットとデータ型
+    GLenum format, type;
+
+    // テクスチャの内部フォーマットとラッピングモード
+    GLenum internal, wrap;
+
+    // 作成したテクスチャ名 (作成前は 0)
+    GLuint texture;
+
+    // 次に転送する行
+    GLsizei row;
+
+    // コンストラクタ
+    TextureUpload()
+      : texture(0)
+      , row(0)
+    {}
+
+    // デストラクタ (転送の途中で破棄されたらテクスチャを削除する)
+    ~TextureUpload()
+    {
+      if (texture != 0) ggDeleteTextures(1, &texture);
+    }
+
+    // 行の帯を一つ転送する (全部転送したら true)
+    bool step()
+    {
+      // 最初にテクスチャメモリを確保する
+      if (texture == 0)
+        texture = ggLoadTexture(nullptr, width, height, format, type, internal, wrap);
+      else
+      {
+        ggBindTexture(GL_TEXTURE_2D, texture);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, (format == GL_BGRA || format == GL_RGBA) ? 4 : 1);
+      }
+
+      // uploadChunk 程度の行数を転送する
+      const std::size_t pitch(pixel.size() / height);
+      const GLsizei rows(std::min(height - row, static_cast<GLsizei>(std::max<std::size_t>(uploadChunk / pitch, 1))));
+      glTexSubImage2D(GL_TEXTURE_2D, 0, 0, row, width, rows, format, type, pixel.data() + pitch * row);
+      row += rows;
+
+      return row >= height;
+    }
+
+    // 作成したテクスチャを引き渡す
+    GLuint release()
+    {
+      const GLuint tex(texture);
+      texture = 0;
+      return tex;
+    }
+  };
 
-    // 光源の位置を設定する
-    light->position[0] = x;
-    light->position[1] = y;
-    light->position[2] = z;
-    light->position[3] = w;
+  // 読み込みを完了する
+  template <typename S, typename T>
+  static bool finishAsset(const std::shared_ptr<S> &state, T *value)
+  {
+    state->value.reset(value);
+    state->ready = true;
+    return true;
   }
-  unmap();
 }
+// \endcond
 
 /*
-** 三角形に単純な陰影付けを行うシェーダが参照する光源データ：光源の位置を設定する
+** 非同期のデータの読み込み：コンストラクタ
 **
-**   position 光源の位置
-**   first 値を設定する光源データの最初の番号, デフォルトは 0
-**   count 値を設定する光源データの数, デフォルトは 1
+**   threads ワーカースレッドの数 (0 なら描画とキャプチャのスレッドを除いた論理コア数)
 */
-void gg::GgSimpleShader::LightBuffer::loadPosition(const GgVector &position,
-  GLint first, GLsizei count) const
+gg::GgLoader::GgLoader(unsigned int threads)
+  : quit(false)
+  , pending(0)
 {
-  // データを格納するバッファオブジェクトの先頭のポインタ
-  char *const start(static_cast<char *>(map(first, count)));
-  for (GLsizei i = 0; i < count; ++i)
+  if (threads == 0)
   {
-    // バッファオブジェクトの i 番目のブロックのポインタ
-    Light *const light(reinterpret_cast<Light *>(start + getStride() * i));
+    const unsigned int n(std::thread::hardware_concurrency());
+    threads = n > 2 ? n - 2 : 1;
+  }
 
-    // 光源の位置を設定する
-    light->position = position;
+  for (unsigned int i = 0; i < threads; ++i)
+  {
+    worker.emplace_back([this]()
+    {
+      // トレース上のスレッド名を設定する
+      ggTraceThread("loader");
+
+      for (;;)
+      {
+        // 処理が追加されるのを待って取り出す
+        std::function<void()> work;
+        {
+          std::unique_lock<std::mutex> lock(taskMutex);
+          taskCondition.wait(lock, [this]() { return quit || !task.empty(); });
+          if (quit) return;
+          work = std::move(task.front());
+          task.pop_front();
+        }
+
+        // 取り出した処理を実行する
+        work();
+      }
+    });
   }
-  unmap();
 }
 
 /*
-** 三角形に単純な陰影付けを行うシェーダが参照する材質データ：環境光に対する反射係数を設定する
-**
-**   r 環境光に対する反射係数の赤成分
-**   g 環境光に対する反射係数の緑成分
-**   b 環境光に対する反射係数の青成分
-**   a 環境光に対する反射係数の不透明度, デフォルトは 1
-**   first 値を設定する材質データの最初の番号, デフォルトは 0
-**   count 値を設定する材質データの数, デフォルトは 1
+** 非同期のデータの読み込み：デストラクタ
 */
-void gg::GgSimpleShader::MaterialBuffer::loadAmbient(GLfloat r, GLfloat g, GLfloat b, GLfloat a,
-  GLint first, GLsizei count) const
+gg::GgLoader::~GgLoader()
 {
-  // データを格納するバッファオブジェクトの先頭のポインタ
-  char *const start(static_cast<char *>(map(first, count)));
-  for (GLsizei i = 0; i < count; ++i)
+  // ワーカースレッドを終了する
   {
-    // バッファオブジェクトの i 番目のブロックのポインタ
-    Material *const material(reinterpret_cast<Material *>(start + getStride() * i));
-
-    // 環境光に対する反射係数を設定する
-    material->ambient[0] = r;
-    material->ambient[1] = g;
-    material->ambient[2] = b;
-    material->ambient[3] = a;
+    std::lock_guard<std::mutex> lock(taskMutex);
+    quit = true;
   }
-  unmap();
+  taskCondition.notify_all();
+  for (auto &w : worker) w.join();
 }
 
 /*
-** 三角形に単純な陰影付けを行うシェーダが参照する材質データ：拡散反射係数を設定する
-**
-**   r 拡散反射係数の赤成分
-**   g 拡散反射係数の緑成分
-**   b 拡散反射係数の青成分
-**   a 拡散反射係数の不透明度, デフォルトは 1
-**   first 値を設定する材質データの最初の番号, デフォルトは 0
-**   count 値を設定する材質データの数, デフォルトは 1
+** 非同期のデータの読み込み：ワーカースレッドで実行する処理を追加する
 */
-void gg::GgSimpleShader::MaterialBuffer::loadDiffuse(GLfloat r, GLfloat g, GLfloat b, GLfloat a,
-  GLint first, GLsizei count) const
+void gg::GgLoader::push(const std::function<void()> &work)
 {
-  // データを格納するバッファオブジェクトの先頭のポインタ
-  char *const start(static_cast<char *>(map(first, count)));
-  for (GLsizei i = 0; i < count; ++i)
+  ++pending;
   {
-    // バッファオブジェクトの i 番目のブロックのポインタ
-    Material *const material(reinterpret_cast<Material *>(start + getStride() * i));
-
-    // 拡散反射係数を設定する
-    material->diffuse[0] = r;
-    material->diffuse[1] = g;
-    material->diffuse[2] = b;
-    material->diffuse[3] = a;
+    std::lock_guard<std::mutex> lock(taskMutex);
+    task.push_back(work);
   }
-  unmap();
+  taskCondition.notify_one();
 }
 
 /*
-** 三角形に単純な陰影付けを行うシェーダが参照する材質データ：環境光に対する反射係数と拡散反射係数を設定する
-**
-**   r 環境光に対する反射係数と拡散反射係数の赤成分
-**   g 環境光に対する反射係数と拡散反射係数の緑成分
-**   b 環境光に対する反射係数と拡散反射係数の青成分
-**   a 環境光に対する反射係数と拡散反射係数の不透明度, デフォルトは 1
-**   first 値を設定する材質データの最初の番号, デフォルトは 0
-**   count 値を設定する材質データの数, デフォルトは 1
+** 非同期のデータの読み込み：描画スレッドで実行する転送処理を追加する
 */
-void gg::GgSimpleShader::MaterialBuffer::loadAmbientAndDiffuse(GLfloat r, GLfloat g, GLfloat b, GLfloat a,
-  GLint first, GLsizei count) const
+void gg::GgLoader::post(const std::function<bool()> &step)
 {
-  // データを格納するバッファオブジェクトの先頭のポインタ
-  char *const start(static_cast<char *>(map(first, count)));
-  for (GLsizei i = 0; i < count; ++i)
-  {
-    // バッファオブジェクトの i 番目のブロックのポインタ
-    Material *const material(reinterpret_cast<Material *>(start + getStride() * i));
-
-    // 環境光に対する反射係数と拡散反射係数を設定する
-    material->ambient[0] = material->diffuse[0] = r;
-    material->ambient[1] = material->diffuse[1] = g;
-    material->ambient[2] = material->diffuse[2] = b;
-    material->ambient[3] = material->diffuse[3] = a;
-  }
-  unmap();
+  std::lock_guard<std::mutex> lock(uploadMutex);
+  upload.push_back(step);
 }
 
 /*
-** 三角形に単純な陰影付けを行うシェーダが参照する材質データ：環境光に対する反射係数と拡散反射係数を設定する
+** 非同期のデータの読み込み：三角形分割された Alias OBJ 形式のファイルを読み込む
 **
-**   color 環境光に対する反射係数と拡散反射係数を格納した GLfloat 型の 4 要素の配列
-**   first 値を設定する材質データの最初の番号, デフォルトは 0
-**   count 値を設定する材質データの数, デフォルトは 1
+**   name 三角形分割された Alias OBJ 形式のファイルのファイル名
+**   normalize true なら図形のサイズを [-1, 1] に正規化する
+**   compact true なら頂点属性を GgCompactVertex に量子化して保持する
+**   戻り値 読み込んだ形状データの受け取り口
 */
-void gg::GgSimpleShader::MaterialBuffer::loadAmbientAndDiffuse(const GLfloat *color,
-  GLint first, GLsizei count) const
+gg::GgAsset<gg::GgSimpleObj> gg::GgLoader::loadSimpleObj(const char *name, bool normalize, bool compact)
 {
-  // ambient 要素のバイトオフセット
-  constexpr GLint ambientOffset(offsetof(Material, ambient));
-
-  // ambient 要素のバイト数
-  constexpr size_t ambientSize(sizeof (Material::diffuse));
-
-  // diffuse 要素のバイトオフセット
-  constexpr GLint diffuseOffset(offsetof(Material, diffuse));
-
-  // diffuse 要素のバイト数
-  constexpr size_t diffuseSize(sizeof (Material::diffuse));
-
-  // 元のデータの先頭
-  const char *source(reinterpret_cast<const char *>(color));
+  GgAsset<GgSimpleObj> asset;
+  const auto state(std::make_shared<GgAsset<GgSimpleObj>::State>());
+  asset.state = state;
 
-  // first 番目のブロックから count 個の ambient 要素と diffuse 要素に値を設定する
-  bind();
-  for (GLsizei i = 0; i < count; ++i)
+  const std::string file(name);
+  push([this, state, file, normalize, compact]()
   {
-    // 格納先
-    const GLsizeiptr destination(getStride() * (first + i));
+    // ファイルを読み込んで最適化する
+    const auto group(std::make_shared<std::vector<std::array<GLuint, 3>>>());
+    const auto mat(std::make_shared<std::vector<GgSimpleShader::Material>>());
+    const auto vert(std::make_shared<std::vector<GgVertex>>());
+    const auto face(std::make_shared<std::vector<GLuint>>());
+    const bool ok(readSimpleObj(file.c_str(), normalize, *group, *mat, *vert, *face));
 
-    // first + i 番目のブロックの ambient 要素に値を設定する
-    glBufferSubData(getTarget(), destination + ambientOffset, ambientSize, source + i * ambientSize);
+    // 頂点バッファオブジェクトを作成する
+    post([state, ok, group, mat, vert, face, compact]()
+    {
+      return finishAsset(state, ok ? new GgSimpleObj(*group, *mat, *vert, *face, compact) : nullptr);
+    });
+  });
 
-    // first + i 番目のブロックの diffuse 要素に値を設定する
-    glBufferSubData(getTarget(), destination + diffuseOffset, diffuseSize, source + i * diffuseSize);
-  }
+  return asset;
 }
 
 /*
-** 三角形に単純な陰影付けを行うシェーダが参照する材質データ：鏡面反射係数を設定する
+** 非同期のデータの読み込み：TGA 画像ファイルを読み込んでテクスチャを作成する
 **
-**   r 鏡面反射係数の赤成分
-**   g 鏡面反射係数の緑成分
-**   b 鏡面反射係数の青成分
-**   a 鏡面反射係数の不透明度, デフォルトは 1
-**   first 値を設定する材質データの最初の番号, デフォルトは 0
-**   count 値を設定する材質データの数, デフォルトは 1
+**   name 読み込むファイル名
+**   internal テクスチャの内部フォーマット (0 なら外部フォーマットに合わせる)
+**   wrap テクスチャのラッピングモード
+**   戻り値 作成したテクスチャの受け取り口
 */
-void gg::GgSimpleShader::MaterialBuffer::loadSpecular(GLfloat r, GLfloat g, GLfloat b, GLfloat a,
-  GLint first, GLsizei count) const
+gg::GgAsset<gg::GgColorTexture> gg::GgLoader::loadImage(const char *name, GLenum internal, GLenum wrap)
 {
-  // データを格納するバッファオブジェクトの先頭のポインタ
-  char *const start(static_cast<char *>(map(first, count)));
-  for (GLsizei i = 0; i < count; ++i)
+  GgAsset<GgColorTexture> asset;
+  const auto state(std::make_shared<GgAsset<GgColorTexture>::State>());
+  asset.state = state;
+
+  const std::string file(name);
+  internal = supportedInternal(internal);
+  push([this, state, file, internal, wrap]()
   {
-    // バッファオブジェクトの i 番目のブロックのポインタ
-    Material *const material(reinterpret_cast<Material *>(start + getStride() * i));
+    // 圧縮テクスチャの内部フォーマットならブロック圧縮したミップマップを作成する
+    if (compressedBlockBytes(internal) > 0)
+    {
+      const auto level(std::make_shared<std::vector<std::vector<GLubyte>>>());
+      GLsizei size[2];
+      const bool ok(readCompressedTga(file.c_str(), internal, size[0], size[1], *level));
 
-    // 鏡面反射係数を設定する
-    material->specular[0] = r;
-    material->specular[1] = g;
-    material->specular[2] = b;
-    material->specular[3] = a;
-  }
-  unmap();
-}
+      post([state, ok, level, size, internal, wrap]()
+      {
+        if (!ok) return finishAsset(state, static_cast<GgColorTexture *>(nullptr));
+
+        std::vector<std::pair<const GLubyte *, GLsizei>> data;
+        for (const auto &l : *level) data.emplace_back(l.data(), static_cast<GLsizei>(l.size()));
+        const GLuint tex(createCompressedTexture(internal, size[0], size[1], wrap, data));
+        return finishAsset(state, new GgColorTexture(tex, size));
+      });
+      return;
+    }
 
-/*
-** 三角形に単純な陰影付けを行うシェーダが参照する材質データ：輝き係数を設定する
-**
-**   shininess 輝き係数
-**   first 値を設定する材質データの最初の番号, デフォルトは 0
-**   count 値を設定する材質データの数, デフォルトは 1
-*/
-void gg::GgSimpleShader::MaterialBuffer::loadShininess(GLfloat shininess,
-  GLint first, GLsizei count) const
-{
-  // データを格納するバッファオブジェクトの先頭のポインタ
-  char *const start(static_cast<char *>(map(first, count)));
-  for (GLsizei i = 0; i < count; ++i)
-  {
-    // バッファオブジェクトの i 番目のブロックのポインタ
-    Material *const material(reinterpret_cast<Material *>(start + getStride() * i));
-    material->shininess = shininess;
-  }
-  unmap();
+    // 画像を読み込む
+    const auto image(std::make_shared<TextureUpload>());
+    GLenum format;
+    const bool ok(ggReadImage(file.c_str(), image->pixel, &image->width, &image->height, &format));
+    image->format = format;
+    image->type = GL_UNSIGNED_BYTE;
+    image->wrap = wrap;
+
+    // internal == 0 なら内部フォーマットを読み込んだファイルに合わせる
+    image->internal = internal;
+    if (internal == 0)
+    {
+      switch (format)
+      {
+      case GL_BGR:
+        image->internal = GL_RGB;
+        break;
+      case GL_BGRA:
+        image->internal = GL_RGBA;
+        break;
+      default:
+        image->internal = format;
+        break;
+      }
+    }
+
+    // 行の帯に分けて転送する
+    post([state, ok, image]()
+    {
+      if (!ok || image->pixel.empty()) return finishAsset(state, static_cast<GgColorTexture *>(nullptr));
+      if (!image->step()) return false;
+      const GLsizei size[] = { image->width, image->height };
+      return finishAsset(state, new GgColorTexture(image->release(), size));
+    });
+  });
+
+  return asset;
 }
 
 /*
-** 三角形に単純な陰影付けを行うシェーダが参照する材質データ：輝き係数を設定する
+** 非同期のデータの読み込み：TGA 画像ファイルの高さマップを読み込んで法線マップのテクスチャを作成する
 **
-**   shininess 輝き係数
-**   first 値を設定する材質データの最初の番号, デフォルトは 0
-**   count 値を設定する材質データの数, デフォルトは 1
+**   name 読み込むファイル名
+**   nz 法線マップの z 成分の値
+**   internal テクスチャの内部フォーマット
+**   戻り値 作成した法線マップのテクスチャの受け取り口
 */
-void gg::GgSimpleShader::MaterialBuffer::loadShininess(const GLfloat *shininess,
-  GLint first, GLsizei count) const
+gg::GgAsset<gg::GgNormalTexture> gg::GgLoader::loadHeight(const char *name, float nz, GLenum internal)
 {
-  // データを格納するバッファオブジェクトの先頭のポインタ
-  char *const start(static_cast<char *>(map(first, count)));
-  for (GLsizei i = 0; i < count; ++i)
+  GgAsset<GgNormalTexture> asset;
+  const auto state(std::make_shared<GgAsset<GgNormalTexture>::State>());
+  asset.state = state;
+
+  const std::string file(name);
+  push([this, state, file, nz, internal]()
   {
-    // バッファオブジェクトの i 番目のブロックのポインタ
-    Material *const material(reinterpret_cast<Material *>(start + getStride() * i));
-    material->shininess = shininess[i];
-  }
-  unmap();
-}
+    // 高さマップの画像を読み込む
+    std::vector<GLubyte> hmap;
+    GLsizei width(0), height(0);
+    GLenum format;
+    const bool ok(ggReadImage(file.c_str(), hmap, &width, &height, &format) && !hmap.empty());
+
+    // テクスチャの内部フォーマットに合わせた形式で法線マップを作成する
+    const auto image(std::make_shared<TextureUpload>());
+    image->width = width;
+    image->height = height;
+    image->internal = internal;
+    image->wrap = GL_REPEAT;
+    const NormalMapType type(normalMapType(internal, image->format, image->type));
+    if (ok)
+    {
+      image->pixel.resize(static_cast<std::size_t>(width) * height * normalMapBytes[type]);
+      createNormalMap(hmap.data(), width, height, format, nz, type, image->pixel.data());
+    }
 
-/*
-** 三角形に単純な陰影付けを行うシェーダ：コンストラクタ
-*/
-gg::GgSimpleShader::GgSimpleShader(const char *vert, const char *frag,
-  const char *geom, GLint nvarying, const char **varyings)
-  : GgPointShader(vert, frag, geom, nvarying, varyings)
-  , materialIndex(glGetUniformBlockIndex(get(), "Material"))
-  , lightIndex(glGetUniformBlockIndex(get(), "Light"))
-  , mnLoc(glGetUniformLocation(get(), "mn"))
-{
-  glUniformBlockBinding(get(), materialIndex, 1);
-  glUniformBlockBinding(get(), lightIndex, 0);
+    // 行の帯に分けて転送する
+    post([state, ok, image]()
+    {
+      if (!ok) return finishAsset(state, static_cast<GgNormalTexture *>(nullptr));
+      if (!image->step()) return false;
+      const GLsizei size[] = { image->width, image->height };
+      return finishAsset(state, new GgNormalTexture(image->release(), size));
+    });
+  });
+
+  return asset;
 }
 
 /*
-** Wavefront OBJ 形式のデータ：コンストラクタ
+** 非同期のデータの読み込み：シェーダのソースファイルを読み込んでプログラムオブジェクトを作成する
+**
+**   vert バーテックスシェーダのソースファイル名
+**   frag フラグメントシェーダのソースファイル名 (nullptr なら不使用)
+**   geom ジオメトリシェーダのソースファイル名 (nullptr なら不使用)
+**   defines 各シェーダの #version の直後に挿入する #define などの文字列 (nullptr なら不使用)
+**   戻り値 作成したシェーダの受け取り口
 */
-gg::GgSimpleObj::GgSimpleObj(const char *name, bool normalize)
+gg::GgAsset<gg::GgShader> gg::GgLoader::loadShader(const char *vert, const char *frag, const char *geom,
+  const char *defines)
 {
-  // 作業用のメモリ
-  std::vector<GgSimpleShader::Material> mat;
-  std::vector<GgVertex> vert;
-  std::vector<GLuint> face;
+  GgAsset<GgShader> asset;
+  const auto state(std::make_shared<GgAsset<GgShader>::State>());
+  asset.state = state;
 
-  // ファイルを読み込む
-  if (ggLoadSimpleObj(name, group, mat, vert, face, normalize))
+  // ファイル名は文字列にして保持する (nullptr は空の文字列にする)
+  const std::array<std::string, 4> name
   {
-    // 頂点バッファオブジェクトを作成する
-    data.reset(new GgElements(vert.data(), static_cast<GLsizei>(vert.size()),
-      face.data(), static_cast<GLsizei>(face.size()), GL_TRIANGLES));
+    {
+      vert ? vert : "", frag ? frag : "", geom ? geom : "", defines ? defines : ""
+    }
+  };
+  push([this, state, name]()
+  {
+    // ソースファイルを読み込む
+    const auto src(std::make_shared<std::array<std::vector<GLchar>, 3>>());
+    const char *const d(name[3].empty() ? nullptr : name[3].c_str());
+    bool ok(true);
+    for (int i = 0; i < 3; ++i)
+      if (!name[i].empty() && !readShaderSource(name[i].c_str(), (*src)[i], d)) ok = false;
 
-    // 材質データを設定する
-    material.reset(new GgSimpleShader::MaterialBuffer(mat.data(), static_cast<GLsizei>(mat.size())));
-  }
+    // プログラムオブジェクトを作成する
+    post([state, ok, src, name]()
+    {
+      const auto source([&](int i) { return (*src)[i].empty() ? nullptr : (*src)[i].data(); });
+      const auto text([&](int i) { return name[i].empty() ? nullptr : name[i].c_str(); });
+      const GLuint program(ok ? ggCreateShader(source(0), source(1), source(2),
+        0, nullptr, text(0), text(1), text(2)) : 0);
+      return finishAsset(state, program != 0 ? new GgShader(program) : nullptr);
+    });
+  });
+
+  return asset;
 }
 
 /*
-** Wavefront OBJ 形式のデータ：図形の描画
+** 非同期のデータの読み込み：ワーカースレッドが用意したデータを OpenGL のオブジェクトに転送する
+**
+**   budget このフレームで転送に使う時間の予算 (ミリ秒)
+**   戻り値 このフレームで読み込みが完了したデータの数
 */
-void gg::GgSimpleObj::draw(GLint first, GLsizei count) const
+unsigned int gg::GgLoader::update(double budget)
 {
-  // 保持しているグループの数
-  const GLsizei ng(static_cast<GLsizei>(group.size()));
+  // 転送の区間を記録する
+  ggTrace("GgLoader::update");
 
-  // 描画する最後のグループの次
-  GLsizei last(count <= static_cast<GLsizei>(0) ? ng : first + count);
-  if (last > ng) last = ng;
+  const auto start(std::chrono::steady_clock::now());
+  unsigned int count(0);
 
-  for (GLsizei g = first; g < last; ++g)
+  do
   {
-    // 材質を設定する
-    material->select(group[g][2]);
+    // 先頭の転送処理を取り出す
+    std::function<bool()> step;
+    {
+      std::lock_guard<std::mutex> lock(uploadMutex);
+      if (upload.empty()) break;
+      step = std::move(upload.front());
+      upload.pop_front();
+    }
 
-    // 図形を描画する
-    data->draw(group[g][0], group[g][1]);
+    // 完了していなければ先頭に戻して次の機会に続ける
+    if (step())
+    {
+      --pending;
+      ++count;
+    }
+    else
+    {
+      std::lock_guard<std::mutex> lock(uploadMutex);
+      upload.push_front(std::move(step));
+    }
   }
+  while (std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() < budget);
+
+  return count;
 }
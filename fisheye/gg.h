@@ -1283,11 +1283,48 @@ extern PFNGLWINDOWRECTANGLESEXTPROC glWindowRectanglesEXT;
 
 //! \endcond
 
+// CPU 側の処理区間のトレースを記録するなら 1
+#if !defined(GG_USE_TRACE)
+#  define GG_USE_TRACE 0
+#endif
+
+// 変換行列や四元数の演算に SIMD 命令を使うなら 1
+#if !defined(GG_USE_SIMD)
+#  define GG_USE_SIMD 1
+#endif
+
+// 状態設定の呼び出しと省略の回数を数えるなら 1
+#if !defined(GG_COUNT_STATE)
+#  define GG_COUNT_STATE 0
+#endif
+
+// OpenGL のエラーをデバッグ出力のコールバックで受け取るなら 1 (0 なら DEBUG のとき glGetError() で調べる)
+#if !defined(GG_USE_DEBUG_OUTPUT)
+#  define GG_USE_DEBUG_OUTPUT 1
+#endif
+
+// デバッグ出力をエラーの発生した API の呼び出しの中で受け取るなら 1 (デバッグコンテキストを要求する)
+#if !defined(GG_DEBUG_SYNCHRONOUS)
+#  define GG_DEBUG_SYNCHRONOUS 0
+#endif
+
+// OpenGL の API のアドレスを最初に呼び出したときに取得するなら 1 (0 なら ggInit() ですべて取得する)
+#if !defined(GG_LAZY_PROC)
+#  define GG_LAZY_PROC 1
+#endif
+
 // 標準ライブラリ
 #include <array>
 #include <vector>
 #include <memory>
+#include <string>
 #include <cstddef>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
 
 /*!
 ** \brief ゲームグラフィックス特論の宿題用補助プログラムの名前空間
@@ -1301,11 +1338,24 @@ namespace gg
     MaterialBindingPoint
   };
 
+  // GgSimpleObj をまとめて描画するときに材質のテクスチャバッファを結合するテクスチャユニット
+  enum TextureUnits
+  {
+    MaterialTextureUnit = 15
+  };
+
   /*!
   ** \brief 使用している GPU のバッファオブジェクトのアライメント
   */
   extern GLint ggBufferAlignment;
 
+  /*!
+  ** \brief 使用している GPU で永続的にマップするバッファオブジェクトが使えるか
+  **
+  **   OpenGL 4.4 以降で glBufferStorage() が使えれば ggInit() が true にする.
+  */
+  extern bool ggBufferStorage;
+
   /*!
   ** \brief 4 要素の単精度実数の配列
   */
@@ -1315,18 +1365,78 @@ namespace gg
   ** \brief ゲームグラフィックス特論の都合にもとづく初期化を行う.
   **
   **   Windows で OpenGL 1.2 以降の API を有効化する.
+  **   GG_LAZY_PROC が 1 なら API の関数ポインタには仮の関数を設定し,
+  **   API のアドレスはそれぞれ最初に呼び出したときに取得する.
   */
   extern void ggInit();
 
+  /*!
+  ** \brief OpenGL の API が使えるかどうか調べる.
+  **
+  **   GG_LAZY_PROC が 1 なら ggInit() の後の API の関数ポインタは nullptr にならないので,
+  **   API が使えるかどうかは関数ポインタではなくこの関数で調べる.
+  **
+  **   \param name API の名前.
+  **   \return 現在のコンテキストで name の API のアドレスが取得できれば true.
+  */
+  extern bool ggHasProc(const char *name);
+
+  /*!
+  ** \brief 最初の呼び出しを待っている API のアドレスをすべて取得する.
+  **
+  **   GG_LAZY_PROC が 1 なら API の関数ポインタは最初の呼び出しで排他制御せずに置き換えるので,
+  **   コンテキストを共有する別のスレッドから API を呼び出す前に描画するスレッドで呼び出しておく.
+  **   GG_LAZY_PROC が 0 なら何もしない.
+  */
+  extern void ggResolveProcs();
+
+  /*!
+  ** \brief API のアドレスの取得に要した時間の報告を得る.
+  **
+  **   ggInit() が設定した API の数とその処理時間, および最初の呼び出しか ggResolveProcs() でアドレスを取得した
+  **   API の数とその処理時間の合計を 1 行の文字列にする.
+  **
+  **   \return API のアドレスの取得に要した時間の報告.
+  */
+  extern std::string ggInitReport();
+
+  /*!
+  ** \brief OpenGL のデバッグ出力を使っているか
+  **
+  **   ggEnableDebugOutput() がデバッグ出力のコールバックを登録すると true になる.
+  **   true なら ggError() は glGetError() を呼び出さない.
+  */
+  extern bool ggDebugOutput;
+
+  /*!
+  ** \brief OpenGL のデバッグ出力のコールバックを現在のコンテキストに登録する.
+  **
+  **   KHR_debug (OpenGL 4.3) のコールバックでエラーなどのメッセージを受け取って標準エラー出力に表示する.
+  **   重要度が GL_DEBUG_SEVERITY_MEDIUM 以上のメッセージだけを受け取り,
+  **   同じメッセージは 1 秒間に limit 回までしか表示しない.
+  **   synchronous が false ならドライバが非同期に通知するのでパイプラインを止めないが,
+  **   通知はエラーの発生した API の呼び出しより後になることがある.
+  **
+  **   \param synchronous true ならエラーの発生した API の呼び出しの中でメッセージを通知する.
+  **   \param verbose true なら重要度が GL_DEBUG_SEVERITY_LOW のメッセージも受け取る.
+  **   \param limit 同じメッセージを 1 秒間に表示する最大の回数.
+  **   \return デバッグ出力が使えなければ false.
+  */
+  extern bool ggEnableDebugOutput(bool synchronous = false, bool verbose = false, unsigned int limit = 10);
+
   /*!
   ** \brief OpenGL のエラーをチェックする.
   **
   **   OpenGL の API を呼び出し直後に実行すればエラーのあるときにメッセージを表示する.
+  **   glGetError() は GPU との同期を伴うので, ggError() マクロは DEBUG のときしか呼び出さず,
+  **   デバッグ出力を使っているときは呼び出さない.
   **
   **   \param msg エラー発生時に標準エラー出力に出力する文字列. nullptr なら何も出力しない.
   */
   extern void _ggError(const char *name = nullptr, unsigned int line = 0);
-#if defined(DEBUG)
+#if defined(DEBUG) && GG_USE_DEBUG_OUTPUT
+#  define ggError() (gg::ggDebugOutput ? static_cast<void>(0) : gg::_ggError(__FILE__, __LINE__))
+#elif defined(DEBUG)
 #  define ggError() gg::_ggError(__FILE__, __LINE__)
 #else
 #  define ggError()
@@ -1346,6 +1456,167 @@ namespace gg
 #  define ggFBOError()
 #endif
 
+  /*!
+  ** \brief CPU 側の処理区間を記録する.
+  **
+  **   生成から破棄までの区間をそのスレッドのトレースに記録する.
+  **   記録はスレッドごとのバッファに行うのでロックしない.
+  **   GG_USE_TRACE が 0 のときは ggTrace() マクロが何も生成しない.
+  */
+#if GG_USE_TRACE
+  class GgTraceZone
+  {
+    // 区間名
+    const char *const name;
+
+    // 開始時刻 (マイクロ秒)
+    const long long start;
+
+  public:
+
+    //! \brief コンストラクタ.
+    //!   \param name 区間名 (文字列リテラルのように記録の保存まで有効なもの).
+    GgTraceZone(const char *name);
+
+    //! \brief デストラクタ.
+    ~GgTraceZone();
+
+    // コピーコンストラクタを封じる
+    GgTraceZone(const GgTraceZone &o) = delete;
+
+    // 代入演算子を封じる
+    GgTraceZone &operator=(const GgTraceZone &o) = delete;
+  };
+
+  /*!
+  ** \brief 現在のスレッドのトレース上の名前を設定する.
+  **
+  **   \param name スレッド名 (文字列リテラルのように記録の保存まで有効なもの).
+  */
+  extern void _ggTraceThread(const char *name);
+
+#  define GG_TRACE_CONCAT_(a, b) a##b
+#  define GG_TRACE_CONCAT(a, b) GG_TRACE_CONCAT_(a, b)
+#  define ggTrace(name) gg::GgTraceZone GG_TRACE_CONCAT(ggTraceZone, __LINE__)(name)
+#  define ggTraceThread(name) gg::_ggTraceThread(name)
+#else
+#  define ggTrace(name)
+#  define ggTraceThread(name)
+#endif
+
+  /*!
+  ** \brief 記録したトレースを Chrome Trace Event 形式で保存する.
+  **
+  **   chrome://tracing や Perfetto で読み込める JSON ファイルを出力する.
+  **
+  **   \param name 保存するファイル名.
+  **   \return 保存に成功すれば true, 失敗するか GG_USE_TRACE が 0 なら false.
+  */
+  extern bool ggSaveTrace(const char *name);
+
+  /*!
+  ** \brief 状態設定の呼び出しの回数.
+  **
+  **   GG_COUNT_STATE が 1 のとき gg〜 の状態設定の関数が OpenGL の API を呼び出した回数と
+  **   直前の設定と同じだったので呼び出しを省いた回数を数える.
+  */
+  struct GgStateCount
+  {
+    unsigned int issued;  //! OpenGL の API を呼び出した回数.
+    unsigned int elided;  //! 呼び出しを省いた回数.
+  };
+
+  /*!
+  ** \brief プログラムオブジェクトの使用を開始する.
+  **
+  **   ggUseProgram() などの gg〜 の状態設定の関数は現在のスレッドのコンテキストの状態を記録し,
+  **   直前の設定と同じなら OpenGL の API を呼び出さない. 記録はスレッドごとに行う.
+  **   記録している状態はこれらの関数を経由せずに変更しないようにし, 記録しているテクスチャや
+  **   バッファオブジェクトは ggDeleteTextures() / ggDeleteBuffers() で削除する.
+  **   コンテキストを切り替えたり外部のライブラリが状態を変更したりしたときは ggResetState() を呼び出す.
+  **
+  **   \param program プログラム名 (0 なら使用を終了する).
+  */
+  extern void ggUseProgram(GLuint program);
+
+  /*!
+  ** \brief 頂点配列オブジェクトを結合する.
+  **
+  **   \param vao 頂点配列オブジェクト名 (0 なら解放する).
+  */
+  extern void ggBindVertexArray(GLuint vao);
+
+  /*!
+  ** \brief テクスチャユニットを選択する.
+  **
+  **   \param unit テクスチャユニット (GL_TEXTURE0 〜).
+  */
+  extern void ggActiveTexture(GLenum unit);
+
+  /*!
+  ** \brief 選択しているテクスチャユニットにテクスチャを結合する.
+  **
+  **   \param target テクスチャのターゲット.
+  **   \param texture テクスチャ名 (0 なら解放する).
+  */
+  extern void ggBindTexture(GLenum target, GLuint texture);
+
+  /*!
+  ** \brief バッファオブジェクトの範囲をインデックス付きのターゲットの結合ポイントに結合する.
+  **
+  **   \param target バッファオブジェクトのターゲット.
+  **   \param index 結合ポイント.
+  **   \param buffer バッファオブジェクト名.
+  **   \param offset 結合する範囲のバッファオブジェクトの先頭からのバイトオフセット.
+  **   \param size 結合する範囲のバイト数.
+  */
+  extern void ggBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+
+  /*!
+  ** \brief 機能を有効にする.
+  **
+  **   \param cap 有効にする機能.
+  */
+  extern void ggEnable(GLenum cap);
+
+  /*!
+  ** \brief 機能を無効にする.
+  **
+  **   \param cap 無効にする機能.
+  */
+  extern void ggDisable(GLenum cap);
+
+  /*!
+  ** \brief テクスチャを削除して記録している結合を解除する.
+  **
+  **   \param n 削除するテクスチャの数.
+  **   \param textures 削除するテクスチャ名の配列.
+  */
+  extern void ggDeleteTextures(GLsizei n, const GLuint *textures);
+
+  /*!
+  ** \brief バッファオブジェクトを削除して記録している結合を解除する.
+  **
+  **   \param n 削除するバッファオブジェクトの数.
+  **   \param buffers 削除するバッファオブジェクト名の配列.
+  */
+  extern void ggDeleteBuffers(GLsizei n, const GLuint *buffers);
+
+  /*!
+  ** \brief 現在のスレッドで記録している状態を破棄する.
+  **
+  **   次に gg〜 の状態設定の関数を呼び出したときは必ず OpenGL の API を呼び出す.
+  */
+  extern void ggResetState();
+
+  /*!
+  ** \brief 現在のスレッドの状態設定の呼び出しの回数を取り出す.
+  **
+  **   \param reset true なら取り出した後に回数を 0 にする.
+  **   \return 前回 0 にしてからの呼び出しの回数 (GG_COUNT_STATE が 0 なら常に 0).
+  */
+  extern GgStateCount ggGetStateCount(bool reset = true);
+
   /*!
   ** \brief 配列の内容を TGA ファイルに保存する.
   **
@@ -1406,6 +1677,15 @@ namespace gg
   /*!
   ** \brief テクスチャメモリを確保して TGA 画像ファイルを読み込む.
   **
+  **   メモリマップしたファイルを画素アンパックバッファに直接展開し, そこからテクスチャに転送する.
+  **   転送の完了は待たない.
+  **
+  **   internal に GL_COMPRESSED_RGB_S3TC_DXT1_EXT (BC1), GL_COMPRESSED_RED_RGTC1 (BC4),
+  **   GL_COMPRESSED_RG_RGTC2 (BC5), GL_COMPRESSED_RGBA_BPTC_UNORM (BC7) を指定すると,
+  **   画像をブロック圧縮したミップマップ付きのテクスチャを作成する. 圧縮結果は元のファイル名に
+  **   ".bc1.ktx" などを付けた KTX ファイルに保存し, 元のファイルが更新されていなければ次回からはそれを使う.
+  **   BPTC を扱えない macOS では BC7 の代わりに非圧縮の GL_RGBA にする.
+  **
   **   \param name 読み込むファイル名.
   **   \param pWidth 読みだした画像ファイルの横の画素数の格納先のポインタ (nullptr なら格納しない).
   ++   \param pHeight 読みだした画像ファイルの縦の画素数の格納先のポインタ (nullptr なら格納しない).
@@ -1419,6 +1699,8 @@ namespace gg
   /*!
   ** \brief グレースケール画像 (8bit) から法線マップのデータを作成する.
   **
+  **   行をいくつかのブロックに分けて並列に処理する.
+  **
   **   \param hmap グレースケール画像のデータ.
   **   \param width 高さマップのグレースケール画像 hmap の横の画素数.
   **   \param height 高さマップのグレースケール画像 hmap の縦の画素数.
@@ -1433,6 +1715,11 @@ namespace gg
   /*!
   ** \brief テクスチャメモリを確保して TGA 画像ファイルを読み込み法線マップを作成する.
   **
+  **   法線マップは画素アンパックバッファに直接作成して転送する. 値の範囲は ggCreateNormalMap() と同じで,
+  **   internal が GL_RGB16F, GL_RGBA16F, GL_RGB32F, GL_RGBA32F なら法線を [-1,1] のまま GL_FLOAT で,
+  **   それ以外なら [0,1] に正規化して転送する. 正規化したものは 8bit の内部フォーマットなら GL_UNSIGNED_BYTE,
+  **   GL_RG16F なら法線の xy だけを GL_HALF_FLOAT, それ以外は GL_FLOAT で転送する.
+  **
   **   \param name 読み込むファイル名.
   **   \param nz 法線の z 成分の割合.
   **   \param pWidth 読みだした画像ファイルの横の画素数の格納先のポインタ (nullptr なら格納しない).
@@ -1470,10 +1757,26 @@ namespace gg
   **   \param geom ジオメトリシェーダのソースファイル名 (nullptr なら不使用).
   **   \param nvarying フィードバックする varying 変数の数 (0 なら不使用).
   **   \param varyings フィードバックする varying 変数のリスト (nullptr なら不使用).
+  **   \param defines 各シェーダの #version の直後に挿入する #define などの文字列 (nullptr なら不使用).
   **   \return プログラムオブジェクトのプログラム名 (作成できなければ 0).
+  **
+  **   ソースファイル中の #include "ファイル名" の行はそのファイルのあるディレクトリからの
+  **   相対パスのファイルの内容に置き換える.
   */
   extern GLuint ggLoadShader(const char *vert, const char *frag = nullptr, const char *geom = nullptr,
-    GLint nvarying = 0, const char *const varyings[] = nullptr);
+    GLint nvarying = 0, const char *const varyings[] = nullptr, const char *defines = nullptr);
+
+  /*!
+  ** \brief プログラムオブジェクトのバイナリのキャッシュを設定する.
+  **
+  **   設定すると ggCreateShader() / ggLoadShader() はシェーダのソースプログラムと
+  **   ドライバの GL_VENDOR / GL_RENDERER / GL_VERSION から求めたハッシュ値をキーにして
+  **   リンク済みのプログラムオブジェクトのバイナリを保存し, 次回以降はコンパイルせずにそれを使う.
+  **   ドライバがバイナリを受け付けなければソースプログラムからコンパイルし直す.
+  **
+  **   \param dir キャッシュを保存するディレクトリ名 (nullptr ならキャッシュを使わない).
+  */
+  extern void ggSetShaderCache(const char *dir);
 
 #if !defined(__APPLE__)
   /*!
@@ -1615,6 +1918,16 @@ namespace gg
     return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
   }
 
+  /*!
+  ** \brief 変換行列や四元数の演算に使っている SIMD 命令セットの名前を返す.
+  **
+  **   AVX は実行時に CPU と OS が対応しているか調べて使う.
+  **   環境変数 GG_SIMD を sse2 にしておけば AVX に対応していても SSE2 を使う.
+  **
+  **   \return "avx", "sse2", "neon", SIMD 命令を使っていなければ "none".
+  */
+  extern const char *ggSimd();
+
   /*!
   ** \brief 変換行列.
   */
@@ -1644,15 +1957,23 @@ namespace gg
       load(a);
     }
 
+    //! \brief 要素を列優先で並べて指定するコンストラクタ (定数式で使える).
+    //!   \param a0～a15 変換行列の要素.
+    constexpr GgMatrix(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3,
+      GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7,
+      GLfloat a8, GLfloat a9, GLfloat a10, GLfloat a11,
+      GLfloat a12, GLfloat a13, GLfloat a14, GLfloat a15)
+      : array{ { a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15 } }
+    {}
+
     //! \brief コピーコンストラクタ.
     //!   \param m GgMatrix 型の変数.
-    GgMatrix(const GgMatrix &m)
-    {
-      load(m);
-    }
+    constexpr GgMatrix(const GgMatrix &m)
+      : array(m.array)
+    {}
 
     //! \brief デストラクタ.
-    ~GgMatrix() {}
+    ~GgMatrix() = default;
 
     //! \brief 配列変数の値を格納する.
     //!   \param a GLfloat 型の 16 要素の配列変数.
@@ -2097,6 +2418,13 @@ namespace gg
       return loadNormal(m.array.data());
     }
 
+    //! \brief 二つの変換行列の積の法線変換行列を格納する.
+    //!   \param a 左辺の GgMatrix 型の変換行列.
+    //!   \param b 右辺の GgMatrix 型の変換行列.
+    //!   \return 設定した a * b の法線変換行列.
+    //!   \note a * b は左上 3×3 の部分しか求めない.
+    GgMatrix &loadNormal(const GgMatrix &a, const GgMatrix &b);
+
     //! \brief 平行移動変換を乗じた結果を返す.
     //!   \param x x 方向の移動量.
     //!   \param y y 方向の移動量.
@@ -2366,6 +2694,12 @@ namespace gg
       projection(c.data(), v.data());
     }
 
+    //! \brief ベクトルの配列に対してまとめて投影変換を行う.
+    //!   \param c 変換結果を格納する GgVector 型の count 要素の配列変数 (v と同じでもよい).
+    //!   \param v 元のベクトルの GgVector 型の count 要素の配列変数.
+    //!   \param count 変換するベクトルの数.
+    void projection(GgVector *c, const GgVector *v, std::size_t count) const;
+
     //! \brief ベクトルに対して投影変換を行う.
     //!   \param v 元のベクトルの GgVector 型の変数.
     //!   \return c 変換結果の GgVector 型の値.
@@ -2392,14 +2726,14 @@ namespace gg
 
     //! \brief 変換行列の要素を取り出す.
     //!   \return 変換行列を格納した GLfloat 型の 16 要素の配列変数 の i 番目の要素.
-    GLfloat get(int i) const
+    constexpr GLfloat get(int i) const
     {
       return array[i];
     }
 
     //! \brief 変換行列の要素にアクセスする.
     //!   \return 変換行列を格納した GLfloat 型の 16 要素の配列変数 の i 番目の要素の参照.
-    const GLfloat &operator[](std::size_t i) const
+    constexpr const GLfloat &operator[](std::size_t i) const
     {
       return array[i];
     }
@@ -2678,132 +3012,404 @@ namespace gg
   }
 
   /*!
-  ** \brief 四元数.
+  ** \brief 変換行列の積の式 (式テンプレート) の基底クラス.
+  **
+  **   ggExpression() で包んだ変換行列の積は, その場で 4×4 の一時的な変換行列を作らずに,
+  **   右端の変換行列の列ベクトルに順に変換を適用して評価する.
+  **   式は参照している変換行列が有効な間 (ふつうは式を含む文の中) に評価すること.
+  **
+  **   \tparam E 派生クラス.
   */
-  class GgQuaternion
+  template <typename E>
+  class GgMatrixExpression
   {
-    // 四元数の要素
-    GgVector quaternion;
-
-    // GgQuaternion 型の四元数 p と四元数 q の積を四元数 r に求める
-    void multiply(GLfloat *r, const GLfloat *p, const GLfloat *q) const;
-
-    // GgQuaternion 型の四元数 q が表す回転の変換行列を m に求める
-    void toMatrix(GLfloat *m, const GLfloat *q) const;
-
-    // 回転の変換行列 m が表す四元数を q に求める
-    void toQuaternion(GLfloat *q, const GLfloat *m) const;
-
-    // 球面線形補間 q と r を t で補間した四元数を p に求める
-    void slerp(GLfloat *p, const GLfloat *q, const GLfloat *r, GLfloat t) const;
-
   public:
 
-    //! \brief コンストラクタ.
-    GgQuaternion() {}
-
-    //! \brief コンストラクタ.
-    //!   \param x 四元数の x 要素.
-    //!   \param y 四元数の y 要素.
-    //!   \param z 四元数の z 要素.
-    //!   \param w 四元数の w 要素.
-    GgQuaternion(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+    //! \brief 派生クラスを取り出す.
+    //!   \return 派生クラスの参照.
+    const E &self() const
     {
-      load(x, y, z, w);
+      return *static_cast<const E *>(this);
     }
 
-    //! \brief コンストラクタ.
-    //!   \param v 四元数を格納した GgVector 型の変数.
-    GgQuaternion(const GgVector &v)
+    //! \brief 式が表す変換をベクトルに適用する.
+    //!   \param c 変換結果を格納する GLfloat 型の 4 要素の配列変数 (v と別の場所).
+    //!   \param v 元のベクトルの GLfloat 型の 4 要素の配列変数.
+    void transform(GLfloat *c, const GLfloat *v) const
     {
-      load(v);
+      self().transform(c, v);
     }
 
-    //! \brief コンストラクタ.
-    //!   \param a 四元数を格納した GLfloat 型の 4 要素の配列変数.
-    GgQuaternion(const GLfloat *a)
+    //! \brief 式が表す変換行列を求める.
+    //!   \param m 変換行列を格納する GgMatrix 型の変数.
+    //!   \param mn 法線変換行列を格納する GgMatrix 型の変数のポインタ, nullptr なら求めない.
+    void evaluate(GgMatrix &m, GgMatrix *mn = nullptr) const
     {
-      load(a);
+      GLfloat c[16];
+      for (int k = 0; k < 16; k += 4) self().column(c + k, k >> 2);
+      m.load(c);
+      if (mn) mn->loadNormal(c);
     }
 
-    //! \brief コピーコンストラクタ.
-    //!   \param q GgQuaternion 型の四元数.
-    GgQuaternion(const GgQuaternion &q)
+    //! \brief 式が表す変換行列を返す.
+    //!   \return 式を評価した GgMatrix 型の変換行列.
+    operator GgMatrix() const
     {
-      load(q);
+      GgMatrix m;
+      evaluate(m);
+      return m;
     }
 
-    //! \brief デストラクタ.
-    ~GgQuaternion() {}
+    //! \brief 式が表す変換行列の法線変換行列を返す.
+    //!   \return 式の左上 3×3 の部分から求めた法線変換行列.
+    GgMatrix normal() const
+    {
+      GgMatrix mn;
+      self().evaluateNormal(mn);
+      return mn;
+    }
 
-    //! \brief 四元数のノルムを求める.
-    //!   \return 四元数のノルム.
-    GLfloat norm() const
+    //! \brief 式が表す変換行列の法線変換行列を求める.
+    //!   \param mn 法線変換行列を格納する GgMatrix 型の変数.
+    void evaluateNormal(GgMatrix &mn) const
     {
-      return ggLength4(quaternion.data());
+      // 法線変換行列には左上 3×3 の部分しか使わない
+      GLfloat c[12];
+      for (int k = 0; k < 12; k += 4)
+      {
+        self().column3(c + k, k >> 2);
+        c[k + 3] = 0.0f;
+      }
+      mn.loadNormal(c);
     }
 
-    //! \brief 四元数を格納する.
-    //!   \param x 四元数の x 要素.
-    //!   \param y 四元数の y 要素.
-    //!   \param z 四元数の z 要素.
-    //!   \param w 四元数の w 要素.
-    //!   \return 設定した四元数.
-    GgQuaternion &load(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+    //! \brief 式が表す変換をベクトルに適用する.
+    //!   \param v 元のベクトルの GgVector 型の変数.
+    //!   \return 変換結果の GgVector 型の値.
+    GgVector operator*(const GgVector &v) const
     {
-      quaternion[0] = x;
-      quaternion[1] = y;
-      quaternion[2] = z;
-      quaternion[3] = w;
-      return *this;
+      GgVector c;
+      self().transform(c.data(), v.data());
+      return c;
     }
+  };
 
-    //! \brief 四元数を格納する.
-    //!   \param v 四元数を格納した GgVector 型の変数.
-    //!   \return 設定した四元数.
-    GgQuaternion &load(const GgVector &v)
+  /*!
+  ** \brief 変換行列の積の式の末端 (変換行列の参照).
+  */
+  class GgMatrixReference
+    : public GgMatrixExpression<GgMatrixReference>
+  {
+    // 参照する変換行列
+    const GgMatrix &matrix;
+
+  public:
+
+    //! \brief コンストラクタ.
+    //!   \param m 参照する GgMatrix 型の変換行列.
+    explicit GgMatrixReference(const GgMatrix &m)
+      : matrix(m)
+    {}
+
+    //! \brief 参照している変換行列を取り出す.
+    //!   \return 参照している GgMatrix 型の変換行列.
+    const GgMatrix &get() const
     {
-      quaternion = v;
-      return *this;
+      return matrix;
     }
 
-    //! \brief 四元数を格納する.
-    //!   \param a 四元数を格納した GLfloat 型の 4 要素の配列変数.
-    //!   \return 設定した四元数.
-    GgQuaternion &load(const GLfloat *a)
+    //! \brief 変換行列の k 列目を取り出す.
+    //!   \param c 列ベクトルを格納する GLfloat 型の 4 要素の配列変数.
+    //!   \param k 取り出す列の番号.
+    void column(GLfloat *c, int k) const
     {
-      return load(a[0], a[1], a[2], a[3]);
+      const GLfloat *const m(matrix.get() + k * 4);
+      c[0] = m[0];
+      c[1] = m[1];
+      c[2] = m[2];
+      c[3] = m[3];
     }
 
-    //! \brief 四元数を格納する.
-    //!   \param q GgQuaternion 型の四元数.
-    //!   \return 設定した四元数.
-    GgQuaternion &load(const GgQuaternion &q)
+    //! \brief 変換行列をベクトルに適用する.
+    //!   \param c 変換結果を格納する GLfloat 型の 4 要素の配列変数 (v と別の場所).
+    //!   \param v 元のベクトルの GLfloat 型の 4 要素の配列変数.
+    void transform(GLfloat *c, const GLfloat *v) const
     {
-      return load(q.quaternion);
+      const GLfloat *const m(matrix.get());
+      for (int i = 0; i < 4; ++i) c[i] = m[i] * v[0] + m[i + 4] * v[1] + m[i + 8] * v[2] + m[i + 12] * v[3];
     }
 
-    //! \brief 四元数に別の四元数を加算した結果を格納する.
-    //!   \param x 加える四元数の x 要素.
-    //!   \param y 加える四元数の y 要素.
-    //!   \param z 加える四元数の z 要素.
-    //!   \param w 加える四元数の w 要素.
-    //!   \return (x, y, z, w) を加えた四元数.
-    GgQuaternion &loadAdd(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+    //! \brief 変換行列の k 列目の上 3 要素を取り出す.
+    //!   \param c 列ベクトルの上 3 要素を格納する GLfloat 型の 3 要素の配列変数.
+    //!   \param k 取り出す列の番号.
+    void column3(GLfloat *c, int k) const
     {
-      quaternion[0] += x;
-      quaternion[1] += y;
-      quaternion[2] += z;
-      quaternion[3] += w;
-      return *this;
+      const GLfloat *const m(matrix.get() + k * 4);
+      c[0] = m[0];
+      c[1] = m[1];
+      c[2] = m[2];
     }
 
-    //! \brief 四元数に別の四元数を加算した結果を格納する.
-    //!   \param v 四元数を格納した GgVector 型の変数.
-    //!   \return v を加えた四元数.
-    GgQuaternion &loadAdd(const GgVector &v)
+    //! \brief 変換行列をベクトルに適用した結果の上 3 要素を求める.
+    //!   \param c 変換結果の上 3 要素を格納する GLfloat 型の 3 要素の配列変数 (v と別の場所).
+    //!   \param v 元のベクトルの GLfloat 型の 4 要素の配列変数.
+    void transform3(GLfloat *c, const GLfloat *v) const
     {
-      return loadAdd(v[0], v[1], v[2], v[3]);
+      const GLfloat *const m(matrix.get());
+      for (int i = 0; i < 3; ++i) c[i] = m[i] * v[0] + m[i + 4] * v[1] + m[i + 8] * v[2] + m[i + 12] * v[3];
+    }
+  };
+
+  /*!
+  ** \brief 二つの式の積の式.
+  **
+  **   \tparam L 左辺の式の型.
+  **   \tparam R 右辺の式の型.
+  */
+  template <typename L, typename R>
+  class GgMatrixProduct
+    : public GgMatrixExpression<GgMatrixProduct<L, R>>
+  {
+    // 左辺と右辺の式
+    const L left;
+    const R right;
+
+    // 変換行列どうしの積の法線変換行列は 3 列分の積から直接求める
+    static void fuseNormal(GgMatrix &mn, const GgMatrixReference &l, const GgMatrixReference &r)
+    {
+      mn.loadNormal(l.get(), r.get());
+    }
+
+    // それ以外は 3 列分の上 3 要素を求めてから法線変換行列を求める
+    template <typename A, typename B>
+    void fuseNormal(GgMatrix &mn, const A &, const B &) const
+    {
+      GgMatrixExpression<GgMatrixProduct<L, R>>::evaluateNormal(mn);
+    }
+
+  public:
+
+    //! \brief コンストラクタ.
+    //!   \param l 左辺の式.
+    //!   \param r 右辺の式.
+    GgMatrixProduct(const L &l, const R &r)
+      : left(l), right(r)
+    {}
+
+    //! \brief 積の k 列目を求める.
+    //!   \param c 列ベクトルを格納する GLfloat 型の 4 要素の配列変数.
+    //!   \param k 求める列の番号.
+    void column(GLfloat *c, int k) const
+    {
+      GLfloat t[4];
+      right.column(t, k);
+      left.transform(c, t);
+    }
+
+    //! \brief 積をベクトルに適用する.
+    //!   \param c 変換結果を格納する GLfloat 型の 4 要素の配列変数 (v と別の場所).
+    //!   \param v 元のベクトルの GLfloat 型の 4 要素の配列変数.
+    void transform(GLfloat *c, const GLfloat *v) const
+    {
+      GLfloat t[4];
+      right.transform(t, v);
+      left.transform(c, t);
+    }
+
+    //! \brief 積の k 列目の上 3 要素を求める.
+    //!   \param c 列ベクトルの上 3 要素を格納する GLfloat 型の 3 要素の配列変数.
+    //!   \param k 求める列の番号.
+    void column3(GLfloat *c, int k) const
+    {
+      GLfloat t[4];
+      right.column(t, k);
+      left.transform3(c, t);
+    }
+
+    //! \brief 積をベクトルに適用した結果の上 3 要素を求める.
+    //!   \param c 変換結果の上 3 要素を格納する GLfloat 型の 3 要素の配列変数 (v と別の場所).
+    //!   \param v 元のベクトルの GLfloat 型の 4 要素の配列変数.
+    void transform3(GLfloat *c, const GLfloat *v) const
+    {
+      GLfloat t[4];
+      right.transform(t, v);
+      left.transform3(c, t);
+    }
+
+    //! \brief 積の法線変換行列を求める.
+    //!   \param mn 法線変換行列を格納する GgMatrix 型の変数.
+    void evaluateNormal(GgMatrix &mn) const
+    {
+      fuseNormal(mn, left, right);
+    }
+  };
+
+  //! \brief 変換行列を式テンプレートで扱う.
+  //!   \param m GgMatrix 型の変換行列.
+  //!   \return m を参照する式.
+  inline GgMatrixReference ggExpression(const GgMatrix &m)
+  {
+    return GgMatrixReference(m);
+  }
+
+  //! \brief 二つの式の積の式を返す.
+  //!   \param l 左辺の式.
+  //!   \param r 右辺の式.
+  //!   \return l と r の積の式.
+  template <typename L, typename R>
+  inline GgMatrixProduct<L, R> operator*(const GgMatrixExpression<L> &l, const GgMatrixExpression<R> &r)
+  {
+    return GgMatrixProduct<L, R>(l.self(), r.self());
+  }
+
+  //! \brief 式と変換行列の積の式を返す.
+  //!   \param l 左辺の式.
+  //!   \param m 右辺の GgMatrix 型の変換行列.
+  //!   \return l と m の積の式.
+  template <typename L>
+  inline GgMatrixProduct<L, GgMatrixReference> operator*(const GgMatrixExpression<L> &l, const GgMatrix &m)
+  {
+    return GgMatrixProduct<L, GgMatrixReference>(l.self(), GgMatrixReference(m));
+  }
+
+  //! \brief 変換行列と式の積の式を返す.
+  //!   \param m 左辺の GgMatrix 型の変換行列.
+  //!   \param r 右辺の式.
+  //!   \return m と r の積の式.
+  template <typename R>
+  inline GgMatrixProduct<GgMatrixReference, R> operator*(const GgMatrix &m, const GgMatrixExpression<R> &r)
+  {
+    return GgMatrixProduct<GgMatrixReference, R>(GgMatrixReference(m), r.self());
+  }
+
+  /*!
+  ** \brief 四元数.
+  */
+  class GgQuaternion
+  {
+    // 四元数の要素
+    GgVector quaternion;
+
+    // GgQuaternion 型の四元数 p と四元数 q の積を四元数 r に求める
+    void multiply(GLfloat *r, const GLfloat *p, const GLfloat *q) const;
+
+    // GgQuaternion 型の四元数 q が表す回転の変換行列を m に求める
+    void toMatrix(GLfloat *m, const GLfloat *q) const;
+
+    // 回転の変換行列 m が表す四元数を q に求める
+    void toQuaternion(GLfloat *q, const GLfloat *m) const;
+
+    // 球面線形補間 q と r を t で補間した四元数を p に求める
+    void slerp(GLfloat *p, const GLfloat *q, const GLfloat *r, GLfloat t) const;
+
+    // 四元数の配列をまとめて処理する関数から要素を直接参照できるようにする
+    friend void ggMultiplyQuaternion(GgQuaternion *r, const GgQuaternion *p, const GgQuaternion *q, std::size_t count);
+    friend void ggSlerpQuaternion(GgQuaternion *r, const GgQuaternion *p, const GgQuaternion *q, GLfloat t, std::size_t count);
+
+  public:
+
+    //! \brief コンストラクタ.
+    GgQuaternion() {}
+
+    //! \brief コンストラクタ.
+    //!   \param x 四元数の x 要素.
+    //!   \param y 四元数の y 要素.
+    //!   \param z 四元数の z 要素.
+    //!   \param w 四元数の w 要素.
+    constexpr GgQuaternion(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+      : quaternion{ { x, y, z, w } }
+    {}
+
+    //! \brief コンストラクタ.
+    //!   \param v 四元数を格納した GgVector 型の変数.
+    constexpr GgQuaternion(const GgVector &v)
+      : quaternion(v)
+    {}
+
+    //! \brief コンストラクタ.
+    //!   \param a 四元数を格納した GLfloat 型の 4 要素の配列変数.
+    GgQuaternion(const GLfloat *a)
+    {
+      load(a);
+    }
+
+    //! \brief コピーコンストラクタ.
+    //!   \param q GgQuaternion 型の四元数.
+    constexpr GgQuaternion(const GgQuaternion &q)
+      : quaternion(q.quaternion)
+    {}
+
+    //! \brief デストラクタ.
+    ~GgQuaternion() = default;
+
+    //! \brief 四元数のノルムを求める.
+    //!   \return 四元数のノルム.
+    GLfloat norm() const
+    {
+      return ggLength4(quaternion.data());
+    }
+
+    //! \brief 四元数を格納する.
+    //!   \param x 四元数の x 要素.
+    //!   \param y 四元数の y 要素.
+    //!   \param z 四元数の z 要素.
+    //!   \param w 四元数の w 要素.
+    //!   \return 設定した四元数.
+    GgQuaternion &load(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+    {
+      quaternion[0] = x;
+      quaternion[1] = y;
+      quaternion[2] = z;
+      quaternion[3] = w;
+      return *this;
+    }
+
+    //! \brief 四元数を格納する.
+    //!   \param v 四元数を格納した GgVector 型の変数.
+    //!   \return 設定した四元数.
+    GgQuaternion &load(const GgVector &v)
+    {
+      quaternion = v;
+      return *this;
+    }
+
+    //! \brief 四元数を格納する.
+    //!   \param a 四元数を格納した GLfloat 型の 4 要素の配列変数.
+    //!   \return 設定した四元数.
+    GgQuaternion &load(const GLfloat *a)
+    {
+      return load(a[0], a[1], a[2], a[3]);
+    }
+
+    //! \brief 四元数を格納する.
+    //!   \param q GgQuaternion 型の四元数.
+    //!   \return 設定した四元数.
+    GgQuaternion &load(const GgQuaternion &q)
+    {
+      return load(q.quaternion);
+    }
+
+    //! \brief 四元数に別の四元数を加算した結果を格納する.
+    //!   \param x 加える四元数の x 要素.
+    //!   \param y 加える四元数の y 要素.
+    //!   \param z 加える四元数の z 要素.
+    //!   \param w 加える四元数の w 要素.
+    //!   \return (x, y, z, w) を加えた四元数.
+    GgQuaternion &loadAdd(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+    {
+      quaternion[0] += x;
+      quaternion[1] += y;
+      quaternion[2] += z;
+      quaternion[3] += w;
+      return *this;
+    }
+
+    //! \brief 四元数に別の四元数を加算した結果を格納する.
+    //!   \param v 四元数を格納した GgVector 型の変数.
+    //!   \return v を加えた四元数.
+    GgQuaternion &loadAdd(const GgVector &v)
+    {
+      return loadAdd(v[0], v[1], v[2], v[3]);
     }
 
     //! \brief 四元数に別の四元数を加算した結果を格納する.
@@ -3461,6 +4067,14 @@ namespace gg
       a[3] = quaternion[3];
     }
 
+    //! \brief 四元数の要素を取り出す.
+    //!   \param i 取り出す要素の番号 (0～3).
+    //!   \return 四元数の i 番目の要素.
+    constexpr GLfloat get(int i) const
+    {
+      return quaternion[i];
+    }
+
     //! \brief 四元数が表す回転の変換行列を a に求める.
     //!   \param a 回転の変換行列を格納する GLfloat 型の 16 要素の配列変数.
     void getMatrix(GLfloat *a) const
@@ -3666,79 +4280,448 @@ namespace gg
     return ggSlerp(a, q.get(), t);
   }
 
-  //! \brief 四元数のノルムを返す.
-  //!   \param q GgQuaternion 型の四元数.
-  //!   \return 四元数 q のノルム.
-  inline GLfloat ggNorm(const GgQuaternion &q)
+  /*!
+  ** \brief 二つの四元数の配列の要素ごとの積を求める.
+  **
+  **   \param r 積を格納する GgQuaternion 型の count 要素の配列変数 (p や q と同じでもよい).
+  **   \param p GgQuaternion 型の count 要素の配列変数.
+  **   \param q GgQuaternion 型の count 要素の配列変数.
+  **   \param count 四元数の数.
+  */
+  extern void ggMultiplyQuaternion(GgQuaternion *r, const GgQuaternion *p, const GgQuaternion *q, std::size_t count);
+
+  /*!
+  ** \brief 二つの四元数の配列の要素ごとに球面線形補間を行う.
+  **
+  **   \param r 補間結果を格納する GgQuaternion 型の count 要素の配列変数 (p や q と同じでもよい).
+  **   \param p GgQuaternion 型の count 要素の配列変数.
+  **   \param q GgQuaternion 型の count 要素の配列変数.
+  **   \param t 補間パラメータ.
+  **   \param count 四元数の数.
+  */
+  extern void ggSlerpQuaternion(GgQuaternion *r, const GgQuaternion *p, const GgQuaternion *q, GLfloat t, std::size_t count);
+
+  //! \cond
+  // 定数式で使う平方根 (Newton 法)
+  constexpr double _ggConstSqrt(double x, double g, double h, int n)
   {
-    return q.norm();
+    return g == h || n == 0 ? g : _ggConstSqrt(x, 0.5 * (g + x / g), g, n - 1);
   }
-
-  //! \brief 正規化した四元数を返す.
-  //!   \param q GgQuaternion 型の四元数.
-  //!   \return 四元数 q を正規化した四元数.
-  inline GgQuaternion ggNormalize(const GgQuaternion &q)
+  constexpr double _ggConstSqrt(double x)
   {
-    return q.normalize();
+    return x > 0.0 ? _ggConstSqrt(x, x > 1.0 ? x : 1.0, 0.0, 256) : 0.0;
   }
 
-  //! \brief 共役四元数を返す.
-  //!   \param q GgQuaternion 型の四元数.
-  //!   \return 四元数 q の共役四元数.
-  inline GgQuaternion ggConjugate(const GgQuaternion &q)
+  // 定数式で使う三角関数 (-π～π に収めてから Taylor 展開する)
+  constexpr double _ggConstWrap(double a)
   {
-    return q.conjugate();
+    return a - 6.283185307179586 * static_cast<double>(static_cast<long long>(a / 6.283185307179586 + (a < 0.0 ? -0.5 : 0.5)));
+  }
+  constexpr double _ggConstSeries(double x2, double t, int d)
+  {
+    return d > 40 ? t : t + _ggConstSeries(x2, -t * x2 / (d * (d + 1)), d + 2);
+  }
+  constexpr double _ggConstSin(double x)
+  {
+    return _ggConstSeries(x * x, x, 2);
+  }
+  constexpr double _ggConstCos(double x)
+  {
+    return _ggConstSeries(x * x, 1.0, 1);
+  }
+  constexpr GLfloat _ggConstSin(GLfloat a)
+  {
+    return static_cast<GLfloat>(_ggConstSin(_ggConstWrap(a)));
+  }
+  constexpr GLfloat _ggConstCos(GLfloat a)
+  {
+    return static_cast<GLfloat>(_ggConstCos(_ggConstWrap(a)));
+  }
+  constexpr GLfloat _ggConstSqrt(GLfloat x)
+  {
+    return static_cast<GLfloat>(_ggConstSqrt(static_cast<double>(x)));
   }
 
-  //! \brief 四元数の逆元を求める.
-  //!   \param q GgQuaternion 型の四元数.
-  //!   \return 四元数 q の逆元.
-  inline GgQuaternion ggInvert(const GgQuaternion &q)
+  // 行列の積の i 番目の要素
+  constexpr GLfloat _ggConstProduct(const GgMatrix &a, const GgMatrix &b, int i)
   {
-    return q.invert();
+    return a.get(0 + (i & 3)) * b.get((i & ~3) + 0) + a.get(4 + (i & 3)) * b.get((i & ~3) + 1)
+      + a.get(8 + (i & 3)) * b.get((i & ~3) + 2) + a.get(12 + (i & 3)) * b.get((i & ~3) + 3);
   }
 
-  /*!
-  ** \brief 簡易トラックボール処理.
-  */
-  class GgTrackball
+  // 正規化した軸 (l, m, n) と c = cos(a), s = sin(a) から回転の変換行列を求める
+  constexpr GgMatrix _ggConstRotate(GLfloat l, GLfloat m, GLfloat n, GLfloat c, GLfloat s)
   {
-    bool drag;        // ドラッグ中か否か
-    float start[2];   // ドラッグ開始位置
-    float scale[2];   // マウスの絶対位置→ウィンドウ内での相対位置の換算係数
-    GgQuaternion cq;  // 回転の初期値 (四元数)
-    GgQuaternion tq;  // ドラッグ中の回転 (四元数)
-    GgMatrix rt;      // 回転の変換行列
+    return GgMatrix(
+      (1.0f - l * l) * c + l * l, l * m * (1.0f - c) + n * s, n * l * (1.0f - c) - m * s, 0.0f,
+      l * m * (1.0f - c) - n * s, (1.0f - m * m) * c + m * m, m * n * (1.0f - c) + l * s, 0.0f,
+      n * l * (1.0f - c) + m * s, m * n * (1.0f - c) - l * s, (1.0f - n * n) * c + n * n, 0.0f,
+      0.0f, 0.0f, 0.0f, 1.0f);
+  }
 
-  public:
+  // 長さ x, y, z で正規化した x 軸, y 軸, z 軸と視点の位置からビュー変換行列を求める
+  constexpr GgMatrix _ggConstLookat(GLfloat ex, GLfloat ey, GLfloat ez,
+    GLfloat xx, GLfloat xy, GLfloat xz, GLfloat x,
+    GLfloat yx, GLfloat yy, GLfloat yz, GLfloat y,
+    GLfloat zx, GLfloat zy, GLfloat zz, GLfloat z)
+  {
+    return GgMatrix(
+      xx / x, yx / y, zx / z, 0.0f,
+      xy / x, yy / y, zy / z, 0.0f,
+      xz / x, yz / y, zz / z, 0.0f,
+      -(ex * (xx / x) + ey * (xy / x) + ez * (xz / x)),
+      -(ex * (yx / y) + ey * (yy / y) + ez * (yz / y)),
+      -(ex * (zx / z) + ey * (zy / z) + ez * (zz / z)),
+      1.0f);
+  }
 
-    //! \brief コンストラクタ.
-    GgTrackball()
-    {
-      reset();
-    }
+  // x 軸, y 軸, z 軸と視点の位置からビュー変換行列を求める
+  constexpr GgMatrix _ggConstLookat(GLfloat ex, GLfloat ey, GLfloat ez,
+    GLfloat xx, GLfloat xy, GLfloat xz,
+    GLfloat yx, GLfloat yy, GLfloat yz,
+    GLfloat zx, GLfloat zy, GLfloat zz)
+  {
+    return yx * yx + yy * yy + yz * yz == 0.0f
+      ? GgMatrix(1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f)
+      : _ggConstLookat(ex, ey, ez,
+        xx, xy, xz, _ggConstSqrt(xx * xx + xy * xy + xz * xz),
+        yx, yy, yz, _ggConstSqrt(yx * yx + yy * yy + yz * yz),
+        zx, zy, zz, _ggConstSqrt(zx * zx + zy * zy + zz * zz));
+  }
 
-    //! \brief デストラクタ.
-    virtual ~GgTrackball() {}
+  // x 軸と z 軸から y 軸を求めてビュー変換行列を求める
+  constexpr GgMatrix _ggConstLookat(GLfloat ex, GLfloat ey, GLfloat ez,
+    GLfloat xx, GLfloat xy, GLfloat xz,
+    GLfloat zx, GLfloat zy, GLfloat zz)
+  {
+    return _ggConstLookat(ex, ey, ez, xx, xy, xz,
+      zy * xz - zz * xy, zz * xx - zx * xz, zx * xy - zy * xx,
+      zx, zy, zz);
+  }
 
-    //! \brief トラックボール処理するマウスの移動範囲を指定する.
-    //!   \brief ウィンドウのリサイズ時に呼び出す.
-    //!   \param w 領域の横幅.
-    //!   \param h 領域の高さ.
-    void region(float w, float h);
+  // 四元数の要素の積から回転の変換行列を求める
+  constexpr GgMatrix _ggConstQuaternionMatrix(GLfloat xx, GLfloat yy, GLfloat zz,
+    GLfloat xy, GLfloat yz, GLfloat zx, GLfloat xw, GLfloat yw, GLfloat zw)
+  {
+    return GgMatrix(
+      1.0f - yy - zz, xy + zw, zx - yw, 0.0f,
+      xy - zw, 1.0f - zz - xx, yz + xw, 0.0f,
+      zx + yw, yz - xw, 1.0f - xx - yy, 0.0f,
+      0.0f, 0.0f, 0.0f, 1.0f);
+  }
 
-    //! \brief トラックボール処理するマウスの移動範囲を指定する.
-    //!   \brief ウィンドウのリサイズ時に呼び出す.
-    //!   \param w 領域の横幅.
-    //!   \param h 領域の高さ.
-    void region(int w, int h)
-    {
-      region(static_cast<float>(w), static_cast<float>(h));
-    }
+  // 長さの二乗 l の軸 (x, y, z) と角度の半分 h から回転の四元数を求める
+  constexpr GgQuaternion _ggConstRotateQuaternion(GLfloat x, GLfloat y, GLfloat z, GLfloat l, GLfloat h)
+  {
+    return l != 0.0f
+      ? GgQuaternion(x * (_ggConstSin(h) / _ggConstSqrt(l)), y * (_ggConstSin(h) / _ggConstSqrt(l)),
+        z * (_ggConstSin(h) / _ggConstSqrt(l)), _ggConstCos(h))
+      : GgQuaternion(0.0f, 0.0f, 0.0f, _ggConstCos(h));
+  }
+  //! \endcond
 
-    //! \brief トラックボール処理を開始する.
-    //!   \brief マウスのドラッグ開始時 (マウスボタンを押したとき) に呼び出す.
-    //!   \param x 現在のマウスの x 座標.
+  /*!
+  ** \brief 定数式で単位行列を返す.
+  **
+  **   \return 単位行列.
+  */
+  constexpr GgMatrix ggConstIdentity()
+  {
+    return GgMatrix(
+      1.0f, 0.0f, 0.0f, 0.0f,
+      0.0f, 1.0f, 0.0f, 0.0f,
+      0.0f, 0.0f, 1.0f, 0.0f,
+      0.0f, 0.0f, 0.0f, 1.0f);
+  }
+
+  /*!
+  ** \brief 定数式で平行移動の変換行列を返す.
+  **
+  **   \param x x 方向の移動量.
+  **   \param y y 方向の移動量.
+  **   \param z z 方向の移動量.
+  **   \return 平行移動の変換行列.
+  */
+  constexpr GgMatrix ggConstTranslate(GLfloat x, GLfloat y, GLfloat z)
+  {
+    return GgMatrix(
+      1.0f, 0.0f, 0.0f, 0.0f,
+      0.0f, 1.0f, 0.0f, 0.0f,
+      0.0f, 0.0f, 1.0f, 0.0f,
+      x, y, z, 1.0f);
+  }
+
+  /*!
+  ** \brief 定数式で拡大縮小の変換行列を返す.
+  **
+  **   \param x x 方向の拡大率.
+  **   \param y y 方向の拡大率.
+  **   \param z z 方向の拡大率.
+  **   \return 拡大縮小の変換行列.
+  */
+  constexpr GgMatrix ggConstScale(GLfloat x, GLfloat y, GLfloat z)
+  {
+    return GgMatrix(
+      x, 0.0f, 0.0f, 0.0f,
+      0.0f, y, 0.0f, 0.0f,
+      0.0f, 0.0f, z, 0.0f,
+      0.0f, 0.0f, 0.0f, 1.0f);
+  }
+
+  /*!
+  ** \brief 定数式で x 軸中心の回転の変換行列を返す.
+  **
+  **   \param a 回転角.
+  **   \return x 軸中心に a だけ回転する変換行列.
+  */
+  constexpr GgMatrix ggConstRotateX(GLfloat a)
+  {
+    return GgMatrix(
+      1.0f, 0.0f, 0.0f, 0.0f,
+      0.0f, _ggConstCos(a), _ggConstSin(a), 0.0f,
+      0.0f, -_ggConstSin(a), _ggConstCos(a), 0.0f,
+      0.0f, 0.0f, 0.0f, 1.0f);
+  }
+
+  /*!
+  ** \brief 定数式で y 軸中心の回転の変換行列を返す.
+  **
+  **   \param a 回転角.
+  **   \return y 軸中心に a だけ回転する変換行列.
+  */
+  constexpr GgMatrix ggConstRotateY(GLfloat a)
+  {
+    return GgMatrix(
+      _ggConstCos(a), 0.0f, -_ggConstSin(a), 0.0f,
+      0.0f, 1.0f, 0.0f, 0.0f,
+      _ggConstSin(a), 0.0f, _ggConstCos(a), 0.0f,
+      0.0f, 0.0f, 0.0f, 1.0f);
+  }
+
+  /*!
+  ** \brief 定数式で z 軸中心の回転の変換行列を返す.
+  **
+  **   \param a 回転角.
+  **   \return z 軸中心に a だけ回転する変換行列.
+  */
+  constexpr GgMatrix ggConstRotateZ(GLfloat a)
+  {
+    return GgMatrix(
+      _ggConstCos(a), _ggConstSin(a), 0.0f, 0.0f,
+      -_ggConstSin(a), _ggConstCos(a), 0.0f, 0.0f,
+      0.0f, 0.0f, 1.0f, 0.0f,
+      0.0f, 0.0f, 0.0f, 1.0f);
+  }
+
+  /*!
+  ** \brief 定数式で (x, y, z) 方向のベクトルを軸とする回転の変換行列を返す.
+  **
+  **   \param x 回転軸の x 成分.
+  **   \param y 回転軸の y 成分.
+  **   \param z 回転軸の z 成分.
+  **   \param a 回転角.
+  **   \return (x, y, z) を軸に a だけ回転する変換行列 (軸の長さが 0 なら単位行列).
+  */
+  constexpr GgMatrix ggConstRotate(GLfloat x, GLfloat y, GLfloat z, GLfloat a)
+  {
+    return x * x + y * y + z * z > 0.0f
+      ? _ggConstRotate(x / _ggConstSqrt(x * x + y * y + z * z), y / _ggConstSqrt(x * x + y * y + z * z),
+        z / _ggConstSqrt(x * x + y * y + z * z), _ggConstCos(a), _ggConstSin(a))
+      : ggConstIdentity();
+  }
+
+  /*!
+  ** \brief 定数式でビュー変換行列を返す.
+  **
+  **   \param ex 視点の位置の x 座標値.
+  **   \param ey 視点の位置の y 座標値.
+  **   \param ez 視点の位置の z 座標値.
+  **   \param tx 目標点の位置の x 座標値.
+  **   \param ty 目標点の位置の y 座標値.
+  **   \param tz 目標点の位置の z 座標値.
+  **   \param ux 上方向のベクトルの x 成分.
+  **   \param uy 上方向のベクトルの y 成分.
+  **   \param uz 上方向のベクトルの z 成分.
+  **   \return 求めたビュー変換行列 (上方向が視線と平行なら単位行列).
+  */
+  constexpr GgMatrix ggConstLookat(GLfloat ex, GLfloat ey, GLfloat ez,
+    GLfloat tx, GLfloat ty, GLfloat tz,
+    GLfloat ux, GLfloat uy, GLfloat uz)
+  {
+    return _ggConstLookat(ex, ey, ez,
+      uy * (ez - tz) - uz * (ey - ty), uz * (ex - tx) - ux * (ez - tz), ux * (ey - ty) - uy * (ex - tx),
+      ex - tx, ey - ty, ez - tz);
+  }
+
+  /*!
+  ** \brief 定数式で透視投影変換行列を返す.
+  **
+  **   \param fovy y 方向の画角.
+  **   \param aspect 縦横比.
+  **   \param zNear 前方面までの距離.
+  **   \param zFar 後方面までの距離.
+  **   \return 求めた透視投影変換行列 (zNear と zFar が等しければ単位行列).
+  */
+  constexpr GgMatrix ggConstPerspective(GLfloat fovy, GLfloat aspect, GLfloat zNear, GLfloat zFar)
+  {
+    return zFar != zNear
+      ? GgMatrix(
+        _ggConstCos(fovy * 0.5f) / _ggConstSin(fovy * 0.5f) / aspect, 0.0f, 0.0f, 0.0f,
+        0.0f, _ggConstCos(fovy * 0.5f) / _ggConstSin(fovy * 0.5f), 0.0f, 0.0f,
+        0.0f, 0.0f, -(zFar + zNear) / (zFar - zNear), -1.0f,
+        0.0f, 0.0f, -2.0f * zFar * zNear / (zFar - zNear), 0.0f)
+      : ggConstIdentity();
+  }
+
+  /*!
+  ** \brief 定数式で二つの変換行列の積を返す.
+  **
+  **   \param a GgMatrix 型の変換行列.
+  **   \param b GgMatrix 型の変換行列.
+  **   \return a と b の積.
+  */
+  constexpr GgMatrix ggConstMultiply(const GgMatrix &a, const GgMatrix &b)
+  {
+    return GgMatrix(
+      _ggConstProduct(a, b, 0), _ggConstProduct(a, b, 1), _ggConstProduct(a, b, 2), _ggConstProduct(a, b, 3),
+      _ggConstProduct(a, b, 4), _ggConstProduct(a, b, 5), _ggConstProduct(a, b, 6), _ggConstProduct(a, b, 7),
+      _ggConstProduct(a, b, 8), _ggConstProduct(a, b, 9), _ggConstProduct(a, b, 10), _ggConstProduct(a, b, 11),
+      _ggConstProduct(a, b, 12), _ggConstProduct(a, b, 13), _ggConstProduct(a, b, 14), _ggConstProduct(a, b, 15));
+  }
+
+  /*!
+  ** \brief 定数式で (x, y, z) 方向のベクトルを軸とする回転の四元数を返す.
+  **
+  **   \param x 回転軸の x 成分.
+  **   \param y 回転軸の y 成分.
+  **   \param z 回転軸の z 成分.
+  **   \param a 回転角.
+  **   \return (x, y, z) を軸に a だけ回転する四元数.
+  */
+  constexpr GgQuaternion ggConstRotateQuaternion(GLfloat x, GLfloat y, GLfloat z, GLfloat a)
+  {
+    return _ggConstRotateQuaternion(x, y, z, x * x + y * y + z * z, a * 0.5f);
+  }
+
+  /*!
+  ** \brief 定数式で二つの四元数の積を返す.
+  **
+  **   \param p GgQuaternion 型の四元数.
+  **   \param q GgQuaternion 型の四元数.
+  **   \return p と q の積.
+  */
+  constexpr GgQuaternion ggConstMultiply(const GgQuaternion &p, const GgQuaternion &q)
+  {
+    return GgQuaternion(
+      p.get(1) * q.get(2) - p.get(2) * q.get(1) + p.get(0) * q.get(3) + p.get(3) * q.get(0),
+      p.get(2) * q.get(0) - p.get(0) * q.get(2) + p.get(1) * q.get(3) + p.get(3) * q.get(1),
+      p.get(0) * q.get(1) - p.get(1) * q.get(0) + p.get(2) * q.get(3) + p.get(3) * q.get(2),
+      p.get(3) * q.get(3) - p.get(0) * q.get(0) - p.get(1) * q.get(1) - p.get(2) * q.get(2));
+  }
+
+  /*!
+  ** \brief 定数式でオイラー角 (heading, pitch, roll) で与えられた回転を表す四元数を返す.
+  **
+  **   \param heading y 軸中心の回転角.
+  **   \param pitch x 軸中心の回転角.
+  **   \param roll z 軸中心の回転角.
+  **   \return 回転を表す四元数.
+  */
+  constexpr GgQuaternion ggConstEulerQuaternion(GLfloat heading, GLfloat pitch, GLfloat roll)
+  {
+    return ggConstMultiply(ggConstMultiply(
+      GgQuaternion(0.0f, _ggConstSin(heading * 0.5f), 0.0f, _ggConstCos(heading * 0.5f)),
+      GgQuaternion(_ggConstSin(pitch * 0.5f), 0.0f, 0.0f, _ggConstCos(pitch * 0.5f))),
+      GgQuaternion(0.0f, 0.0f, _ggConstSin(roll * 0.5f), _ggConstCos(roll * 0.5f)));
+  }
+
+  /*!
+  ** \brief 定数式で四元数が表す回転の変換行列を返す.
+  **
+  **   \param q GgQuaternion 型の四元数.
+  **   \return q が表す回転の変換行列.
+  */
+  constexpr GgMatrix ggConstQuaternionMatrix(const GgQuaternion &q)
+  {
+    return _ggConstQuaternionMatrix(
+      q.get(0) * q.get(0) * 2.0f, q.get(1) * q.get(1) * 2.0f, q.get(2) * q.get(2) * 2.0f,
+      q.get(0) * q.get(1) * 2.0f, q.get(1) * q.get(2) * 2.0f, q.get(2) * q.get(0) * 2.0f,
+      q.get(0) * q.get(3) * 2.0f, q.get(1) * q.get(3) * 2.0f, q.get(2) * q.get(3) * 2.0f);
+  }
+
+  //! \brief 四元数のノルムを返す.
+  //!   \param q GgQuaternion 型の四元数.
+  //!   \return 四元数 q のノルム.
+  inline GLfloat ggNorm(const GgQuaternion &q)
+  {
+    return q.norm();
+  }
+
+  //! \brief 正規化した四元数を返す.
+  //!   \param q GgQuaternion 型の四元数.
+  //!   \return 四元数 q を正規化した四元数.
+  inline GgQuaternion ggNormalize(const GgQuaternion &q)
+  {
+    return q.normalize();
+  }
+
+  //! \brief 共役四元数を返す.
+  //!   \param q GgQuaternion 型の四元数.
+  //!   \return 四元数 q の共役四元数.
+  inline GgQuaternion ggConjugate(const GgQuaternion &q)
+  {
+    return q.conjugate();
+  }
+
+  //! \brief 四元数の逆元を求める.
+  //!   \param q GgQuaternion 型の四元数.
+  //!   \return 四元数 q の逆元.
+  inline GgQuaternion ggInvert(const GgQuaternion &q)
+  {
+    return q.invert();
+  }
+
+  /*!
+  ** \brief 簡易トラックボール処理.
+  */
+  class GgTrackball
+  {
+    bool drag;        // ドラッグ中か否か
+    float start[2];   // ドラッグ開始位置
+    float scale[2];   // マウスの絶対位置→ウィンドウ内での相対位置の換算係数
+    GgQuaternion cq;  // 回転の初期値 (四元数)
+    GgQuaternion tq;  // ドラッグ中の回転 (四元数)
+    GgMatrix rt;      // 回転の変換行列
+
+  public:
+
+    //! \brief コンストラクタ.
+    GgTrackball()
+    {
+      reset();
+    }
+
+    //! \brief デストラクタ.
+    virtual ~GgTrackball() {}
+
+    //! \brief トラックボール処理するマウスの移動範囲を指定する.
+    //!   \brief ウィンドウのリサイズ時に呼び出す.
+    //!   \param w 領域の横幅.
+    //!   \param h 領域の高さ.
+    void region(float w, float h);
+
+    //! \brief トラックボール処理するマウスの移動範囲を指定する.
+    //!   \brief ウィンドウのリサイズ時に呼び出す.
+    //!   \param w 領域の横幅.
+    //!   \param h 領域の高さ.
+    void region(int w, int h)
+    {
+      region(static_cast<float>(w), static_cast<float>(h));
+    }
+
+    //! \brief トラックボール処理を開始する.
+    //!   \brief マウスのドラッグ開始時 (マウスボタンを押したとき) に呼び出す.
+    //!   \param x 現在のマウスの x 座標.
     //!   \param y 現在のマウスの y 座標.
     void begin(float x, float y);
 
@@ -3857,11 +4840,19 @@ namespace gg
       , size{ width, height }
     {}
 
+    //! \brief 作成済みのテクスチャを引き取るコンストラクタ.
+    //!   \param texture 引き取るテクスチャ名, このオブジェクトの削除時に削除する.
+    //!   \param size テクスチャの横と縦の画素数を格納した 2 要素の配列.
+    GgTexture(GLuint texture, const GLsizei *size)
+      : texture(texture)
+      , size{ size[0], size[1] }
+    {}
+
     //! \brief デストラクタ.
     virtual ~GgTexture()
     {
-      glBindTexture(GL_TEXTURE_2D, 0);
-      glDeleteTextures(1, &texture);
+      ggBindTexture(GL_TEXTURE_2D, 0);
+      ggDeleteTextures(1, &texture);
     }
 
     // コピーコンストラクタを封じる
@@ -3873,13 +4864,13 @@ namespace gg
     //! \brief テクスチャの使用開始 (このテクスチャを使用する際に呼び出す).
     void bind() const
     {
-      glBindTexture(GL_TEXTURE_2D, texture);
+      ggBindTexture(GL_TEXTURE_2D, texture);
     }
 
     //! \brief テクスチャの使用終了 (このテクスチャを使用しなくなったら呼び出す).
     void unbind() const
     {
-      glBindTexture(GL_TEXTURE_2D, 0);
+      ggBindTexture(GL_TEXTURE_2D, 0);
     }
 
     //! \brief 使用しているテクスチャの横の画素数を取り出す.
@@ -3952,11 +4943,19 @@ namespace gg
     //! \brief ファイルからデータを読み込んでテクスチャを作成するコンストラクタ.
     //!   \param name 読み込むファイル名.
     //!   \param internal glTexImage2D() に指定するテクスチャの内部フォーマット. 0 なら外部フォーマットに合わせる.
+    //!     圧縮テクスチャの内部フォーマットなら ggLoadImage() と同様にブロック圧縮したミップマップを作成する.
     GgColorTexture(const char *name, GLenum internal = 0, GLenum wrap = GL_CLAMP_TO_EDGE)
     {
       load(name, internal, wrap);
     }
 
+    //! \brief 作成済みのテクスチャを引き取るコンストラクタ.
+    //!   \param texture 引き取るテクスチャ名, このオブジェクトの削除時に削除する.
+    //!   \param size テクスチャの横と縦の画素数を格納した 2 要素の配列.
+    GgColorTexture(GLuint texture, const GLsizei *size)
+      : texture(std::make_shared<GgTexture>(texture, size))
+    {}
+
     //! \brief デストラクタ.
     virtual ~GgColorTexture() {}
 
@@ -3979,6 +4978,7 @@ namespace gg
     //! \brief テクスチャを作成してファイルからデータを読み込む.
     //!   \param name 読み込むファイル名.
     //!   \param internal glTexImage2D() に指定するテクスチャの内部フォーマット. 0 なら外部フォーマットに合わせる.
+    //!     圧縮テクスチャの内部フォーマットなら ggLoadImage() と同様にブロック圧縮したミップマップを作成する.
     //!   \return テクスチャの作成に成功すれば true, 失敗すれば false.
     void load(const char *name, GLenum internal = 0, GLenum wrap = GL_CLAMP_TO_EDGE);
   };
@@ -4022,6 +5022,13 @@ namespace gg
       load(name, nz, internal);
     }
 
+    //! \brief 作成済みの法線マップのテクスチャを引き取るコンストラクタ.
+    //!   \param texture 引き取るテクスチャ名, このオブジェクトの削除時に削除する.
+    //!   \param size テクスチャの横と縦の画素数を格納した 2 要素の配列.
+    GgNormalTexture(GLuint texture, const GLsizei *size)
+      : texture(std::make_shared<GgTexture>(texture, size))
+    {}
+
     //! \brief デストラクタ.
     virtual ~GgNormalTexture() {}
 
@@ -4033,17 +5040,7 @@ namespace gg
     //!   \param nz 法線マップの z 成分の値.
     //!   \param internal テクスチャの内部フォーマット.
     void load(const GLubyte *hmap, GLsizei width, GLsizei height, GLenum format = GL_RED, float nz = 1.0f,
-      GLenum internal = GL_RGBA)
-    {
-      // 法線マップ
-      std::vector<GgVector> nmap;
-
-      // 法線マップを作成する
-      ggCreateNormalMap(hmap, width, height, format, nz, internal, nmap);
-
-      // テクスチャを作成する
-      texture.reset(new GgTexture(nmap.data(), width, height, GL_RGBA, GL_FLOAT, internal, GL_REPEAT));
-    }
+      GLenum internal = GL_RGBA);
 
     //! \brief ファイルからデータを読み込んで法線マップのテクスチャを作成する.
     //!   \param name 画像ファイル名 (1 チャネルの TGA 画像).
@@ -4096,7 +5093,7 @@ namespace gg
     {
       // バッファオブジェクトを削除する
       glBindBuffer(target, 0);
-      glDeleteBuffers(1, &buffer);
+      ggDeleteBuffers(1, &buffer);
     }
 
     // コピーコンストラクタを封じる
@@ -4228,83 +5225,335 @@ namespace gg
   };
 
   /*!
-  ** \brief ユニフォームバッファオブジェクト.
+  ** \brief 毎フレーム更新するデータのバッファオブジェクト.
   **
-  **   ユニフォーム変数を格納するバッファオブジェクトの基底クラス.
+  **   frames フレーム分の領域を確保してリングとして使い, フレームごとに別の領域に書き込む.
+  **   書き込み先のフレームの描画完了をフェンスで確認してから書き込むので, GPU がまだ前のフレームを
+  **   参照していてもパイプラインを停止させない. ggBufferStorage が true なら glBufferStorage() で
+  **   確保して永続的にマップしたままにし, そうでなければ書き込むたびに同期せずにマップする.
+  **   next() で次のフレームに切り替えたあと map() / unmap() か send() でそのフレームのデータを書き込み,
+  **   描画命令を発行し終えたら fence() を呼び出す. 切り替えたフレームには前のフレームの内容は
+  **   引き継がれないので, 描画に使うデータは毎フレーム全て書き込む.
   */
   template <typename T>
-  class GgUniformBuffer
+  class GgStreamBuffer
   {
-    // ユニフォームバッファオブジェクト
-    std::shared_ptr<GgBuffer<T>> uniform;
+    // ターゲット
+    const GLenum target;
+
+    // バッファオブジェクトのアライメントを考慮したデータの間隔
+    const GLsizei stride;
+
+    // 1 フレームのデータの数
+    const GLsizei count;
+
+    // リングのフレーム数
+    const GLsizei frames;
+
+    // 現在のフレーム
+    GLsizei frame;
+
+    // バッファオブジェクト
+    const GLuint buffer;
+
+    // 永続的にマップしたバッファオブジェクトの先頭 (nullptr なら書き込むたびにマップする)
+    char *persistent;
+
+    // フレームごとの描画完了のフェンス
+    std::vector<GLsync> sync;
 
   public:
 
     //! \brief コンストラクタ.
-    GgUniformBuffer<T>() {}
-
-    //! \brief ユニフォームバッファオブジェクトのブロックごとにデータを転送するコンストラクタ.
-    //!   \param data データが格納されている領域の先頭のポインタ (nullptr ならデータを転送しない).
-    //!   \param count データの数.
-    //!   \param usage バッファオブジェクトの使い方.
-    GgUniformBuffer<T>(const T *data, GLsizei count, GLenum usage = GL_STATIC_DRAW)
+    //!   \param target バッファオブジェクトのターゲット.
+    //!   \param data 全てのフレームに格納するデータの先頭のポインタ (nullptr ならデータを転送しない).
+    //!   \param stride データの間隔 (GL_UNIFORM_BUFFER なら ggBufferAlignment の倍数に切り上げる).
+    //!   \param count 1 フレームのデータの数.
+    //!   \param frames リングのフレーム数.
+    GgStreamBuffer<T>(GLenum target, const T *data, GLsizei stride, GLsizei count, GLsizei frames = 3)
+      : target(target)
+      , stride(target == GL_UNIFORM_BUFFER
+        ? (((stride - 1) / ggBufferAlignment) + 1) * ggBufferAlignment : stride)
+      , count(count)
+      , frames(frames)
+      , frame(0)
+      , buffer([] { GLuint buffer; glGenBuffers(1, &buffer); return buffer; } ())
+      , persistent(nullptr)
+      , sync(frames, nullptr)
     {
-      load(data, count, usage);
+      // リング全体の大きさ
+      const GLsizeiptr size(getStride() * count * frames);
+
+      glBindBuffer(target, buffer);
+
+#if !defined(__APPLE__)
+      if (ggBufferStorage)
+      {
+        // 変更できない大きさのメモリを確保して描画中もマップしたままにする
+        const GLbitfield flags(GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+        glBufferStorage(target, size, nullptr, flags);
+        persistent = static_cast<char *>(glMapBufferRange(target, 0, size, flags));
+      }
+#endif
+
+      // 永続的にマップできなければ書き込むたびにマップする
+      if (!persistent) glBufferData(target, size, nullptr, GL_STREAM_DRAW);
+
+      // 全てのフレームに同じデータを格納する
+      if (data)
+      {
+        for (frame = 0; frame < frames; ++frame) send(data, 0, count);
+        frame = 0;
+      }
     }
 
-    //! \brief ユニフォームバッファオブジェクトの全ブロックに同じデータを格納するコンストラクタ.
-    //!   \param data 格納するデータ.
-    //!   \param count 格納する数.
-    //!   \param usage バッファオブジェクトの使い方.
-    GgUniformBuffer<T>(const T &data, GLsizei count, GLenum usage = GL_STATIC_DRAW)
+    //! \brief デストラクタ.
+    virtual ~GgStreamBuffer<T>()
     {
-      load(data, count, usage);
+      for (auto s : sync) if (s) glDeleteSync(s);
+
+      // 永続的なマップはバッファオブジェクトの削除で解除される
+      glBindBuffer(target, 0);
+      ggDeleteBuffers(1, &buffer);
     }
 
-    //! \brief デストラクタ.
-    virtual ~GgUniformBuffer<T>() {}
+    // コピーコンストラクタを封じる
+    GgStreamBuffer<T>(const GgStreamBuffer<T> &o) = delete;
 
-    //! \brief ユニフォームバッファオブジェクトのターゲットを取り出す.
-    //!   \return このユニフォームバッファオブジェクトのターゲット.
+    // 代入演算子を封じる
+    GgStreamBuffer<T> &operator=(const GgStreamBuffer<T> &o) = delete;
+
+    //! \brief バッファオブジェクトのターゲットを取り出す.
+    //!   \return このバッファオブジェクトのターゲット.
     GLuint getTarget() const
     {
-      return uniform->getTarget();
+      return target;
     }
 
-    //! \brief ユニフォームバッファオブジェクトのアライメントを考慮したデータの間隔を取り出す.
-    //!   \return このユニフォームバッファオブジェクトのデータの間隔.
+    //! \brief バッファオブジェクトのアライメントを考慮したデータの間隔を取り出す.
+    //!   \return このバッファオブジェクトのデータの間隔.
     GLsizeiptr getStride() const
     {
-      return  uniform->getStride();
+      return static_cast<GLsizeiptr>(stride);
     }
 
-    //! \brief データの数を取り出す.
-    //!   \return このユニフォームバッファオブジェクトのデータの数.
+    //! \brief 1 フレームのデータの数を取り出す.
+    //!   \return このバッファオブジェクトの 1 フレームが保持するデータの数.
     GLsizei getCount() const
     {
-      return uniform->getCount();
+      return count;
     }
 
-    //! \brief ユニフォームバッファオブジェクト名を取り出す.
-    //!   \return このユニフォームバッファオブジェクト名.
-    GLuint getBuffer() const
+    //! \brief リングのフレーム数を取り出す.
+    //!   \return このバッファオブジェクトのフレーム数.
+    GLsizei getFrames() const
     {
-      return uniform->getBuffer();
+      return frames;
     }
 
-    //! \brief ユニフォームバッファオブジェクトを結合する.
-    void bind() const
+    //! \brief 現在のフレームの番号を取り出す.
+    //!   \return 書き込みと描画に使っているフレームの番号.
+    GLsizei getFrame() const
     {
-      uniform->bind();
+      return frame;
     }
 
-    //! \brief ユニフォームバッファオブジェクトを解放する.
-    void unbind() const
+    //! \brief バッファオブジェクト名を取り出す.
+    //!   \return このバッファオブジェクト名.
+    GLuint getBuffer() const
     {
-      uniform->unbind();
+      return buffer;
     }
 
-    //! \brief ユニフォームバッファオブジェクトをマップする.
+    //! \brief 永続的にマップしているか調べる.
+    //!   \return glBufferStorage() で確保して永続的にマップしていれば true.
+    bool isPersistent() const
+    {
+      return persistent != nullptr;
+    }
+
+    //! \brief 現在のフレームのデータのバッファオブジェクトの先頭からの位置を取り出す.
+    //!   \param first データの番号.
+    //!   \return 現在のフレームの first 番目のデータのバイトオフセット.
+    GLintptr getOffset(GLint first = 0) const
+    {
+      return getStride() * (static_cast<GLintptr>(count) * frame + first);
+    }
+
+    //! \brief バッファオブジェクトを結合する.
+    void bind() const
+    {
+      glBindBuffer(target, buffer);
+    }
+
+    //! \brief バッファオブジェクトを解放する.
+    void unbind() const
+    {
+      glBindBuffer(target, 0);
+    }
+
+    //! \brief 現在のフレームのデータをインデックス付きのターゲットの結合ポイントに結合する.
+    //!   \param index 結合ポイント.
+    //!   \param first 結合する最初のデータの番号.
+    //!   \param count 結合するデータの数.
+    void select(GLuint index, GLint first = 0, GLsizei count = 1) const
+    {
+      ggBindBufferRange(target, index, buffer, getOffset(first), getStride() * (count - 1) + sizeof (T));
+    }
+
+    //! \brief 次のフレームに切り替える.
+    //!   \note 切り替えたフレームの領域を GPU が使い終わるまで待つ.
+    void next()
+    {
+      // 次のフレームに切り替える
+      if (++frame >= frames) frame = 0;
+
+      // このフレームの領域を GPU が使い終わるのを待つ
+      if (sync[frame])
+      {
+        glClientWaitSync(sync[frame], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ULL);
+        glDeleteSync(sync[frame]);
+        sync[frame] = nullptr;
+      }
+    }
+
+    //! \brief 現在のフレームの指定した範囲をマップする.
+    //!   \param first マップする範囲の現在のフレームの先頭からの位置.
+    //!   \param count マップするデータの数 (0 ならフレーム全体).
+    //!   \return マップしたメモリの先頭のポインタ.
+    void *map(GLint first = 0, GLsizei count = 0) const
+    {
+      // count が 0 ならフレームの全データをマップする
+      if (count == 0) count = getCount();
+      if (first + count > getCount()) count = getCount() - first;
+
+      // 永続的にマップしていればその中の領域を返す
+      if (persistent) return persistent + getOffset(first);
+
+      // このフレームの領域を同期せずにマップする
+      glBindBuffer(target, buffer);
+      return glMapBufferRange(target, getOffset(first), getStride() * count,
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    }
+
+    //! \brief バッファオブジェクトをアンマップする.
+    void unmap() const
+    {
+      // 永続的にマップしていればアンマップしない
+      if (persistent) return;
+
+      glBindBuffer(target, buffer);
+      glUnmapBuffer(target);
+    }
+
+    //! \brief 現在のフレームにデータを転送する.
+    //!   \param data 転送元のデータが格納されてている領域の先頭のポインタ.
+    //!   \param first 転送先の現在のフレームの先頭の要素番号.
+    //!   \param count 転送するデータの数 (0 ならフレーム全体).
+    void send(const T *data, GLint first = 0, GLsizei count = 0) const
+    {
+      // count が 0 ならフレームの全データを転送する
+      if (count == 0) count = getCount();
+      if (first + count > getCount()) count = getCount() - first;
+
+      char *const start(static_cast<char *>(map(first, count)));
+      if (!start) return;
+
+      // データの間隔が T の大きさと同じなら一度に転送する
+      if (getStride() == sizeof (T))
+        memcpy(start, data, sizeof (T) * count);
+      else
+        for (GLsizei i = 0; i < count; ++i) memcpy(start + getStride() * i, data + i, sizeof (T));
+
+      unmap();
+    }
+
+    //! \brief 現在のフレームの描画命令を発行し終えたことを記録する.
+    void fence()
+    {
+      if (sync[frame]) glDeleteSync(sync[frame]);
+      sync[frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+  };
+
+  /*!
+  ** \brief ユニフォームバッファオブジェクト.
+  **
+  **   ユニフォーム変数を格納するバッファオブジェクトの基底クラス.
+  */
+  template <typename T>
+  class GgUniformBuffer
+  {
+    // ユニフォームバッファオブジェクト
+    std::shared_ptr<GgBuffer<T>> uniform;
+
+  public:
+
+    //! \brief コンストラクタ.
+    GgUniformBuffer<T>() {}
+
+    //! \brief ユニフォームバッファオブジェクトのブロックごとにデータを転送するコンストラクタ.
+    //!   \param data データが格納されている領域の先頭のポインタ (nullptr ならデータを転送しない).
+    //!   \param count データの数.
+    //!   \param usage バッファオブジェクトの使い方.
+    GgUniformBuffer<T>(const T *data, GLsizei count, GLenum usage = GL_STATIC_DRAW)
+    {
+      load(data, count, usage);
+    }
+
+    //! \brief ユニフォームバッファオブジェクトの全ブロックに同じデータを格納するコンストラクタ.
+    //!   \param data 格納するデータ.
+    //!   \param count 格納する数.
+    //!   \param usage バッファオブジェクトの使い方.
+    GgUniformBuffer<T>(const T &data, GLsizei count, GLenum usage = GL_STATIC_DRAW)
+    {
+      load(data, count, usage);
+    }
+
+    //! \brief デストラクタ.
+    virtual ~GgUniformBuffer<T>() {}
+
+    //! \brief ユニフォームバッファオブジェクトのターゲットを取り出す.
+    //!   \return このユニフォームバッファオブジェクトのターゲット.
+    GLuint getTarget() const
+    {
+      return uniform->getTarget();
+    }
+
+    //! \brief ユニフォームバッファオブジェクトのアライメントを考慮したデータの間隔を取り出す.
+    //!   \return このユニフォームバッファオブジェクトのデータの間隔.
+    GLsizeiptr getStride() const
+    {
+      return  uniform->getStride();
+    }
+
+    //! \brief データの数を取り出す.
+    //!   \return このユニフォームバッファオブジェクトのデータの数.
+    GLsizei getCount() const
+    {
+      return uniform->getCount();
+    }
+
+    //! \brief ユニフォームバッファオブジェクト名を取り出す.
+    //!   \return このユニフォームバッファオブジェクト名.
+    GLuint getBuffer() const
+    {
+      return uniform->getBuffer();
+    }
+
+    //! \brief ユニフォームバッファオブジェクトを結合する.
+    void bind() const
+    {
+      uniform->bind();
+    }
+
+    //! \brief ユニフォームバッファオブジェクトを解放する.
+    void unbind() const
+    {
+      uniform->unbind();
+    }
+
+    //! \brief ユニフォームバッファオブジェクトをマップする.
     //!   \return マップしたメモリの先頭のポインタ.
     void *map() const
     {
@@ -4492,13 +5741,13 @@ namespace gg
       : vao([] { GLuint vao; glGenVertexArrays(1, &vao); return vao; } ())
       , mode(mode)
     {
-      glBindVertexArray(vao);
+      ggBindVertexArray(vao);
     }
 
     //! \brief デストラクタ.
     virtual ~GgShape()
     {
-      glBindVertexArray(0);
+      ggBindVertexArray(0);
       glDeleteVertexArrays(1, &vao);
     }
 
@@ -4534,12 +5783,17 @@ namespace gg
     //!   \param count 描画するアイテムの数, 0 なら全部のアイテムを描画する.
     virtual void draw(GLint first = 0, GLsizei count = 0) const
     {
-      glBindVertexArray(vao);
+      ggBindVertexArray(vao);
     }
   };
 
   /*!
   ** \brief 点.
+  **
+  **   loadStream() で格納すると頂点の位置を GgStreamBuffer のリングに置く.
+  **   フレームの先頭で next() を一回だけ呼び出して書き込むフレームを切り替え,
+  **   そのフレームの send() や map() はすべて同じフレームに書き込む.
+  **   切り替えたフレームには前のフレームの内容が残っていないので, 描画する頂点はすべて書き直す.
   */
   class GgPoints
     : public GgShape
@@ -4547,6 +5801,9 @@ namespace gg
     // 頂点バッファオブジェクト
     std::shared_ptr<GgBuffer<GgVector>> position;
 
+    // 毎フレーム更新する頂点バッファオブジェクト
+    std::unique_ptr<GgStreamBuffer<GgVector>> stream;
+
   public:
 
     //! \brief コンストラクタ.
@@ -4572,23 +5829,55 @@ namespace gg
     //!   \return この図形の頂点の位置データの数 (頂点数).
     GLsizei getCount() const
     {
-      return position->getCount();
+      return stream ? stream->getCount() : position->getCount();
     }
 
     //! \brief 頂点の位置データを格納した頂点バッファオブジェクト名を取り出す.
     //!   \return この図形の頂点の位置データを格納した頂点バッファオブジェクト名.
     GLuint getBuffer() const
     {
-      return position->getBuffer();
+      return stream ? stream->getBuffer() : position->getBuffer();
+    }
+
+    //! \brief 頂点の位置データをストリーミングしているか調べる.
+    //!   \return loadStream() で格納していれば true.
+    bool isStreaming() const
+    {
+      return static_cast<bool>(stream);
     }
 
     //! \brief 既存のバッファオブジェクトに頂点の位置データを転送する.
     //!   \param pos 転送元の頂点の位置データが格納されてている領域の先頭のポインタ.
     //!   \param first 転送先のバッファオブジェクトの先頭の要素番号.
     //!   \param count 転送する頂点の位置データの数 (0 ならバッファオブジェクト全体).
+    //!   \note ストリーミングしていれば next() で切り替えた現在のフレームに転送する.
     void send(const GgVector *pos, GLint first = 0, GLsizei count = 0) const
     {
-      position->send(pos, first, count);
+      if (!stream) return position->send(pos, first, count);
+      stream->send(pos, first, count);
+    }
+
+    //! \brief 頂点の位置データの書き込み先を得る.
+    //!   \return 頂点数分の GgVector を書き込める領域の先頭のポインタ.
+    //!   \note ストリーミングしていれば next() で切り替えた現在のフレームを返す. 書き込みが終わったら unmap() を呼び出す.
+    GgVector *map() const
+    {
+      if (!stream) return static_cast<GgVector *>(position->map());
+      return static_cast<GgVector *>(stream->map());
+    }
+
+    //! \brief ストリーミングしているとき頂点の位置データを書き込むフレームを次に切り替える.
+    //!   \note 1 フレームに一回, そのフレームの最初の send() や map() の前に呼び出す.
+    //!     切り替えたフレームを前回使った描画が終わるまで待つ. ストリーミングしていなければ何もしない.
+    void next() const
+    {
+      if (stream) stream->next();
+    }
+
+    //! \brief 頂点の位置データの書き込みを終了する.
+    void unmap() const
+    {
+      if (stream) stream->unmap(); else position->unmap();
     }
 
     //! \brief バッファオブジェクトを確保して頂点の位置データを格納する.
@@ -4599,12 +5888,29 @@ namespace gg
     {
       // 頂点バッファオブジェクトを作成する
       position.reset(new GgBuffer<GgVector>(GL_ARRAY_BUFFER, pos, sizeof (GgVector), count, usage));
+      stream.reset();
 
       // このバッファオブジェクトは index == 0 の in 変数から入力する
       glVertexAttribPointer(0, static_cast<GLint>(pos->size()), GL_FLOAT, GL_FALSE, 0, 0);
       glEnableVertexAttribArray(0);
     }
 
+    //! \brief 毎フレーム更新する頂点の位置データを格納する.
+    //!   \param pos 全てのフレームに格納する頂点の位置データの先頭のポインタ (nullptr ならデータを転送しない).
+    //!   \param count 1 フレームの頂点のデータの数 (頂点数).
+    //!   \param frames リングのフレーム数.
+    void loadStream(const GgVector *pos, GLsizei count, GLsizei frames = 3)
+    {
+      // リングにした頂点バッファオブジェクトを作成する
+      stream.reset(new GgStreamBuffer<GgVector>(GL_ARRAY_BUFFER, pos, sizeof (GgVector), count, frames));
+      position.reset();
+
+      // リング全体を index == 0 の in 変数から入力し, 描画時に現在のフレームの位置から読み出す
+      stream->bind();
+      glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 0, 0);
+      glEnableVertexAttribArray(0);
+    }
+
     //! \brief 点の描画.
     //!   \param first 描画を開始する最初の点の番号.
     //!   \param count 描画する点の数, 0 なら全部の点を描く.
@@ -4649,8 +5955,44 @@ namespace gg
     {}
   };
 
+  /*!
+  ** \brief 量子化した三角形の頂点データ.
+  **
+  **   位置はバウンディングボックスを基準にした 16 bit の符号なし整数, 法線は八面体写像した 8 bit の符号付き整数で表し,
+  **   GgVertex の 1/4 の 8 バイトに収める. ggCompactVertex() で GgVertex から作成する.
+  */
+  struct GgCompactVertex
+  {
+    GLushort position[3];  //! 量子化した位置.
+    GLbyte normal[2];      //! 八面体写像で量子化した法線.
+  };
+
+  /*!
+  ** \brief 頂点データを量子化する.
+  **
+  **   \param vert 量子化する GgVertex 型の頂点データ.
+  **   \param count 頂点数.
+  **   \param compact 量子化した頂点データの格納先.
+  **   \return 量子化した位置を元に戻す係数, xyz がバウンディングボックスの最小値, w が倍率.
+  */
+  extern GgVector ggCompactVertex(const GgVertex *vert, GLsizei count, std::vector<GgCompactVertex> &compact);
+
+  /*!
+  ** \brief 単精度浮動小数点数を半精度浮動小数点数に変換する.
+  **
+  **   \param f 変換する単精度浮動小数点数.
+  **   \return 最近接偶数丸めで変換した半精度浮動小数点数.
+  */
+  extern GLhalf ggHalf(GLfloat f);
+
   /*!
   ** \brief 三角形で表した形状データ (Arrays 形式).
+  **
+  **   loadStream() で格納すると頂点属性を GgStreamBuffer のリングに置く.
+  **   フレームの先頭で next() を一回だけ呼び出して書き込むフレームを切り替え,
+  **   そのフレームの send() や map() はすべて同じフレームに書き込む.
+  **   切り替えたフレームには前のフレームの内容が残っていないので, 描画する頂点はすべて書き直す.
+  **   量子化した頂点属性は位置を元に戻す係数が形状全体で一つなのでストリーミングしない.
   */
   class GgTriangles
     : public GgShape
@@ -4658,6 +6000,35 @@ namespace gg
     // 頂点属性
     std::unique_ptr<GgBuffer<GgVertex>> vertex;
 
+    // 毎フレーム更新する頂点属性
+    std::unique_ptr<GgStreamBuffer<GgVertex>> stream;
+
+    // 量子化した頂点属性
+    std::unique_ptr<GgBuffer<GgCompactVertex>> compact;
+
+    // 量子化した位置を元に戻す係数
+    std::unique_ptr<GgBuffer<GgVector>> dequantize;
+
+    // 半精度浮動小数点数のテクスチャ座標
+    std::unique_ptr<GgBuffer<std::array<GLhalf, 2>>> texcoord;
+
+    // GgVertex の位置と法線を index == 0 と 1 の in 変数から入力する
+    static void vertexAttribute()
+    {
+      // 頂点の位置は index == 0 の in 変数から入力する
+      glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE,
+        sizeof (GgVertex), static_cast<const char *>(0) + offsetof(GgVertex, position));
+      glEnableVertexAttribArray(0);
+
+      // 頂点の法線は index == 1 の in 変数から入力する
+      glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE,
+        sizeof (GgVertex), static_cast<const char *>(0) + offsetof(GgVertex, normal));
+      glEnableVertexAttribArray(1);
+
+      // 量子化した頂点属性を使わない
+      glDisableVertexAttribArray(3);
+    }
+
   public:
 
     //! \brief コンストラクタ
@@ -4678,6 +6049,19 @@ namespace gg
       load(vert, count, usage);
     }
 
+    //! \brief コンストラクタ.
+    //!   \param vert この図形の量子化した頂点属性の配列 (nullptr ならデータを転送しない).
+    //!   \param count 頂点数.
+    //!   \param dequantize ggCompactVertex() が返す量子化した位置を元に戻す係数.
+    //!   \param mode 描画する基本図形の種類.
+    //!   \param usage バッファオブジェクトの使い方.
+    GgTriangles(const GgCompactVertex *vert, GLsizei count, const GgVector &dequantize,
+      GLenum mode = GL_TRIANGLES, GLenum usage = GL_STATIC_DRAW)
+      : GgShape(mode)
+    {
+      load(vert, count, dequantize, usage);
+    }
+
     //! \brief デストラクタ.
     virtual ~GgTriangles() {}
 
@@ -4685,23 +6069,84 @@ namespace gg
     //!   \return この図形の頂点属性の数 (頂点数).
     GLsizei getCount() const
     {
-      return vertex->getCount();
+      return compact ? compact->getCount() : stream ? stream->getCount() : vertex->getCount();
     }
 
     //! \brief 頂点属性を格納した頂点バッファオブジェクト名を取り出す.
     //!   \return この図形の頂点属性を格納した頂点バッファオブジェクト名.
     GLuint getBuffer() const
     {
-      return vertex->getBuffer();
+      return compact ? compact->getBuffer() : stream ? stream->getBuffer() : vertex->getBuffer();
+    }
+
+    //! \brief 頂点属性をストリーミングしているか調べる.
+    //!   \return loadStream() で格納していれば true.
+    bool isStreaming() const
+    {
+      return static_cast<bool>(stream);
+    }
+
+    //! \brief 現在のフレームの頂点属性の先頭の頂点番号を取り出す.
+    //!   \return 描画時に頂点番号に加える値 (ストリーミングしていなければ 0).
+    GLint getBaseVertex() const
+    {
+      return stream ? stream->getCount() * stream->getFrame() : 0;
+    }
+
+    //! \brief 現在のフレームの頂点属性を使う描画命令を発行し終えたことを記録する.
+    void fence() const
+    {
+      if (stream) stream->fence();
+    }
+
+    //! \brief 頂点属性が量子化されているか調べる.
+    //!   \return 頂点属性が GgCompactVertex なら true.
+    bool isCompact() const
+    {
+      return static_cast<bool>(compact);
     }
 
     //! \brief 既存のバッファオブジェクトに頂点属性を転送する.
     //!   \param vert 転送元の頂点属性が格納されてている領域の先頭のポインタ.
     //!   \param first 転送先のバッファオブジェクトの先頭の要素番号.
     //!   \param count 転送する頂点の位置データの数 (0 ならバッファオブジェクト全体).
+    //!   \note ストリーミングしていれば next() で切り替えた現在のフレームに転送する.
     void send(const GgVertex *vert, GLint first = 0, GLsizei count = 0) const
     {
-      vertex->send(vert, first, count);
+      if (!stream) return vertex->send(vert, first, count);
+      stream->send(vert, first, count);
+    }
+
+    //! \brief 頂点属性の書き込み先を得る.
+    //!   \return 頂点数分の GgVertex を書き込める領域の先頭のポインタ.
+    //!   \note ストリーミングしていれば next() で切り替えた現在のフレームを返す. 書き込みが終わったら unmap() を呼び出す.
+    GgVertex *map() const
+    {
+      if (!stream) return static_cast<GgVertex *>(vertex->map());
+      return static_cast<GgVertex *>(stream->map());
+    }
+
+    //! \brief ストリーミングしているとき頂点属性を書き込むフレームを次に切り替える.
+    //!   \note 1 フレームに一回, そのフレームの最初の send() や map() の前に呼び出す.
+    //!     切り替えたフレームを前回使った描画が終わるまで待つ. ストリーミングしていなければ何もしない.
+    void next() const
+    {
+      if (stream) stream->next();
+    }
+
+    //! \brief 頂点属性の書き込みを終了する.
+    void unmap() const
+    {
+      if (stream) stream->unmap(); else vertex->unmap();
+    }
+
+    //! \brief 既存のバッファオブジェクトに量子化した頂点属性を転送する.
+    //!   \param vert 転送元の量子化した頂点属性が格納されてている領域の先頭のポインタ.
+    //!   \param first 転送先のバッファオブジェクトの先頭の要素番号.
+    //!   \param count 転送する頂点の位置データの数 (0 ならバッファオブジェクト全体).
+    void send(const GgCompactVertex *vert, GLint first = 0, GLsizei count = 0) const
+    {
+      compact->send(vert, first, count);
     }
 
     //! \brief バッファオブジェクトを確保して頂点属性を格納する.
@@ -4712,16 +6157,71 @@ namespace gg
     {
       // 頂点バッファオブジェクトを作成する
       vertex.reset(new GgBuffer<GgVertex>(GL_ARRAY_BUFFER, vert, sizeof (GgVertex), count, usage));
+      vertexAttribute();
+      stream.reset();
+      compact.reset();
+      dequantize.reset();
+    }
 
-      // 頂点の位置は index == 0 の in 変数から入力する
-      glVertexAttribPointer(0, static_cast<GLint>(vert->position.size()), GL_FLOAT, GL_FALSE,
-        sizeof (GgVertex), static_cast<const char *>(0) + offsetof(GgVertex, position));
+    //! \brief 毎フレーム更新する頂点属性を格納する.
+    //!   \param vert 全てのフレームに格納する頂点属性の先頭のポインタ (nullptr ならデータを転送しない).
+    //!   \param count 1 フレームの頂点のデータの数 (頂点数).
+    //!   \param frames リングのフレーム数.
+    void loadStream(const GgVertex *vert, GLsizei count, GLsizei frames = 3)
+    {
+      // リングにした頂点バッファオブジェクトを作成する
+      stream.reset(new GgStreamBuffer<GgVertex>(GL_ARRAY_BUFFER, vert, sizeof (GgVertex), count, frames));
+
+      // リング全体を入力し, 描画時に現在のフレームの位置から読み出す
+      stream->bind();
+      vertexAttribute();
+      vertex.reset();
+      compact.reset();
+      dequantize.reset();
+    }
+
+    //! \brief バッファオブジェクトを確保して量子化した頂点属性を格納する.
+    //!   \param vert 量子化した頂点属性が格納されてている領域の先頭のポインタ.
+    //!   \param count 頂点のデータの数 (頂点数).
+    //!   \param dequantize ggCompactVertex() が返す量子化した位置を元に戻す係数.
+    //!   \param usage バッファオブジェクトの使い方.
+    void load(const GgCompactVertex *vert, GLsizei count, const GgVector &dequantize,
+      GLenum usage = GL_STATIC_DRAW)
+    {
+      // 頂点バッファオブジェクトを作成する
+      compact.reset(new GgBuffer<GgCompactVertex>(GL_ARRAY_BUFFER, vert, sizeof (GgCompactVertex), count, usage));
+      vertex.reset();
+      stream.reset();
+
+      // 頂点の位置は index == 0 の in 変数に整数のまま入力する
+      glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_FALSE,
+        sizeof (GgCompactVertex), static_cast<const char *>(0) + offsetof(GgCompactVertex, position));
       glEnableVertexAttribArray(0);
 
-      // 頂点の法線は index == 1 の in 変数から入力する
-      glVertexAttribPointer(1, static_cast<GLint>(vert->normal.size()), GL_FLOAT, GL_FALSE,
-        sizeof (GgVertex), static_cast<const char *>(0) + offsetof(GgVertex, normal));
+      // 頂点の法線は index == 1 の in 変数の xy に整数のまま入力する (w は 1 になる)
+      glVertexAttribPointer(1, 2, GL_BYTE, GL_FALSE,
+        sizeof (GgCompactVertex), static_cast<const char *>(0) + offsetof(GgCompactVertex, normal));
       glEnableVertexAttribArray(1);
+
+      // 位置を元に戻す係数は index == 3 の in 変数に描画ごとに一つだけ入力する
+      this->dequantize.reset(new GgBuffer<GgVector>(GL_ARRAY_BUFFER, &dequantize, sizeof (GgVector), 1, GL_STATIC_DRAW));
+      glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, 0, 0);
+      glVertexAttribDivisor(3, 1);
+      glEnableVertexAttribArray(3);
+    }
+
+    //! \brief バッファオブジェクトを確保して半精度浮動小数点数のテクスチャ座標を格納する.
+    //!   \param tex ggHalf() で変換したテクスチャ座標が格納されてている領域の先頭のポインタ.
+    //!   \param count テクスチャ座標の数 (頂点数).
+    //!   \param usage バッファオブジェクトの使い方.
+    void loadTexcoord(const std::array<GLhalf, 2> *tex, GLsizei count, GLenum usage = GL_STATIC_DRAW)
+    {
+      // 頂点バッファオブジェクトを作成する
+      texcoord.reset(new GgBuffer<std::array<GLhalf, 2>>(GL_ARRAY_BUFFER, tex, sizeof (std::array<GLhalf, 2>), count, usage));
+
+      // テクスチャ座標は index == 2 の in 変数から入力する
+      glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, 0, 0);
+      glEnableVertexAttribArray(2);
     }
 
     //! \brief 三角形の描画.
@@ -4732,6 +6232,9 @@ namespace gg
 
   /*!
   ** \brief 三角形で表した形状データ (Elements 形式).
+  **
+  **   loadStream() で格納すると頂点属性だけを GgStreamBuffer のリングに置く.
+  **   頂点インデックスは全てのフレームで共有し, 描画時に現在のフレームの先頭の頂点番号を加える.
   */
   class GgElements
     : public GgTriangles
@@ -4739,6 +6242,9 @@ namespace gg
     // インデックスを格納する頂点バッファオブジェクト
     std::unique_ptr<GgBuffer<GLuint>> index;
 
+    // 16 bit のインデックスを格納する頂点バッファオブジェクト
+    std::unique_ptr<GgBuffer<GLushort>> index16;
+
   public:
 
     //! \brief コンストラクタ.
@@ -4761,21 +6267,58 @@ namespace gg
       load(vert, countv, face, countf, usage);
     }
 
-    //! \brief デストラクタ.
-    virtual ~GgElements() {}
-
-    //! \brief データの数を取り出す.
-    //!   \return この図形の三角形数.
-    GLsizei getIndexCount() const
-    {
-      return index->getCount();
-    }
-
-    //! \brief 三角形の頂点インデックスデータを格納した頂点バッファオブジェクト名を取り出す.
-    //!   \return この図形の三角形の頂点インデックスデータを格納した頂点バッファオブジェクト名.
+    //! \brief コンストラクタ.
+    //!   \param vert この図形の頂点属性の配列 (nullptr ならデータを転送しない).
+    //!   \param countv 頂点数 (65536 以下).
+    //!   \param face 三角形の 16 bit の頂点インデックス.
+    //!   \param countf 三角形の頂点数.
+    //!   \param mode 描画する基本図形の種類.
+    //!   \param usage バッファオブジェクトの使い方.
+    GgElements(const GgVertex *vert, GLsizei countv, const GLushort *face, GLsizei countf,
+      GLenum mode = GL_TRIANGLES, GLenum usage = GL_STATIC_DRAW)
+      : GgTriangles(mode)
+    {
+      load(vert, countv, face, countf, usage);
+    }
+
+    //! \brief コンストラクタ.
+    //!   \param vert この図形の量子化した頂点属性の配列 (nullptr ならデータを転送しない).
+    //!   \param countv 頂点数.
+    //!   \param dequantize ggCompactVertex() が返す量子化した位置を元に戻す係数.
+    //!   \param face 三角形の頂点インデックス (GLuint か GLushort).
+    //!   \param countf 三角形の頂点数.
+    //!   \param mode 描画する基本図形の種類.
+    //!   \param usage バッファオブジェクトの使い方.
+    template <typename T>
+    GgElements(const GgCompactVertex *vert, GLsizei countv, const GgVector &dequantize,
+      const T *face, GLsizei countf, GLenum mode = GL_TRIANGLES, GLenum usage = GL_STATIC_DRAW)
+      : GgTriangles(mode)
+    {
+      load(vert, countv, dequantize, face, countf, usage);
+    }
+
+    //! \brief デストラクタ.
+    virtual ~GgElements() {}
+
+    //! \brief データの数を取り出す.
+    //!   \return この図形の三角形数.
+    GLsizei getIndexCount() const
+    {
+      return index16 ? index16->getCount() : index->getCount();
+    }
+
+    //! \brief 三角形の頂点インデックスデータを格納した頂点バッファオブジェクト名を取り出す.
+    //!   \return この図形の三角形の頂点インデックスデータを格納した頂点バッファオブジェクト名.
     GLuint getIndexBuffer() const
     {
-      return index->getBuffer();
+      return index16 ? index16->getBuffer() : index->getBuffer();
+    }
+
+    //! \brief 三角形の頂点インデックスのデータ型を取り出す.
+    //!   \return GL_UNSIGNED_SHORT か GL_UNSIGNED_INT.
+    GLenum getIndexType() const
+    {
+      return index16 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
     }
 
     //! \brief 既存のバッファオブジェクトに頂点属性と三角形の頂点インデックスデータを転送する.
@@ -4805,7 +6348,92 @@ namespace gg
       GgTriangles::load(vert, countv, usage);
 
       // インデックスの頂点バッファオブジェクトを作成する
-      index.reset(new GgBuffer<GLuint>(GL_ELEMENT_ARRAY_BUFFER, face, sizeof (GLuint), countf, usage));
+      loadIndex(face, countf, usage);
+    }
+
+    //! \brief 既存のバッファオブジェクトに頂点属性と三角形の 16 bit の頂点インデックスデータを転送する.
+    //!   \param vertex 頂点属性が格納されてている領域の先頭のポインタ.
+    //!   \param firstv 頂点属性の転送先のバッファオブジェクトの先頭の要素番号.
+    //!   \param countv 頂点のデータの数 (頂点数).
+    //!   \param face 三角形の 16 bit の頂点インデックスデータ.
+    //!   \param firstf インデックスの転送先のバッファオブジェクトの先頭の要素番号.
+    //!   \param countf 三角形の頂点数.
+    void send(const GgVertex *vert, GLuint firstv, GLsizei countv,
+      const GLushort *face, GLuint firstf = 0, GLsizei countf = 0) const
+    {
+      GgTriangles::send(vert, firstv, countv);
+      if (face != nullptr && countf > 0) index16->send(face, firstf, countf);
+    }
+
+    //! \brief バッファオブジェクトを確保して頂点属性と三角形の 16 bit の頂点インデックスデータを格納する.
+    //!   \param vertex 頂点属性が格納されてている領域の先頭のポインタ.
+    //!   \param countv 頂点のデータの数 (頂点数, 65536 以下).
+    //!   \param face 三角形の 16 bit の頂点インデックスデータ.
+    //!   \param countf 三角形の頂点数.
+    //!   \param usage バッファオブジェクトの使い方.
+    void load(const GgVertex *vert, GLsizei countv, const GLushort *face, GLsizei countf,
+      GLenum usage = GL_STATIC_DRAW)
+    {
+      // 頂点バッファオブジェクトを作成する
+      GgTriangles::load(vert, countv, usage);
+
+      // インデックスの頂点バッファオブジェクトを作成する
+      loadIndex(face, countf, usage);
+    }
+
+    //! \brief バッファオブジェクトを確保して量子化した頂点属性と三角形の頂点インデックスデータを格納する.
+    //!   \param vertex 量子化した頂点属性が格納されてている領域の先頭のポインタ.
+    //!   \param countv 頂点のデータの数 (頂点数).
+    //!   \param dequantize ggCompactVertex() が返す量子化した位置を元に戻す係数.
+    //!   \param face 三角形の頂点インデックスデータ (GLuint か GLushort).
+    //!   \param countf 三角形の頂点数.
+    //!   \param usage バッファオブジェクトの使い方.
+    template <typename T>
+    void load(const GgCompactVertex *vert, GLsizei countv, const GgVector &dequantize,
+      const T *face, GLsizei countf, GLenum usage = GL_STATIC_DRAW)
+    {
+      // 頂点バッファオブジェクトを作成する
+      GgTriangles::load(vert, countv, dequantize, usage);
+
+      // インデックスの頂点バッファオブジェクトを作成する
+      loadIndex(face, countf, usage);
+    }
+
+    //! \brief 毎フレーム更新する頂点属性と三角形の頂点インデックスデータを格納する.
+    //!   \param vert 全てのフレームに格納する頂点属性の先頭のポインタ (nullptr ならデータを転送しない).
+    //!   \param countv 1 フレームの頂点のデータの数 (頂点数).
+    //!   \param face 三角形の頂点インデックスデータ (GLuint か GLushort).
+    //!   \param countf 三角形の頂点数.
+    //!   \param frames リングのフレーム数.
+    template <typename T>
+    void loadStream(const GgVertex *vert, GLsizei countv, const T *face, GLsizei countf,
+      GLsizei frames = 3)
+    {
+      // リングにした頂点バッファオブジェクトを作成する
+      GgTriangles::loadStream(vert, countv, frames);
+
+      // インデックスは変更しないので全てのフレームで共有する
+      loadIndex(face, countf, GL_STATIC_DRAW);
+    }
+
+    //! \brief バッファオブジェクトを確保して三角形の頂点インデックスデータを格納する.
+    //!   \param face 三角形の頂点インデックスデータ.
+    //!   \param count 三角形の頂点数.
+    //!   \param usage バッファオブジェクトの使い方.
+    void loadIndex(const GLuint *face, GLsizei count, GLenum usage = GL_STATIC_DRAW)
+    {
+      index.reset(new GgBuffer<GLuint>(GL_ELEMENT_ARRAY_BUFFER, face, sizeof (GLuint), count, usage));
+      index16.reset();
+    }
+
+    //! \brief バッファオブジェクトを確保して三角形の 16 bit の頂点インデックスデータを格納する.
+    //!   \param face 三角形の 16 bit の頂点インデックスデータ.
+    //!   \param count 三角形の頂点数.
+    //!   \param usage バッファオブジェクトの使い方.
+    void loadIndex(const GLushort *face, GLsizei count, GLenum usage = GL_STATIC_DRAW)
+    {
+      index16.reset(new GgBuffer<GLushort>(GL_ELEMENT_ARRAY_BUFFER, face, sizeof (GLushort), count, usage));
+      index.reset();
     }
 
     //! \brief インデックスを使った三角形の描画.
@@ -4902,6 +6530,100 @@ namespace gg
   */
   extern GgElements *ggElementsSphere(GLfloat radius = 1.0f, int slices = 16, int stacks = 8);
 
+  /*!
+  ** \brief インスタンスごとの変換行列と色.
+  */
+  struct GgInstance
+  {
+    GLfloat model[16];  //! モデル変換行列 (列優先, 拡大縮小は一様なものに限る).
+    GLfloat color[4];   //! 色 (材質の環境光と拡散光の反射係数に掛ける).
+  };
+
+  /*!
+  ** \brief 形状をインスタンスごとに変換行列と色を変えて描画する.
+  **
+  **   GgInstance の配列を GgStreamBuffer に格納し, 一つの GgElements を一回の
+  **   glDrawElementsInstanced() でインスタンスの数だけ描画する.
+  **   描画には simple.vert を "#define INSTANCED\n" 付きで読み込んだ GgSimpleShader を使う.
+  **   インスタンスの変換行列は index == 5 〜 8, 色は index == 9 の in 変数から入力する.
+  */
+  class GgInstances
+  {
+    // インスタンスのデータを格納するバッファオブジェクト
+    GgStreamBuffer<GgInstance> instance;
+
+    // 現在のフレームのインスタンスの数
+    GLsizei count;
+
+  public:
+
+    //! \brief コンストラクタ.
+    //!   \param capacity 1 フレームに描画できるインスタンスの最大数.
+    //!   \param frames リングのフレーム数.
+    GgInstances(GLsizei capacity, GLsizei frames = 3)
+      : instance(GL_ARRAY_BUFFER, nullptr, sizeof (GgInstance), capacity, frames)
+      , count(0)
+    {}
+
+    //! \brief デストラクタ.
+    virtual ~GgInstances() {}
+
+    // コピーコンストラクタを封じる
+    GgInstances(const GgInstances &o) = delete;
+
+    // 代入演算子を封じる
+    GgInstances &operator=(const GgInstances &o) = delete;
+
+    //! \brief 1 フレームに描画できるインスタンスの最大数を取り出す.
+    //!   \return 1 フレームに格納できるインスタンスの数.
+    GLsizei getCapacity() const
+    {
+      return instance.getCount();
+    }
+
+    //! \brief 現在のフレームのインスタンスの数を取り出す.
+    //!   \return 最後に unmap() か send() で確定したインスタンスの数.
+    GLsizei getCount() const
+    {
+      return count;
+    }
+
+    //! \brief バッファオブジェクト名を取り出す.
+    //!   \return インスタンスのデータを格納したバッファオブジェクト名.
+    GLuint getBuffer() const
+    {
+      return instance.getBuffer();
+    }
+
+    //! \brief 永続的にマップしたバッファオブジェクトを使っているか調べる.
+    //!   \return OpenGL 4.4 の glBufferStorage() で確保したバッファオブジェクトを使っていれば true.
+    bool isPersistent() const
+    {
+      return instance.isPersistent();
+    }
+
+    //! \brief 次のフレームに切り替えてインスタンスのデータの書き込み先を得る.
+    //!   \return capacity 個の GgInstance を書き込める領域の先頭のポインタ (失敗したら nullptr).
+    //!   \note 書き込みが終わったら unmap() を呼び出す.
+    GgInstance *map();
+
+    //! \brief インスタンスのデータの書き込みを終了する.
+    //!   \param count 書き込んだインスタンスの数.
+    void unmap(GLsizei count);
+
+    //! \brief 次のフレームに切り替えてインスタンスのデータを転送する.
+    //!   \param instance インスタンスのデータの配列.
+    //!   \param count インスタンスの数.
+    void send(const GgInstance *instance, GLsizei count);
+
+    //! \brief 現在のフレームのインスタンスを描画する.
+    //!   \param shape 各インスタンスで描画する形状.
+    //!   \param first 描画する最初のインスタンスの番号.
+    //!   \param count 描画するインスタンスの数, 0 なら全部のインスタンスを描画する.
+    //!   \note 描画命令を発行した後にこのフレームのフェンスを設定する.
+    void draw(const GgElements &shape, GLint first = 0, GLsizei count = 0);
+  };
+
   /*!
   ** \brief シェーダの基底クラス.
   **
@@ -4920,16 +6642,23 @@ namespace gg
     //!   \param geom ジオメトリシェーダのソースファイル名 (0 なら不使用).
     //!   \param nvarying フィードバックする varying 変数の数 (0 なら不使用).
     //!   \param varyings フィードバックする varying 変数のリスト.
+    //!   \param defines 各シェーダの #version の直後に挿入する #define などの文字列 (0 なら不使用).
     GgShader(const char *vert, const char *frag = 0, const char *geom = 0,
-      int nvarying = 0, const char **varyings = 0)
-      : program(ggLoadShader(vert, frag, geom, nvarying, varyings))
+      int nvarying = 0, const char **varyings = 0, const char *defines = 0)
+      : program(ggLoadShader(vert, frag, geom, nvarying, varyings, defines))
+    {}
+
+    //! \brief 作成済みのプログラムオブジェクトを引き取るコンストラクタ.
+    //!   \param program 引き取るプログラム名, このオブジェクトの削除時に削除する.
+    explicit GgShader(GLuint program)
+      : program(program)
     {}
 
     //! \brief デストラクタ.
     virtual ~GgShader()
     {
       // 参照しているオブジェクトが一つだけならシェーダを削除する
-      glUseProgram(0);
+      ggUseProgram(0);
       glDeleteProgram(program);
     }
 
@@ -4942,13 +6671,13 @@ namespace gg
     //! \brief シェーダプログラムの使用を開始する.
     void use() const
     {
-      glUseProgram(program);
+      ggUseProgram(program);
     }
 
     //! \brief シェーダプログラムの使用を終了する.
     void unuse() const
     {
-      glUseProgram(0);
+      ggUseProgram(0);
     }
 
     //! \brief シェーダのプログラム名を得る.
@@ -4984,11 +6713,12 @@ namespace gg
     //!   \param geom ジオメトリシェーダのソースファイル名 (0 なら不使用).
     //!   \param nvarying フィードバックする varying 変数の数 (0 なら不使用).
     //!   \param varyings フィードバックする varying 変数のリスト.
+    //!   \param defines 各シェーダの #version の直後に挿入する #define などの文字列 (0 なら不使用).
     GgPointShader(const char *vert, const char *frag = 0,
-      const char *geom = 0, GLint nvarying = 0, const char **varyings = 0)
+      const char *geom = 0, GLint nvarying = 0, const char **varyings = 0, const char *defines = 0)
     {
       // シェーダを作成する
-      shader.reset(new GgShader(vert, frag, geom, nvarying, varyings));
+      shader.reset(new GgShader(vert, frag, geom, nvarying, varyings, defines));
 
       // プログラム名を取り出す
       const GLuint program(shader->get());
@@ -5124,8 +6854,11 @@ namespace gg
     //!   \param geom ジオメトリシェーダのソースファイル名 (0 なら不使用).
     //!   \param nvarying フィードバックする varying 変数の数 (0 なら不使用).
     //!   \param varyings フィードバックする varying 変数のリスト.
+    //!   \param defines 各シェーダの #version の直後に挿入する #define などの文字列 (0 なら不使用).
+    //!   \note simple.vert は defines に "#define INSTANCED\n" を与えると GgInstances のインスタンスごとの
+    //!         変換行列と色を使うものになる.
     GgSimpleShader(const char *vert, const char *frag = 0,
-      const char *geom = 0, GLint nvarying = 0, const char **varyings = 0);
+      const char *geom = 0, GLint nvarying = 0, const char **varyings = 0, const char *defines = 0);
 
     //! \brief コピーコンストラクタ.
     GgSimpleShader(const GgSimpleShader &o)
@@ -5172,7 +6905,7 @@ namespace gg
     //!   \param mv GLfloat 型の 16 要素の配列変数に格納されたモデルビュー変換行列.
     virtual void loadModelviewMatrix(const GLfloat *mv) const
     {
-      loadModelviewMatrix(mv, GgMatrix(mv).normal().get());
+      loadModelviewMatrix(mv, GgMatrix().loadNormal(mv).get());
     }
 
     //! \brief モデルビュー変換行列とそれから求めた法線変換行列を設定する.
@@ -5206,7 +6939,7 @@ namespace gg
     //!   \param mv GLfloat 型の 16 要素の配列変数に格納されたモデルビュー変換行列.
     virtual void loadMatrix(const GLfloat *mp, const GLfloat *mv) const
     {
-      loadMatrix(mp, mv, GgMatrix(mv).normal());
+      loadMatrix(mp, mv, GgMatrix().loadNormal(mv));
     }
 
     //! \brief 投影変換行列とモデルビュー変換行列を設定しモデルビュー変換行列から求めた法線変換行列を設定する.
@@ -5371,7 +7104,7 @@ namespace gg
       {
         // バッファオブジェクトの i 番目のブロックの位置
         const GLintptr offset(static_cast<GLintptr>(getStride()) * i);
-        glBindBufferRange(getTarget(), LightBindingPoint, getBuffer(), offset, sizeof (Light));
+        ggBindBufferRange(getTarget(), LightBindingPoint, getBuffer(), offset, sizeof (Light));
       }
     };
 
@@ -5515,7 +7248,7 @@ namespace gg
       {
         // バッファオブジェクトの i 番目のブロックの位置
         const GLintptr offset(static_cast<GLintptr>(getStride()) * i);
-        glBindBufferRange(getTarget(), MaterialBindingPoint, getBuffer(), offset, sizeof (Material));
+        ggBindBufferRange(getTarget(), MaterialBindingPoint, getBuffer(), offset, sizeof (Material));
       }
     };
 
@@ -5553,7 +7286,7 @@ namespace gg
     //!   \param mv GLfloat 型の 16 要素の配列変数に格納されたモデルビュー変換行列.
     void use(const GLfloat *mp, const GLfloat *mv) const
     {
-      use(mp, mv, GgMatrix(mv).normal().get());
+      use(mp, mv, GgMatrix().loadNormal(mv).get());
     }
 
     //! \brief 投影変換行列とモデルビュー変換行列を設定しモデルビュー変換行列から求めた法線変換行列を設定してシェーダプログラムの使用を開始する.
@@ -5564,6 +7297,17 @@ namespace gg
       use(mp, mv, mv.normal());
     }
 
+    //! \brief 投影変換行列と式テンプレートで与えたモデルビュー変換行列とそれから求めた法線変換行列を設定してシェーダプログラムの使用を開始する.
+    //!   \param mp GgMatrix 型の投影変換行列.
+    //!   \param mv ggExpression() で作ったモデルビュー変換行列の式.
+    template <typename E>
+    void use(const GgMatrix &mp, const GgMatrixExpression<E> &mv) const
+    {
+      GgMatrix m, mn;
+      mv.evaluate(m, &mn);
+      use(mp, m, mn);
+    }
+
     //! \brief 光源を指定してシェーダプログラムの使用を開始する.
     //!   \param light 光源の特性の gg::LightBuffer 構造体のポインタ.
     //!   \param i 光源データの uniform block のインデックス.
@@ -5617,7 +7361,7 @@ namespace gg
     //!   \param i 光源データの uniform block のインデックス.
     void use(const GLfloat *mp, const GLfloat *mv, const LightBuffer *light, GLint i = 0) const
     {
-      use(mp, mv, GgMatrix(mv).normal().get(), light, i);
+      use(mp, mv, GgMatrix().loadNormal(mv).get(), light, i);
     }
 
     //! \brief 光源を指定し投影変換行列とモデルビュー変換行列を設定しモデルビュー変換行列から求めた法線変換行列を設定してシェーダプログラムの使用を開始する.
@@ -5630,6 +7374,20 @@ namespace gg
       use(mp, mv, mv.normal(), light, i);
     }
 
+    //! \brief 光源を指定し投影変換行列と式テンプレートで与えたモデルビュー変換行列とそれから求めた法線変換行列を設定してシェーダプログラムの使用を開始する.
+    //!   \param mp GgMatrix 型の投影変換行列.
+    //!   \param mv ggExpression() で作ったモデルビュー変換行列の式.
+    //!   \param light 光源の特性の gg::LightBuffer 構造体.
+    //!   \param i 光源データの uniform block のインデックス.
+    template <typename E>
+    void use(const GgMatrix &mp, const GgMatrixExpression<E> &mv, const LightBuffer &light, GLint i = 0) const
+    {
+      // モデルビュー変換行列と法線変換行列を一度に求める
+      GgMatrix m, mn;
+      mv.evaluate(m, &mn);
+      use(mp, m, mn, light, i);
+    }
+
     //! \brief 光源を指定し投影変換行列を設定してシェーダプログラムの使用を開始する.
     //!   \param mp GLfloat 型の 16 要素の配列変数に格納された投影変換行列.
     //!   \param light 光源の特性の gg::LightBuffer 構造体のポインタ.
@@ -5679,6 +7437,7 @@ namespace gg
   **   \param vert 読み込んだデータの頂点属性.
   **   \param face 読み込んだデータの三角形の頂点インデックス.
   **   \param normalize true なら読み込んだデータの大きさを正規化する.
+  **   \param mtllib 読み込んだ MTL ファイルのパス名を追加する std::string 型の vector のポインタ (nullptr なら追加しない).
   **   \return ファイルの読み込みに成功したら true.
   */
   extern bool ggLoadSimpleObj(const char *name,
@@ -5686,7 +7445,46 @@ namespace gg
     std::vector<GgSimpleShader::Material> &material,
     std::vector<GgVertex> &vert,
     std::vector<GLuint> &face,
-    bool normalize = false);
+    bool normalize = false,
+    std::vector<std::string> *mtllib = nullptr);
+
+  /*!
+  ** \brief 三角形の頂点インデックスの ACMR (三角形あたりの頂点キャッシュのミス数) を求める.
+  **
+  **   \param face 三角形の頂点インデックス.
+  **   \param count 三角形の頂点数.
+  **   \param cache シミュレートする FIFO 頂点キャッシュの大きさ.
+  **   \return ACMR, 0.5〜3.0 の値で小さいほど頂点シェーダの実行回数が少ない.
+  */
+  extern GLfloat ggAcmr(const GLuint *face, GLsizei count, GLsizei cache = 32);
+
+  /*!
+  ** \brief 三角形分割された形状データ (Elements 形式) を描画用に最適化する.
+  **
+  **   内容が同じ頂点を一つにまとめ, ポリゴングループごとに三角形の順序を Tipsify 法で頂点キャッシュに
+  **   乗りやすいように並べ替え, 頂点を最初に参照される順に並べ替える. どの頂点からも参照されない頂点は取り除く.
+  **   ポリゴングループの最初の頂点インデックスの位置と頂点数, 三角形の頂点の巡回順は変わらない.
+  **
+  **   \param group ポリゴングループごとの最初の頂点インデックスの位置と頂点数・材質番号.
+  **   \param vert 頂点属性.
+  **   \param face 三角形の頂点インデックス.
+  **   \param cache 最適化の対象にする頂点キャッシュの大きさ.
+  */
+  extern void ggOptimizeMesh(const std::vector<std::array<GLuint, 3>> &group,
+    std::vector<GgVertex> &vert,
+    std::vector<GLuint> &face,
+    GLsizei cache = 32);
+
+  /*!
+  ** \brief 形状データのキャッシュを設定する.
+  **
+  **   設定すると GgSimpleObj は読み込んで頂点の生成や法線の算出, 正規化を済ませた形状データを
+  **   このディレクトリにバイナリ形式で保存し, 次回以降は OBJ ファイルを解析せずにそれをメモリマップして使う.
+  **   OBJ ファイルの更新時刻か大きさが変わっていればキャッシュを作り直す.
+  **
+  **   \param dir キャッシュを保存するディレクトリ名 (nullptr ならキャッシュを使わない).
+  */
+  extern void ggSetMeshCache(const char *dir);
 
   /*!
   ** \brief Wavefront OBJ 形式のファイル (Arrays 形式).
@@ -5702,12 +7500,35 @@ namespace gg
     // この図形の形状データ
     std::shared_ptr<GgElements> data;
 
+    // 全てのポリゴングループを一度に描画するための間接描画バッファと材質のテクスチャバッファ
+    struct Batch;
+    std::shared_ptr<Batch> batch;
+
+    // 読み込んだデータから頂点バッファオブジェクトと材質のユニフォームバッファを作成する
+    void create(const std::vector<GgSimpleShader::Material> &mat,
+      const std::vector<GgVertex> &vert, const std::vector<GLuint> &face, bool compact);
+
   public:
 
     //! \brief コンストラクタ.
     //!   \param name 三角形分割された Alias OBJ 形式のファイルのファイル名.
     //!   \param normalize true なら図形のサイズを [-1, 1] に正規化する.
-    GgSimpleObj(const char *name, bool normalize = false);
+    //!   \param compact true なら頂点属性を GgCompactVertex に量子化して保持する.
+    GgSimpleObj(const char *name, bool normalize = false, bool compact = false);
+
+    //! \brief 読み込み済みのデータから作成するコンストラクタ.
+    //!   \param group 同じ材質を割り当てるポリゴングループごとの最初の三角形番号, 三角形数, 材質番号.
+    //!   \param mat ポリゴングループごとの材質.
+    //!   \param vert 頂点属性.
+    //!   \param face 頂点インデックス, 頂点数が 65536 以下なら 16 bit にして保持する.
+    //!   \param compact true なら頂点属性を GgCompactVertex に量子化して保持する.
+    GgSimpleObj(const std::vector<std::array<GLuint, 3>> &group,
+      const std::vector<GgSimpleShader::Material> &mat,
+      const std::vector<GgVertex> &vert, const std::vector<GLuint> &face, bool compact = false)
+      : group(group)
+    {
+      create(mat, vert, face, compact);
+    }
 
     //! \brief デストラクタ.
     virtual ~GgSimpleObj() {}
@@ -5722,6 +7543,650 @@ namespace gg
     //! \brief Wavefront OBJ 形式のデータを描画する手続き.
     //!   \param first 描画する最初のパーツ番号.
     //!   \param count 描画するパーツの数, 0 なら全部のパーツを描く.
+    //!   \note OpenGL 4.3 以降では全てのパーツの材質をテクスチャバッファにまとめ, glMultiDrawElementsIndirect() の一回の呼び出しで描画する.
+    //!     それ以外ではパーツごとに材質のユニフォームバッファを切り替えて描画する.
     virtual void draw(GLint first = 0, GLsizei count = 0) const;
+
+    //! \brief 全てのパーツを一回の呼び出しで描画できるか調べる.
+    //!   \return glMultiDrawElementsIndirect() で描画するなら true.
+    bool isBatched() const
+    {
+      return static_cast<bool>(batch);
+    }
+  };
+
+  /*!
+  ** \brief GPU の処理時間の計測.
+  **
+  **   名前を付けた区間の前後にタイムスタンプのクエリを発行し, GPU 上の処理時間を計測する.
+  **   クエリは二重化しており, 結果は次のフレームで結果が揃っているものだけを回収するのでパイプラインを停止させない.
+  */
+  class GgProfiler
+  {
+    // 計測区間
+    struct Section
+    {
+      // 区間名
+      std::string name;
+
+      // タイムスタンプのクエリ [フレーム][開始/終了]
+      GLuint query[2][2];
+
+      // クエリを発行したら true [フレーム]
+      bool issued[2];
+
+      // 計測値の履歴 (ミリ秒)
+      std::vector<double> sample;
+
+      // 次に計測値を格納する位置
+      size_t next;
+
+      // 格納されている計測値の数
+      size_t count;
+    };
+
+    // 計測区間のリスト
+    std::vector<Section> section;
+
+    // 計測値の履歴の長さ
+    const size_t history;
+
+    // 現在クエリを発行しているフレーム
+    int frame;
+
+  public:
+
+    //! \brief コンストラクタ.
+    //!   \param history 統計に用いる計測値の履歴の長さ.
+    GgProfiler(size_t history = 60)
+      : history(history > 0 ? history : 1)
+      , frame(0)
+    {
+    }
+
+    //! \brief デストラクタ.
+    virtual ~GgProfiler();
+
+    // コピーコンストラクタを封じる
+    GgProfiler(const GgProfiler &o) = delete;
+
+    // 代入演算子を封じる
+    GgProfiler &operator=(const GgProfiler &o) = delete;
+
+    //! \brief 計測区間を追加する.
+    //!   \param name 計測区間の名前.
+    //!   \return 計測区間の番号.
+    GLuint add(const char *name);
+
+    //! \brief 計測区間を開始する.
+    //!   \param i 計測区間の番号.
+    void begin(GLuint i)
+    {
+      glQueryCounter(section[i].query[frame][0], GL_TIMESTAMP);
+    }
+
+    //! \brief 計測区間を終了する.
+    //!   \param i 計測区間の番号.
+    void end(GLuint i)
+    {
+      glQueryCounter(section[i].query[frame][1], GL_TIMESTAMP);
+      section[i].issued[frame] = true;
+    }
+
+    //! \brief フレームを切り替えて前のフレームの計測結果のうち得られているものを回収する.
+    //!   \note フレームの描画を終えるごとに一回呼び出す.
+    void update();
+
+    //! \brief 計測区間の数を得る.
+    //!   \return 計測区間の数.
+    GLuint size() const
+    {
+      return static_cast<GLuint>(section.size());
+    }
+
+    //! \brief 計測区間の名前を得る.
+    //!   \param i 計測区間の番号.
+    //!   \return 計測区間の名前.
+    const char *getName(GLuint i) const
+    {
+      return section[i].name.c_str();
+    }
+
+    //! \brief 計測区間の計測値の数を得る.
+    //!   \param i 計測区間の番号.
+    //!   \return 統計に用いている計測値の数.
+    size_t getCount(GLuint i) const
+    {
+      return section[i].count;
+    }
+
+    //! \brief 計測区間の最新の計測値を得る.
+    //!   \param i 計測区間の番号.
+    //!   \return 最新の処理時間 (ミリ秒), 計測値がなければ 0.
+    double getLatest(GLuint i) const;
+
+    //! \brief 計測区間の計測値の平均を得る.
+    //!   \param i 計測区間の番号.
+    //!   \return 履歴中の処理時間の平均 (ミリ秒), 計測値がなければ 0.
+    double getAverage(GLuint i) const;
+
+    //! \brief 計測区間の計測値の最小値を得る.
+    //!   \param i 計測区間の番号.
+    //!   \return 履歴中の処理時間の最小値 (ミリ秒), 計測値がなければ 0.
+    double getMin(GLuint i) const;
+
+    //! \brief 計測区間の計測値の最大値を得る.
+    //!   \param i 計測区間の番号.
+    //!   \return 履歴中の処理時間の最大値 (ミリ秒), 計測値がなければ 0.
+    double getMax(GLuint i) const;
+
+    //! \brief 計測結果の一覧を文字列で得る.
+    //!   \return 各計測区間の名前と処理時間の平均を並べた文字列.
+    std::string summary() const;
+
+    //! \brief 計測結果を CSV 形式で保存する.
+    //!   \param name 保存するファイル名.
+    //!   \return 保存に成功したら true.
+    bool saveCsv(const char *name) const;
+
+    //! \brief 計測結果を JSON 形式で保存する.
+    //!   \param name 保存するファイル名.
+    //!   \return 保存に成功したら true.
+    bool saveJson(const char *name) const;
+
+    //! \brief 計測結果を保存する.
+    //!   \param name 保存するファイル名, 拡張子が .json なら JSON 形式, それ以外は CSV 形式.
+    //!   \return 保存に成功したら true.
+    bool save(const char *name) const;
+  };
+
+  /*!
+  ** \brief 描画パスの依存関係にもとづいてフレームを描画する手順.
+  **
+  **   描画パスが読み書きするテクスチャ, バッファオブジェクト, フレームバッファオブジェクトを宣言しておくと,
+  **   出力に寄与しない描画パスを省き, 残りを依存関係を満たす順に並べて実行する.
+  **   一時的なレンダーターゲットは使用期間が重ならなければ同じテクスチャを共用する.
+  **   image store などで書き込んだ資源を読み出す描画パスの前には glMemoryBarrier() を,
+  **   CPU が読み出すバッファオブジェクトに最後に書き込んだ描画パスの後には同期オブジェクトを挿入する.
+  **   描画パスごとの GPU の処理時間は GgProfiler で計測する.
+  */
+  class GgRenderGraph
+  {
+    // 資源の種類
+    enum Kind { Texture, Buffer, Framebuffer };
+
+    // 描画パスが読み書きする資源
+    struct Resource
+    {
+      // 資源名
+      std::string name;
+
+      // 資源の種類
+      Kind kind;
+
+      // OpenGL のオブジェクト (一時的な資源なら割り当てたテクスチャ)
+      GLuint object;
+
+      // 一時的なレンダーターゲットなら true
+      bool transient;
+
+      // 一時的なレンダーターゲットの内部フォーマットと大きさ
+      GLenum format;
+      GLsizei width, height;
+
+      // CPU が読み出すバッファオブジェクトなら true
+      bool readback;
+
+      // フレームの出力なら true
+      bool output;
+
+      // 最後に書き込んだ描画パスの後に挿入した同期オブジェクト
+      GLsync sync;
+    };
+
+    // 描画パスによる資源の読み出し
+    struct Read
+    {
+      // 資源の番号
+      GLuint resource;
+
+      // 読み出す前に必要なメモリバリアのビット
+      GLbitfield barrier;
+    };
+
+    // 描画パス
+    struct Pass
+    {
+      // 描画パス名
+      std::string name;
+
+      // 描画パスの処理
+      std::function<void()> execute;
+
+      // 読み出す資源と書き込む資源
+      std::vector<Read> read;
+      std::vector<GLuint> write;
+
+      // 実行前に挿入するメモリバリアのビット
+      GLbitfield barrier;
+
+      // 描画先のフレームバッファオブジェクト (負ならフレームバッファを切り替えない)
+      GLint framebuffer;
+
+      // 描画先の一時的なレンダーターゲットの大きさ (0 ならウィンドウのビューポートを使う)
+      GLsizei width, height;
+
+      // 描画先のフレームバッファオブジェクトが完全なら true (false なら実行しない)
+      bool complete;
+
+      // 実行後に同期オブジェクトを挿入する資源
+      std::vector<GLuint> fence;
+
+      // 実行するなら true
+      bool live;
+
+      // 計測区間の番号
+      GLuint section;
+    };
+
+    // 一時的なレンダーターゲットに割り当てるテクスチャ
+    struct Target
+    {
+      // テクスチャ名
+      GLuint texture;
+
+      // 内部フォーマットと大きさ
+      GLenum format;
+      GLsizei width, height;
+
+      // このテクスチャを最後に使う描画パスの実行順
+      GLint until;
+    };
+
+    // 描画パスのリスト (トレースが名前を参照するので要素を移動しない std::deque を使う)
+    std::deque<Pass> pass;
+
+    // 資源のリスト
+    std::vector<Resource> resource;
+
+    // 描画パスの実行順
+    std::vector<GLuint> order;
+
+    // 一時的なレンダーターゲットに割り当てたテクスチャ
+    std::vector<Target> texture;
+
+    // 一時的なレンダーターゲットに描画するフレームバッファオブジェクト
+    std::vector<GLuint> framebuffer;
+
+    // 描画パスか資源を変更したので実行順を求め直すなら true
+    bool dirty;
+
+    // ウィンドウのビューポート (大きさが 0 なら execute() で一度だけ取得する)
+    std::array<GLint, 4> viewport;
+
+    // 描画パスごとの GPU の処理時間の計測
+    GgProfiler profiler;
+
+    // 資源を追加する
+    GLuint addResource(const char *name, Kind kind, GLuint object, bool transient,
+      GLenum format, GLsizei width, GLsizei height, bool readback);
+
+    // 割り当てたテクスチャとフレームバッファオブジェクトを削除する
+    void release();
+
+    // 一時的なレンダーターゲットに割り当てるテクスチャを作成する
+    //   spare 前回割り当てたテクスチャのうち, まだ割り当てていないもの
+    Target allocate(const Resource &r, std::vector<Target> &spare);
+
+  public:
+
+    //! \brief コンストラクタ.
+    //!   \param history 描画パスの処理時間の統計に用いる計測値の履歴の長さ.
+    GgRenderGraph(size_t history = 60)
+      : dirty(true)
+      , viewport{ { 0, 0, 0, 0 } }
+      , profiler(history)
+    {
+    }
+
+    //! \brief デストラクタ.
+    virtual ~GgRenderGraph();
+
+    // コピーコンストラクタを封じる
+    GgRenderGraph(const GgRenderGraph &o) = delete;
+
+    // 代入演算子を封じる
+    GgRenderGraph &operator=(const GgRenderGraph &o) = delete;
+
+    //! \brief 外部で作成したテクスチャを資源に加える.
+    //!   \param name 資源名.
+    //!   \param texture テクスチャ名.
+    //!   \return 資源の番号.
+    GLuint importTexture(const char *name, GLuint texture)
+    {
+      return addResource(name, Texture, texture, false, GL_NONE, 0, 0, false);
+    }
+
+    //! \brief 外部で作成したバッファオブジェクトを資源に加える.
+    //!   \param name 資源名.
+    //!   \param buffer バッファオブジェクト名.
+    //!   \param readback CPU が読み出すなら true, 最後に書き込んだ描画パスの後に同期オブジェクトを挿入する.
+    //!   \return 資源の番号.
+    GLuint importBuffer(const char *name, GLuint buffer, bool readback = false)
+    {
+      return addResource(name, Buffer, buffer, false, GL_NONE, 0, 0, readback);
+    }
+
+    //! \brief 外部で作成したフレームバッファオブジェクトを資源に加える.
+    //!   \param name 資源名.
+    //!   \param framebuffer フレームバッファオブジェクト名, 0 ならウィンドウのフレームバッファ.
+    //!   \return 資源の番号.
+    GLuint importFramebuffer(const char *name, GLuint framebuffer = 0)
+    {
+      return addResource(name, Framebuffer, framebuffer, false, GL_NONE, 0, 0, false);
+    }
+
+    //! \brief 一時的なレンダーターゲットを資源に加える.
+    //!   \param name 資源名.
+    //!   \param format テクスチャの内部フォーマット, デプスのフォーマットならデプスバッファになる.
+    //!   \param width テクスチャの横の画素数.
+    //!   \param height テクスチャの縦の画素数.
+    //!   \return 資源の番号.
+    //!   \note テクスチャは実行順を求めるときに割り当て, 使用期間が重ならない同じ形式のものと共用する.
+    //!     実行順を求め直しても同じ形式のテクスチャは作り直さずに使い回す.
+    GLuint createTexture(const char *name, GLenum format, GLsizei width, GLsizei height)
+    {
+      return addResource(name, Texture, 0, true, format, width, height, false);
+    }
+
+    //! \brief 一時的なレンダーターゲットの大きさを変更する.
+    //!   \param i 資源の番号.
+    //!   \param width テクスチャの横の画素数.
+    //!   \param height テクスチャの縦の画素数.
+    void resizeTexture(GLuint i, GLsizei width, GLsizei height)
+    {
+      Resource &r(resource[i]);
+      if (r.width == width && r.height == height) return;
+      r.width = width;
+      r.height = height;
+      dirty = true;
+    }
+
+    //! \brief 資源をフレームの出力にする.
+    //!   \param i 資源の番号.
+    //!   \param output フレームの出力にするなら true, 出力から外すなら false.
+    //!   \note 出力に最後に書き込む描画パスと, それが読み出す資源に書き込む描画パスだけを実行する.
+    void setOutput(GLuint i, bool output = true)
+    {
+      if (resource[i].output == output) return;
+      resource[i].output = output;
+      dirty = true;
+    }
+
+    //! \brief 描画パスを追加する.
+    //!   \param name 描画パス名.
+    //!   \param execute 描画パスの処理.
+    //!   \return 描画パスの番号.
+    GLuint addPass(const char *name, std::function<void()> execute);
+
+    //! \brief 描画パスが読み出す資源を宣言する.
+    //!   \param i 描画パスの番号.
+    //!   \param r 資源の番号.
+    //!   \param barrier 前の描画パスが image store などで書き込んだ資源を読み出すときに必要な glMemoryBarrier() のビット.
+    void read(GLuint i, GLuint r, GLbitfield barrier = 0)
+    {
+      pass[i].read.push_back(Read{ r, barrier });
+      dirty = true;
+    }
+
+    //! \brief 描画パスが書き込む資源を宣言する.
+    //!   \param i 描画パスの番号.
+    //!   \param r 資源の番号.
+    //!   \note 一時的なレンダーターゲットに書き込む描画パスはそれらを取り付けたフレームバッファオブジェクトに描画する.
+    void write(GLuint i, GLuint r)
+    {
+      pass[i].write.push_back(r);
+      dirty = true;
+    }
+
+    //! \brief 描画パスの実行順を求めて一時的なレンダーターゲットを割り当てる.
+    //!   \return フレームバッファオブジェクトが完全でなければ false.
+    //!   \note execute() は描画パスか資源が変更されていれば自動的にこれを呼び出す.
+    bool compile();
+
+    //! \brief ウィンドウのビューポートを設定する.
+    //!   \param x ビューポートの左下隅の x 座標.
+    //!   \param y ビューポートの左下隅の y 座標.
+    //!   \param width ビューポートの横の画素数.
+    //!   \param height ビューポートの縦の画素数.
+    //!   \note ウィンドウの大きさが変わったら呼び出す. 一度も呼び出さなければ最初の execute() で glGetIntegerv() で取得する.
+    void setViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+    {
+      viewport[0] = x;
+      viewport[1] = y;
+      viewport[2] = width;
+      viewport[3] = height;
+    }
+
+    //! \brief 描画パスを実行順に実行する.
+    //!   \note 実行後はフレームバッファをウィンドウのものに戻し, ビューポートを setViewport() で設定したものに戻す.
+    //!     描画先のフレームバッファオブジェクトが完全でない描画パスは実行しない.
+    void execute();
+
+    //! \brief 描画パスの処理時間の計測のフレームを切り替える.
+    //!   \note フレームの描画を終えるごとに一回呼び出す.
+    void update()
+    {
+      profiler.update();
+    }
+
+    //! \brief CPU が読み出すバッファオブジェクトへの書き込みの完了を待つ.
+    //!   \param i 資源の番号.
+    //!   \param timeout 待つ最長時間 (ナノ秒).
+    //!   \return 書き込みが完了していれば true, 時間切れなら false.
+    bool wait(GLuint i, GLuint64 timeout = 1000000000ULL);
+
+    //! \brief 資源に割り当てられている OpenGL のオブジェクトを得る.
+    //!   \param i 資源の番号.
+    //!   \return OpenGL のオブジェクト名, 割り当てられていない一時的なレンダーターゲットなら 0.
+    GLuint get(GLuint i) const
+    {
+      return resource[i].object;
+    }
+
+    //! \brief 描画パスを実行するかどうか調べる.
+    //!   \param i 描画パスの番号.
+    //!   \return 出力に寄与しないので省いた描画パスなら false.
+    bool isLive(GLuint i) const
+    {
+      return pass[i].live;
+    }
+
+    //! \brief 描画パスの実行順を得る.
+    //!   \return 実行する描画パスの番号を実行順に並べたもの.
+    const std::vector<GLuint> &getOrder() const
+    {
+      return order;
+    }
+
+    //! \brief 一時的なレンダーターゲットに割り当てたテクスチャの数を得る.
+    //!   \return テクスチャの数.
+    GLsizei getTextureCount() const
+    {
+      return static_cast<GLsizei>(texture.size());
+    }
+
+    //! \brief 描画パスの処理時間の計測結果を得る.
+    //!   \return 描画パス名を計測区間名とする GgProfiler.
+    const GgProfiler &getProfiler() const
+    {
+      return profiler;
+    }
+  };
+
+  /*!
+  ** \brief 非同期に読み込むデータ.
+  **
+  **   GgLoader が返す読み込み結果の受け取り口. 読み込みが完了するまで get() は nullptr を返す.
+  **   読み込みの完了は GgLoader::update() の中で設定するので, 描画スレッドからのみ参照する.
+  */
+  template <typename T>
+  class GgAsset
+  {
+    friend class GgLoader;
+
+    // 読み込みの状態
+    struct State
+    {
+      // 読み込みが完了したら true
+      bool ready;
+
+      // 読み込んだデータ (読み込みに失敗したら nullptr)
+      std::shared_ptr<T> value;
+
+      // コンストラクタ
+      State()
+        : ready(false)
+      {}
+    };
+
+    // 読み込みの状態
+    std::shared_ptr<State> state;
+
+  public:
+
+    //! \brief コンストラクタ.
+    GgAsset() {}
+
+    //! \brief デストラクタ.
+    virtual ~GgAsset() {}
+
+    //! \brief 読み込みが完了したかどうか調べる.
+    //!   \return 読み込みが完了していれば (失敗した場合も) true.
+    bool ready() const
+    {
+      return state && state->ready;
+    }
+
+    //! \brief 読み込んだデータを取り出す.
+    //!   \return 読み込んだデータのポインタ, 読み込み中か読み込みに失敗したら nullptr.
+    std::shared_ptr<T> get() const
+    {
+      return state ? state->value : nullptr;
+    }
+
+    //! \brief 読み込んだデータのメンバを参照する.
+    //!   \note 読み込みが完了していて失敗していないことを確かめてから使う.
+    T *operator->() const
+    {
+      return state->value.get();
+    }
+
+    //! \brief 読み込んだデータが使えるかどうか調べる.
+    //!   \return 読み込みが完了していて成功していれば true.
+    explicit operator bool() const
+    {
+      return state && state->value;
+    }
+  };
+
+  /*!
+  ** \brief 非同期のデータの読み込み.
+  **
+  **   ファイルの読み込み, 解析, 法線マップの作成, メッシュの最適化, テクスチャの圧縮をワーカースレッドで行い,
+  **   OpenGL のオブジェクトの作成と転送は update() の中で一フレームあたりの時間の予算内で少しずつ行う.
+  **   テクスチャは 1MB 程度ずつ転送するので大きな画像でもフレームを落とさない.
+  */
+  class GgLoader
+  {
+    // ワーカースレッド
+    std::vector<std::thread> worker;
+
+    // ワーカースレッドで実行する処理
+    std::deque<std::function<void()>> task;
+
+    // task の排他制御
+    std::mutex taskMutex;
+
+    // task の追加の通知
+    std::condition_variable taskCondition;
+
+    // ワーカースレッドを終了するなら true
+    bool quit;
+
+    // 描画スレッドで実行する転送処理 (完了したら true を返す)
+    std::deque<std::function<bool()>> upload;
+
+    // upload の排他制御
+    std::mutex uploadMutex;
+
+    // 読み込みを開始して完了していないデータの数
+    std::size_t pending;
+
+    // ワーカースレッドで実行する処理を追加する
+    void push(const std::function<void()> &work);
+
+    // 描画スレッドで実行する転送処理を追加する
+    void post(const std::function<bool()> &step);
+
+  public:
+
+    //! \brief コンストラクタ.
+    //!   \param threads ワーカースレッドの数, 0 なら描画とキャプチャのスレッドを除いた論理コア数.
+    explicit GgLoader(unsigned int threads = 0);
+
+    //! \brief デストラクタ.
+    //!   \note 実行中の処理の完了を待ち, 未着手の処理と転送前のデータは破棄する.
+    virtual ~GgLoader();
+
+    // コピーコンストラクタを封じる
+    GgLoader(const GgLoader &o) = delete;
+
+    // 代入演算子を封じる
+    GgLoader &operator=(const GgLoader &o) = delete;
+
+    //! \brief 三角形分割された Alias OBJ 形式のファイルを非同期に読み込む.
+    //!   \param name 三角形分割された Alias OBJ 形式のファイルのファイル名.
+    //!   \param normalize true なら図形のサイズを [-1, 1] に正規化する.
+    //!   \param compact true なら頂点属性を GgCompactVertex に量子化して保持する.
+    //!   \return 読み込んだ形状データの受け取り口.
+    GgAsset<GgSimpleObj> loadSimpleObj(const char *name, bool normalize = false, bool compact = false);
+
+    //! \brief TGA 画像ファイルを非同期に読み込んでテクスチャを作成する.
+    //!   \param name 読み込むファイル名.
+    //!   \param internal テクスチャの内部フォーマット, 0 なら外部フォーマットに合わせる, 圧縮テクスチャの内部フォーマットならブロック圧縮したミップマップを作成する.
+    //!   \param wrap テクスチャのラッピングモード.
+    //!   \return 作成したテクスチャの受け取り口.
+    GgAsset<GgColorTexture> loadImage(const char *name, GLenum internal = 0, GLenum wrap = GL_CLAMP_TO_EDGE);
+
+    //! \brief TGA 画像ファイルの高さマップを非同期に読み込んで法線マップのテクスチャを作成する.
+    //!   \param name 読み込むファイル名.
+    //!   \param nz 法線マップの z 成分の値.
+    //!   \param internal テクスチャの内部フォーマット.
+    //!   \return 作成した法線マップのテクスチャの受け取り口.
+    GgAsset<GgNormalTexture> loadHeight(const char *name, float nz = 1.0f, GLenum internal = GL_RGBA);
+
+    //! \brief シェーダのソースファイルを非同期に読み込んでプログラムオブジェクトを作成する.
+    //!   \param vert バーテックスシェーダのソースファイル名.
+    //!   \param frag フラグメントシェーダのソースファイル名 (nullptr なら不使用).
+    //!   \param geom ジオメトリシェーダのソースファイル名 (nullptr なら不使用).
+    //!   \param defines 各シェーダの #version の直後に挿入する #define などの文字列 (nullptr なら不使用).
+    //!   \return 作成したシェーダの受け取り口.
+    //!   \note ソースファイルの読み込みだけをワーカースレッドで行い, コンパイルは update() の中で行う.
+    GgAsset<GgShader> loadShader(const char *vert, const char *frag = nullptr, const char *geom = nullptr,
+      const char *defines = nullptr);
+
+    //! \brief ワーカースレッドが用意したデータを OpenGL のオブジェクトに転送する.
+    //!   \param budget このフレームで転送に使う時間の予算 (ミリ秒), 予算を超えても一回は転送する.
+    //!   \return このフレームで読み込みが完了したデータの数.
+    //!   \note 描画スレッドでフレームごとに一回呼び出す.
+    unsigned int update(double budget = 2.0);
+
+    //! \brief 読み込みを開始して完了していないデータの数を得る.
+    //!   \return 読み込み中のデータの数.
+    std::size_t getPending() const
+    {
+      return pending;
+    }
   };
 }
@@ -0,0 +1,15 @@
+//
+// 背景テクスチャ
+//
+
+// 背景テクスチャ
+uniform sampler2D image;
+
+// 背景テクスチャの縦横比 (高さ / 幅)
+//   IMAGE_ASPECT が定義されていれば定数にして、テクスチャのサイズを問い合わせない。
+#if defined(IMAGE_ASPECT)
+const float aspect = IMAGE_ASPECT;
+#else
+vec2 size = vec2(textureSize(image, 0));
+float aspect = size.y / size.x;
+#endif
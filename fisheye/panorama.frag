@@ -5,15 +5,12 @@
 // 正距円筒図法のテクスチャをサンプリング
 //
 
-// 背景テクスチャの半径と中心位置
-uniform vec4 circle;
+// 平面展開のパラメータ
+#include "expansion.glsl"
 
 // 背景テクスチャ
 uniform sampler2D image;
 
-// 背景テクスチャのサイズ
-vec2 size = textureSize(image, 0);
-
 // 背景テクスチャのテクスチャ空間上のスケール
 vec2 scale = vec2(-0.15915494, -0.31830989) / circle.st;
 
@@ -0,0 +1,32 @@
+//
+// 平面展開に使うバーテックスシェーダの共通部分
+//
+
+// 平面展開のパラメータ
+#include "expansion.glsl"
+
+// スクリーンの格子点の位置
+vec2 screenPosition()
+{
+  // 頂点位置
+  //   各頂点において gl_VertexID が 0, 1, 2, 3, ... のように割り当てられるから、
+  //     x = gl_VertexID >> 1      = 0, 0, 1, 1, 2, 2, 3, 3, ...
+  //     y = 1 - (gl_VertexID & 1) = 1, 0, 1, 0, 1, 0, 1, 0, ...
+  //   のように GL_TRIANGLE_STRIP 向けの頂点座標値が得られる。
+  //   y に gl_InstaceID を足せば glDrawArrayInstanced() のインスタンスごとに y が変化する。
+  //   これに格子の間隔 gap をかけて 1 を引けば縦横 [-1, 1] の範囲の点群 position が得られる。
+  int x = gl_VertexID >> 1;
+  int y = gl_InstanceID + 1 - (gl_VertexID & 1);
+  return vec2(x, y) * gap - 1.0;
+}
+
+// スクリーン上の点に向かう視線ベクトル
+vec4 screenVector(vec2 position)
+{
+  // 視線ベクトル
+  //   position にスクリーンの大きさ screen.st をかけて中心位置 screen.pq を足せば、
+  //   スクリーン上の点の位置 p が得られるから、原点にある視点からこの点に向かう視線は、
+  //   焦点距離 focal を Z 座標に用いて (p, -focal) となる。
+  vec2 p = position * screen.st + screen.pq;
+  return vec4(p, -focal, 0.0);
+}
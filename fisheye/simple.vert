@@ -5,6 +5,8 @@
 //
 //   単純な陰影付けを行ってオブジェクトを描画するシェーダ
 //
+//   INSTANCED を #define すると GgInstances のインスタンスごとの変換行列と色を使う
+//
 
 // 材質
 layout (std140) uniform Material
@@ -15,6 +17,9 @@ layout (std140) uniform Material
   float kshi;                                         // 輝き係数
 };
 
+// GgSimpleObj をまとめて描画するときの材質 (材質ごとに kamb, kdiff, kspec, kshi の 4 要素)
+uniform samplerBuffer materials;
+
 // 光源
 layout (std140) uniform Light
 {
@@ -31,24 +36,67 @@ uniform mat4 mn;                                      // 法線変換行列
 
 // 頂点属性
 layout (location = 0) in vec4 pv;                     // ローカル座標系の頂点位置
-layout (location = 1) in vec4 nv;                     // 頂点の法線ベクトル
+layout (location = 1) in vec4 nv;                     // 頂点の法線ベクトル (w が 1 なら八面体写像した xy)
+layout (location = 3) in vec4 pq;                     // 量子化した頂点位置を元に戻す係数 (xyz: 最小値, w: 倍率)
+layout (location = 4) in vec2 pm;                     // 描画ごとの材質番号 (y が 1 なら材質を materials から取り出す)
+#if defined(INSTANCED)
+layout (location = 5) in mat4 mi;                     // インスタンスのモデル変換行列 (location = 5 〜 8)
+layout (location = 9) in vec4 ci;                     // インスタンスの色
+#endif
 
 // ラスタライザに送る頂点属性
 out vec4 idiff;                                       // 拡散反射光強度
 out vec4 ispec;                                       // 鏡面反射光強度
 
+// 八面体写像した法線ベクトルを復元する
+vec3 octahedron(in vec2 e)
+{
+  vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+  float t = max(-n.z, 0.0);
+  n.xy += mix(vec2(t), vec2(-t), greaterThanEqual(n.xy, vec2(0.0)));
+  return n;
+}
+
 void main(void)
 {
+  // 量子化した頂点属性を元に戻す (量子化していなければ pq は既定値の (0, 0, 0, 1))
+  vec4 position = vec4(pv.xyz * pq.w + pq.xyz * pv.w, pv.w);
+  vec4 normal = nv.w == 0.0 ? nv : vec4(octahedron(nv.xy / 127.0), 0.0);
+
+#if defined(INSTANCED)
+  // インスタンスのモデル変換 (拡大縮小は一様なものに限るので法線は mat3(mi) で変換する)
+  position = mi * position;
+  normal = vec4(mat3(mi) * normal.xyz, 0.0);
+#endif
+
   // 座標計算
-  vec4 p = mv * pv;                                   // 視点座標系の頂点の位置
+  vec4 p = mv * position;                             // 視点座標系の頂点の位置
   vec3 v = normalize(p.xyz);                          // 視点座標系の視線ベクトル
   vec3 l = normalize((lpos * p.w - p * lpos.w).xyz);  // 視点座標系の光線ベクトル
   vec3 h = normalize(l - v);                          // 中間ベクトル
-  vec3 n = normalize((mn * nv).xyz);                  // 法線ベクトル
+  vec3 n = normalize((mn * normal).xyz);              // 法線ベクトル
+
+  // 材質 (まとめて描画していなければ pm は既定値の (0, 0) なので uniform block のものを使う)
+  vec4 ka = kamb, kd = kdiff, ks = kspec;
+  float sh = kshi;
+  if (pm.y != 0.0)
+  {
+    int m = int(pm.x) * 4;
+    ka = texelFetch(materials, m);
+    kd = texelFetch(materials, m + 1);
+    ks = texelFetch(materials, m + 2);
+    sh = texelFetch(materials, m + 3).x;
+  }
+
+#if defined(INSTANCED)
+  // インスタンスの色を環境光と拡散光の反射係数に掛ける
+  ka *= ci;
+  kd *= ci;
+#endif
 
   // 陰影計算
-  idiff = max(dot(n, l), 0.0) * kdiff * ldiff + kamb * lamb;
-  ispec = pow(max(dot(n, h), 0.0), kshi) * kspec * lspec;
+  idiff = max(dot(n, l), 0.0) * kd * ldiff + ka * lamb;
+  ispec = pow(max(dot(n, h), 0.0), sh) * ks * lspec;
 
   // クリッピング座標系の頂点位置
   gl_Position = mp * p;